@@ -12,6 +12,11 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
 #include "chrono/collision/ChConvexDecomposition.h"
 #include "chrono_thirdparty/HACDv2/wavefront.h"
 
@@ -21,20 +26,55 @@ namespace collision {
 
 //
 // Utility functions to process bad topology in meshes with repeated vertices
-//  (to be optimized for performance; in future it is better to use hash lookup)
 //
 
-int GetIndex(ChVector<double> vertex, std::vector<ChVector<double> >& vertexOUT, double tol) {
-    // Suboptimal: search vertexes with same position and reuse, (in future: adopt hash map..)
-    for (unsigned int iv = 0; iv < vertexOUT.size(); iv++) {
-        if (vertex.Equals(vertexOUT[iv], tol)) {
-            return iv;
+// Spatial hash of mesh vertices, using a uniform grid with cells of size equal to the fusing tolerance.
+// A vertex within tolerance of a given one is necessarily in one of the 27 neighboring cells.
+class VertexGrid {
+  public:
+    VertexGrid(double tol) : m_tol(tol) {}
+
+    // Return the index of the first stored vertex within tolerance of the given one (or -1 if none).
+    int Find(const ChVector<double>& vertex, const std::vector<ChVector<double> >& vertexOUT) const {
+        int64_t c[3];
+        GetCell(vertex, c);
+        int found = -1;
+        for (int64_t i = c[0] - 1; i <= c[0] + 1; i++) {
+            for (int64_t j = c[1] - 1; j <= c[1] + 1; j++) {
+                for (int64_t k = c[2] - 1; k <= c[2] + 1; k++) {
+                    auto it = m_cells.find(Key(i, j, k));
+                    if (it == m_cells.end())
+                        continue;
+                    for (int iv : it->second) {
+                        if ((found < 0 || iv < found) && vertex.Equals(vertexOUT[iv], m_tol))
+                            found = iv;
+                    }
+                }
+            }
         }
+        return found;
     }
-    // not found, so add it to new vertexes
-    vertexOUT.push_back(vertex);
-    return ((int)vertexOUT.size() - 1);
-}
+
+    // Register the vertex with specified index.
+    void Add(const ChVector<double>& vertex, int index) {
+        int64_t c[3];
+        GetCell(vertex, c);
+        m_cells[Key(c[0], c[1], c[2])].push_back(index);
+    }
+
+  private:
+    void GetCell(const ChVector<double>& vertex, int64_t* c) const {
+        for (int i = 0; i < 3; i++)
+            c[i] = (int64_t)std::floor(vertex[i] / m_tol);
+    }
+
+    static uint64_t Key(int64_t i, int64_t j, int64_t k) {
+        return ((uint64_t)i * 73856093ULL) ^ ((uint64_t)j * 19349663ULL) ^ ((uint64_t)k * 83492791ULL);
+    }
+
+    double m_tol;
+    std::unordered_map<uint64_t, std::vector<int> > m_cells;  // cells may share a key (all candidates are tested)
+};
 
 void FuseMesh(std::vector<ChVector<double> >& vertexIN,
               std::vector<ChVector<int> >& triangleIN,
@@ -43,14 +83,89 @@ void FuseMesh(std::vector<ChVector<double> >& vertexIN,
               double tol = 0.0) {
     vertexOUT.clear();
     triangleOUT.clear();
+    triangleOUT.reserve(triangleIN.size());
+
+    // With a non-positive tolerance no vertices are fused (ChVector::Equals is never true)
+    if (!(tol > 0)) {
+        vertexOUT.reserve(3 * triangleIN.size());
+        for (unsigned int it = 0; it < triangleIN.size(); it++) {
+            int i0 = (int)vertexOUT.size();
+            vertexOUT.push_back(vertexIN[triangleIN[it].x()]);
+            vertexOUT.push_back(vertexIN[triangleIN[it].y()]);
+            vertexOUT.push_back(vertexIN[triangleIN[it].z()]);
+            triangleOUT.push_back(ChVector<int>(i0, i0 + 1, i0 + 2));
+        }
+        return;
+    }
+
+    // Hash the fused vertices; among all vertices within tolerance, reuse the one with lowest index
+    VertexGrid grid(tol);
+    auto index = [&](const ChVector<double>& vertex) {
+        int iv = grid.Find(vertex, vertexOUT);
+        if (iv >= 0)
+            return iv;
+        iv = (int)vertexOUT.size();
+        vertexOUT.push_back(vertex);
+        grid.Add(vertex, iv);
+        return iv;
+    };
+
     for (unsigned int it = 0; it < triangleIN.size(); it++) {
-        unsigned int i1 = GetIndex(vertexIN[triangleIN[it].x()], vertexOUT, tol);
-        unsigned int i2 = GetIndex(vertexIN[triangleIN[it].y()], vertexOUT, tol);
-        unsigned int i3 = GetIndex(vertexIN[triangleIN[it].z()], vertexOUT, tol);
+        int i1 = index(vertexIN[triangleIN[it].x()]);
+        int i2 = index(vertexIN[triangleIN[it].y()]);
+        int i3 = index(vertexIN[triangleIN[it].z()]);
+        triangleOUT.push_back(ChVector<int>(i1, i2, i3));
+    }
+}
 
-        ChVector<int> merged_triangle(i1, i2, i3);
+// Split a mesh into its connected components (sets of triangles sharing vertices).
+// Components are ordered by their first triangle; vertex and triangle order is preserved within each component.
+void SplitMesh(const std::vector<ChVector<double> >& vertexIN,
+               const std::vector<ChVector<int> >& triangleIN,
+               std::vector<std::vector<ChVector<double> > >& vertexOUT,
+               std::vector<std::vector<ChVector<int> > >& triangleOUT) {
+    // Union-find over mesh vertices
+    std::vector<int> parent(vertexIN.size());
+    for (size_t i = 0; i < parent.size(); i++)
+        parent[i] = (int)i;
+    auto root = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (const auto& t : triangleIN) {
+        for (int k = 1; k < 3; k++) {
+            int r0 = root(t[0]);
+            int rk = root(t[k]);
+            if (r0 != rk)
+                parent[std::max(r0, rk)] = std::min(r0, rk);
+        }
+    }
 
-        triangleOUT.push_back(merged_triangle);
+    // Collect triangles and vertices of each component
+    std::vector<int> component(vertexIN.size(), -1);
+    std::vector<int> local(vertexIN.size(), -1);
+    vertexOUT.clear();
+    triangleOUT.clear();
+    for (const auto& t : triangleIN) {
+        int r = root(t[0]);
+        if (component[r] < 0) {
+            component[r] = (int)vertexOUT.size();
+            vertexOUT.push_back(std::vector<ChVector<double> >());
+            triangleOUT.push_back(std::vector<ChVector<int> >());
+        }
+        int c = component[r];
+        ChVector<int> tri;
+        for (int k = 0; k < 3; k++) {
+            if (local[t[k]] < 0) {
+                local[t[k]] = (int)vertexOUT[c].size();
+                vertexOUT[c].push_back(vertexIN[t[k]]);
+            }
+            tri[k] = local[t[k]];
+        }
+        triangleOUT[c].push_back(tri);
     }
 }
 
@@ -284,20 +399,16 @@ void ChConvexDecompositionHACD::WriteConvexHullsAsWavefrontObj(ChStreamOutAscii&
 /// Basic constructor
 ChConvexDecompositionHACDv2::ChConvexDecompositionHACDv2() {
     this->descriptor.init();
-
-    gHACD = HACD::createHACD_API();
-
     this->fuse_tol = 1e-9;
+    this->num_threads = 1;
 }
 
 /// Destructor
-ChConvexDecompositionHACDv2::~ChConvexDecompositionHACDv2() {
-    gHACD->release();  // will delete itself
-}
+ChConvexDecompositionHACDv2::~ChConvexDecompositionHACDv2() {}
 
 void ChConvexDecompositionHACDv2::Reset(void) {
     this->descriptor.init();
-    gHACD->releaseHACD();
+    this->hulls.reset();
 
     this->points.clear();
     this->triangles.clear();
@@ -339,19 +450,120 @@ void ChConvexDecompositionHACDv2::SetParameters(unsigned int mmMaxHullCount,
     this->fuse_tol = mmFuseTol;
 }
 
+void ChConvexDecompositionHACDv2::SetNumThreads(int mnum_threads) {
+    this->num_threads = std::max(mnum_threads, 1);
+}
+
 class MyCallback : public hacd::ICallback {
   public:
+    MyCallback(bool verbose) : m_verbose(verbose) {}
+
     virtual bool Cancelled() {
         // Don't have a cancel button in the test console app.
         return false;
     }
 
-    virtual void ReportProgress(const char* message, hacd::HaF32 progress) { std::cout << message; }
+    virtual void ReportProgress(const char* message, hacd::HaF32 progress) {
+        if (m_verbose)
+            std::cout << message;
+    }
+
+  private:
+    bool m_verbose;
 };
 
+// Decompose the given (fused) mesh with HACD and append the resulting hulls to the output list.
+// Progress messages are printed only if 'verbose' is true (they would interleave if parts are decomposed in parallel).
+static void PerformHACD(HACD::HACD_API::Desc desc,
+                        const std::vector<ChVector<double> >& points_FUSED,
+                        const std::vector<ChVector<int> >& triangles_FUSED,
+                        bool verbose,
+                        ChConvexDecompositionCache::HullList& hulls) {
+    // Convert to HACD format
+    std::vector<hacd::HaF32> vertices(3 * points_FUSED.size());
+    std::vector<hacd::HaU32> indices(3 * triangles_FUSED.size());
+    for (size_t mv = 0; mv < points_FUSED.size(); mv++) {
+        vertices[mv * 3 + 0] = (float)points_FUSED[mv].x();
+        vertices[mv * 3 + 1] = (float)points_FUSED[mv].y();
+        vertices[mv * 3 + 2] = (float)points_FUSED[mv].z();
+    }
+    for (size_t mt = 0; mt < triangles_FUSED.size(); mt++) {
+        indices[mt * 3 + 0] = triangles_FUSED[mt].x();
+        indices[mt * 3 + 1] = triangles_FUSED[mt].y();
+        indices[mt * 3 + 2] = triangles_FUSED[mt].z();
+    }
+    desc.mTriangleCount = (hacd::HaU32)triangles_FUSED.size();
+    desc.mVertexCount = (hacd::HaU32)points_FUSED.size();
+    desc.mIndices = indices.data();
+    desc.mVertices = vertices.data();
+
+    MyCallback callback(verbose);
+    desc.mCallback = static_cast<hacd::ICallback*>(&callback);
+
+    // Perform the decomposition!
+    HACD::HACD_API* gHACD = HACD::createHACD_API();
+    hacd::HaU32 hullCount = gHACD->performHACD(desc);
+
+    // Extract the resulting hulls
+    for (hacd::HaU32 i = 0; i < hullCount; i++) {
+        const HACD::HACD_API::Hull* hull = gHACD->getHull(i);
+        if (!hull)
+            continue;
+        ChConvexDecompositionCache::Hull result;
+        result.vertices.resize(hull->mVertexCount);
+        for (hacd::HaU32 j = 0; j < hull->mVertexCount; j++) {
+            const hacd::HaF32* p = &hull->mVertices[j * 3];
+            result.vertices[j] = ChVector<>(p[0], p[1], p[2]);
+        }
+        result.faces.resize(hull->mTriangleCount);
+        for (hacd::HaU32 j = 0; j < hull->mTriangleCount; j++) {
+            const hacd::HaU32* t = &hull->mIndices[j * 3];
+            result.faces[j] = ChVector<int>(t[0], t[1], t[2]);
+        }
+        hulls.push_back(std::move(result));
+    }
+
+    gHACD->release();  // will delete itself
+}
+
+std::vector<char> ChConvexDecompositionHACDv2::SerializeInput() const {
+    std::vector<char> data(points.size() * 3 * sizeof(double) + triangles.size() * 3 * sizeof(int) +
+                           3 * sizeof(hacd::HaU32) + 2 * sizeof(hacd::HaF32) + sizeof(double) + sizeof(int));
+    char* ptr = data.data();
+    auto write = [&ptr](const void* src, size_t size) {
+        std::memcpy(ptr, src, size);
+        ptr += size;
+    };
+    for (const auto& p : points)
+        write(p.data(), 3 * sizeof(double));
+    for (const auto& t : triangles)
+        write(t.data(), 3 * sizeof(int));
+    write(&descriptor.mMaxHullCount, sizeof(hacd::HaU32));
+    write(&descriptor.mMaxMergeHullCount, sizeof(hacd::HaU32));
+    write(&descriptor.mMaxHullVertices, sizeof(hacd::HaU32));
+    write(&descriptor.mConcavity, sizeof(hacd::HaF32));
+    write(&descriptor.mSmallClusterThreshold, sizeof(hacd::HaF32));
+    write(&fuse_tol, sizeof(double));
+    int split = (num_threads > 1) ? 1 : 0;  // results differ if disconnected parts are decomposed separately
+    write(&split, sizeof(int));
+    return data;
+}
+
+std::string ChConvexDecompositionHACDv2::GetCacheKey() const {
+    return ChConvexDecompositionCache::MakeKey("HACDv2", SerializeInput());
+}
+
 int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
-    if (!gHACD)
-        return 0;
+    // Check if the same decomposition is available in the cache
+    std::string key;
+    if (ChConvexDecompositionCache::IsActive()) {
+        key = GetCacheKey();
+        auto cached = ChConvexDecompositionCache::Find(key);
+        if (cached) {
+            this->hulls = cached;
+            return (int)this->hulls->size();
+        }
+    }
 
     // Preprocess: fuse repeated vertices...
 
@@ -359,77 +571,60 @@ int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
     std::vector<ChVector<int> > triangles_FUSED;
     FuseMesh(this->points, this->triangles, points_FUSED, triangles_FUSED, this->fuse_tol);
 
-    // Convert to HACD format
-
-    this->descriptor.mTriangleCount = (hacd::HaU32)triangles_FUSED.size();
-    this->descriptor.mVertexCount = (hacd::HaU32)points_FUSED.size();
-    this->descriptor.mIndices = new hacd::HaU32[3 * this->descriptor.mTriangleCount];
-    this->descriptor.mVertices = new hacd::HaF32[3 * this->descriptor.mVertexCount];
-    for (unsigned int mv = 0; mv < points_FUSED.size(); mv++) {
-        ((hacd::HaF32*)descriptor.mVertices)[mv * 3 + 0] = (float)points_FUSED[mv].x();
-        ((hacd::HaF32*)descriptor.mVertices)[mv * 3 + 1] = (float)points_FUSED[mv].y();
-        ((hacd::HaF32*)descriptor.mVertices)[mv * 3 + 2] = (float)points_FUSED[mv].z();
-    }
-    for (unsigned int mt = 0; mt < triangles_FUSED.size(); mt++) {
-        ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 0] = triangles_FUSED[mt].x();
-        ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 1] = triangles_FUSED[mt].y();
-        ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 2] = triangles_FUSED[mt].z();
-    }
+    auto result = chrono_types::make_shared<ChConvexDecompositionCache::HullList>();
 
-    MyCallback callback;
-    descriptor.mCallback = static_cast<hacd::ICallback*>(&callback);
+    if (this->num_threads > 1) {
+        // Decompose the disconnected parts of the mesh in parallel
+        std::vector<std::vector<ChVector<double> > > points_PART;
+        std::vector<std::vector<ChVector<int> > > triangles_PART;
+        SplitMesh(points_FUSED, triangles_FUSED, points_PART, triangles_PART);
 
-    // Perform the decomposition!
+        int num_parts = (int)points_PART.size();
+        std::vector<ChConvexDecompositionCache::HullList> hulls_PART(num_parts);
+#pragma omp parallel for schedule(dynamic) num_threads(this->num_threads) if (num_parts > 1)
+        for (int i = 0; i < num_parts; i++) {
+            PerformHACD(this->descriptor, points_PART[i], triangles_PART[i], num_parts == 1, hulls_PART[i]);
+        }
 
-    hacd::HaU32 hullCount = gHACD->performHACD(this->descriptor);
+        for (auto& part : hulls_PART) {
+            for (auto& hull : part)
+                result->push_back(std::move(hull));
+        }
+    } else {
+        PerformHACD(this->descriptor, points_FUSED, triangles_FUSED, true, *result);
+    }
 
-    delete[] this->descriptor.mIndices;
-    delete[] this->descriptor.mVertices;
-    this->descriptor.mTriangleCount = 0;
-    this->descriptor.mVertexCount = 0;
+    this->hulls = result;
+    if (!key.empty())
+        this->hulls = ChConvexDecompositionCache::Insert(key, result);
 
-    return hullCount;
+    return (int)this->hulls->size();
 }
 
 /// Get the number of computed hulls after the convex decomposition
 unsigned int ChConvexDecompositionHACDv2::GetHullCount() {
-    return this->gHACD->getHullCount();
+    return this->hulls ? (unsigned int)this->hulls->size() : 0;
 }
 
 bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex,
                                                       std::vector<ChVector<double> >& convexhull) {
-    if (hullIndex > this->gHACD->getHullCount())
+    if (hullIndex >= GetHullCount())
         return false;
 
-    const HACD::HACD_API::Hull* hull = gHACD->getHull(hullIndex);
-    if (hull) {
-        for (hacd::HaU32 i = 0; i < hull->mVertexCount; i++) {
-            const hacd::HaF32* p = &hull->mVertices[i * 3];
-            ChVector<double> point(p[0], p[1], p[2]);
-            convexhull.push_back(point);
-        }
-        return true;
-    }
-    return false;
+    const auto& hull = (*this->hulls)[hullIndex];
+    convexhull.insert(convexhull.end(), hull.vertices.begin(), hull.vertices.end());
+    return true;
 }
 
 /// Get the n-th computed convex hull, by filling a ChTriangleMesh object
 /// that is passed as a parameter.
 bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, geometry::ChTriangleMesh& convextrimesh) {
-    if (hullIndex > this->gHACD->getHullCount())
+    if (hullIndex >= GetHullCount())
         return false;
 
-    const HACD::HACD_API::Hull* hull = gHACD->getHull(hullIndex);
-    if (hull) {
-        for (unsigned int i = 0; i < hull->mTriangleCount; i++) {
-            unsigned int i1 = 3 * hull->mIndices[i * 3 + 0];
-            unsigned int i2 = 3 * hull->mIndices[i * 3 + 1];
-            unsigned int i3 = 3 * hull->mIndices[i * 3 + 2];
-            convextrimesh.addTriangle(
-                ChVector<>(hull->mVertices[i1 + 0], hull->mVertices[i1 + 1], hull->mVertices[i1 + 2]),
-                ChVector<>(hull->mVertices[i2 + 0], hull->mVertices[i2 + 1], hull->mVertices[i2 + 2]),
-                ChVector<>(hull->mVertices[i3 + 0], hull->mVertices[i3 + 1], hull->mVertices[i3 + 2]));
-        }
+    const auto& hull = (*this->hulls)[hullIndex];
+    for (const auto& t : hull.faces) {
+        convextrimesh.addTriangle(hull.vertices[t.x()], hull.vertices[t.y()], hull.vertices[t.z()]);
     }
     return true;
 }
@@ -443,34 +638,22 @@ void ChConvexDecompositionHACDv2::WriteConvexHullsAsWavefrontObj(ChStreamOutAsci
 
     char buffer[200];
 
-    hacd::HaU32* baseVertex = new hacd::HaU32[GetHullCount()];
-    hacd::HaU32 vertexCount = 0;
-    for (hacd::HaU32 i = 0; i < GetHullCount(); i++) {
-        const HACD::HACD_API::Hull* hull = gHACD->getHull(i);
-        if (hull) {
-            baseVertex[i] = vertexCount;
-            for (hacd::HaU32 j = 0; j < hull->mVertexCount; j++) {
-                const hacd::HaF32* p = &hull->mVertices[j * 3];
-                sprintf(buffer, "v %0.9f %0.9f %0.9f\r\n", p[0], p[1], p[2]);
-                mstream << buffer;
-            }
-            vertexCount += hull->mVertexCount;
+    for (unsigned int i = 0; i < GetHullCount(); i++) {
+        for (const auto& p : (*this->hulls)[i].vertices) {
+            sprintf(buffer, "v %0.9f %0.9f %0.9f\r\n", p.x(), p.y(), p.z());
+            mstream << buffer;
         }
     }
-    for (hacd::HaU32 i = 0; i < GetHullCount(); i++) {
-        const HACD::HACD_API::Hull* hull = gHACD->getHull(i);
-        if (hull) {
-            hacd::HaU32 startVertex = baseVertex[i];
-            for (hacd::HaU32 j = 0; j < hull->mTriangleCount; j++) {
-                hacd::HaU32 i1 = hull->mIndices[j * 3 + 0] + startVertex + 1;
-                hacd::HaU32 i2 = hull->mIndices[j * 3 + 1] + startVertex + 1;
-                hacd::HaU32 i3 = hull->mIndices[j * 3 + 2] + startVertex + 1;
-                sprintf(buffer, "f %d %d %d\r\n", i1, i2, i3);
-                mstream << buffer;
-            }
+    unsigned int startVertex = 0;
+    for (unsigned int i = 0; i < GetHullCount(); i++) {
+        const auto& hull = (*this->hulls)[i];
+        for (const auto& t : hull.faces) {
+            sprintf(buffer, "f %d %d %d\r\n", t.x() + startVertex + 1, t.y() + startVertex + 1,
+                    t.z() + startVertex + 1);
+            mstream << buffer;
         }
+        startVertex += (unsigned int)hull.vertices.size();
     }
-    delete[] baseVertex;
 }
 
 }  // end namespace collision
@@ -15,7 +15,10 @@
 #ifndef CH_CONVEX_DECOMPOSITION_H
 #define CH_CONVEX_DECOMPOSITION_H
 
+#include <memory>
+
 #include "chrono/core/ChApiCE.h"
+#include "chrono/collision/ChConvexDecompositionCache.h"
 #include "chrono/geometry/ChTriangleMeshSoup.h"
 
 #include "chrono_thirdparty/HACD/hacdHACD.h"
@@ -177,13 +180,23 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
                        float mSmallClusterThreshold = 0.0f,
                        float mFuseTolerance = 1e-9);
 
+    /// Set the number of threads used for the decomposition (default: 1).
+    /// If larger than 1, the disconnected parts of the input mesh (if any) are decomposed independently and in
+    /// parallel; in that case, the hull count limits specified in SetParameters apply to each part separately.
+    void SetNumThreads(int num_threads);
+
     /// Perform the convex decomposition.
     /// This operation is time consuming, and it may take a while to complete.
     /// Quality of the results can depend a lot on the parameters. Also, meshes
     /// with triangles that are not well oriented (normals always pointing outside)
     /// or with gaps/holes, may give wrong results.
+    /// If the convex decomposition cache is active (see ChConvexDecompositionCache), the result of a previous
+    /// decomposition of the same mesh with the same parameters is reused.
     virtual int ComputeConvexDecomposition();
 
+    /// Return the key identifying the current input mesh and parameters in the convex decomposition cache.
+    std::string GetCacheKey() const;
+
     /// Get the number of computed hulls after the convex decomposition
     virtual unsigned int GetHullCount();
 
@@ -201,11 +214,15 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
     virtual void WriteConvexHullsAsWavefrontObj(ChStreamOutAscii& mstream);
 
   private:
+    /// Serialize the input mesh and the decomposition parameters (used to generate the cache key).
+    std::vector<char> SerializeInput() const;
+
     HACD::HACD_API::Desc descriptor;
-    HACD::HACD_API* gHACD;
     std::vector<ChVector<double> > points;
     std::vector<ChVector<int> > triangles;
     double fuse_tol;
+    int num_threads;
+    std::shared_ptr<const ChConvexDecompositionCache::HullList> hulls;  ///< results of the last decomposition
 };
 
 /// @} chrono_collision
@@ -0,0 +1,244 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "chrono/collision/ChConvexDecompositionCache.h"
+#include "chrono/utils/ChUtilsHash.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+namespace chrono {
+namespace collision {
+
+// -----------------------------------------------------------------------------
+
+// Cache storage (shared by all threads)
+struct DecompositionCacheStorage {
+    std::atomic<bool> enabled{false};
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> disk_hits{0};
+    std::mutex mutex;
+    std::string dir;
+    std::unordered_map<std::string, std::shared_ptr<const ChConvexDecompositionCache::HullList>> entries;
+};
+
+static DecompositionCacheStorage& storage() {
+    static DecompositionCacheStorage cache;
+    return cache;
+}
+
+// Header of files in the on-disk cache.
+static const char disk_magic[4] = {'C', 'H', 'C', 'D'};
+static const uint32_t disk_version = 1;
+
+// Read a list of hulls from a file in the on-disk cache.
+static bool ReadDisk(const std::string& filename, ChConvexDecompositionCache::HullList& hulls) {
+    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+    if (!ifs.good())
+        return false;
+    uint64_t size = (uint64_t)ifs.tellg();
+    ifs.seekg(0);
+
+    char magic[4];
+    uint32_t version;
+    uint64_t nh;
+    ifs.read(magic, sizeof(magic));
+    ifs.read((char*)&version, sizeof(version));
+    ifs.read((char*)&nh, sizeof(nh));
+    if (!ifs.good() || std::memcmp(magic, disk_magic, sizeof(magic)) != 0 || version != disk_version)
+        return false;
+
+    // Check all array sizes against the file size before allocating (protects against truncated files)
+    if (nh > size / (2 * sizeof(uint64_t)))
+        return false;
+    hulls.resize(nh);
+    for (auto& hull : hulls) {
+        uint64_t nv, nf;
+        ifs.read((char*)&nv, sizeof(nv));
+        if (!ifs.good() || nv > size / (3 * sizeof(double)))
+            return false;
+        std::vector<double> v(3 * nv);
+        ifs.read((char*)v.data(), v.size() * sizeof(double));
+        ifs.read((char*)&nf, sizeof(nf));
+        if (!ifs.good() || nf > size / (3 * sizeof(int32_t)))
+            return false;
+        std::vector<int32_t> f(3 * nf);
+        ifs.read((char*)f.data(), f.size() * sizeof(int32_t));
+        if (!ifs.good())
+            return false;
+
+        hull.vertices.resize(nv);
+        for (size_t i = 0; i < nv; i++)
+            hull.vertices[i] = ChVector<>(v[3 * i + 0], v[3 * i + 1], v[3 * i + 2]);
+        hull.faces.resize(nf);
+        for (size_t i = 0; i < nf; i++) {
+            for (int k = 0; k < 3; k++) {
+                if (f[3 * i + k] < 0 || f[3 * i + k] >= (int32_t)nv)
+                    return false;
+            }
+            hull.faces[i] = ChVector<int>(f[3 * i + 0], f[3 * i + 1], f[3 * i + 2]);
+        }
+    }
+
+    return true;
+}
+
+// Write a list of hulls to a file in the on-disk cache.
+// The data is first written to a temporary file which is then renamed, so that other threads or processes never see
+// a partially written file.
+static void WriteDisk(const std::string& filename, const ChConvexDecompositionCache::HullList& hulls) {
+    auto thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
+    auto tmp_filename = filename + "." + std::to_string(thread_id) + ".tmp";
+    {
+        std::ofstream ofs(tmp_filename, std::ios::binary | std::ios::trunc);
+        if (!ofs.good())
+            return;
+        uint64_t nh = hulls.size();
+        ofs.write(disk_magic, sizeof(disk_magic));
+        ofs.write((const char*)&disk_version, sizeof(disk_version));
+        ofs.write((const char*)&nh, sizeof(nh));
+        for (const auto& hull : hulls) {
+            uint64_t nv = hull.vertices.size();
+            uint64_t nf = hull.faces.size();
+            ofs.write((const char*)&nv, sizeof(nv));
+            for (const auto& v : hull.vertices)
+                ofs.write((const char*)v.data(), 3 * sizeof(double));
+            ofs.write((const char*)&nf, sizeof(nf));
+            for (const auto& f : hull.faces) {
+                int32_t idx[3] = {f.x(), f.y(), f.z()};
+                ofs.write((const char*)idx, sizeof(idx));
+            }
+        }
+        if (!ofs.good()) {
+            ofs.close();
+            std::remove(tmp_filename.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+        std::remove(tmp_filename.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+void ChConvexDecompositionCache::Enable(bool val) {
+    storage().enabled = val;
+    if (!val)
+        Clear();
+}
+
+bool ChConvexDecompositionCache::IsEnabled() {
+    return storage().enabled;
+}
+
+void ChConvexDecompositionCache::SetCacheDirectory(const std::string& dir) {
+    if (!dir.empty())
+        filesystem::create_subdirectory(filesystem::path(dir));
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    storage().dir = dir;
+}
+
+std::string ChConvexDecompositionCache::GetCacheDirectory() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    return storage().dir;
+}
+
+std::string ChConvexDecompositionCache::GetDiskFilename(const std::string& key) {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    if (storage().dir.empty())
+        return "";
+    return storage().dir + "/" + key + ".bin";
+}
+
+bool ChConvexDecompositionCache::IsActive() {
+    return IsEnabled() || !GetCacheDirectory().empty();
+}
+
+void ChConvexDecompositionCache::Clear() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    storage().entries.clear();
+    storage().hits = 0;
+    storage().disk_hits = 0;
+}
+
+size_t ChConvexDecompositionCache::GetNumEntries() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    return storage().entries.size();
+}
+
+size_t ChConvexDecompositionCache::GetNumHits() {
+    return storage().hits;
+}
+
+size_t ChConvexDecompositionCache::GetNumDiskHits() {
+    return storage().disk_hits;
+}
+
+std::string ChConvexDecompositionCache::MakeKey(const std::string& type, const std::vector<char>& data) {
+    return utils::MakeContentKey(type, data.data(), data.size());
+}
+
+std::shared_ptr<const ChConvexDecompositionCache::HullList> ChConvexDecompositionCache::Find(const std::string& key) {
+    if (IsEnabled()) {
+        std::lock_guard<std::mutex> lock(storage().mutex);
+        auto it = storage().entries.find(key);
+        if (it != storage().entries.end()) {
+            storage().hits++;
+            return it->second;
+        }
+    }
+
+    auto disk_filename = GetDiskFilename(key);
+    if (disk_filename.empty())
+        return nullptr;
+
+    auto hulls = chrono_types::make_shared<HullList>();
+    if (!ReadDisk(disk_filename, *hulls))
+        return nullptr;
+    storage().disk_hits++;
+
+    if (!IsEnabled())
+        return hulls;
+
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    auto res = storage().entries.insert({key, hulls});
+    return res.first->second;
+}
+
+std::shared_ptr<const ChConvexDecompositionCache::HullList> ChConvexDecompositionCache::Insert(
+    const std::string& key,
+    std::shared_ptr<const HullList> hulls) {
+    auto disk_filename = GetDiskFilename(key);
+    if (!disk_filename.empty())
+        WriteDisk(disk_filename, *hulls);
+
+    if (!IsEnabled())
+        return hulls;
+
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    auto res = storage().entries.insert({key, hulls});
+    return res.first->second;
+}
+
+}  // end namespace collision
+}  // end namespace chrono
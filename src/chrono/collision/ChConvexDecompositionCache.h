@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONVEX_DECOMPOSITION_CACHE_H
+#define CH_CONVEX_DECOMPOSITION_CACHE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector.h"
+
+namespace chrono {
+namespace collision {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Process-wide cache of convex decomposition results.\n
+/// Entries are identified by a hash of the input mesh and of the decomposition parameters, so that repeated
+/// decompositions of the same mesh with the same settings (e.g., when the same model is constructed multiple times, in
+/// the same or in subsequent runs) return the previously computed hulls. Two cache levels are available, both disabled
+/// by default:
+/// - an in-memory cache (see Enable), which shares results within the same process;
+/// - an on-disk cache (see SetCacheDirectory), which stores results in a binary file per entry.
+///
+/// ChConvexDecompositionHACDv2 uses this cache (if enabled) in ComputeConvexDecomposition. All functions of this
+/// class are thread safe.
+class ChApi ChConvexDecompositionCache {
+  public:
+    /// Convex hull, as a list of vertices and a list of triangular faces (indices into the vertex list).
+    struct Hull {
+        std::vector<ChVector<>> vertices;
+        std::vector<ChVector<int>> faces;
+    };
+
+    /// List of convex hulls resulting from a convex decomposition.
+    typedef std::vector<Hull> HullList;
+
+    ChConvexDecompositionCache(ChConvexDecompositionCache const&) = delete;
+    void operator=(ChConvexDecompositionCache const&) = delete;
+
+    /// Enable/disable the in-memory cache (default: false).
+    /// Disabling the cache also clears all cached entries.
+    static void Enable(bool val);
+
+    /// Return true if the in-memory cache is enabled.
+    static bool IsEnabled();
+
+    /// Set the directory for the on-disk cache (default: none).
+    /// The directory is created if it does not exist. An empty string disables the on-disk cache.
+    static void SetCacheDirectory(const std::string& dir);
+
+    /// Return the directory of the on-disk cache (empty if disabled).
+    static std::string GetCacheDirectory();
+
+    /// Return the name of the on-disk cache file for the given key (empty if the on-disk cache is disabled).
+    static std::string GetDiskFilename(const std::string& key);
+
+    /// Return true if either the in-memory or the on-disk cache is enabled.
+    static bool IsActive();
+
+    /// Remove all entries from the in-memory cache and reset the hit counters.
+    /// Files in the on-disk cache are not affected.
+    static void Clear();
+
+    /// Return the number of entries in the in-memory cache.
+    static size_t GetNumEntries();
+
+    /// Return the number of in-memory cache hits since the cache was last cleared.
+    static size_t GetNumHits();
+
+    /// Return the number of on-disk cache hits since the cache was last cleared.
+    static size_t GetNumDiskHits();
+
+    /// Calculate a cache key from the given decomposition type and binary data (input mesh and parameters).
+    static std::string MakeKey(const std::string& type, const std::vector<char>& data);
+
+    /// Return the decomposition result with given key, first looking in memory, then on disk.
+    /// An empty pointer is returned if no such entry exists (or if the cache is not active).
+    static std::shared_ptr<const HullList> Find(const std::string& key);
+
+    /// Insert the given decomposition result in the cache and return the cached entry.
+    /// If another entry with the same key was inserted in the meantime (by a different thread), that one is returned.
+    static std::shared_ptr<const HullList> Insert(const std::string& key, std::shared_ptr<const HullList> hulls);
+
+  private:
+    ChConvexDecompositionCache() {}
+};
+
+/// @} chrono_collision
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
@@ -34,9 +34,17 @@ namespace chrono {
 
 static ChLog* GlobalLog = NULL;
 
+//
+// The pointer to the logger of the current thread (overrides the global logger, if set)
+//
+
+static thread_local ChLog* ThreadLog = nullptr;
+
 // Functions to set/get the global logger
 
 ChLog& GetLog() {
+    if (ThreadLog != nullptr)
+        return (*ThreadLog);
     if (GlobalLog != NULL)
         return (*GlobalLog);
     else {
@@ -53,6 +61,10 @@ void SetLogDefault() {
     GlobalLog = NULL;
 }
 
+void SetThreadLog(ChLog* new_logobject) {
+    ThreadLog = new_logobject;
+}
+
 //
 // Logger class
 //
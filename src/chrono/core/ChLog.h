@@ -114,6 +114,12 @@ ChApi void SetLog(ChLog& new_logobject);
 /// Global function to set the default ChLogConsole output to std::output.
 ChApi void SetLogDefault();
 
+/// Set a ChLog object to be used only by the calling thread (pass nullptr to revert to the global logging system).
+/// While set, GetLog() called from this thread returns the specified object, so that concurrent simulations running
+/// on different threads do not share (and race on) the log state. The caller must ensure that the log object
+/// outlives its use by the thread.
+ChApi void SetThreadLog(ChLog* new_logobject);
+
 }  // end namespace chrono
 
 #endif
@@ -338,6 +338,17 @@ void ChElementHexaCorot_8::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfacto
     //***TO DO*** better per-node lumping, or 12x12 consistent mass matrix.
 }
 
+void ChElementHexaCorot_8::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
+    // Same lumped mass as in ComputeKRMmatricesGlobal
+    double lumped_node_mass = (this->Volume * this->Material->Get_density()) / 8.0;
+    for (int in = 0; in < 8; in++) {
+        if (!nodes[in]->IsFixed()) {
+            unsigned int off = nodes[in]->NodeGetOffsetW();
+            R.segment(off, 3) += (c * lumped_node_mass) * w.segment(off, 3);
+        }
+    }
+}
+
 void ChElementHexaCorot_8::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     assert(Fi.size() == GetNdofs());
 
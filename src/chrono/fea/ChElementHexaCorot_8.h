@@ -128,6 +128,10 @@ class ChApi ChElementHexaCorot_8 : public ChElementHexahedron,
     /// values in the Fi vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
 
+    /// Adds the product of the lumped element mass matrix with w, i.e. R += c*M*w.
+    /// This avoids forming the full element matrix, as done by the generic implementation.
+    virtual void EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) override;
+
     //
     // Custom properties functions
     //
@@ -246,6 +246,17 @@ void ChElementTetraCorot_4::ComputeKRMmatricesGlobal(ChMatrixRef H, double Kfact
     //***TO DO*** better per-node lumping, or 12x12 consistent mass matrix.
 }
 
+void ChElementTetraCorot_4::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
+    // Same lumped mass as in ComputeKRMmatricesGlobal
+    double lumped_node_mass = (this->GetVolume() * this->Material->Get_density()) / 4.0;
+    for (int in = 0; in < 4; in++) {
+        if (!nodes[in]->IsFixed()) {
+            unsigned int off = nodes[in]->NodeGetOffsetW();
+            R.segment(off, 3) += (c * lumped_node_mass) * w.segment(off, 3);
+        }
+    }
+}
+
 void ChElementTetraCorot_4::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     assert(Fi.size() == 12);
 
@@ -26,56 +26,29 @@ using namespace geometry;
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChProximityContainerMeshless)
 
-ChProximityContainerMeshless::ChProximityContainerMeshless() : n_added(0) {
-    lastproximity = proximitylist.begin();
-}
+ChProximityContainerMeshless::ChProximityContainerMeshless() : n_added(0) {}
 
 ChProximityContainerMeshless::ChProximityContainerMeshless(const ChProximityContainerMeshless& other)
     : ChProximityContainer(other) {
     n_added = other.n_added;
     proximitylist = other.proximitylist;
-    lastproximity = proximitylist.begin();
 }
 
-ChProximityContainerMeshless::~ChProximityContainerMeshless() {
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        delete (*iterproximity);
-        (*iterproximity) = 0;
-        ++iterproximity;
-        // proximitylist.erase(iterproximity); //no! do later with clear(), all together
-    }
-    proximitylist.clear();
-
-    lastproximity = proximitylist.begin();
-    n_added = 0;
-}
+ChProximityContainerMeshless::~ChProximityContainerMeshless() {}
 
 void ChProximityContainerMeshless::RemoveAllProximities() {
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        delete (*iterproximity);
-        (*iterproximity) = 0;
-        ++iterproximity;
-        // proximitylist.erase(iterproximity); //no! do later with clear(), all together
-    }
     proximitylist.clear();
-
-    lastproximity = proximitylist.begin();
     n_added = 0;
 }
 
 void ChProximityContainerMeshless::BeginAddProximities() {
-    lastproximity = proximitylist.begin();
     n_added = 0;
 }
 
 void ChProximityContainerMeshless::EndAddProximities() {
-    // remove proximities that are beyond last proximity
-    while (lastproximity != proximitylist.end()) {
-        delete (*lastproximity);
-        lastproximity = proximitylist.erase(lastproximity);
-    }
+    // release memory if the array of pairs shrinks considerably
+    if (proximitylist.size() > 2 * (size_t)n_added + 1024)
+        proximitylist.erase(proximitylist.begin() + n_added, proximitylist.end());
 }
 
 void ChProximityContainerMeshless::AddProximity(collision::ChCollisionModel* modA, collision::ChCollisionModel* modB) {
@@ -93,30 +66,20 @@ void ChProximityContainerMeshless::AddProximity(collision::ChCollisionModel* mod
         this->add_proximity_callback->OnAddProximity(*modA, *modB);
     }
 
-    // %%%%%%% Create and add a ChProximityMeshless object
-
-    if (lastproximity != proximitylist.end()) {
-        // reuse old proximity pairs
-        (*lastproximity)->Reset(modA, modB);
-
-        lastproximity++;
-    } else {
-        // add new proximity
-        ChProximityMeshless* mp = new ChProximityMeshless(modA, modB);
+    // Reuse old proximity pairs or add new proximity
 
-        proximitylist.push_back(mp);
-        lastproximity = proximitylist.end();
-    }
+    if ((size_t)n_added < proximitylist.size())
+        proximitylist[n_added].Reset(modA, modB);
+    else
+        proximitylist.emplace_back(modA, modB);
     n_added++;
 }
 
 void ChProximityContainerMeshless::ReportAllProximities(ReportProximityCallback* mcallback) {
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        bool proceed = mcallback->OnReportProximity((*iterproximity)->GetModelA(), (*iterproximity)->GetModelB());
+    for (int ip = 0; ip < n_added; ++ip) {
+        bool proceed = mcallback->OnReportProximity(proximitylist[ip].GetModelA(), proximitylist[ip].GetModelB());
         if (!proceed)
             break;
-        ++iterproximity;
     }
 }
 
@@ -138,10 +101,9 @@ static double W_sq_visco(double r, double h) {
 
 void ChProximityContainerMeshless::AccumulateStep1() {
     // Per-edge data computation
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeMeshless* mnodeA = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeMeshless* mnodeB = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelB()->GetContactable());
+    for (int ip = 0; ip < n_added; ++ip) {
+        ChNodeMeshless* mnodeA = static_cast<ChNodeMeshless*>(proximitylist[ip].GetModelA()->GetContactable());
+        ChNodeMeshless* mnodeB = static_cast<ChNodeMeshless*>(proximitylist[ip].GetModelB()->GetContactable());
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -182,17 +144,14 @@ void ChProximityContainerMeshless::AccumulateStep1() {
         mnodeB->J.col(0) -= g_BA.x() * m_inc_AB.eigen();
         mnodeB->J.col(1) -= g_BA.y() * m_inc_AB.eigen();
         mnodeB->J.col(2) -= g_BA.z() * m_inc_AB.eigen();
-
-        ++iterproximity;
     }
 }
 
 void ChProximityContainerMeshless::AccumulateStep2() {
     // Per-edge data computation (transfer stress to forces)
-    std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeMeshless* mnodeA = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeMeshless* mnodeB = dynamic_cast<ChNodeMeshless*>((*iterproximity)->GetModelB()->GetContactable());
+    for (int ip = 0; ip < n_added; ++ip) {
+        ChNodeMeshless* mnodeA = static_cast<ChNodeMeshless*>(proximitylist[ip].GetModelA()->GetContactable());
+        ChNodeMeshless* mnodeB = static_cast<ChNodeMeshless*>(proximitylist[ip].GetModelB()->GetContactable());
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -226,8 +185,6 @@ void ChProximityContainerMeshless::AccumulateStep2() {
         ChVector<> viscforceBA = velBA * (mnodeA->volume * avg_viscosity * mnodeB->volume * W_BA_visc);
         mnodeA->UserForce += viscforceBA;
         mnodeB->UserForce -= viscforceBA;
-
-        ++iterproximity;
     }
 }
 
@@ -15,7 +15,7 @@
 #ifndef CHPROXIMITYCONTAINERMESHLESS_H
 #define CHPROXIMITYCONTAINERMESHLESS_H
 
-#include <list>
+#include <vector>
 
 #include "chrono/physics/ChProximityContainer.h"
 
@@ -60,15 +60,14 @@ class ChApi ChProximityMeshless {
 
 /// Class for container of many proximity pairs for a meshless
 /// deformable continuum (necessary for inter-particle material forces),
-/// as CPU typical linked list of ChProximityMeshless objects.
+/// stored in a contiguous array of ChProximityMeshless objects.
 /// Such an item must be addd to the physical system if you added
 /// an object of class ChMatterMeshless.
 
 class ChApi ChProximityContainerMeshless : public ChProximityContainer {
 
   protected:
-    std::list<ChProximityMeshless*> proximitylist;
-    std::list<ChProximityMeshless*>::iterator lastproximity;
+    std::vector<ChProximityMeshless> proximitylist;  ///< proximity pairs, only the first n_added are valid
     int n_added;
 
   public:
@@ -87,9 +86,8 @@ class ChApi ChProximityContainerMeshless : public ChProximityContainer {
 
     /// The collision system will call BeginAddProximities() before adding
     /// all pairs (for example with AddProximity() or similar). Instead of
-    /// simply deleting all list of the previous pairs, this optimized implementation
-    /// rewinds the link iterator to begin and tries to reuse previous pairs objects
-    /// until possible, to avoid too much allocation/deallocation.
+    /// simply deleting all previous pairs, this optimized implementation
+    /// rewinds to the beginning of the pair array and reuses its storage.
     virtual void BeginAddProximities() override;
 
     /// Add a proximity SPH data between two collision models, if possible.
@@ -97,9 +95,8 @@ class ChApi ChProximityContainerMeshless : public ChProximityContainer {
                               collision::ChCollisionModel* modB   ///< get contact model 2
                               ) override;
 
-    /// The collision system will call BeginAddContact() after adding
-    /// all contacts (for example with AddContact() or similar). This optimized version
-    /// purges the end of the list of contacts that were not reused (if any).
+    /// The collision system will call EndAddProximities() after adding
+    /// all pairs (for example with AddProximity() or similar).
     virtual void EndAddProximities() override;
 
     /// Scans all the proximity pairs and, for each pair, executes the OnReportProximity()
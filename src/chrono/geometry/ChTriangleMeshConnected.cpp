@@ -20,9 +20,27 @@
 ///      This could be implemented such that the two new faces point to the same material.
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <map>
+#include <tuple>
+
+#if defined(_WIN32)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
@@ -376,6 +394,264 @@ bool ChTriangleMeshConnected::LoadSTLMesh(const std::string& filename, bool load
     return true;
 }
 
+// -----------------------------------------------------------------------------
+// Chrono binary mesh format
+//
+// Header:  magic (4 bytes), version (uint32), and 9 array sizes (uint64):
+//          vertices, normals, UV, colors, face vertex indices, face normal indices, face UV indices,
+//          face color indices, face material indices
+// Data:    the 9 arrays, in the above order, each stored as a contiguous block (doubles for vertex coordinates,
+//          normals, and UV; floats for colors; int32 for indices) and padded to a multiple of 8 bytes.
+// -----------------------------------------------------------------------------
+
+static_assert(sizeof(ChVector<double>) == 3 * sizeof(double), "unexpected ChVector layout");
+static_assert(sizeof(ChVector2<double>) == 2 * sizeof(double), "unexpected ChVector2 layout");
+static_assert(sizeof(ChVector<int>) == 3 * sizeof(int32_t), "unexpected ChVector<int> layout");
+static_assert(sizeof(ChColor) == 3 * sizeof(float), "unexpected ChColor layout");
+
+static const char binary_mesh_magic[4] = {'C', 'H', 'M', 'B'};
+static const uint32_t binary_mesh_version = 1;
+static const int binary_mesh_num_arrays = 9;
+
+// Read-only memory mapping of an entire file.
+class MappedFile {
+  public:
+    MappedFile(const std::string& filename) : m_data(nullptr), m_size(0) {
+#if defined(_WIN32)
+        m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        m_mapping = NULL;
+        if (m_file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+            return;
+        m_mapping = CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m_mapping == NULL)
+            return;
+        m_data = (const char*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (m_data)
+            m_size = (size_t)size.QuadPart;
+#else
+        m_fd = open(filename.c_str(), O_RDONLY);
+        if (m_fd < 0)
+            return;
+        struct stat st;
+        if (fstat(m_fd, &st) != 0 || st.st_size == 0)
+            return;
+        void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        if (data == MAP_FAILED)
+            return;
+        m_data = (const char*)data;
+        m_size = (size_t)st.st_size;
+    #ifdef MADV_SEQUENTIAL
+        madvise(data, m_size, MADV_SEQUENTIAL);
+    #endif
+#endif
+    }
+
+    ~MappedFile() {
+#if defined(_WIN32)
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping != NULL)
+            CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(m_file);
+#else
+        if (m_data)
+            munmap((void*)m_data, m_size);
+        if (m_fd >= 0)
+            close(m_fd);
+#endif
+    }
+
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+#if defined(_WIN32)
+    HANDLE m_file;
+    HANDLE m_mapping;
+#else
+    int m_fd;
+#endif
+};
+
+static size_t PaddedSize(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// Size (in bytes) of one element of each array in the binary mesh format.
+static const size_t binary_mesh_element_size[binary_mesh_num_arrays] = {
+    sizeof(ChVector<double>), sizeof(ChVector<double>), sizeof(ChVector2<double>),
+    sizeof(ChColor),          sizeof(ChVector<int>),    sizeof(ChVector<int>),
+    sizeof(ChVector<int>),    sizeof(ChVector<int>),    sizeof(int32_t)};
+
+static const size_t binary_mesh_header_size = PaddedSize(sizeof(binary_mesh_magic) + sizeof(uint32_t)) +
+                                              binary_mesh_num_arrays * sizeof(uint64_t);
+
+// Array elements are stored as their packed scalar components.
+static_assert(sizeof(ChVector<double>) == 3 * sizeof(double), "unexpected ChVector layout");
+static_assert(sizeof(ChVector<int>) == 3 * sizeof(int), "unexpected ChVector layout");
+static_assert(sizeof(ChVector2<double>) == 2 * sizeof(double), "unexpected ChVector2 layout");
+static_assert(sizeof(ChColor) == 3 * sizeof(float), "unexpected ChColor layout");
+
+// Set one array element from its components in the mapped file.
+// The element types are not trivially copyable, so the components are copied to a scalar buffer first.
+static void ReadBinaryElement(const char* ptr, ChVector<double>& e) {
+    double s[3];
+    std::memcpy(s, ptr, sizeof(s));
+    e.Set(s[0], s[1], s[2]);
+}
+
+static void ReadBinaryElement(const char* ptr, ChVector<int>& e) {
+    int s[3];
+    std::memcpy(s, ptr, sizeof(s));
+    e.Set(s[0], s[1], s[2]);
+}
+
+static void ReadBinaryElement(const char* ptr, ChVector2<double>& e) {
+    double s[2];
+    std::memcpy(s, ptr, sizeof(s));
+    e.Set(s[0], s[1]);
+}
+
+static void ReadBinaryElement(const char* ptr, ChColor& e) {
+    float s[3];
+    std::memcpy(s, ptr, sizeof(s));
+    e = ChColor(s[0], s[1], s[2]);
+}
+
+static void ReadBinaryElement(const char* ptr, int& e) {
+    std::memcpy(&e, ptr, sizeof(e));
+}
+
+// Copy an array from the mapped file into the given vector.
+template <typename T>
+static const char* ReadBinaryArray(const char* ptr, uint64_t n, bool load, std::vector<T>& v) {
+    if (load) {
+        v.resize(n);
+        for (uint64_t i = 0; i < n; i++)
+            ReadBinaryElement(ptr + i * sizeof(T), v[i]);
+    }
+    return ptr + PaddedSize(n * sizeof(T));
+}
+
+template <typename T>
+static void WriteBinaryArray(std::ofstream& ofs, const std::vector<T>& v) {
+    static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    size_t size = v.size() * sizeof(T);
+    if (size > 0)
+        ofs.write((const char*)v.data(), size);
+    ofs.write(padding, PaddedSize(size) - size);
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromBinaryFile(const std::string& filename,
+                                                                                      bool load_normals,
+                                                                                      bool load_uv) {
+    auto trimesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    if (!trimesh->LoadBinaryMesh(filename, load_normals, load_uv))
+        return nullptr;
+    return trimesh;
+}
+
+bool ChTriangleMeshConnected::LoadBinaryMesh(const std::string& filename, bool load_normals, bool load_uv) {
+    MappedFile file(filename);
+    if (!file.data() || file.size() < binary_mesh_header_size ||
+        std::memcmp(file.data(), binary_mesh_magic, sizeof(binary_mesh_magic)) != 0) {
+        std::cerr << "Error loading binary mesh file " << filename << std::endl;
+        return false;
+    }
+
+    const char* ptr = file.data() + sizeof(binary_mesh_magic);
+    uint32_t version;
+    std::memcpy(&version, ptr, sizeof(version));
+    if (version != binary_mesh_version) {
+        std::cerr << "Unsupported version " << version << " of binary mesh file " << filename << std::endl;
+        return false;
+    }
+    ptr = file.data() + PaddedSize(sizeof(binary_mesh_magic) + sizeof(uint32_t));
+
+    // Validate all array sizes against the file size
+    uint64_t n[binary_mesh_num_arrays];
+    std::memcpy(n, ptr, sizeof(n));
+    ptr += sizeof(n);
+    uint64_t size = binary_mesh_header_size;
+    for (int i = 0; i < binary_mesh_num_arrays; i++) {
+        if (n[i] > file.size() / binary_mesh_element_size[i]) {
+            size = UINT64_MAX;
+            break;
+        }
+        size += PaddedSize(n[i] * binary_mesh_element_size[i]);
+    }
+    if (size > file.size()) {
+        std::cerr << "Corrupt binary mesh file " << filename << std::endl;
+        return false;
+    }
+
+    this->Clear();
+    m_filename = filename;
+
+    ptr = ReadBinaryArray(ptr, n[0], true, m_vertices);
+    ptr = ReadBinaryArray(ptr, n[1], load_normals, m_normals);
+    ptr = ReadBinaryArray(ptr, n[2], load_uv, m_UV);
+    ptr = ReadBinaryArray(ptr, n[3], true, m_colors);
+    ptr = ReadBinaryArray(ptr, n[4], true, m_face_v_indices);
+    ptr = ReadBinaryArray(ptr, n[5], load_normals, m_face_n_indices);
+    ptr = ReadBinaryArray(ptr, n[6], load_uv, m_face_uv_indices);
+    ptr = ReadBinaryArray(ptr, n[7], true, m_face_col_indices);
+    ptr = ReadBinaryArray(ptr, n[8], true, m_face_mat_indices);
+
+    return true;
+}
+
+bool ChTriangleMeshConnected::WriteBinaryMesh(const std::string& filename) const {
+    std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+    if (!ofs.good())
+        return false;
+
+    static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    ofs.write(binary_mesh_magic, sizeof(binary_mesh_magic));
+    ofs.write((const char*)&binary_mesh_version, sizeof(binary_mesh_version));
+    ofs.write(padding, PaddedSize(sizeof(binary_mesh_magic) + sizeof(uint32_t)) - sizeof(binary_mesh_magic) -
+                           sizeof(uint32_t));
+
+    uint64_t n[binary_mesh_num_arrays] = {m_vertices.size(),       m_normals.size(),          m_UV.size(),
+                                          m_colors.size(),         m_face_v_indices.size(),   m_face_n_indices.size(),
+                                          m_face_uv_indices.size(), m_face_col_indices.size(), m_face_mat_indices.size()};
+    ofs.write((const char*)n, sizeof(n));
+
+    WriteBinaryArray(ofs, m_vertices);
+    WriteBinaryArray(ofs, m_normals);
+    WriteBinaryArray(ofs, m_UV);
+    WriteBinaryArray(ofs, m_colors);
+    WriteBinaryArray(ofs, m_face_v_indices);
+    WriteBinaryArray(ofs, m_face_n_indices);
+    WriteBinaryArray(ofs, m_face_uv_indices);
+    WriteBinaryArray(ofs, m_face_col_indices);
+    WriteBinaryArray(ofs, m_face_mat_indices);
+
+    return ofs.good();
+}
+
+bool ChTriangleMeshConnected::IsBinaryMeshFile(const std::string& filename) {
+    std::ifstream ifs(filename, std::ios::binary);
+    char magic[4];
+    ifs.read(magic, sizeof(magic));
+    return ifs.good() && std::memcmp(magic, binary_mesh_magic, sizeof(magic)) == 0;
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromFile(const std::string& filename,
+                                                                                bool load_normals,
+                                                                                bool load_uv) {
+    if (IsBinaryMeshFile(filename))
+        return CreateFromBinaryFile(filename, load_normals, load_uv);
+    return CreateFromWavefrontFile(filename, load_normals, load_uv);
+}
+
 // Write the specified meshes in a Wavefront .obj file
 void ChTriangleMeshConnected::WriteWavefront(const std::string& filename,
                                              const std::vector<ChTriangleMeshConnected>& meshes) {
@@ -518,27 +794,37 @@ void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33
     }
 }
 
+// Triangle edge, identified by its vertex indices (in increasing order), the triangle index, and the edge number.
+struct TriangleEdge {
+    int v1;
+    int v2;
+    int tri;
+    int edge;
+    bool operator<(const TriangleEdge& other) const {
+        return std::tie(v1, v2, tri, edge) < std::tie(other.v1, other.v2, other.tri, other.edge);
+    }
+    bool SameEdge(const TriangleEdge& other) const { return v1 == other.v1 && v2 == other.v2; }
+};
+
+// Collect all triangle edges, sorted by their vertex indices.
+// Entries for the same edge are consecutive and ordered by triangle index.
+static void SortedTriangleEdges(const std::vector<ChVector<int>>& faces, std::vector<TriangleEdge>& edges) {
+    edges.resize(3 * faces.size());
+    for (int it = 0; it < (int)faces.size(); ++it) {
+        for (int ie = 0; ie < 3; ++ie) {
+            int v1 = faces[it][ie];
+            int v2 = faces[it][(ie + 1) % 3];
+            edges[3 * it + ie] = {std::min(v1, v2), std::max(v1, v2), it, ie};
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+}
+
 bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
     bool pathological_edges = false;
 
-    std::multimap<std::pair<int, int>, int> edge_map;
-
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        edge_map.insert({medgeA, it});
-        edge_map.insert({medgeB, it});
-        edge_map.insert({medgeC, it});
-    }
+    std::vector<TriangleEdge> edges;
+    SortedTriangleEdges(this->m_face_v_indices, edges);
 
     // Create a map of neighboring triangles, vector of:
     // [Ti TieA TieB TieC]
@@ -548,43 +834,28 @@ bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::ar
         tri_map[it][1] = -1;  // default no neighbour
         tri_map[it][2] = -1;  // default no neighbour
         tri_map[it][3] = -1;  // default no neighbour
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        if (edge_map.count(medgeA) > 2 || edge_map.count(medgeB) > 2 || edge_map.count(medgeC) > 2) {
+    }
+
+    // For each edge, the neighbour is the first (lowest index) other triangle sharing that edge
+    for (size_t start = 0; start < edges.size();) {
+        size_t end = start + 1;
+        while (end < edges.size() && edges[end].SameEdge(edges[start]))
+            ++end;
+        if (end - start > 2) {
             pathological_edges = true;
             // GetLog() << "Warning, edge shared with more than two triangles! \n";
         }
-        auto retA = edge_map.equal_range(medgeA);
-        for (auto fedge = retA.first; fedge != retA.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][1] = fedge->second;
-                break;
-            }
-        }
-        auto retB = edge_map.equal_range(medgeB);
-        for (auto fedge = retB.first; fedge != retB.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][2] = fedge->second;
-                break;
-            }
-        }
-        auto retC = edge_map.equal_range(medgeC);
-        for (auto fedge = retC.first; fedge != retC.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][3] = fedge->second;
-                break;
+        for (size_t i = start; i < end; ++i) {
+            for (size_t j = start; j < end; ++j) {
+                if (edges[j].tri != edges[i].tri) {
+                    tri_map[edges[i].tri][edges[i].edge + 1] = edges[j].tri;
+                    break;
+                }
             }
         }
+        start = end;
     }
+
     return pathological_edges;
 }
 
@@ -592,56 +863,28 @@ bool ChTriangleMeshConnected::ComputeWingedEdges(std::map<std::pair<int, int>, s
                                                  bool allow_single_wing) const {
     bool pathological_edges = false;
 
-    std::multimap<std::pair<int, int>, int> edge_map;
-
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        edge_map.insert({medgeA, it});
-        edge_map.insert({medgeB, it});
-        edge_map.insert({medgeC, it});
-    }
-
-    for (auto aedge = edge_map.begin(); aedge != edge_map.end(); ++aedge) {
-        auto ret = edge_map.equal_range(aedge->first);
-        int nt = 0;
-        std::pair<int, int> wingedge;
-        std::pair<int, int> wingtri;
-        wingtri.first = -1;
-        wingtri.second = -1;
-        for (auto fedge = ret.first; fedge != ret.second; ++fedge) {
-            if (fedge->second == -1)
-                break;
-            wingedge.first = fedge->first.first;
-            wingedge.second = fedge->first.second;
-            if (nt == 0)
-                wingtri.first = fedge->second;
-            if (nt == 1)
-                wingtri.second = fedge->second;
-            ++nt;
-            if (nt == 2)
-                break;
+    std::vector<TriangleEdge> edges;
+    SortedTriangleEdges(this->m_face_v_indices, edges);
+
+    // Edges are processed in increasing order, so each new winged edge can be inserted at the end of the map
+    for (size_t start = 0; start < edges.size();) {
+        size_t end = start + 1;
+        while (end < edges.size() && edges[end].SameEdge(edges[start]))
+            ++end;
+        int nt = (int)(end - start);
+        std::pair<int, int> wingedge(edges[start].v1, edges[start].v2);
+        std::pair<int, int> wingtri(edges[start].tri, nt > 1 ? edges[start + 1].tri : -1);
+        if ((nt >= 2) || ((nt == 1) && allow_single_wing)) {
+            winged_edges.insert(winged_edges.end(), {wingedge, wingtri});  // ok found winged edge!
         }
-        if ((nt == 2) || ((nt == 1) && allow_single_wing)) {
-            winged_edges.insert(
-                std::pair<std::pair<int, int>, std::pair<int, int>>(wingedge, wingtri));  // ok found winged edge!
-            aedge->second = -1;  // deactivate this way otherwise found again by sister
-        }
-        if (nt == 3) {
+        if (nt > 2) {
             pathological_edges = true;
             // GetLog() << "Warning: winged edge between "<< wing[0] << " and " << wing[1]  << " shared with more than
             // two triangles.\n";
         }
+        start = end;
     }
+
     return pathological_edges;
 }
 
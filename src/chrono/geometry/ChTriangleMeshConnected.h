@@ -92,6 +92,32 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Load an STL file into this triangle mesh.
     bool LoadSTLMesh(const std::string& filename, bool load_normals = true);
 
+    /// Create and return a ChTriangleMeshConnected from a file in the Chrono binary mesh format.
+    /// If an error occurrs during loading, an empty shared pointer is returned.
+    static std::shared_ptr<ChTriangleMeshConnected> CreateFromBinaryFile(const std::string& filename,
+                                                                         bool load_normals = true,
+                                                                         bool load_uv = false);
+
+    /// Load a file in the Chrono binary mesh format (see WriteBinaryMesh) into this triangle mesh.
+    /// The file is memory-mapped and the mesh arrays are copied directly from the mapped data (no parsing).
+    bool LoadBinaryMesh(const std::string& filename, bool load_normals = true, bool load_uv = false);
+
+    /// Write this mesh in the Chrono binary mesh format.
+    /// The binary file contains all vertex data (coordinates, normals, UV, colors) and all face index arrays. Large
+    /// meshes (e.g., terrain meshes) load much faster from a binary file than from a Wavefront OBJ file. Note that the
+    /// format uses the native byte order and is therefore not portable across platforms with different endianness.
+    bool WriteBinaryMesh(const std::string& filename) const;
+
+    /// Return true if the specified file is a mesh file in the Chrono binary mesh format.
+    static bool IsBinaryMeshFile(const std::string& filename);
+
+    /// Create and return a ChTriangleMeshConnected from the specified file.
+    /// Files in the Chrono binary mesh format are identified by their header; all other files are loaded as Wavefront
+    /// OBJ files. If an error occurrs during loading, an empty shared pointer is returned.
+    static std::shared_ptr<ChTriangleMeshConnected> CreateFromFile(const std::string& filename,
+                                                                   bool load_normals = true,
+                                                                   bool load_uv = false);
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, const std::vector<ChTriangleMeshConnected>& meshes);
 
@@ -69,7 +69,8 @@ class ChApi ChFunction {
         FUNCT_LAMBDA,
         FUNCT_CYCLOIDAL,
         FUNCT_BSPLINE,
-        FUNCT_DOUBLES
+        FUNCT_DOUBLES,
+        FUNCT_TABLE
     };
 
   public:
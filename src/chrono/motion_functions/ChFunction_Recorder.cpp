@@ -12,7 +12,9 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
 
 #include "chrono/motion_functions/ChFunction_Recorder.h"
@@ -24,7 +26,7 @@ CH_FACTORY_REGISTER(ChFunction_Recorder)
 
 ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other) {
     m_points = other.m_points;
-    m_last = m_points.end();
+    m_last = 0;
 }
 
 void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
@@ -41,30 +43,56 @@ void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
 }
 
 void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
-    for (auto iter = m_points.rbegin(); iter != m_points.rend(); ++iter) {
-        double dist = mx - iter->x;
-        if (std::abs(dist) < std::numeric_limits<double>::epsilon()) {
-            // Overwrite current iterator
-            iter->x = mx;
-            iter->y = my;
-            iter->w = mw;
-            return;
-        } else if (dist > 0) {
-            // Insert before current iterator
-            ChRecPoint rec(mx, my, mw);
-            m_points.insert(iter.base(), rec);
-            return;
-        }
+    // Fast path: append at the end
+    if (m_points.empty() || mx - m_points.back().x >= std::numeric_limits<double>::epsilon()) {
+        m_points.push_back(ChRecPoint(mx, my, mw));
+        return;
+    }
+
+    // Locate the first point with x > mx
+    auto iter = std::upper_bound(m_points.begin(), m_points.end(), mx,
+                                 [](double val, const ChRecPoint& p) { return val < p.x; });
+
+    // Overwrite the previous point if it has the same x
+    if (iter != m_points.begin() && std::abs(mx - std::prev(iter)->x) < std::numeric_limits<double>::epsilon()) {
+        *std::prev(iter) = ChRecPoint(mx, my, mw);
+        return;
+    }
+    if (iter != m_points.end() && std::abs(iter->x - mx) < std::numeric_limits<double>::epsilon()) {
+        *iter = ChRecPoint(mx, my, mw);
+        return;
     }
 
-    // Insert in front of list
-    m_points.push_front(ChRecPoint(mx, my, mw));
+    m_points.insert(iter, ChRecPoint(mx, my, mw));
 }
 
-double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
+static inline double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
     return ((x - p1.x) * p2.y + (p2.x - x) * p1.y) / (p2.x - p1.x);
 }
 
+size_t ChFunction_Recorder::FindInterval(double x) const {
+    size_t n = m_points.size();
+
+    // Check the last interval used and its neighbors
+    size_t i = m_last;
+    if (i < n - 1) {
+        if (x >= m_points[i].x) {
+            if (x <= m_points[i + 1].x)
+                return i;
+            if (i + 2 < n && x <= m_points[i + 2].x)
+                return m_last = i + 1;
+        } else if (i > 0 && x >= m_points[i - 1].x) {
+            return m_last = i - 1;
+        }
+    }
+
+    // Binary search for the first point with x_i >= x (guaranteed to be in [1, n-1])
+    auto iter = std::lower_bound(m_points.begin() + 1, m_points.end() - 1, x,
+                                 [](const ChRecPoint& p, double val) { return p.x < val; });
+    m_last = (size_t)(iter - m_points.begin()) - 1;
+    return m_last;
+}
+
 double ChFunction_Recorder::Get_y(double x) const {
     if (m_points.empty()) {
         return 0;
@@ -79,31 +107,14 @@ double ChFunction_Recorder::Get_y(double x) const {
     }
 
     // At this point we are guaranteed that there are at least two records.
+    size_t i = FindInterval(x);
+    return Interpolate_y(x, m_points[i], m_points[i + 1]);
+}
 
-    if (m_last == m_points.end()) {
-        m_last = m_points.begin();
-    }
-
-    if (x > m_last->x) {
-        // Search to the right
-        for (auto iter = m_last; iter != m_points.end(); ++iter) {
-            if (x <= iter->x) {
-                return Interpolate_y(x, *m_last, *iter);
-            }
-            m_last = iter;
-        }
-    } else {
-        // Search to the left
-        for (auto iter = m_last; iter != m_points.begin();) {
-            --iter;
-            if (x >= iter->x) {
-                return Interpolate_y(x, *iter, *m_last);
-            }
-            m_last = iter;
-        }
-    }
-
-    return 0;
+void ChFunction_Recorder::Get_y_batch(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    for (int k = 0; k < x.size(); k++)
+        y(k) = Get_y(x(k));
 }
 
 double ChFunction_Recorder::Get_y_dx(double x) const {
@@ -121,9 +132,8 @@ void ChFunction_Recorder::ArchiveOut(ChArchiveOut& marchive) {
     marchive.VersionWrite<ChFunction_Recorder>();
     // serialize parent class
     ChFunction::ArchiveOut(marchive);
-    // serialize all member data: copy to vector and store
-    std::vector<ChRecPoint> tmpvect{std::begin(m_points), std::end(m_points)};
-    marchive << CHNVP(tmpvect);
+    // serialize all member data
+    marchive << CHNVP(m_points, "tmpvect");
 }
 
 void ChFunction_Recorder::ArchiveIn(ChArchiveIn& marchive) {
@@ -131,11 +141,9 @@ void ChFunction_Recorder::ArchiveIn(ChArchiveIn& marchive) {
     /*int version =*/ marchive.VersionRead<ChFunction_Recorder>();
     // deserialize parent class
     ChFunction::ArchiveIn(marchive);
-    // stream in all member data: load vector of points and copy to list
-    std::vector<ChRecPoint> tmpvect;
-    marchive >> CHNVP(tmpvect);
-    m_points.clear();
-    std::copy(tmpvect.begin(), tmpvect.end(), std::back_inserter(m_points));
+    // stream in all member data
+    marchive >> CHNVP(m_points, "tmpvect");
+    m_last = 0;
 }
 
 }  // end namespace chrono
@@ -15,8 +15,7 @@
 #ifndef CHFUNCT_RECORDER_H
 #define CHFUNCT_RECORDER_H
 
-#include <iterator>
-#include <list>
+#include <vector>
 
 #include "chrono/motion_functions/ChFunction_Base.h"
 
@@ -51,13 +50,17 @@ class ChApi ChRecPoint {
 ///
 /// y = interpolation of array of (x,y) data,
 ///     where (x,y) points can be inserted randomly.
+///
+/// Points are kept sorted in contiguous storage. A lookup first checks the interval used by the previous call (and
+/// its successor), so that queries with slowly varying argument are O(1); otherwise the interval is located with a
+/// binary search. See ChFunction_Table for a read-only table with O(1) lookup on uniform grids and cubic interpolation.
 class ChApi ChFunction_Recorder : public ChFunction {
   private:
-    std::list<ChRecPoint> m_points;  ///< the list of points
-    mutable std::list<ChRecPoint>::const_iterator m_last;
+    std::vector<ChRecPoint> m_points;  ///< the sorted array of points
+    mutable size_t m_last;             ///< index of the left end of the last interval used
 
   public:
-    ChFunction_Recorder() : m_last(m_points.end()) {}
+    ChFunction_Recorder() : m_last(0) {}
     ChFunction_Recorder(const ChFunction_Recorder& other);
     ~ChFunction_Recorder() {}
 
@@ -70,15 +73,26 @@ class ChApi ChFunction_Recorder : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Evaluate the function at all values in the array x.
+    /// If x is sorted, the cost of each lookup is O(1).
+    void Get_y_batch(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Add a point, overwriting any existing point with the same x.
+    /// Adding points in increasing order of x has O(1) cost.
     void AddPoint(double mx, double my, double mw = 1);
 
+    /// Reserve storage for the specified number of points.
+    void Reserve(size_t n) { m_points.reserve(n); }
+
     void Reset() {
         m_points.clear();
-        m_last = m_points.end();
+        m_last = 0;
     }
 
-    const std::list<ChRecPoint>& GetPoints() const { return m_points; }
-    std::list<ChRecPoint>& GetPoints() { return m_points; }
+    /// Access the array of points, sorted by x.
+    /// If points are modified directly, the caller must ensure they remain sorted.
+    const std::vector<ChRecPoint>& GetPoints() const { return m_points; }
+    std::vector<ChRecPoint>& GetPoints() { return m_points; }
 
     virtual void Estimate_x_range(double& xmin, double& xmax) const override;
 
@@ -87,6 +101,10 @@ class ChApi ChFunction_Recorder : public ChFunction {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  private:
+    /// Find the interval [x_i, x_{i+1}] containing x (assumes at least two points and x strictly inside the range).
+    size_t FindInterval(double x) const;
 };
 
 /// @} chrono_functions
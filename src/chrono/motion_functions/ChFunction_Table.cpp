@@ -0,0 +1,490 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "chrono/core/ChException.h"
+#include "chrono/motion_functions/ChFunction_Table.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChFunction_Table)
+CH_FACTORY_REGISTER(ChFunction_Table2D)
+
+// -----------------------------------------------------------------------------
+// Utility functions for lookup in an array of abscissas
+// -----------------------------------------------------------------------------
+
+// Check that the abscissas are strictly increasing and whether they are uniformly spaced.
+// Return the inverse of the spacing (0 for non-uniform abscissas).
+static double CheckAbscissas(const std::vector<double>& x, const char* func) {
+    size_t n = x.size();
+    if (n < 2)
+        throw ChException(std::string(func) + ": at least two points are required.");
+    for (size_t i = 1; i < n; i++) {
+        if (!(x[i] > x[i - 1]))
+            throw ChException(std::string(func) + ": abscissas must be strictly increasing.");
+    }
+
+    double dx = (x[n - 1] - x[0]) / (n - 1);
+    double tol = 1e-12 * (x[n - 1] - x[0]);
+    for (size_t i = 1; i < n - 1; i++) {
+        if (std::abs(x[i] - (x[0] + i * dx)) > tol)
+            return 0;
+    }
+    return 1 / dx;
+}
+
+// Find the interval [x_i, x_{i+1}] containing the value xval, clamped to the range of abscissas.
+static inline int LocateInterval(const std::vector<double>& x, double inv_dx, double xval) {
+    int n = (int)x.size();
+
+    if (inv_dx > 0) {
+        // Uniform abscissas: direct indexing, then correct for round-off
+        int i = (int)((xval - x[0]) * inv_dx);
+        i = std::max(0, std::min(i, n - 2));
+        if (xval < x[i] && i > 0)
+            i--;
+        else if (xval > x[i + 1] && i < n - 2)
+            i++;
+        return i;
+    }
+
+    // Non-uniform abscissas: binary search for the first x_j > xval (with j in [1, n-1])
+    auto iter = std::upper_bound(x.begin() + 1, x.end() - 1, xval);
+    return (int)(iter - x.begin()) - 1;
+}
+
+// -----------------------------------------------------------------------------
+// ChFunction_Table
+// -----------------------------------------------------------------------------
+
+ChFunction_Table::ChFunction_Table() : m_type(Interpolation::LINEAR), m_uniform(false), m_inv_dx(0) {}
+
+ChFunction_Table::ChFunction_Table(const std::vector<double>& x, const std::vector<double>& y, Interpolation type) {
+    Setup(x, y, type);
+}
+
+ChFunction_Table::ChFunction_Table(const ChFunction_Recorder& recorder, Interpolation type) {
+    Setup(recorder, type);
+}
+
+ChFunction_Table::ChFunction_Table(const ChFunction_Table& other) : ChFunction(other) {
+    m_type = other.m_type;
+    m_x = other.m_x;
+    m_y = other.m_y;
+    m_coefs = other.m_coefs;
+    m_uniform = other.m_uniform;
+    m_inv_dx = other.m_inv_dx;
+}
+
+void ChFunction_Table::Setup(const std::vector<double>& x, const std::vector<double>& y, Interpolation type) {
+    if (x.size() != y.size())
+        throw ChException("ChFunction_Table::Setup: incompatible array sizes.");
+    m_type = type;
+    m_x = x;
+    m_y = y;
+    Process();
+}
+
+void ChFunction_Table::SetupUniform(double x0, double dx, const std::vector<double>& y, Interpolation type) {
+    m_type = type;
+    m_x.resize(y.size());
+    for (size_t i = 0; i < y.size(); i++)
+        m_x[i] = x0 + i * dx;
+    m_y = y;
+    Process();
+}
+
+void ChFunction_Table::Setup(const ChFunction_Recorder& recorder, Interpolation type) {
+    m_type = type;
+    m_x.clear();
+    m_y.clear();
+    for (const auto& p : recorder.GetPoints()) {
+        m_x.push_back(p.x);
+        m_y.push_back(p.y);
+    }
+    Process();
+}
+
+void ChFunction_Table::Sample(const ChFunction& fun, double xmin, double xmax, int n, Interpolation type) {
+    if (n < 2)
+        throw ChException("ChFunction_Table::Sample: at least two points are required.");
+    m_type = type;
+    m_x.resize(n);
+    m_y.resize(n);
+    double dx = (xmax - xmin) / (n - 1);
+    for (int i = 0; i < n; i++) {
+        m_x[i] = xmin + i * dx;
+        m_y[i] = fun.Get_y(m_x[i]);
+    }
+    Process();
+}
+
+double ChFunction_Table::Approximate(const ChFunction& fun,
+                                     double xmin,
+                                     double xmax,
+                                     double tol,
+                                     Interpolation type,
+                                     int max_points) {
+    if (!(xmax > xmin))
+        throw ChException("ChFunction_Table::Approximate: invalid range.");
+
+    // Initial uniform grid
+    int n = std::max(2, std::min(max_points, 17));
+    Sample(fun, xmin, xmax, n, type);
+
+    // Intervals narrower than this are not refined further (e.g., at discontinuities of the function)
+    double hmin = 1e-9 * (xmax - xmin);
+
+    // Check points within each interval, in local coordinates
+    const double check[3] = {0.25, 0.5, 0.75};
+
+    std::vector<double> err;
+    double max_err = 0;
+    while (true) {
+        // Estimate the interpolation error on each interval
+        n = (int)m_x.size();
+        err.assign(n - 1, 0.0);
+        max_err = 0;
+        for (int i = 0; i < n - 1; i++) {
+            double h = m_x[i + 1] - m_x[i];
+            const double* c = &m_coefs[4 * i];
+            for (auto u : check) {
+                double s = u * h;
+                double e = std::abs(c[0] + s * (c[1] + s * (c[2] + s * c[3])) - fun.Get_y(m_x[i] + s));
+                err[i] = std::max(err[i], e);
+            }
+            max_err = std::max(max_err, err[i]);
+        }
+
+        // Select intervals to be bisected, largest errors first, within the available budget
+        std::vector<int> split;
+        for (int i = 0; i < n - 1; i++) {
+            if (err[i] > tol && m_x[i + 1] - m_x[i] > hmin)
+                split.push_back(i);
+        }
+        int budget = max_points - n;
+        if (split.empty() || budget <= 0)
+            break;
+        if ((int)split.size() > budget) {
+            std::nth_element(split.begin(), split.begin() + budget, split.end(),
+                             [&err](int a, int b) { return err[a] > err[b]; });
+            split.resize(budget);
+            std::sort(split.begin(), split.end());
+        }
+
+        // Insert the midpoints of the selected intervals
+        std::vector<double> x;
+        std::vector<double> y;
+        x.reserve(n + split.size());
+        y.reserve(n + split.size());
+        size_t k = 0;
+        for (int i = 0; i < n; i++) {
+            x.push_back(m_x[i]);
+            y.push_back(m_y[i]);
+            if (k < split.size() && split[k] == i) {
+                double xm = 0.5 * (m_x[i] + m_x[i + 1]);
+                x.push_back(xm);
+                y.push_back(fun.Get_y(xm));
+                k++;
+            }
+        }
+        m_x.swap(x);
+        m_y.swap(y);
+        Process();
+    }
+
+    return max_err;
+}
+
+void ChFunction_Table::Process() {
+    m_inv_dx = CheckAbscissas(m_x, "ChFunction_Table");
+    m_uniform = (m_inv_dx > 0);
+
+    int n = (int)m_x.size();
+    m_coefs.assign(4 * (n - 1), 0.0);
+
+    // Second derivatives at the knots (zero for linear interpolation)
+    std::vector<double> ypp(n, 0.0);
+
+    if (m_type == Interpolation::CUBIC && n > 2) {
+        // Natural spline: solve the tridiagonal system for the interior second derivatives (Thomas algorithm)
+        std::vector<double> diag(n, 1.0);
+        std::vector<double> rhs(n, 0.0);
+        std::vector<double> upper(n, 0.0);
+        for (int i = 1; i < n - 1; i++) {
+            double hm = m_x[i] - m_x[i - 1];
+            double hp = m_x[i + 1] - m_x[i];
+            double lower = (i > 1) ? hm : 0.0;
+            diag[i] = 2 * (hm + hp) - lower * upper[i - 1];
+            upper[i] = (i < n - 2) ? hp / diag[i] : 0.0;
+            rhs[i] = (6 * ((m_y[i + 1] - m_y[i]) / hp - (m_y[i] - m_y[i - 1]) / hm) - lower * rhs[i - 1]) / diag[i];
+        }
+        for (int i = n - 2; i >= 1; i--)
+            ypp[i] = rhs[i] - upper[i] * ypp[i + 1];
+    }
+
+    // Polynomial coefficients on each interval, in powers of s = x - x_i
+    for (int i = 0; i < n - 1; i++) {
+        double h = m_x[i + 1] - m_x[i];
+        double* c = &m_coefs[4 * i];
+        c[0] = m_y[i];
+        c[1] = (m_y[i + 1] - m_y[i]) / h - h * (2 * ypp[i] + ypp[i + 1]) / 6;
+        c[2] = ypp[i] / 2;
+        c[3] = (ypp[i + 1] - ypp[i]) / (6 * h);
+    }
+}
+
+int ChFunction_Table::FindInterval(double x) const {
+    return LocateInterval(m_x, m_inv_dx, x);
+}
+
+double ChFunction_Table::Get_y(double x) const {
+    if (m_x.empty())
+        return 0;
+    if (x <= m_x.front())
+        return m_y.front();
+    if (x >= m_x.back())
+        return m_y.back();
+
+    int i = FindInterval(x);
+    const double* c = &m_coefs[4 * i];
+    double s = x - m_x[i];
+    return c[0] + s * (c[1] + s * (c[2] + s * c[3]));
+}
+
+double ChFunction_Table::Get_y_dx(double x) const {
+    if (m_x.empty() || x < m_x.front() || x > m_x.back())
+        return 0;
+
+    int i = FindInterval(x);
+    const double* c = &m_coefs[4 * i];
+    double s = x - m_x[i];
+    return c[1] + s * (2 * c[2] + s * 3 * c[3]);
+}
+
+double ChFunction_Table::Get_y_dxdx(double x) const {
+    if (m_x.empty() || x < m_x.front() || x > m_x.back())
+        return 0;
+
+    int i = FindInterval(x);
+    const double* c = &m_coefs[4 * i];
+    double s = x - m_x[i];
+    return 2 * c[2] + 6 * c[3] * s;
+}
+
+double ChFunction_Table::Get_y_dxdxdx(double x) const {
+    if (m_x.empty() || x < m_x.front() || x > m_x.back())
+        return 0;
+
+    int i = FindInterval(x);
+    return 6 * m_coefs[4 * i + 3];
+}
+
+void ChFunction_Table::Get_y_batch(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    for (int k = 0; k < x.size(); k++)
+        y(k) = Get_y(x(k));
+}
+
+void ChFunction_Table::Get_y_batch(const ChVectorDynamic<>& x,
+                                   ChVectorDynamic<>& y,
+                                   ChVectorDynamic<>& y_dx,
+                                   ChVectorDynamic<>& y_dxdx) const {
+    y.resize(x.size());
+    y_dx.resize(x.size());
+    y_dxdx.resize(x.size());
+
+    if (m_x.empty()) {
+        y.setZero();
+        y_dx.setZero();
+        y_dxdx.setZero();
+        return;
+    }
+
+    for (int k = 0; k < x.size(); k++) {
+        if (x(k) <= m_x.front() || x(k) >= m_x.back()) {
+            y(k) = Get_y(x(k));
+            y_dx(k) = Get_y_dx(x(k));
+            y_dxdx(k) = Get_y_dxdx(x(k));
+            continue;
+        }
+        int i = FindInterval(x(k));
+        const double* c = &m_coefs[4 * i];
+        double s = x(k) - m_x[i];
+        y(k) = c[0] + s * (c[1] + s * (c[2] + s * c[3]));
+        y_dx(k) = c[1] + s * (2 * c[2] + s * 3 * c[3]);
+        y_dxdx(k) = 2 * c[2] + 6 * c[3] * s;
+    }
+}
+
+void ChFunction_Table::Estimate_x_range(double& xmin, double& xmax) const {
+    if (m_x.empty()) {
+        xmin = 0.0;
+        xmax = 1.2;
+        return;
+    }
+
+    xmin = m_x.front();
+    xmax = m_x.back();
+}
+
+void ChFunction_Table::ArchiveOut(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChFunction_Table>();
+    // serialize parent class
+    ChFunction::ArchiveOut(marchive);
+    // serialize all member data
+    int type = static_cast<int>(m_type);
+    marchive << CHNVP(type, "interpolation");
+    marchive << CHNVP(m_x);
+    marchive << CHNVP(m_y);
+}
+
+void ChFunction_Table::ArchiveIn(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChFunction_Table>();
+    // deserialize parent class
+    ChFunction::ArchiveIn(marchive);
+    // stream in all member data
+    int type;
+    marchive >> CHNVP(type, "interpolation");
+    marchive >> CHNVP(m_x);
+    marchive >> CHNVP(m_y);
+    m_type = static_cast<Interpolation>(type);
+    if (m_x.empty()) {
+        m_coefs.clear();
+        m_uniform = false;
+        m_inv_dx = 0;
+        return;
+    }
+    Process();
+}
+
+// -----------------------------------------------------------------------------
+// ChFunction_Table2D
+// -----------------------------------------------------------------------------
+
+ChFunction_Table2D::ChFunction_Table2D()
+    : m_uniform_x(false), m_uniform_y(false), m_inv_dx(0), m_inv_dy(0) {}
+
+ChFunction_Table2D::ChFunction_Table2D(const std::vector<double>& x,
+                                       const std::vector<double>& y,
+                                       const std::vector<double>& z) {
+    Setup(x, y, z);
+}
+
+void ChFunction_Table2D::Setup(const std::vector<double>& x,
+                               const std::vector<double>& y,
+                               const std::vector<double>& z) {
+    if (z.size() != x.size() * y.size())
+        throw ChException("ChFunction_Table2D::Setup: incompatible array sizes.");
+    m_x = x;
+    m_y = y;
+    m_z = z;
+    Process();
+}
+
+void ChFunction_Table2D::Process() {
+    m_inv_dx = CheckAbscissas(m_x, "ChFunction_Table2D");
+    m_inv_dy = CheckAbscissas(m_y, "ChFunction_Table2D");
+    m_uniform_x = (m_inv_dx > 0);
+    m_uniform_y = (m_inv_dy > 0);
+}
+
+void ChFunction_Table2D::FindCell(double x, double y, int& i, int& j, double& u, double& v) const {
+    x = std::max(m_x.front(), std::min(x, m_x.back()));
+    y = std::max(m_y.front(), std::min(y, m_y.back()));
+    i = LocateInterval(m_x, m_inv_dx, x);
+    j = LocateInterval(m_y, m_inv_dy, y);
+    u = (x - m_x[i]) / (m_x[i + 1] - m_x[i]);
+    v = (y - m_y[j]) / (m_y[j + 1] - m_y[j]);
+}
+
+double ChFunction_Table2D::Get_z(double x, double y) const {
+    if (m_z.empty())
+        return 0;
+
+    int i, j;
+    double u, v;
+    FindCell(x, y, i, j, u, v);
+
+    size_t ny = m_y.size();
+    const double* z0 = &m_z[i * ny + j];  // row i
+    const double* z1 = z0 + ny;           // row i+1
+    return (1 - u) * ((1 - v) * z0[0] + v * z0[1]) + u * ((1 - v) * z1[0] + v * z1[1]);
+}
+
+double ChFunction_Table2D::Get_z_dx(double x, double y) const {
+    if (m_z.empty() || x < m_x.front() || x > m_x.back())
+        return 0;
+
+    int i, j;
+    double u, v;
+    FindCell(x, y, i, j, u, v);
+
+    size_t ny = m_y.size();
+    const double* z0 = &m_z[i * ny + j];
+    const double* z1 = z0 + ny;
+    return ((1 - v) * (z1[0] - z0[0]) + v * (z1[1] - z0[1])) / (m_x[i + 1] - m_x[i]);
+}
+
+double ChFunction_Table2D::Get_z_dy(double x, double y) const {
+    if (m_z.empty() || y < m_y.front() || y > m_y.back())
+        return 0;
+
+    int i, j;
+    double u, v;
+    FindCell(x, y, i, j, u, v);
+
+    size_t ny = m_y.size();
+    const double* z0 = &m_z[i * ny + j];
+    const double* z1 = z0 + ny;
+    return ((1 - u) * (z0[1] - z0[0]) + u * (z1[1] - z1[0])) / (m_y[j + 1] - m_y[j]);
+}
+
+void ChFunction_Table2D::Get_z_batch(const ChVectorDynamic<>& x,
+                                     const ChVectorDynamic<>& y,
+                                     ChVectorDynamic<>& z) const {
+    assert(x.size() == y.size());
+    z.resize(x.size());
+    for (int k = 0; k < x.size(); k++)
+        z(k) = Get_z(x(k), y(k));
+}
+
+void ChFunction_Table2D::ArchiveOut(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChFunction_Table2D>();
+    // serialize all member data
+    marchive << CHNVP(m_x);
+    marchive << CHNVP(m_y);
+    marchive << CHNVP(m_z);
+}
+
+void ChFunction_Table2D::ArchiveIn(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChFunction_Table2D>();
+    // stream in all member data
+    marchive >> CHNVP(m_x);
+    marchive >> CHNVP(m_y);
+    marchive >> CHNVP(m_z);
+    if (!m_z.empty())
+        Process();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,212 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHFUNCT_TABLE_H
+#define CHFUNCT_TABLE_H
+
+#include <vector>
+
+#include "chrono/motion_functions/ChFunction_Base.h"
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_functions
+/// @{
+
+/// Table function:
+///
+/// y = piecewise linear or cubic spline interpolation of tabulated (x,y) data.
+///
+/// Unlike ChFunction_Recorder, the table is set up once and then only queried. The data is stored in contiguous arrays,
+/// with the polynomial coefficients of each interval precomputed. If the abscissas are uniformly spaced, the interval
+/// containing a given argument is found in O(1); otherwise a binary search is used. Cubic interpolation uses a natural
+/// spline. Outside the table range, the function is constant (equal to the first or last tabulated value).
+class ChApi ChFunction_Table : public ChFunction {
+  public:
+    /// Interpolation method between tabulated values.
+    enum class Interpolation {
+        LINEAR,  ///< piecewise linear
+        CUBIC    ///< natural cubic spline
+    };
+
+    ChFunction_Table();
+    ChFunction_Table(const std::vector<double>& x,
+                     const std::vector<double>& y,
+                     Interpolation type = Interpolation::LINEAR);
+    ChFunction_Table(const ChFunction_Recorder& recorder, Interpolation type = Interpolation::LINEAR);
+    ChFunction_Table(const ChFunction_Table& other);
+    ~ChFunction_Table() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChFunction_Table* Clone() const override { return new ChFunction_Table(*this); }
+
+    virtual FunctionType Get_Type() const override { return FUNCT_TABLE; }
+
+    virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
+    virtual double Get_y_dxdx(double x) const override;
+    virtual double Get_y_dxdxdx(double x) const override;
+
+    /// Evaluate the function at all values in the array x.
+    void Get_y_batch(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Evaluate the function and its first two derivatives at all values in the array x.
+    void Get_y_batch(const ChVectorDynamic<>& x,
+                     ChVectorDynamic<>& y,
+                     ChVectorDynamic<>& y_dx,
+                     ChVectorDynamic<>& y_dxdx) const;
+
+    /// Set the tabulated data from arrays of (x,y) values.
+    /// The abscissas must be strictly increasing; at least two points are required.
+    void Setup(const std::vector<double>& x,
+               const std::vector<double>& y,
+               Interpolation type = Interpolation::LINEAR);
+
+    /// Set the tabulated data from y values at uniformly spaced abscissas x0, x0+dx, x0+2*dx, ...
+    void SetupUniform(double x0, double dx, const std::vector<double>& y, Interpolation type = Interpolation::LINEAR);
+
+    /// Set the tabulated data from the points of a recorder function.
+    void Setup(const ChFunction_Recorder& recorder, Interpolation type = Interpolation::LINEAR);
+
+    /// Tabulate the given function at n uniformly spaced points in [xmin, xmax].
+    void Sample(const ChFunction& fun, double xmin, double xmax, int n, Interpolation type = Interpolation::LINEAR);
+
+    /// Approximate (freeze) the given function on [xmin, xmax] with a table of adaptively refined abscissas.
+    /// Starting from a uniform grid, intervals where the interpolation error (sampled at interior points) exceeds the
+    /// specified tolerance are repeatedly bisected, until the tolerance is met everywhere or the maximum number of
+    /// points is reached. Returns the estimated maximum interpolation error over [xmin, xmax].
+    /// This can be used to replace a composite function (e.g., a tree of ChFunction_Operation, ChFunction_Sequence,
+    /// ChFunction_Mirror, ChFunction_Repeat, ChFunction_Derive, ChFunction_Integrate objects) queried at every step by
+    /// a motor or link with a flat table, with analytic derivatives. Note that the tolerance only applies to the
+    /// function values; with CUBIC interpolation, the first two derivatives are continuous approximations of those of
+    /// the original function, except at discontinuities of the original function or of its derivatives.
+    double Approximate(const ChFunction& fun,
+                       double xmin,
+                       double xmax,
+                       double tol,
+                       Interpolation type = Interpolation::CUBIC,
+                       int max_points = 10000);
+
+    /// Return the number of tabulated points.
+    int GetNumPoints() const { return (int)m_x.size(); }
+
+    /// Return the interpolation method.
+    Interpolation GetInterpolation() const { return m_type; }
+
+    /// Return true if the tabulated abscissas are uniformly spaced.
+    bool IsUniform() const { return m_uniform; }
+
+    /// Return the tabulated abscissas.
+    const std::vector<double>& GetX() const { return m_x; }
+
+    /// Return the tabulated values.
+    const std::vector<double>& GetY() const { return m_y; }
+
+    virtual void Estimate_x_range(double& xmin, double& xmax) const override;
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  private:
+    /// Find the interval [x_i, x_{i+1}] containing x (clamped to the table range).
+    int FindInterval(double x) const;
+
+    /// Check for uniform spacing and calculate the polynomial coefficients of all intervals.
+    void Process();
+
+    Interpolation m_type;         ///< interpolation method
+    std::vector<double> m_x;      ///< tabulated abscissas
+    std::vector<double> m_y;      ///< tabulated values
+    std::vector<double> m_coefs;  ///< polynomial coefficients (4 per interval, in increasing powers of x-x_i)
+    bool m_uniform;               ///< true if uniformly spaced abscissas
+    double m_inv_dx;              ///< inverse of spacing (uniform abscissas only)
+};
+
+/// Table function of two variables:
+///
+/// z = bilinear interpolation of values tabulated on a rectilinear (x,y) grid.
+///
+/// Values are stored contiguously, in row-major order (z(i,j) at index i*ny+j). Lookup along each axis is O(1) for
+/// uniformly spaced abscissas and a binary search otherwise. Outside the grid, the arguments are clamped to the grid.
+class ChApi ChFunction_Table2D {
+  public:
+    ChFunction_Table2D();
+    ChFunction_Table2D(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z);
+    virtual ~ChFunction_Table2D() {}
+
+    /// Set the grid abscissas and the tabulated values (row-major, of size x.size()*y.size()).
+    /// The grid abscissas must be strictly increasing, with at least two values in each direction.
+    void Setup(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z);
+
+    /// Return the interpolated value at (x,y).
+    double Get_z(double x, double y) const;
+
+    /// Return the partial derivative with respect to x at (x,y).
+    double Get_z_dx(double x, double y) const;
+
+    /// Return the partial derivative with respect to y at (x,y).
+    double Get_z_dy(double x, double y) const;
+
+    /// Evaluate the function at all pairs (x(k), y(k)).
+    void Get_z_batch(const ChVectorDynamic<>& x, const ChVectorDynamic<>& y, ChVectorDynamic<>& z) const;
+
+    /// Return the number of grid points in x direction.
+    int GetNumPointsX() const { return (int)m_x.size(); }
+
+    /// Return the number of grid points in y direction.
+    int GetNumPointsY() const { return (int)m_y.size(); }
+
+    /// Return the grid abscissas in x direction.
+    const std::vector<double>& GetX() const { return m_x; }
+
+    /// Return the grid abscissas in y direction.
+    const std::vector<double>& GetY() const { return m_y; }
+
+    /// Return the tabulated values (row-major).
+    const std::vector<double>& GetZ() const { return m_z; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& marchive);
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& marchive);
+
+  private:
+    /// Locate the cell containing (x,y) and calculate the local coordinates in [0,1] within that cell.
+    void FindCell(double x, double y, int& i, int& j, double& u, double& v) const;
+
+    /// Calculate lookup data for the current grid.
+    void Process();
+
+    std::vector<double> m_x;  ///< grid abscissas in x direction
+    std::vector<double> m_y;  ///< grid abscissas in y direction
+    std::vector<double> m_z;  ///< tabulated values (row-major)
+    bool m_uniform_x;         ///< true if uniform spacing in x direction
+    bool m_uniform_y;         ///< true if uniform spacing in y direction
+    double m_inv_dx;          ///< inverse of spacing in x direction (if uniform)
+    double m_inv_dy;          ///< inverse of spacing in y direction (if uniform)
+};
+
+/// @} chrono_functions
+
+CH_CLASS_VERSION(ChFunction_Table, 0)
+CH_CLASS_VERSION(ChFunction_Table2D, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -19,6 +19,7 @@
 #include "chrono/core/ChTransform.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -47,8 +48,9 @@ ChAssembly::ChAssembly()
       nsysvars_w(0),
       ndof(0),
       ndoc_w_C(0),
-      ndoc_w_D(0)
-       {}
+      ndoc_w_D(0),
+      parallel_traversal(false),
+      min_items_per_thread(32) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -69,6 +71,8 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     ndof = other.ndof;
     nsysvars = other.nsysvars;
     nsysvars_w = other.nsysvars_w;
+    parallel_traversal = other.parallel_traversal;
+    min_items_per_thread = other.min_items_per_thread;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -110,6 +114,8 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.ndof, second.ndof);
     swap(first.nsysvars, second.nsysvars);
     swap(first.nsysvars_w, second.nsysvars_w);
+    swap(first.parallel_traversal, second.parallel_traversal);
+    swap(first.min_items_per_thread, second.min_items_per_thread);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -501,6 +507,18 @@ void ChAssembly::SetupInitial() {
     }
 }
 
+void ChAssembly::EnableParallelTraversal(bool val, int min_items) {
+    parallel_traversal = val;
+    min_items_per_thread = std::max(1, min_items);
+}
+
+int ChAssembly::GetTraversalThreads(size_t num_items) const {
+    if (!parallel_traversal || !system)
+        return 1;
+    auto nthreads = std::min<size_t>(system->nthreads_chrono, num_items / min_items_per_thread);
+    return std::max((int)nthreads, 1);
+}
+
 // Count all bodies, links, meshes, and other physics items.
 // Set counters (DOF, num constraints, etc) and offsets.
 void ChAssembly::Setup() {
@@ -638,16 +656,23 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
+    // Items in the body, shaft, and link lists only update their own data and can be processed in parallel.
+    // Other physics items and meshes (which have their own parallel loops) are always updated sequentially.
+    int nthreads = GetTraversalThreads(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
     for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
         bodylist[ip]->Update(ChTime, update_assets);
     }
+    nthreads = GetTraversalThreads(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
     for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
         shaftlist[ip]->Update(ChTime, update_assets);
     }
     for (int ip = 0; ip < (int)otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
+    nthreads = GetTraversalThreads(linklist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
     for (int ip = 0; ip < (int)linklist.size(); ++ip) {
         linklist[ip]->Update(ChTime, update_assets);
     }
@@ -682,17 +707,31 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Each item writes only to its own segments of x and v (offsets computed in Setup).
+    // Items in the body, shaft, and link lists can therefore be processed in parallel.
+    int nthreads = GetTraversalThreads(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+    nthreads = GetTraversalThreads(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+    nthreads = GetTraversalThreads(linklist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
+        double T_item;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -717,17 +756,25 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // 2. Order below is *important*
     //    - in particular, bodies and meshes must be processed *before* links, so that links can use
     //      up-to-date body and node information
+    // 3. With parallel traversal enabled, the items within each list are processed concurrently, but the lists
+    //    themselves are still processed in the order above.
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    int nthreads = GetTraversalThreads(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+    nthreads = GetTraversalThreads(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T, full_update);
         else
@@ -736,7 +783,10 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     for (auto& mesh : meshlist) {
         mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
     }
-    for (auto& link : linklist) {
+    nthreads = GetTraversalThreads(linklist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
@@ -920,17 +970,59 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts only load forces in their own segments of R
+    int nthreads = GetTraversalThreads(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+    nthreads = GetTraversalThreads(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
+
+    // Links load forces in the segments of the connected bodies, which may be shared by several links.
+    // In parallel, accumulate in per-thread buffers and reduce in thread order (deterministic for a given number of
+    // threads).
+    // The set of entries touched by a link is not known in general (motors and drivelines load into inner shafts), so
+    // the buffers span all of R. This costs O(threads x DOF) work per call, but each thread zeroes its own buffer and
+    // reduces one slice of R over all buffers, so the wall-clock overhead is O(DOF), the same order as the vector
+    // operations the integrator performs on R. Parallel traversal of links only kicks in with at least
+    // min_items_per_thread links per thread.
+    nthreads = GetTraversalThreads(linklist.size());
+    if (nthreads > 1) {
+        if ((int)residual_buffers.size() < nthreads)
+            residual_buffers.resize(nthreads);
+        const Eigen::Index size = R.size();
+#pragma omp parallel num_threads(nthreads)
+        {
+            auto& R_thread = residual_buffers[ChOMP::GetThreadNum()];
+            R_thread.setZero(size);
+#pragma omp for schedule(static)
+            for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+                auto& link = linklist[ip];
+                if (link->IsActive())
+                    link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R_thread, c);
+            }
+            // implicit barrier: all buffers are complete
+#pragma omp for schedule(static)
+            for (int is = 0; is < nthreads; ++is) {
+                Eigen::Index start = (size * is) / nthreads;
+                Eigen::Index len = (size * (is + 1)) / nthreads - start;
+                for (int it = 0; it < nthreads; ++it)
+                    R.segment(start, len) += residual_buffers[it].segment(start, len);
+            }
+        }
+    } else {
+        for (auto& link : linklist) {
+            if (link->IsActive())
+                link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
+        }
     }
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
@@ -1481,6 +1573,34 @@ void ChAssembly::ShowHierarchy(ChStreamOutAscii& m_file, int level) const {
     m_file << "\n\n";
 }
 
+void ChAssembly::WriteExtraState(std::ostream& stream) const {
+    for (auto& body : bodylist)
+        body->WriteExtraState(stream);
+    for (auto& shaft : shaftlist)
+        shaft->WriteExtraState(stream);
+    for (auto& link : linklist)
+        link->WriteExtraState(stream);
+    for (auto& mesh : meshlist)
+        mesh->WriteExtraState(stream);
+    for (auto& item : otherphysicslist)
+        item->WriteExtraState(stream);
+}
+
+void ChAssembly::ReadExtraState(std::istream& stream) {
+    for (auto& body : bodylist)
+        body->ReadExtraState(stream);
+    for (auto& shaft : shaftlist)
+        shaft->ReadExtraState(stream);
+    for (auto& link : linklist)
+        link->ReadExtraState(stream);
+    for (auto& mesh : meshlist)
+        mesh->ReadExtraState(stream);
+    for (auto& item : otherphysicslist)
+        item->ReadExtraState(stream);
+}
+
+// -----------------------------------------------------------------------------
+
 void ChAssembly::ArchiveOut(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChAssembly>();
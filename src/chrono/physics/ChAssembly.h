@@ -135,6 +135,19 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Search an item (body, link or other ChPhysics items) by name.
     std::shared_ptr<ChPhysicsItem> Search(const std::string& name) const;
 
+    /// Enable/disable parallel traversal of the bodies, shafts, and links in this assembly (default: false).
+    /// If enabled, item updates, state gather/scatter, and loading of generalized forces are performed in parallel over
+    /// each of these lists, using the number of threads set through ChSystem::SetNumThreads (num_threads_chrono). Lists
+    /// with fewer than 'min_items_per_thread' items per thread are traversed with fewer threads (or sequentially).
+    /// Meshes (which use their own parallel loops over elements) and other physics items are always processed
+    /// sequentially. The order in which the different lists are processed is not changed.\n
+    /// Only enable this if the Update() and IntLoadResidual_F() functions of all items, as well as any user callbacks
+    /// invoked from them (e.g., ChLinkTSDA force functors shared by multiple springs), are thread safe.
+    void EnableParallelTraversal(bool val, int min_items_per_thread = 32);
+
+    /// Return true if parallel traversal of the assembly items is enabled.
+    bool IsParallelTraversalEnabled() const { return parallel_traversal; }
+
     //
     // STATISTICS
     //
@@ -311,6 +324,12 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
 
+    /// Write the extra state data of all items in this assembly.
+    virtual void WriteExtraState(std::ostream& stream) const override;
+
+    /// Read the extra state data of all items in this assembly.
+    virtual void ReadExtraState(std::istream& stream) override;
+
     // SWAP FUNCTION
 
     /// Swap the contents of the two provided ChAssembly objects.
@@ -349,6 +368,14 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_C;    ///< number of scalar constraints C, when using 3 rot. dof. per body (excluding unilaterals)
     int ndoc_w_D;    ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
 
+    // Parallel traversal:
+    bool parallel_traversal;                          ///< traverse item lists in parallel
+    int min_items_per_thread;                         ///< minimum number of list items assigned to a thread
+    std::vector<ChVectorDynamic<>> residual_buffers;  ///< per-thread buffers for link generalized forces
+
+    /// Return the number of threads to use for traversing a list with the given number of items.
+    int GetTraversalThreads(size_t num_items) const;
+
     friend class ChSystem;
     friend class ChSystemMulticore;
     friend class ChSystemDistributed;
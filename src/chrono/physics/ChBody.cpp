@@ -1076,6 +1076,16 @@ void ChBody::ComputeNF(
 // ---------------------------------------------------------------------------
 // FILE I/O
 
+void ChBody::WriteExtraState(std::ostream& stream) const {
+    stream.write(reinterpret_cast<const char*>(coord_dt.rot.data()), 4 * sizeof(double));
+    stream.write(reinterpret_cast<const char*>(coord_dtdt.rot.data()), 4 * sizeof(double));
+}
+
+void ChBody::ReadExtraState(std::istream& stream) {
+    stream.read(reinterpret_cast<char*>(&coord_dt.rot.e0()), 4 * sizeof(double));
+    stream.read(reinterpret_cast<char*>(&coord_dtdt.rot.e0()), 4 * sizeof(double));
+}
+
 void ChBody::ArchiveOut(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChBody>();
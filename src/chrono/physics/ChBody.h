@@ -443,6 +443,13 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
 
+    /// Write the time derivatives of the body rotation quaternion.
+    /// These cannot be recovered exactly from the angular velocity and acceleration in the state vectors.
+    virtual void WriteExtraState(std::ostream& stream) const override;
+
+    /// Read the time derivatives of the body rotation quaternion.
+    virtual void ReadExtraState(std::istream& stream) override;
+
   public:
     // Public functions for ADVANCED use.
     // For example, access to these methods may be needed in implementing custom loads
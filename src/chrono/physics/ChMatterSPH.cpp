@@ -378,19 +378,22 @@ void ChMatterSPH::IntLoadResidual_F(
 
     // 1- Per-node initialization
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int j = 0; j < (int)nodes.size(); j++) {
         nodes[j]->UserForce = VNULL;
         nodes[j]->density = 0;
     }
 
-    // 2- Per-edge initialization and accumulation of particles's density
+    // 2- Per-edge initialization and accumulation of particles's density (parallel, if using a cell list)
 
     edges->AccumulateStep1();
 
     // 3- Per-node volume and pressure computation
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int j = 0; j < (int)nodes.size(); j++) {
+        const auto& mnode = nodes[j];
         assert(mnode);
 
         // node volume is v=mass/density
@@ -409,16 +412,19 @@ void ChMatterSPH::IntLoadResidual_F(
 
     // 5- Per-node load forces
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
+    ChVector<> G_acc = GetSystem()->Get_G_acc();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int j = 0; j < (int)nodes.size(); j++) {
         // particle gyroscopic force:
         // none.
 
         // add gravity
-        ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
+        ChVector<> Gforce = G_acc * nodes[j]->GetMass();
         ChVector<> TotForce = nodes[j]->UserForce + Gforce;
 
         // downcast
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
+        const auto& mnode = nodes[j];
         assert(mnode);
 
         R.segment(off + 3 * j, 3) += c * TotForce.eigen();
@@ -488,19 +494,22 @@ void ChMatterSPH::VariablesFbLoadForces(double factor) {
 
     // 1- Per-node initialization
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int j = 0; j < (int)nodes.size(); j++) {
         nodes[j]->UserForce = VNULL;
         nodes[j]->density = 0;
     }
 
-    // 2- Per-edge initialization and accumulation of particles's density
+    // 2- Per-edge initialization and accumulation of particles's density (parallel, if using a cell list)
 
     edges->AccumulateStep1();
 
     // 3- Per-node volume and pressure computation
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int j = 0; j < (int)nodes.size(); j++) {
+        const auto& mnode = nodes[j];
         assert(mnode);
 
         // node volume is v=mass/density
@@ -519,16 +528,19 @@ void ChMatterSPH::VariablesFbLoadForces(double factor) {
 
     // 5- Per-node load forces
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
+    ChVector<> G_acc = GetSystem()->Get_G_acc();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int j = 0; j < (int)nodes.size(); j++) {
         // particle gyroscopic force:
         // none.
 
         // add gravity
-        ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
+        ChVector<> Gforce = G_acc * nodes[j]->GetMass();
         ChVector<> TotForce = nodes[j]->UserForce + Gforce;
 
         // downcast
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
+        const auto& mnode = nodes[j];
         assert(mnode);
 
         mnode->variables.Get_fb() += factor * TotForce.eigen();
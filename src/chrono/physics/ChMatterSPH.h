@@ -262,6 +262,9 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
         return nodes[n];
     }
 
+    /// Access the list of SPH nodes.
+    const std::vector<std::shared_ptr<ChNodeSPH>>& GetNodes() const { return nodes; }
+
     /// Resize the node cluster. Also clear the state of
     /// previously created particles, if any.
     void ResizeNnodes(int newsize);
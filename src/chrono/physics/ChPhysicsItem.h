@@ -428,6 +428,14 @@ class ChApi ChPhysicsItem : public ChObj {
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
 
+    /// Write (in binary form) any internal data which is not part of the state vectors but is needed to continue the
+    /// simulation (e.g., contact history). Used to take a snapshot of the system state (see ChSystemSnapshot).
+    /// Children classes with such data must override both this function and ReadExtraState().
+    virtual void WriteExtraState(std::ostream& stream) const {}
+
+    /// Read the internal data written by WriteExtraState().
+    virtual void ReadExtraState(std::istream& stream) {}
+
   protected:
     ChSystem* system;  ///< parent system
 
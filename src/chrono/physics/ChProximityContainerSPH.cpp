@@ -12,7 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
-#include <list>
+#include <algorithm>
+#include <cmath>
 
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChMatterSPH.h"
@@ -27,59 +28,41 @@ using namespace geometry;
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChProximityContainerSPH)
 
-ChProximityContainerSPH::ChProximityContainerSPH() : n_added(0) {
-    lastproximity = proximitylist.begin();
-}
+ChProximityContainerSPH::ChProximityContainerSPH() : n_added(0), search(NeighborSearch::CELL_LIST) {}
 
 ChProximityContainerSPH::ChProximityContainerSPH(const ChProximityContainerSPH& other)
     : ChProximityContainer(other) {
-    n_added = other.n_added;
+    search = other.search;
     proximitylist = other.proximitylist;
-    lastproximity = proximitylist.begin();
+    n_added = (search == NeighborSearch::COLLISION_SYSTEM) ? other.n_added : 0;
 }
 
-ChProximityContainerSPH::~ChProximityContainerSPH() {
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        delete (*iterproximity);
-        (*iterproximity) = 0;
-        ++iterproximity;
-        // proximitylist.erase(iterproximity); //no! do later with clear(), all together
-    }
-    proximitylist.clear();
-
-    lastproximity = proximitylist.begin();
-    n_added = 0;
-}
+ChProximityContainerSPH::~ChProximityContainerSPH() {}
 
 void ChProximityContainerSPH::RemoveAllProximities() {
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        delete (*iterproximity);
-        (*iterproximity) = 0;
-        ++iterproximity;
-        // proximitylist.erase(iterproximity); //no! do later with clear(), all together
-    }
     proximitylist.clear();
-
-    lastproximity = proximitylist.begin();
+    p_node.clear();
+    cell_key.clear();
     n_added = 0;
 }
 
 void ChProximityContainerSPH::BeginAddProximities() {
-    lastproximity = proximitylist.begin();
-    n_added = 0;
+    // With a cell list, the pair count is set when the neighbors are searched
+    if (search == NeighborSearch::COLLISION_SYSTEM)
+        n_added = 0;
 }
 
 void ChProximityContainerSPH::EndAddProximities() {
-    // remove proximities that are beyond last proximity
-    while (lastproximity != proximitylist.end()) {
-        delete (*lastproximity);
-        lastproximity = proximitylist.erase(lastproximity);
-    }
+    // release memory if the array of pairs shrinks considerably
+    if (proximitylist.size() > 2 * (size_t)n_added + 1024)
+        proximitylist.erase(proximitylist.begin() + n_added, proximitylist.end());
 }
 
 void ChProximityContainerSPH::AddProximity(collision::ChCollisionModel* modA, collision::ChCollisionModel* modB) {
+    // Neighbors are found by the cell list
+    if (search == NeighborSearch::CELL_LIST)
+        return;
+
     // Fetch the frames of that proximity and other infos
 
     ChNodeSPH* mnA = dynamic_cast<ChNodeSPH*>(modA->GetContactable());
@@ -94,30 +77,179 @@ void ChProximityContainerSPH::AddProximity(collision::ChCollisionModel* modA, co
         this->add_proximity_callback->OnAddProximity(*modA, *modB);
     }
 
-    // %%%%%%% Create and add a ChProximitySPH object
+    // Reuse old proximity pairs or add new proximity
 
-    if (lastproximity != proximitylist.end()) {
-        // reuse old proximity pairs
-        (*lastproximity)->Reset(modA, modB);
+    if ((size_t)n_added < proximitylist.size())
+        proximitylist[n_added].Reset(modA, modB);
+    else
+        proximitylist.emplace_back(modA, modB);
+    n_added++;
+}
 
-        lastproximity++;
-    } else {
-        // add new proximity
-        ChProximitySPH* mp = new ChProximitySPH(modA, modB);
+void ChProximityContainerSPH::ReportAllProximities(ReportProximityCallback* mcallback) {
+    if (search == NeighborSearch::COLLISION_SYSTEM) {
+        for (int ip = 0; ip < n_added; ++ip) {
+            bool proceed = mcallback->OnReportProximity(proximitylist[ip].GetModelA(), proximitylist[ip].GetModelB());
+            if (!proceed)
+                break;
+        }
+        return;
+    }
 
-        proximitylist.push_back(mp);
-        lastproximity = proximitylist.end();
+    // Report each pair found at the last cell list search once
+    bool proceed = true;
+    for (int i = 0; i < (int)p_node.size() && proceed; i++) {
+        ForEachNeighbor(i, [&](int, int j, double, double, double, double, double) {
+            if (proceed && j > i)
+                proceed = mcallback->OnReportProximity(p_node[i]->collision_model, p_node[j]->collision_model);
+        });
     }
-    n_added++;
 }
 
-void ChProximityContainerSPH::ReportAllProximities(ReportProximityCallback* mcallback) {
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        bool proceed = mcallback->OnReportProximity((*iterproximity)->GetModelA(), (*iterproximity)->GetModelB());
-        if (!proceed)
-            break;
-        ++iterproximity;
+// -----------------------------------------------------------------------------
+// Cell list neighbor search
+
+// Spread the lower 21 bits of the given value, inserting two zero bits between them.
+static inline uint64_t SpreadBits(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffffULL;
+    v = (v | v << 16) & 0x1f0000ff0000ffULL;
+    v = (v | v << 8) & 0x100f00f00f00f00fULL;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v << 2) & 0x1249249249249249ULL;
+    return v;
+}
+
+// Z-order (Morton) key of the cell with given integer coordinates.
+static inline uint64_t CellKey(uint64_t ix, uint64_t iy, uint64_t iz) {
+    return SpreadBits(ix) | (SpreadBits(iy) << 1) | (SpreadBits(iz) << 2);
+}
+
+void ChProximityContainerSPH::BuildCellList() {
+    // Collect all SPH nodes in the system
+    p_node.clear();
+    for (const auto& item : GetSystem()->Get_otherphysicslist()) {
+        if (auto matter = std::dynamic_pointer_cast<ChMatterSPH>(item)) {
+            for (const auto& node : matter->GetNodes())
+                p_node.push_back(node.get());
+        }
+    }
+    int num_particles = (int)p_node.size();
+    cell_key.clear();
+    cell_start.clear();
+    cell_neighbors.clear();
+    if (num_particles == 0)
+        return;
+
+    // Grid extent and cell size (at least the largest kernel radius, so that all neighbors are in adjacent cells)
+    ChVector<> pmin(+1e300), pmax(-1e300);
+    double hmax = 0;
+    for (auto node : p_node) {
+        pmin = Vmin(pmin, node->pos);
+        pmax = Vmax(pmax, node->pos);
+        hmax = std::max(hmax, node->GetKernelRadius());
+    }
+    const uint64_t max_cells = (1 << 21) - 1;
+    double cell_size = std::max(hmax, (pmax - pmin).LengthInf() / max_cells);
+    if (cell_size <= 0)
+        cell_size = 1;
+
+    // Sort particles along the Z-order curve of their cells
+    std::vector<std::pair<uint64_t, int>> keys(num_particles);
+    for (int i = 0; i < num_particles; i++) {
+        ChVector<> c = (p_node[i]->pos - pmin) / cell_size;
+        keys[i].first = CellKey(std::min((uint64_t)c.x(), max_cells), std::min((uint64_t)c.y(), max_cells),
+                                std::min((uint64_t)c.z(), max_cells));
+        keys[i].second = i;
+    }
+    std::sort(keys.begin(), keys.end());
+
+    // Load particle data in contiguous arrays, in sorted order
+    std::vector<ChNodeSPH*> nodes(num_particles);
+    p_x.resize(num_particles);
+    p_y.resize(num_particles);
+    p_z.resize(num_particles);
+    p_vx.resize(num_particles);
+    p_vy.resize(num_particles);
+    p_vz.resize(num_particles);
+    p_mass.resize(num_particles);
+    p_h.resize(num_particles);
+    p_visc.resize(num_particles);
+    p_volume.resize(num_particles);
+    p_pressure.resize(num_particles);
+    p_cell.resize(num_particles);
+    for (int i = 0; i < num_particles; i++) {
+        ChNodeSPH* node = p_node[keys[i].second];
+        nodes[i] = node;
+        p_x[i] = node->pos.x();
+        p_y[i] = node->pos.y();
+        p_z[i] = node->pos.z();
+        p_vx[i] = node->pos_dt.x();
+        p_vy[i] = node->pos_dt.y();
+        p_vz[i] = node->pos_dt.z();
+        p_mass[i] = node->GetMass();
+        p_h[i] = node->GetKernelRadius();
+        p_visc[i] = node->GetContainer()->GetMaterial().Get_viscosity();
+
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            cell_key.push_back(keys[i].first);
+            cell_start.push_back(i);
+        }
+        p_cell[i] = (int)cell_key.size() - 1;
+    }
+    p_node.swap(nodes);
+    int num_cells = (int)cell_key.size();
+    cell_start.push_back(num_particles);
+
+    // Find the non-empty adjacent cells of each cell
+    cell_neighbors.resize(27 * num_cells);
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1 && num_cells > 1000)
+    for (int ic = 0; ic < num_cells; ic++) {
+        ChNodeSPH* node = p_node[cell_start[ic]];
+        ChVector<> c = (node->pos - pmin) / cell_size;
+        int64_t ix = std::min((int64_t)c.x(), (int64_t)max_cells);
+        int64_t iy = std::min((int64_t)c.y(), (int64_t)max_cells);
+        int64_t iz = std::min((int64_t)c.z(), (int64_t)max_cells);
+        int k = 27 * ic;
+        for (int64_t dx = -1; dx <= 1; dx++) {
+            for (int64_t dy = -1; dy <= 1; dy++) {
+                for (int64_t dz = -1; dz <= 1; dz++) {
+                    int64_t jx = ix + dx, jy = iy + dy, jz = iz + dz;
+                    int neighbor = -1;
+                    if (jx >= 0 && jy >= 0 && jz >= 0 && jx <= (int64_t)max_cells && jy <= (int64_t)max_cells &&
+                        jz <= (int64_t)max_cells) {
+                        uint64_t key = CellKey(jx, jy, jz);
+                        auto it = std::lower_bound(cell_key.begin(), cell_key.end(), key);
+                        if (it != cell_key.end() && *it == key)
+                            neighbor = (int)(it - cell_key.begin());
+                    }
+                    cell_neighbors[k++] = neighbor;
+                }
+            }
+        }
+    }
+}
+
+template <typename Function>
+void ChProximityContainerSPH::ForEachNeighbor(int i, Function f) const {
+    const int* neighbors = &cell_neighbors[27 * p_cell[i]];
+    for (int k = 0; k < 27; k++) {
+        int nc = neighbors[k];
+        if (nc < 0)
+            continue;
+        for (int j = cell_start[nc]; j < cell_start[nc + 1]; j++) {
+            if (j == i)
+                continue;
+            double rx = p_x[j] - p_x[i];
+            double ry = p_y[j] - p_y[i];
+            double rz = p_z[j] - p_z[i];
+            double dist2 = rx * rx + ry * ry + rz * rz;
+            // Symmetric kernel radius of the pair (COLLISION_SYSTEM uses the radius of the first node of each pair)
+            double h = 0.5 * (p_h[i] + p_h[j]);
+            if (dist2 < h * h)
+                f(i, j, rx, ry, rz, std::sqrt(dist2), h);
+        }
     }
 }
 
@@ -125,32 +257,57 @@ void ChProximityContainerSPH::ReportAllProximities(ReportProximityCallback* mcal
 
 static double W_poly6(double r, double h) {
     if (r < h) {
-        return (315.0 / (64.0 * CH_C_PI * pow(h, 9))) * pow((h * h - r * r), 3);
+        double h2 = h * h;
+        double h3 = h2 * h;
+        double d = h2 - r * r;
+        return (315.0 / (64.0 * CH_C_PI * h3 * h3 * h3)) * (d * d * d);
     } else
         return 0;
 }
 
 static double W_sq_visco(double r, double h) {
     if (r < h) {
-        return (45.0 / (CH_C_PI * pow(h, 6))) * (h - r);
+        double h3 = h * h * h;
+        return (45.0 / (CH_C_PI * h3 * h3)) * (h - r);
     } else
         return 0;
 }
 
 static void W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_length, const double h) {
     if (r_length < h) {
+        double h3 = h * h * h;
         Wresult = r;
-        Wresult *= -(45.0 / (CH_C_PI * pow(h, 6))) * pow((h - r_length), 2.0);
+        Wresult *= -(45.0 / (CH_C_PI * h3 * h3)) * (h - r_length) * (h - r_length);
     } else
         Wresult = VNULL;
 }
 
 void ChProximityContainerSPH::AccumulateStep1() {
+    if (search == NeighborSearch::CELL_LIST) {
+        // Find neighbors at the current positions, then accumulate density contributions of neighbors in each node.
+        // Each node is only written by the thread processing it, so that no synchronization is needed.
+        BuildCellList();
+
+        int num_particles = (int)p_node.size();
+        int num_pairs = 0;
+        int nthreads = GetSystem()->GetNumThreadsChrono();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1) reduction(+ : num_pairs)
+        for (int i = 0; i < num_particles; i++) {
+            double density = 0;
+            ForEachNeighbor(i, [&](int, int j, double, double, double, double dist, double h) {
+                density += p_mass[j] * W_poly6(dist, h);
+                num_pairs++;
+            });
+            p_node[i]->density += density;
+        }
+        n_added = num_pairs / 2;
+        return;
+    }
+
     // Per-edge data computation
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeSPH* mnodeA = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeSPH* mnodeB = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelB()->GetContactable());
+    for (int ip = 0; ip < n_added; ++ip) {
+        ChNodeSPH* mnodeA = static_cast<ChNodeSPH*>(proximitylist[ip].GetModelA()->GetContactable());
+        ChNodeSPH* mnodeB = static_cast<ChNodeSPH*>(proximitylist[ip].GetModelB()->GetContactable());
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -164,17 +321,45 @@ void ChProximityContainerSPH::AccumulateStep1() {
 
         mnodeA->density += mnodeB->GetMass() * W_k_poly6;
         mnodeB->density += mnodeA->GetMass() * W_k_poly6;
-
-        ++iterproximity;
     }
 }
 
 void ChProximityContainerSPH::AccumulateStep2() {
+    if (search == NeighborSearch::CELL_LIST) {
+        // Use the neighbors found in AccumulateStep1 (same positions); load the current volumes and pressures, then
+        // accumulate pressure and viscous forces from neighbors in each node.
+        int num_particles = (int)p_node.size();
+        for (int i = 0; i < num_particles; i++) {
+            p_volume[i] = p_node[i]->volume;
+            p_pressure[i] = p_node[i]->pressure;
+        }
+
+        int nthreads = GetSystem()->GetNumThreadsChrono();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+        for (int i = 0; i < num_particles; i++) {
+            ChVector<> force(VNULL);
+            ForEachNeighbor(i, [&](int, int j, double rx, double ry, double rz, double dist, double h) {
+                // pressure force
+                ChVector<> W_k_press;
+                W_gr_press(W_k_press, ChVector<>(rx, ry, rz), dist, h);
+                double avg_press = 0.5 * (p_pressure[i] + p_pressure[j]);
+                force += W_k_press * (p_volume[i] * avg_press * p_volume[j]);
+
+                // viscous force
+                double W_k_visc = W_sq_visco(dist, h);
+                double avg_viscosity = 0.5 * (p_visc[i] + p_visc[j]);
+                ChVector<> velBA(p_vx[j] - p_vx[i], p_vy[j] - p_vy[i], p_vz[j] - p_vz[i]);
+                force += velBA * (p_volume[i] * avg_viscosity * p_volume[j] * W_k_visc);
+            });
+            p_node[i]->UserForce += force;
+        }
+        return;
+    }
+
     // Per-edge data computation (transfer stress to forces)
-    std::list<ChProximitySPH*>::iterator iterproximity = proximitylist.begin();
-    while (iterproximity != proximitylist.end()) {
-        ChNodeSPH* mnodeA = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelA()->GetContactable());
-        ChNodeSPH* mnodeB = dynamic_cast<ChNodeSPH*>((*iterproximity)->GetModelB()->GetContactable());
+    for (int ip = 0; ip < n_added; ++ip) {
+        ChNodeSPH* mnodeA = static_cast<ChNodeSPH*>(proximitylist[ip].GetModelA()->GetContactable());
+        ChNodeSPH* mnodeB = static_cast<ChNodeSPH*>(proximitylist[ip].GetModelB()->GetContactable());
 
         ChVector<> x_A = mnodeA->GetPos();
         ChVector<> x_B = mnodeB->GetPos();
@@ -206,8 +391,6 @@ void ChProximityContainerSPH::AccumulateStep2() {
         ChVector<> viscforceBA = velBA * (mnodeA->volume * avg_viscosity * mnodeB->volume * W_k_visc);
         mnodeA->UserForce += viscforceBA;
         mnodeB->UserForce -= viscforceBA;
-
-        ++iterproximity;
     }
 }
 
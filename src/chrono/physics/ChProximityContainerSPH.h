@@ -15,12 +15,16 @@
 #ifndef CHPROXIMITYCONTAINERSPH_H
 #define CHPROXIMITYCONTAINERSPH_H
 
-#include <list>
+#include <cstdint>
+#include <vector>
 
 #include "chrono/physics/ChProximityContainer.h"
 
 namespace chrono {
 
+// Forward references
+class ChNodeSPH;
+
 /// Class for a proximity pair information in a SPH cluster
 /// of particles - that is, an 'edge' topological connectivity in
 /// in a meshless FEA approach, like the Smoothed Particle Hydrodynamics.
@@ -57,16 +61,46 @@ class ChApi ChProximitySPH {
 };
 
 /// Class for container of many proximity pairs for SPH (Smooth
-/// Particle Hydrodynamics and similar meshless force computations),
-/// as CPU typical linked list of ChProximitySPH objects.
-
+/// Particle Hydrodynamics and similar meshless force computations).
+/// Two neighbor search methods are available:
+/// - CELL_LIST (default): the container gathers all SPH nodes in the system (from all ChMatterSPH items) into
+///   contiguous arrays, sorts them along a Z-order curve of a uniform grid with cell size equal to the largest kernel
+///   radius, and finds neighbors by scanning the 27 adjacent cells. Neighbors are recomputed at each force evaluation
+///   and the per-particle density and force loops are multithreaded (using the number of Chrono threads set for the
+///   containing system). Proximity pairs reported by the collision system are ignored, so that collision detection
+///   for the SPH nodes (see ChMatterSPH::SetCollide) is only needed for contacts with other objects.
+///   The kernels of a pair of nodes are evaluated with the mean of their kernel radii, while COLLISION_SYSTEM uses
+///   the kernel radius of the first node of the pair (which depends on the order in which the collision system
+///   reports pairs). Both methods give the same results if all SPH nodes have the same kernel radius.
+/// - COLLISION_SYSTEM: proximity pairs are provided by the collision system (from the bounding boxes of the node
+///   collision models) and stored in a contiguous array; the accumulation loops are serial.
 class ChApi ChProximityContainerSPH : public ChProximityContainer {
+  public:
+    /// Method used to find pairs of interacting SPH nodes.
+    enum class NeighborSearch {
+        CELL_LIST,        ///< sorted cell list over all SPH nodes in the system
+        COLLISION_SYSTEM  ///< proximity pairs reported by the collision system
+    };
 
   protected:
-    std::list<ChProximitySPH*> proximitylist;
-    std::list<ChProximitySPH*>::iterator lastproximity;
+    std::vector<ChProximitySPH> proximitylist;  ///< proximity pairs (COLLISION_SYSTEM), only first n_added are valid
     int n_added;
 
+    NeighborSearch search;
+
+    // Particle data, in Z-order (CELL_LIST)
+    std::vector<ChNodeSPH*> p_node;
+    std::vector<double> p_x, p_y, p_z;
+    std::vector<double> p_vx, p_vy, p_vz;
+    std::vector<double> p_mass, p_h, p_visc;
+    std::vector<double> p_volume, p_pressure;
+    std::vector<int> p_cell;
+
+    // Cell list (CELL_LIST)
+    std::vector<uint64_t> cell_key;   ///< Z-order keys of non-empty cells (sorted)
+    std::vector<int> cell_start;      ///< index of first particle in each cell (plus end marker)
+    std::vector<int> cell_neighbors;  ///< indices of non-empty adjacent cells (27 per cell, -1 if empty)
+
   public:
     ChProximityContainerSPH();
     ChProximityContainerSPH(const ChProximityContainerSPH& other);
@@ -75,7 +109,14 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
     /// "Virtual" copy constructor (covariant return type).
     virtual ChProximityContainerSPH* Clone() const override { return new ChProximityContainerSPH(*this); }
 
-    /// Tell the number of added contacts
+    /// Set the method used to find interacting SPH nodes (default: CELL_LIST).
+    void SetNeighborSearch(NeighborSearch method) { search = method; }
+
+    /// Return the method used to find interacting SPH nodes.
+    NeighborSearch GetNeighborSearch() const { return search; }
+
+    /// Tell the number of proximity pairs.
+    /// With CELL_LIST, this is the number of pairs of nodes closer than their kernel radius at the last evaluation.
     virtual int GetNproximities() const override { return n_added; }
 
     /// Remove (delete) all contained contact data.
@@ -83,9 +124,8 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
 
     /// The collision system will call BeginAddProximities() before adding
     /// all pairs (for example with AddProximity() or similar). Instead of
-    /// simply deleting all list of the previous pairs, this optimized implementation
-    /// rewinds the link iterator to begin and tries to reuse previous pairs objects
-    /// until possible, to avoid too much allocation/deallocation.
+    /// simply deleting all previous pairs, this optimized implementation
+    /// rewinds to the beginning of the pair array and reuses its storage.
     virtual void BeginAddProximities() override;
 
     /// Add a proximity SPH data between two collision models, if possible.
@@ -93,9 +133,8 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
                               collision::ChCollisionModel* modB   ///< get contact model 2
                               ) override;
 
-    /// The collision system will call BeginAddContact() after adding
-    /// all contacts (for example with AddContact() or similar). This optimized version
-    /// purges the end of the list of contacts that were not reused (if any).
+    /// The collision system will call EndAddProximities() after adding
+    /// all pairs (for example with AddProximity() or similar).
     virtual void EndAddProximities() override;
 
     /// Scans all the proximity pairs and, for each pair, executes the OnReportProximity()
@@ -103,11 +142,11 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
     virtual void ReportAllProximities(ReportProximityCallback* mcallback) override;
 
     // Perform some SPH per-edge initializations and accumulations of values
-    // into the connected pairs of particles (summation into particle's  J, Amoment, m_v, UserForce -viscous only- )
+    // into the connected pairs of particles (summation into particle's density)
     // Will be called by the ChMatterSPH item.
     void AccumulateStep1();
 
-    // Perform some SPH per-edge transfer of forces, given stress tensors in A B nodes
+    // Perform some SPH per-edge transfer of forces, given pressures and volumes in A B nodes
     // Will be called by the ChMatterSPH item.
     void AccumulateStep2();
 
@@ -120,6 +159,15 @@ class ChApi ChProximityContainerSPH : public ChProximityContainer {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& marchive) override;
+
+  private:
+    /// Gather all SPH nodes in the system, sort them in Z-order and build the cell list.
+    void BuildCellList();
+
+    /// Loop over all pairs of neighbor particles (i,j), i != j, with distance less than their average kernel radius.
+    /// The functor is called as f(i, j, rx, ry, rz, dist, h) with r = x_j - x_i; each pair is visited twice.
+    template <typename Function>
+    void ForEachNeighbor(int i, Function f) const;
 };
 
 }  // end namespace chrono
@@ -13,6 +13,8 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
@@ -66,6 +68,7 @@ ChSystem::ChSystem()
       setupcount(0),
       solvecount(0),
       write_matrix(false),
+      matrix_free_krm(false),
       ncontacts(0),
       composition_strategy(new ChMaterialCompositionStrategy),
       visual_system(nullptr),
@@ -107,6 +110,7 @@ ChSystem::ChSystem(const ChSystem& other) {
     setupcount = other.setupcount;
     write_matrix = other.write_matrix;
     output_dir = other.output_dir;
+    matrix_free_krm = other.matrix_free_krm;
     SetTimestepperType(other.GetTimestepperType());
     tol_force = other.tol_force;
     nthreads_chrono = other.nthreads_chrono;
@@ -623,11 +627,20 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& mdescriptor) {
 
     InjectConstraints(mdescriptor);
     InjectVariables(mdescriptor);
-    InjectKRMmatrices(mdescriptor);
+
+    // With matrix-free products, the K and R terms are not stored in the descriptor
+    if (!UseMatrixFreeKRM())
+        InjectKRMmatrices(mdescriptor);
 
     mdescriptor.EndInsertion();
 }
 
+bool ChSystem::UseMatrixFreeKRM() const {
+    // MINRES relies on the symmetry of the system matrix, which finite-difference products do not preserve exactly
+    return matrix_free_krm && std::dynamic_pointer_cast<ChIterativeSolverLS>(solver) != nullptr &&
+           std::dynamic_pointer_cast<ChSolverMINRES>(solver) == nullptr;
+}
+
 // -----------------------------------------------------------------------------
 
 // SETUP
@@ -916,6 +929,136 @@ void ChSystem::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     contact_container->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
 }
 
+// -----------------------------------------------------------------------------
+//  MATRIX-FREE KRM PRODUCTS
+// -----------------------------------------------------------------------------
+
+// Callback for matrix-free products with the Newton matrix
+//    G = c_a*M + c_v*dF/dv + c_x*dF/dx
+// The product [c_v*dF/dv + c_x*dF/dx]*w is approximated with a forward finite difference of the generalized forces
+// along the direction w, i.e. [F(x + eps*c_x*w, v + eps*c_v*w) - F(x, v)] / eps. The product c_a*M*w is obtained
+// through LoadResidual_Mv, so that element mass matrices need not be stored either. Since the mass of the ChVariables
+// objects is also applied by the system descriptor, that contribution is subtracted here.
+// Each product requires one state scatter (with update) and one evaluation of the generalized forces, both of which are
+// O(DOF), but no element matrices are ever assembled or stored.
+class ChSystem::MatrixFreeKRM : public ChSystemDescriptor::KRMProductCallback {
+  public:
+    MatrixFreeKRM(ChSystem* sys) : m_sys(sys), m_T(0), m_ca(0), m_cv(0), m_cx(0), m_scale(0) {}
+
+    // Cache the linearization point, the generalized forces at this point, and the map from entries in a state
+    // increment to unknowns in the system descriptor.
+    // Note that this function overwrites the 'qb' vectors of all variables objects in the system descriptor.
+    void Setup(const ChState& x, const ChStateDelta& v, double T, double c_a, double c_v, double c_x) {
+        m_x0 = x;
+        m_v0 = v;
+        m_T = T;
+        m_ca = c_a;
+        m_cv = c_v;
+        m_cx = c_x;
+
+        if (c_v || c_x) {
+            m_F0.setZero(m_sys->GetNcoords_v());
+            m_sys->LoadResidual_F(m_F0, 1.0);
+            m_scale = std::sqrt(std::numeric_limits<double>::epsilon()) *
+                      (1 + std::sqrt(m_x0.squaredNorm() + m_v0.squaredNorm())) / std::sqrt(c_v * c_v + c_x * c_x);
+        }
+
+        // Load the index of each descriptor unknown in the variables objects and extract them in state ordering.
+        // Entries not associated with an active variables object are marked with -1.
+        auto descriptor = m_sys->GetSystemDescriptor();
+        int n_q = descriptor->CountActiveVariables();
+        for (auto var : descriptor->GetVariablesList())
+            var->Get_qb().setConstant(-1);
+        ChVectorDynamic<> index(n_q);
+        for (int i = 0; i < n_q; i++)
+            index(i) = i;
+        descriptor->FromVectorToVariables(index);
+
+        ChStateDelta v_index(m_sys->GetNcoords_v(), m_sys);
+        ChVectorDynamic<> L_index(m_sys->GetNconstr());
+        v_index.setConstant(-1);
+        m_sys->IntFromDescriptor(0, v_index, 0, L_index);
+
+        m_map.resize(v_index.size());
+        for (int k = 0; k < v_index.size(); k++)
+            m_map[k] = (int)std::lround(v_index(k));
+
+        for (auto var : descriptor->GetVariablesList())
+            var->Get_qb().setZero();
+    }
+
+    // Scatter the cached linearization point back to the system.
+    void Restore() {
+        if (m_cv || m_cx)
+            m_sys->StateScatter(m_x0, m_v0, m_T, false);
+    }
+
+    virtual void MultiplyAndAdd(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) override {
+        auto n = (int)m_map.size();
+
+        // Extract the direction w in state ordering
+        m_w.setZero(n, m_sys);
+        for (int k = 0; k < n; k++) {
+            if (m_map[k] >= 0)
+                m_w(k) = x(m_map[k]);
+        }
+        double w_norm = m_w.norm();
+        if (w_norm == 0)
+            return;
+
+        m_Gw.setZero(n);
+
+        // Mass terms: c_a*M*w (less the contribution of the variables objects, already included by the descriptor)
+        if (m_ca) {
+            m_sys->LoadResidual_Mv(m_Gw, m_w, m_ca);
+            auto descriptor = m_sys->GetSystemDescriptor();
+            double c_a = descriptor->GetMassFactor();
+            for (auto var : descriptor->GetVariablesList()) {
+                if (var->IsActive())
+                    var->MultiplyAndAdd(result, x, -c_a);
+            }
+        }
+
+        // Stiffness and damping terms: directional derivative of the generalized forces
+        if (m_cv || m_cx) {
+            double eps = m_scale / w_norm;
+
+            m_xp.setZero(m_x0.size(), m_sys);
+            m_sys->StateIncrementX(m_xp, m_x0, m_w * (eps * m_cx));
+            m_vp = m_v0 + m_w * (eps * m_cv);
+            m_sys->StateScatter(m_xp, m_vp, m_T, false);
+
+            m_Fp.setZero(n);
+            m_sys->LoadResidual_F(m_Fp, 1.0);
+
+            m_Gw += (m_Fp - m_F0) / eps;
+        }
+
+        // Accumulate in descriptor ordering
+        for (int k = 0; k < n; k++) {
+            if (m_map[k] >= 0)
+                result(m_map[k]) += m_Gw(k);
+        }
+    }
+
+  private:
+    ChSystem* m_sys;
+    ChState m_x0;            // linearization point, x part
+    ChStateDelta m_v0;       // linearization point, v part
+    double m_T;              // time at linearization point
+    double m_ca;             // factor in c_a*M
+    double m_cv;             // factor in c_v*dF/dv
+    double m_cx;             // factor in c_x*dF/dx
+    double m_scale;          // scale of the finite-difference perturbation
+    ChVectorDynamic<> m_F0;  // generalized forces at linearization point
+    std::vector<int> m_map;  // descriptor index of each entry in a state increment (-1 if not active)
+    ChStateDelta m_w;        // product direction, in state ordering
+    ChState m_xp;            // perturbed state, x part
+    ChStateDelta m_vp;       // perturbed state, v part
+    ChVectorDynamic<> m_Fp;  // generalized forces at perturbed state
+    ChVectorDynamic<> m_Gw;  // product result, in state ordering
+};
+
 // -----------------------------------------------------------------------------
 //    TIMESTEPPER INTERFACE
 // -----------------------------------------------------------------------------
@@ -1050,6 +1193,16 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     if (force_state_scatter)
         StateScatter(x, v, T, full_update);
 
+    // If K and R terms are applied through matrix-free products, cache the current state and forces.
+    // Note: this must be done before loading the descriptor, as it temporarily overwrites the variables objects.
+    bool matrix_free = UseMatrixFreeKRM() && (c_a || c_v || c_x);
+    if (matrix_free) {
+        if (!krm_product)
+            krm_product = chrono_types::make_shared<MatrixFreeKRM>(this);
+        krm_product->Setup(x, v, T, c_a, c_v, c_x);
+        descriptor->RegisterKRMProductCallback(krm_product);
+    }
+
     // R and Qc vectors  --> solver sparse solver structures  (also sets L and Dv to warmstart)
     IntToDescriptor(0, Dv, R, 0, L, Qc);
 
@@ -1061,8 +1214,8 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
         // Cq  matrix
         ConstraintsLoadJacobians();
 
-        // G matrix: M, K, R components
-        if (c_a || c_v || c_x)
+        // G matrix: M, K, R components (unless applied through matrix-free products)
+        if (!matrix_free && (c_a || c_v || c_x))
             KRMmatricesLoad(-c_x, -c_v, c_a);
 
         // For ChVariable objects without a ChKblock, just use the 'a' coefficient
@@ -1101,8 +1254,10 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
         setupcount++;
-        if (!success)
+        if (!success) {
+            descriptor->RegisterKRMProductCallback(nullptr);
             return false;
+        }
     }
 
     // Solve the problem
@@ -1111,6 +1266,12 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     GetSolver()->Solve(*descriptor);
     timer_ls_solve.stop();
 
+    // Restore the system state perturbed during matrix-free products
+    if (matrix_free) {
+        descriptor->RegisterKRMProductCallback(nullptr);
+        krm_product->Restore();
+    }
+
     // Dv and L vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, L);
 
@@ -1351,6 +1512,10 @@ void ChSystem::DumpSystemMatrices(bool save_M, bool save_K, bool save_R, bool sa
     // Prepare lists of variables and constraints, if not already prepared.
     DescriptorPrepareInject(*descriptor);
 
+    // The K and R blocks are always needed here, even if matrix-free products are used during integration
+    if (UseMatrixFreeKRM())
+        InjectKRMmatrices(*descriptor);
+
     if (save_M) {
         ChSparseMatrix mM;
         this->GetMassMatrix(&mM);
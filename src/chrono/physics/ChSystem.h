@@ -197,6 +197,22 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Get the current value of the force-level tolerance (used with iterative solvers only).
     double GetSolverForceTolerance() const { return tol_force; }
 
+    /// Enable/disable matrix-free evaluation of the stiffness and damping terms in implicit integration (default:
+    /// false). If enabled, and if the current solver is one of the GMRES or BiCGSTAB iterative linear solvers, the
+    /// element K, R, and M matrices are neither loaded nor inserted in the system descriptor. Instead, their products
+    /// with the Krylov vectors are evaluated on the fly: the K and R terms as directional derivatives of the generalized
+    /// forces obtained through finite differences (Jacobian-free Newton-Krylov), the M terms through LoadResidual_Mv.
+    /// Memory use then scales with the number of DOFs only, at the cost of one state update and force evaluation per
+    /// solver iteration.\n
+    /// This setting is ignored with all other solvers, which then use the assembled system matrix. This includes
+    /// MINRES, which requires a symmetric operator: finite-difference products are only symmetric up to truncation and
+    /// round-off errors, which MINRES does not tolerate. Note also that preconditioners which use the K blocks (see
+    /// ChPreconditionerBlockJacobi) only see the mass terms in this mode.
+    void EnableMatrixFreeKRM(bool val) { matrix_free_krm = val; }
+
+    /// Return true if matrix-free evaluation of the stiffness and damping terms is enabled.
+    bool IsMatrixFreeKRMEnabled() const { return matrix_free_krm; }
+
     /// Instead of using the default 'system descriptor', you can create your own custom descriptor
     /// (inherited from ChSystemDescriptor) and plug it into the system using this function.
     void SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor);
@@ -225,8 +241,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and in the parallel traversal of the
+    ///                           assembly items (if enabled; see EnableParallelTraversal).
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -245,6 +262,12 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int GetNumthreadsCollision() const { return nthreads_collision; }
     int GetNumthreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable parallel traversal of the bodies, shafts, and links in the underlying assembly.
+    /// See ChAssembly::EnableParallelTraversal.
+    void EnableParallelTraversal(bool val, int min_items_per_thread = 32) {
+        assembly.EnableParallelTraversal(val, min_items_per_thread);
+    }
+
     //
     // DATABASE HANDLING
     //
@@ -478,6 +501,11 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Pushes all ChConstraints and ChVariables contained in links, bodies, etc. into the system descriptor.
     virtual void DescriptorPrepareInject(ChSystemDescriptor& mdescriptor);
 
+    /// Return true if the K and R terms must be applied through matrix-free products.
+    /// This is the case if matrix-free products were enabled and the current solver is an iterative linear solver other
+    /// than MINRES.
+    bool UseMatrixFreeKRM() const;
+
     // Note: SetupInitial need not be typically called by a user, so it is currently marked protected
     // (as it may need to be called by derived classes)
 
@@ -948,6 +976,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     bool write_matrix;       ///< write current system matrix to file(s); for debugging
     std::string output_dir;  ///< output directory for writing system matrices
 
+    class MatrixFreeKRM;
+    bool matrix_free_krm;                        ///< apply K and R terms through matrix-free products
+    std::shared_ptr<MatrixFreeKRM> krm_product;  ///< callback for matrix-free K and R products (created on demand)
+
     int ncontacts;  ///< total number of contacts
 
     collision::ChCollisionSystemType collision_system_type;                     ///< type of the collision engine
@@ -989,6 +1021,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     friend class ChContactContainerNSC;
     friend class ChContactContainerSMC;
 
+    friend class ChSystemSnapshot;
+
     friend class ChVisualSystem;
 
     friend class modal::ChModalAssembly;
@@ -0,0 +1,84 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Forking of the state of a running system into a set of sibling systems which
+// are then advanced concurrently.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+#include "chrono/physics/ChSystemFork.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+
+ChSystemFork::ChSystemFork() : m_num_threads(ChOMP::GetNumProcs()) {}
+
+void ChSystemFork::AddBranch(std::shared_ptr<ChSystem> sys) {
+    m_branches.push_back(sys);
+}
+
+void ChSystemFork::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+}
+
+void ChSystemFork::Fork(ChSystem& lead) {
+    m_snapshot.Save(lead);
+    Reset();
+}
+
+void ChSystemFork::Reset(int branch) {
+    m_snapshot.Restore(*m_branches[branch]);
+}
+
+void ChSystemFork::Reset() {
+    // Restore branches sequentially (system initialization may modify global settings)
+    for (auto& sys : m_branches)
+        m_snapshot.Restore(*sys);
+}
+
+void ChSystemFork::Advance(double duration, double step) {
+    int num_branches = GetNumBranches();
+    int num_steps = (int)std::round(duration / step);
+    int nthreads = std::min(m_num_threads, num_branches);
+
+    // Exceptions cannot propagate out of an OpenMP region; report the first one after all branches are done
+    std::exception_ptr error = nullptr;
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads) if (nthreads > 1)
+    for (int i = 0; i < num_branches; i++) {
+        try {
+            auto& sys = *m_branches[i];
+            for (int k = 0; k < num_steps; k++) {
+                if (m_callback)
+                    m_callback->OnStep(i, sys, step);
+                sys.DoStepDynamics(step);
+            }
+        } catch (...) {
+#pragma omp critical
+            {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}  // end namespace chrono
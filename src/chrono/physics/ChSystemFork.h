@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Forking of the state of a running system into a set of sibling systems which
+// are then advanced concurrently.
+//
+// =============================================================================
+
+#ifndef CH_SYSTEM_FORK_H
+#define CH_SYSTEM_FORK_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChSystemSnapshot.h"
+
+namespace chrono {
+
+/// Forking of the state of a running (lead) system into a set of branch systems.
+/// Branch systems must be constructed identically to the lead system (see ChSystemSnapshot). A fork copies the current
+/// state of the lead system into all branches, without re-creating or re-initializing the branch models, after which
+/// the branches can be advanced concurrently (e.g., to evaluate different controller settings from a common state).
+/// Branches are advanced in parallel with OpenMP, one branch per thread. Since each branch is a separate system, any
+/// data shared by the branches (e.g., through user callbacks) must be thread-safe.
+class ChApi ChSystemFork {
+  public:
+    /// Interface for a callback invoked before each step of a branch.
+    /// This can be used to apply branch-specific inputs (e.g., controller parameters) or to advance additional
+    /// subsystems associated with a branch (e.g., a vehicle driver). It is called concurrently for different branches.
+    class ChApi BranchCallback {
+      public:
+        virtual ~BranchCallback() {}
+
+        /// Called before advancing the specified branch by one step of the given size.
+        virtual void OnStep(int branch, ChSystem& sys, double step) = 0;
+    };
+
+    ChSystemFork();
+
+    /// Add a branch system.
+    /// The branch system must have the same topology as the lead system.
+    /// Branches should use a single thread for their internal computations (see ChSystem::SetNumThreads).
+    void AddBranch(std::shared_ptr<ChSystem> sys);
+
+    /// Get the number of branches.
+    int GetNumBranches() const { return (int)m_branches.size(); }
+
+    /// Get the specified branch system.
+    std::shared_ptr<ChSystem> GetBranch(int branch) const { return m_branches[branch]; }
+
+    /// Set the number of threads used to process branches (default: number of available processors).
+    void SetNumThreads(int num_threads);
+
+    /// Register a callback to be invoked before each step of each branch.
+    void RegisterBranchCallback(std::shared_ptr<BranchCallback> callback) { m_callback = callback; }
+
+    /// Copy the current state of the lead system into all branches.
+    void Fork(ChSystem& lead);
+
+    /// Copy the state of the last fork into the specified branch (e.g., to re-run a branch with different inputs).
+    void Reset(int branch);
+
+    /// Copy the state of the last fork into all branches.
+    void Reset();
+
+    /// Advance all branches by the specified duration, using the given step size.
+    /// The duration is rounded to the nearest multiple of the step size.
+    void Advance(double duration, double step);
+
+    /// Return the snapshot of the lead system state at the last fork.
+    const ChSystemSnapshot& GetSnapshot() const { return m_snapshot; }
+
+  private:
+    std::vector<std::shared_ptr<ChSystem>> m_branches;  ///< branch systems
+    std::shared_ptr<BranchCallback> m_callback;         ///< user callback invoked before each branch step
+    ChSystemSnapshot m_snapshot;                        ///< lead system state at last fork
+    int m_num_threads;                                  ///< number of threads for processing branches
+};
+
+}  // end namespace chrono
+
+#endif
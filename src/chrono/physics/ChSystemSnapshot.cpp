@@ -0,0 +1,246 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Binary snapshot of the complete dynamic state of a Chrono system.
+//
+// Snapshot layout:
+//   header (magic, version, problem sizes)
+//   time, step count
+//   x, v, a (system state vectors), L (assembly reactions)
+//   timestepper type and internal data (size-prefixed block)
+//   extra state of assembly items and contact container (size-prefixed blocks)
+//
+// =============================================================================
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+#include "chrono/physics/ChSystemSnapshot.h"
+
+namespace chrono {
+
+static const uint32_t snapshot_magic = 0x50414e53;  // "SNAP"
+static const uint32_t snapshot_version = 1;
+
+// Problem sizes used to check that a snapshot matches a system.
+struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t ncoords_x;
+    int64_t ncoords_v;
+    int64_t ndoc_w;
+    int64_t nbodies;
+    int64_t nlinks;
+    int64_t nmeshes;
+    int64_t nitems;
+
+    bool operator==(const SnapshotHeader& other) const {
+        return magic == other.magic && version == other.version && ncoords_x == other.ncoords_x &&
+               ncoords_v == other.ncoords_v && ndoc_w == other.ndoc_w && nbodies == other.nbodies &&
+               nlinks == other.nlinks && nmeshes == other.nmeshes && nitems == other.nitems;
+    }
+};
+
+template <typename T>
+static void WriteValue(std::ostream& stream, const T& val) {
+    stream.write(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <typename T>
+static void ReadValue(std::istream& stream, T& val) {
+    stream.read(reinterpret_cast<char*>(&val), sizeof(T));
+}
+
+static void WriteVector(std::ostream& stream, const ChVectorDynamic<>& vec) {
+    stream.write(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(double));
+}
+
+static void ReadVector(std::istream& stream, ChVectorDynamic<>& vec) {
+    stream.read(reinterpret_cast<char*>(vec.data()), vec.size() * sizeof(double));
+}
+
+// Write a block of data, prefixed by its size.
+static void WriteBlock(std::ostream& stream, const std::string& block) {
+    WriteValue(stream, (uint64_t)block.size());
+    stream.write(block.data(), block.size());
+}
+
+// Read a block of data written by WriteBlock.
+static std::string ReadBlock(std::istream& stream) {
+    uint64_t size = 0;
+    ReadValue(stream, size);
+    std::string block(size, '\0');
+    stream.read(&block[0], size);
+    return block;
+}
+
+static SnapshotHeader MakeHeader(const ChSystem& sys) {
+    const auto& assembly = sys.GetAssembly();
+    SnapshotHeader header;
+    header.magic = snapshot_magic;
+    header.version = snapshot_version;
+    header.ncoords_x = sys.GetNcoords();
+    header.ncoords_v = sys.GetNcoords_w();
+    header.ndoc_w = assembly.GetNdoc_w();
+    header.nbodies = assembly.GetNbodies();
+    header.nlinks = assembly.GetNlinks();
+    header.nmeshes = assembly.GetNmeshes();
+    header.nitems = assembly.GetNphysicsItems();
+    return header;
+}
+
+// Bring data cached between steps to a state which depends only on the current system state, so that the simulation
+// continues identically from the saved and from the restored state:
+// - constraint Jacobians (used at the beginning of a step by some integrators) are evaluated at the current state;
+// - persistent contact manifolds are discarded.
+static void ResetCachedData(ChSystem& sys) {
+    sys.ConstraintsLoadJacobians();
+    sys.GetCollisionSystem()->Clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemSnapshot::Save(ChSystem& sys) {
+    if (!sys.is_initialized)
+        sys.SetupInitial();
+    sys.Setup();
+    ResetCachedData(sys);
+
+    ChState x(sys.GetNcoords_x(), &sys);
+    ChStateDelta v(sys.GetNcoords_v(), &sys);
+    ChStateDelta a(sys.GetNcoords_v(), &sys);
+    ChVectorDynamic<> L(sys.assembly.GetNdoc_w());
+    double T;
+    sys.StateGather(x, v, T);
+    sys.StateGatherAcceleration(a);
+    sys.assembly.IntStateGatherReactions(0, L);
+
+    std::ostringstream stream(std::ios::binary);
+
+    WriteValue(stream, MakeHeader(sys));
+    WriteValue(stream, T);
+    WriteValue(stream, (uint64_t)sys.stepcount);
+    WriteVector(stream, x);
+    WriteVector(stream, v);
+    WriteVector(stream, a);
+    WriteVector(stream, L);
+
+    std::ostringstream ts_stream(std::ios::binary);
+    int ts_type = -1;
+    if (sys.timestepper) {
+        ts_type = static_cast<int>(sys.timestepper->GetType());
+        sys.timestepper->WriteState(ts_stream);
+    }
+    WriteValue(stream, ts_type);
+    WriteBlock(stream, ts_stream.str());
+
+    std::ostringstream assembly_stream(std::ios::binary);
+    sys.assembly.WriteExtraState(assembly_stream);
+    WriteBlock(stream, assembly_stream.str());
+
+    std::ostringstream contact_stream(std::ios::binary);
+    sys.contact_container->WriteExtraState(contact_stream);
+    WriteBlock(stream, contact_stream.str());
+
+    m_data = stream.str();
+    m_time = T;
+}
+
+void ChSystemSnapshot::Restore(ChSystem& sys) const {
+    if (m_data.empty())
+        throw ChException("ChSystemSnapshot: cannot restore an empty snapshot");
+
+    if (!sys.is_initialized)
+        sys.SetupInitial();
+    sys.Setup();
+
+    std::istringstream stream(m_data, std::ios::binary);
+
+    SnapshotHeader header;
+    ReadValue(stream, header);
+    if (!(header == MakeHeader(sys)))
+        throw ChException("ChSystemSnapshot: snapshot does not match the system");
+
+    double T;
+    uint64_t stepcount;
+    ChState x(sys.GetNcoords_x(), &sys);
+    ChStateDelta v(sys.GetNcoords_v(), &sys);
+    ChStateDelta a(sys.GetNcoords_v(), &sys);
+    ChVectorDynamic<> L(sys.assembly.GetNdoc_w());
+    ReadValue(stream, T);
+    ReadValue(stream, stepcount);
+    ReadVector(stream, x);
+    ReadVector(stream, v);
+    ReadVector(stream, a);
+    ReadVector(stream, L);
+
+    int ts_type;
+    ReadValue(stream, ts_type);
+    std::string ts_block = ReadBlock(stream);
+    std::string assembly_block = ReadBlock(stream);
+    std::string contact_block = ReadBlock(stream);
+    if (!stream)
+        throw ChException("ChSystemSnapshot: corrupted snapshot data");
+
+    int sys_ts_type = sys.timestepper ? static_cast<int>(sys.timestepper->GetType()) : -1;
+    if (ts_type != sys_ts_type)
+        throw ChException("ChSystemSnapshot: snapshot timestepper does not match the system timestepper");
+
+    sys.StateScatter(x, v, T, true);
+    sys.StateScatterAcceleration(a);
+    sys.assembly.IntStateScatterReactions(0, L);
+    sys.stepcount = (size_t)stepcount;
+
+    if (sys.timestepper) {
+        std::istringstream ts_stream(ts_block, std::ios::binary);
+        sys.timestepper->ReadState(ts_stream);
+    }
+
+    // The extra state of all items must be consumed exactly
+    std::istringstream assembly_stream(assembly_block, std::ios::binary);
+    sys.assembly.ReadExtraState(assembly_stream);
+    std::istringstream contact_stream(contact_block, std::ios::binary);
+    sys.contact_container->ReadExtraState(contact_stream);
+    if (!assembly_stream || assembly_stream.tellg() != (std::streampos)assembly_block.size() || !contact_stream ||
+        contact_stream.tellg() != (std::streampos)contact_block.size())
+        throw ChException("ChSystemSnapshot: extra state data does not match the system");
+
+    // Update all items with the restored extra state
+    sys.Update(false);
+    ResetCachedData(sys);
+    sys.applied_forces_current = false;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemSnapshot::Write(const std::string& filename) const {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile.good())
+        throw ChException("ChSystemSnapshot: cannot open file " + filename);
+    WriteValue(ofile, m_time);
+    WriteBlock(ofile, m_data);
+}
+
+void ChSystemSnapshot::Read(const std::string& filename) {
+    std::ifstream ifile(filename, std::ios::binary);
+    if (!ifile.good())
+        throw ChException("ChSystemSnapshot: cannot open file " + filename);
+    ReadValue(ifile, m_time);
+    m_data = ReadBlock(ifile);
+    if (!ifile)
+        throw ChException("ChSystemSnapshot: cannot read file " + filename);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,78 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Binary snapshot of the complete dynamic state of a Chrono system.
+//
+// =============================================================================
+
+#ifndef CH_SYSTEM_SNAPSHOT_H
+#define CH_SYSTEM_SNAPSHOT_H
+
+#include <string>
+
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+/// Binary snapshot of the complete dynamic state of a Chrono system.
+/// A snapshot includes the simulation time and step count, the system state vectors (positions, velocities,
+/// accelerations, and constraint reactions), the internal data of the timestepper carried over between steps, and any
+/// additional internal data of the physics items in the system (see ChPhysicsItem::WriteExtraState).
+/// A snapshot can only be restored into the same system or into a system with identical topology (i.e., constructed in
+/// the same way, with the same number and order of physics items). Restoring a snapshot and continuing the simulation
+/// reproduces the original simulation.
+/// Unlike the serialization through archives, a snapshot does not include the model definition and therefore is fast
+/// to take and restore, allowing for checkpointing, rollback, or re-running a simulation from an intermediate state.
+/// Notes:
+/// - contact reactions are not included (contacts are regenerated at the next step);
+/// - data cached between steps (constraint Jacobians, persistent contact manifolds) is refreshed both when a snapshot
+///   is taken and when it is restored, so that the simulation continues identically in both cases;
+/// - any physics item with internal data which is not part of its state must implement WriteExtraState and
+///   ReadExtraState for the restored simulation to be identical to the original one.
+class ChApi ChSystemSnapshot {
+  public:
+    ChSystemSnapshot() : m_time(0) {}
+
+    /// Take a snapshot of the current state of the given system.
+    /// If the system was not yet initialized, this function performs its initial setup.
+    /// Note that the cached data of the system is refreshed (see above).
+    void Save(ChSystem& sys);
+
+    /// Restore the state of the given system from this snapshot.
+    /// An exception is thrown if the snapshot is empty or if the system does not match the snapshot.
+    void Restore(ChSystem& sys) const;
+
+    /// Write this snapshot to the specified binary file.
+    void Write(const std::string& filename) const;
+
+    /// Read a snapshot from the specified binary file.
+    void Read(const std::string& filename);
+
+    /// Return true if this snapshot does not contain any data.
+    bool IsEmpty() const { return m_data.empty(); }
+
+    /// Return the simulation time at which the snapshot was taken.
+    double GetTime() const { return m_time; }
+
+    /// Return the size of the snapshot data (in bytes).
+    size_t GetSize() const { return m_data.size(); }
+
+  private:
+    std::string m_data;  ///< snapshot data
+    double m_time;       ///< simulation time of the snapshot
+};
+
+}  // end namespace chrono
+
+#endif
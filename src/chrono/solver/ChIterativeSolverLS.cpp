@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use one of the preconditioners in ChPreconditionerLS.
 //
 // Available solvers:
 //   GMRES
@@ -80,58 +80,60 @@ class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
     chrono::ChVectorDynamic<> m_vect;    // workspace for the result of the SPMV operation
 };
 
-/// Simple diagonal preconditioner
-class ChDiagonalPreconditioner {
+/// Wrapper for using a ChPreconditionerLS with the Eigen iterative solvers.
+class ChEigenPreconditioner {
     typedef double Scalar;
 
   public:
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChEigenPreconditioner() : m_N(0), m_precond(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
+    void Setup(Eigen::Index N, ChPreconditionerLS* precond) {
         m_N = N;
-        m_invdiag = &invdiag;
-        m_diag_precond = (invdiag.size() > 0);
+        m_precond = precond;
     }
 
     Eigen::Index rows() const { return m_N; }
     Eigen::Index cols() const { return m_N; }
 
     template <typename MatType>
-    ChDiagonalPreconditioner& analyzePattern(const MatType&) {
+    ChEigenPreconditioner& analyzePattern(const MatType&) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& factorize(const MatType& mat) {
+    ChEigenPreconditioner& factorize(const MatType& mat) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& compute(const MatType& mat) {
+    ChEigenPreconditioner& compute(const MatType& mat) {
         return *this;
     }
 
     template <typename Rhs, typename Dest>
     void _solve_impl(const Rhs& b, Dest& x) const {
-        if (m_diag_precond) {
-            x = m_invdiag->array() * b.array();
+        if (m_precond) {
+            m_b = b;
+            m_precond->Apply(m_b, m_x);
+            x = m_x;
         } else {
             x = b;
         }
     }
 
     template <typename Rhs>
-    inline const Eigen::Solve<ChDiagonalPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
-        return Eigen::Solve<ChDiagonalPreconditioner, Rhs>(*this, b.derived());
+    inline const Eigen::Solve<ChEigenPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
+        return Eigen::Solve<ChEigenPreconditioner, Rhs>(*this, b.derived());
     }
 
     Eigen::ComputationInfo info() { return Eigen::Success; }
 
   protected:
-    Eigen::Index m_N;                    // problem dimension
-    const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
-    bool m_diag_precond;                 // if false, no preconditioning
+    Eigen::Index m_N;               // problem dimension
+    ChPreconditionerLS* m_precond;  // preconditioner (if null, no preconditioning)
+    mutable ChVectorDynamic<> m_b;  // workspace for the preconditioner input
+    mutable ChVectorDynamic<> m_x;  // workspace for the preconditioner output
 };
 
 }  // namespace chrono
@@ -174,6 +176,7 @@ CH_FACTORY_REGISTER(ChSolverMINRES)
 
 ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
     m_spmv = new ChMatrixSPMV();
+    m_precond = chrono_types::make_shared<ChPreconditionerDiagonal>();
 }
 
 ChIterativeSolverLS::~ChIterativeSolverLS() {
@@ -187,15 +190,12 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Set up the SPMV wrapper
     m_spmv->Setup(dim, sysd);
 
-    // If needed, evaluate the inverse diagonal entries
-    if (m_use_precond) {
-        m_invdiag.resize(dim);
-        sysd.BuildDiagonalVector(m_invdiag);
-        for (int i = 0; i < dim; i++) {
-            if (std::abs(m_invdiag(i)) > 1e-9)
-                m_invdiag(i) = 1.0 / m_invdiag(i);
-            else
-                m_invdiag(i) = 1.0;
+    // If needed, set up the preconditioner
+    if (auto precond = ActivePreconditioner()) {
+        if (!precond->Setup(sysd)) {
+            if (verbose)
+                std::cout << "  Preconditioner setup failed" << std::endl;
+            return false;
         }
     }
 
@@ -215,6 +215,41 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     return result;
 }
 
+void ChIterativeSolverLS::SetPreconditionerType(ChPreconditionerLS::Type type) {
+    switch (type) {
+        case ChPreconditionerLS::Type::NONE:
+            m_precond = nullptr;
+            break;
+        case ChPreconditionerLS::Type::DIAGONAL:
+            m_precond = chrono_types::make_shared<ChPreconditionerDiagonal>();
+            break;
+        case ChPreconditionerLS::Type::BLOCK_JACOBI:
+            m_precond = chrono_types::make_shared<ChPreconditionerBlockJacobi>();
+            break;
+        case ChPreconditionerLS::Type::ILUT:
+            m_precond = chrono_types::make_shared<ChPreconditionerILUT>();
+            break;
+        case ChPreconditionerLS::Type::SCHUR:
+            m_precond = chrono_types::make_shared<ChPreconditionerSchur>();
+            break;
+        case ChPreconditionerLS::Type::CUSTOM:
+            // Do nothing if changing to a CUSTOM preconditioner (use SetPreconditioner)
+            return;
+    }
+    m_use_precond = (m_precond != nullptr);
+}
+
+void ChIterativeSolverLS::SetPreconditioner(std::shared_ptr<ChPreconditionerLS> precond) {
+    m_precond = precond;
+    m_use_precond = (m_precond != nullptr);
+}
+
+ChPreconditionerLS::Type ChIterativeSolverLS::GetPreconditionerType() const {
+    if (!m_use_precond || !m_precond)
+        return ChPreconditionerLS::Type::NONE;
+    return m_precond->GetType();
+}
+
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     // Assemble the problem right-hand side vector
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -243,7 +278,7 @@ double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
 // ---------------------------------------------------------------------------
 
 ChSolverGMRES::ChSolverGMRES() {
-    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChEigenPreconditioner>();
 }
 
 ChSolverGMRES::~ChSolverGMRES() {
@@ -251,7 +286,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_spmv->rows(), ActivePreconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -288,7 +323,7 @@ double ChSolverGMRES::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverBiCGSTAB::ChSolverBiCGSTAB() {
-    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChEigenPreconditioner>();
 }
 
 ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
@@ -296,7 +331,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_spmv->rows(), ActivePreconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -334,7 +369,7 @@ double ChSolverBiCGSTAB::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverMINRES::ChSolverMINRES() {
-    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChEigenPreconditioner>();
 }
 
 ChSolverMINRES::~ChSolverMINRES() {
@@ -342,7 +377,7 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_spmv->rows(), ActivePreconditioner());
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
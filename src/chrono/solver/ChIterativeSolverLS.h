@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use one of the preconditioners in ChPreconditionerLS.
 //
 // Available solvers:
 //   GMRES
@@ -27,8 +27,11 @@
 #ifndef CH_ITERATIVESOLVER_LS_H
 #define CH_ITERATIVESOLVER_LS_H
 
+#include <memory>
+
 #include "chrono/solver/ChSolverLS.h"
 #include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChPreconditionerLS.h"
 
 #include <Eigen/IterativeLinearSolvers>
 #include <unsupported/Eigen/IterativeSolvers>
@@ -40,9 +43,9 @@ namespace chrono {
 
 // ---------------------------------------------------------------------------
 
-// Forward declarations of wrapper class for SPMV operations and custom preconditioner
+// Forward declarations of wrapper classes for SPMV operations and preconditioning
 class ChMatrixSPMV;
-class ChDiagonalPreconditioner;
+class ChEigenPreconditioner;
 
 // ---------------------------------------------------------------------------
 
@@ -63,6 +66,10 @@ residual error: |Ax - b|/|b|. Default: machine precision.
 
 By default, these solvers use a diagonal preconditioner and no warm start. Recall that the warm start option should
 be used **only** in conjunction with the Euler implicit linearized integrator.
+
+A different preconditioner can be selected with #SetPreconditionerType (node-block Jacobi, ILUT, or a
+constraint-aware Schur preconditioner) or provided by the user through #SetPreconditioner. Preconditioning is disabled
+altogether with EnableDiagonalPreconditioner(false).
 */
 class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
   public:
@@ -77,9 +84,25 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     /// Return the maximum constraint violation after termination.
     virtual double Solve(ChSystemDescriptor& sysd) override;
 
+    /// Select one of the built-in preconditioners (default: DIAGONAL).
+    /// Setting ChPreconditionerLS::Type::NONE disables preconditioning.
+    void SetPreconditionerType(ChPreconditionerLS::Type type);
+
+    /// Set a user-provided preconditioner.
+    void SetPreconditioner(std::shared_ptr<ChPreconditionerLS> precond);
+
+    /// Return the type of the current preconditioner.
+    ChPreconditionerLS::Type GetPreconditionerType() const;
+
+    /// Access the current preconditioner (empty if preconditioning is disabled).
+    std::shared_ptr<ChPreconditionerLS> GetPreconditioner() const { return m_precond; }
+
   protected:
     ChIterativeSolverLS();
 
+    /// Return the preconditioner to be used in the current solve (nullptr if no preconditioning).
+    ChPreconditionerLS* ActivePreconditioner() const { return m_use_precond ? m_precond.get() : nullptr; }
+
     /// Indicate whether or not the #Solve() phase requires an up-to-date problem matrix.
     virtual bool SolveRequiresMatrix() const override final { return true; }
 
@@ -90,11 +113,11 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveProblem() = 0;
 
-    ChMatrixSPMV* m_spmv;                 ///< matrix-like wrapper for SPMV operations
-    ChVectorDynamic<double> m_sol;        ///< solution vector
-    ChVectorDynamic<double> m_rhs;        ///< right-hand side vector
-    ChVectorDynamic<double> m_invdiag;    ///< inverse diagonal entries (for preconditioning)
-    ChVectorDynamic<double> m_initguess;  ///< initial guess (for warm start)
+    ChMatrixSPMV* m_spmv;                           ///< matrix-like wrapper for SPMV operations
+    std::shared_ptr<ChPreconditionerLS> m_precond;  ///< preconditioner
+    ChVectorDynamic<double> m_sol;                  ///< solution vector
+    ChVectorDynamic<double> m_rhs;                  ///< right-hand side vector
+    ChVectorDynamic<double> m_initguess;            ///< initial guess (for warm start)
 };
 
 // ---------------------------------------------------------------------------
@@ -115,7 +138,7 @@ class ChApi ChSolverGMRES : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>* m_engine;
+    Eigen::GMRES<ChMatrixSPMV, ChEigenPreconditioner>* m_engine;
 };
 
 // ---------------------------------------------------------------------------
@@ -135,7 +158,7 @@ class ChApi ChSolverBiCGSTAB : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>* m_engine;
+    Eigen::BiCGSTAB<ChMatrixSPMV, ChEigenPreconditioner>* m_engine;
 };
 
 // ---------------------------------------------------------------------------
@@ -156,7 +179,7 @@ class ChApi ChSolverMINRES : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>* m_engine;
+    Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChEigenPreconditioner>* m_engine;
 };
 
 /// @} chrono_solver
@@ -0,0 +1,232 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Preconditioners for the Chrono iterative linear solvers (ChIterativeSolverLS).
+//
+// =============================================================================
+
+#include "chrono/solver/ChPreconditionerLS.h"
+#include "chrono/solver/ChKblockGeneric.h"
+
+#include <Eigen/LU>
+
+namespace chrono {
+
+// Threshold below which a diagonal entry is considered to be zero
+static const double zero_threshold = 1e-9;
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerDiagonal::Setup(ChSystemDescriptor& sysd) {
+    int dim = sysd.BuildDiagonalVector(m_invdiag);
+    for (int i = 0; i < dim; i++) {
+        if (std::abs(m_invdiag(i)) > zero_threshold)
+            m_invdiag(i) = 1.0 / m_invdiag(i);
+        else
+            m_invdiag(i) = 1.0;
+    }
+    return true;
+}
+
+void ChPreconditionerDiagonal::Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const {
+    x = m_invdiag.cwiseProduct(b);
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerBlockJacobi::Setup(ChSystemDescriptor& sysd) {
+    m_nq = sysd.CountActiveVariables();
+    m_nc = sysd.CountActiveConstraints();
+
+    const auto& vvariables = sysd.GetVariablesList();
+    const auto& vstiffness = sysd.GetKblocksList();
+    double c_a = sysd.GetMassFactor();
+
+    // Collect the active variables and their offsets; map each unknown to its owning block
+    std::vector<ChVariables*> variables;
+    variables.reserve(vvariables.size());
+    m_offsets.clear();
+    m_block_index.assign(m_nq, -1);
+    for (auto var : vvariables) {
+        if (var->IsActive() && var->Get_ndof() > 0) {
+            int iblock = (int)variables.size();
+            variables.push_back(var);
+            m_offsets.push_back(var->GetOffset());
+            for (int i = 0; i < var->Get_ndof(); i++)
+                m_block_index[var->GetOffset() + i] = iblock;
+        }
+    }
+
+    int nblocks = (int)variables.size();
+    std::vector<ChMatrixDynamic<>> blocks(nblocks);
+
+    // Mass contributions, obtained by applying the mass of each variables object to the unit vectors
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int ib = 0; ib < nblocks; ib++) {
+        int n = variables[ib]->Get_ndof();
+        blocks[ib].setZero(n, n);
+        ChVectorDynamic<> e = ChVectorDynamic<>::Zero(n);
+        ChVectorDynamic<> col(n);
+        for (int j = 0; j < n; j++) {
+            e(j) = 1;
+            col.setZero();
+            variables[ib]->Compute_inc_Mb_v(col, e);
+            blocks[ib].col(j) = c_a * col;
+            e(j) = 0;
+        }
+    }
+
+    // Stiffness/damping contributions (NON straight parallelizable - different K blocks may share variables).
+    // For generic K blocks, add the diagonal sub-block of each active variables object. For any other type of K
+    // block, only its diagonal can be accessed.
+    ChVectorDynamic<> kdiag;
+    for (auto kblock : vstiffness) {
+        if (auto kgeneric = dynamic_cast<ChKblockGeneric*>(kblock)) {
+            int kio = 0;
+            for (unsigned int iv = 0; iv < kgeneric->GetNvars(); iv++) {
+                auto var = kgeneric->GetVariableN(iv);
+                int in = var->Get_ndof();
+                if (var->IsActive() && in > 0) {
+                    int ib = m_block_index[var->GetOffset()];
+                    blocks[ib] += kgeneric->Get_K().block(kio, kio, in, in);
+                }
+                kio += in;
+            }
+        } else {
+            if (kdiag.size() == 0)
+                kdiag.setZero(m_nq + m_nc);
+            kblock->DiagonalAdd(kdiag);
+        }
+    }
+    if (kdiag.size() > 0) {
+        for (int ib = 0; ib < nblocks; ib++) {
+            int n = (int)blocks[ib].rows();
+            blocks[ib].diagonal() += kdiag.segment(m_offsets[ib], n);
+        }
+    }
+
+    // Invert the diagonal blocks. If a block is singular, fall back to its inverse diagonal.
+    m_invblocks.resize(nblocks);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int ib = 0; ib < nblocks; ib++) {
+        Eigen::FullPivLU<ChMatrixDynamic<>> lu(blocks[ib]);
+        if (lu.isInvertible()) {
+            m_invblocks[ib] = lu.inverse();
+        } else {
+            int n = (int)blocks[ib].rows();
+            m_invblocks[ib].setZero(n, n);
+            for (int i = 0; i < n; i++) {
+                double d = blocks[ib](i, i);
+                m_invblocks[ib](i, i) = (std::abs(d) > zero_threshold) ? 1.0 / d : 1.0;
+            }
+        }
+    }
+
+    // Let derived classes process the constraint rows
+    SetupConstraints(sysd);
+
+    return true;
+}
+
+void ChPreconditionerBlockJacobi::SetupConstraints(ChSystemDescriptor& sysd) {
+    m_invdiag_c.resize(m_nc);
+    for (auto constraint : sysd.GetConstraintsList()) {
+        if (constraint->IsActive()) {
+            double cfm = constraint->Get_cfm_i();
+            m_invdiag_c(constraint->GetOffset()) = (std::abs(cfm) > zero_threshold) ? 1.0 / cfm : 1.0;
+        }
+    }
+}
+
+void ChPreconditionerBlockJacobi::Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const {
+    assert(b.size() == m_nq + m_nc);
+    x.resize(m_nq + m_nc);
+
+    int nblocks = (int)m_invblocks.size();
+#pragma omp parallel for schedule(static)
+    for (int ib = 0; ib < nblocks; ib++) {
+        auto n = m_invblocks[ib].rows();
+        x.segment(m_offsets[ib], n).noalias() = m_invblocks[ib] * b.segment(m_offsets[ib], n);
+    }
+
+    // Unknowns not owned by any block are left unchanged
+    for (int i = 0; i < m_nq; i++) {
+        if (m_block_index[i] < 0)
+            x(i) = b(i);
+    }
+
+    x.tail(m_nc) = m_invdiag_c.cwiseProduct(b.tail(m_nc));
+}
+
+// ---------------------------------------------------------------------------
+
+void ChPreconditionerSchur::SetupConstraints(ChSystemDescriptor& sysd) {
+    // Assemble the constraint Jacobian (rows ordered by constraint offsets)
+    sysd.ConvertToMatrixForm(&m_Cq, nullptr, nullptr, nullptr, nullptr, nullptr);
+    assert(m_Cq.rows() == m_nc);
+
+    // Collect compliance terms
+    ChVectorDynamic<> cfm = ChVectorDynamic<>::Zero(m_nc);
+    for (auto constraint : sysd.GetConstraintsList()) {
+        if (constraint->IsActive())
+            cfm(constraint->GetOffset()) = constraint->Get_cfm_i();
+    }
+
+    // Diagonal of the approximate Schur complement: S_ii = |Cq_i * Hb^(-1) * Cq_i' - E_ii|.
+    // The non-zeros in each row of Cq are sorted by column index, so entries belonging to the same variables
+    // block are contiguous.
+    m_invdiag_c.resize(m_nc);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int ic = 0; ic < m_nc; ic++) {
+        double s = -cfm(ic);
+        ChVectorDynamic<> c;
+        int ib_crt = -1;
+        for (ChSparseMatrix::InnerIterator it(m_Cq, ic); it; ++it) {
+            int col = it.col();
+            int ib = m_block_index[col];
+            if (ib < 0)
+                continue;
+            if (ib != ib_crt) {
+                if (ib_crt >= 0)
+                    s += c.dot(m_invblocks[ib_crt] * c);
+                ib_crt = ib;
+                c.setZero(m_invblocks[ib].rows());
+            }
+            c(col - m_offsets[ib]) = it.value();
+        }
+        if (ib_crt >= 0)
+            s += c.dot(m_invblocks[ib_crt] * c);
+
+        m_invdiag_c(ic) = (std::abs(s) > zero_threshold) ? 1.0 / std::abs(s) : 1.0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+
+bool ChPreconditionerILUT::Setup(ChSystemDescriptor& sysd) {
+    sysd.ConvertToMatrixForm(&m_Z, nullptr);
+    m_Z.makeCompressed();
+
+    m_ilut.setDroptol(m_droptol);
+    m_ilut.setFillfactor(m_fillfactor);
+    m_ilut.compute(m_Z);
+
+    return (m_ilut.info() == Eigen::Success);
+}
+
+void ChPreconditionerILUT::Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const {
+    x = m_ilut.solve(b);
+}
+
+}  // end namespace chrono
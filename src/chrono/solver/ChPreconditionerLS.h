@@ -0,0 +1,178 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Preconditioners for the Chrono iterative linear solvers (ChIterativeSolverLS).
+//
+// Available preconditioners:
+//   diagonal (Jacobi)
+//   block Jacobi (one dense block per ChVariables object)
+//   incomplete LU with dual thresholding (ILUT)
+//   constraint-aware block-diagonal Schur preconditioner
+//
+// =============================================================================
+
+#ifndef CH_PRECONDITIONER_LS_H
+#define CH_PRECONDITIONER_LS_H
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+#include <Eigen/IterativeLinearSolvers>
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Base class for preconditioners used with the Chrono iterative linear solvers.\n
+/// A preconditioner approximates the inverse of the system matrix
+/// <pre>
+///   | H   Cq'|
+///   | Cq  E  |
+/// </pre>
+/// as assembled (or applied through SPMV operations) by the system descriptor. See ChSystemDescriptor for details
+/// on the problem formulation.
+class ChApi ChPreconditionerLS {
+  public:
+    /// Available types of preconditioners.
+    enum class Type {
+        NONE,          ///< no preconditioning
+        DIAGONAL,      ///< inverse of the system matrix diagonal (Jacobi)
+        BLOCK_JACOBI,  ///< inverse of the diagonal blocks associated with each ChVariables object
+        ILUT,          ///< incomplete LU factorization with dual thresholding of the assembled system matrix
+        SCHUR,         ///< block Jacobi on H and diagonal approximation of the constraint Schur complement
+        CUSTOM
+    };
+
+    virtual ~ChPreconditionerLS() {}
+
+    /// Return type of the preconditioner.
+    virtual Type GetType() const { return Type::CUSTOM; }
+
+    /// Indicate whether or not the preconditioner requires the assembled system matrix.
+    virtual bool RequiresMatrix() const { return false; }
+
+    /// Perform the preconditioner setup operations, using the current state of the system descriptor.
+    /// Return true if successful and false otherwise.
+    virtual bool Setup(ChSystemDescriptor& sysd) = 0;
+
+    /// Apply the preconditioner: x = P^(-1) * b.
+    /// The output vector is resized as needed.
+    virtual void Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const = 0;
+
+  protected:
+    ChPreconditionerLS() {}
+};
+
+// ---------------------------------------------------------------------------
+
+/// Diagonal (Jacobi) preconditioner.\n
+/// Uses the inverse of the diagonal entries of the system matrix; entries with negligible magnitude (including zero
+/// entries corresponding to constraints without compliance) are replaced by 1.
+class ChApi ChPreconditionerDiagonal : public ChPreconditionerLS {
+  public:
+    ChPreconditionerDiagonal() {}
+    virtual Type GetType() const override { return Type::DIAGONAL; }
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+    virtual void Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const override;
+
+  private:
+    ChVectorDynamic<> m_invdiag;  ///< inverse diagonal entries
+};
+
+// ---------------------------------------------------------------------------
+
+/// Node-block Jacobi preconditioner.\n
+/// For each active ChVariables object (rigid body, FEA node, shaft, ...) the corresponding diagonal block of
+/// H = c_a*M + K + R is assembled from the mass of the variables object and from the matching diagonal sub-blocks of
+/// all ChKblockGeneric objects, then inverted. Constraint rows are preconditioned with the inverse of their
+/// compliance (or 1, if no compliance is present).\n
+/// Both the setup and the application of this preconditioner are parallelized over the variable blocks.
+class ChApi ChPreconditionerBlockJacobi : public ChPreconditionerLS {
+  public:
+    ChPreconditionerBlockJacobi() : m_nq(0), m_nc(0) {}
+    virtual Type GetType() const override { return Type::BLOCK_JACOBI; }
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+    virtual void Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const override;
+
+  protected:
+    /// Calculate the inverse preconditioner entries for the constraint rows.
+    virtual void SetupConstraints(ChSystemDescriptor& sysd);
+
+    int m_nq;                                    ///< number of active variable unknowns
+    int m_nc;                                    ///< number of active constraint unknowns
+    std::vector<int> m_offsets;                  ///< offsets of the variable blocks
+    std::vector<int> m_block_index;              ///< index of the block owning each variable unknown
+    std::vector<ChMatrixDynamic<>> m_invblocks;  ///< inverse of the diagonal blocks of H
+    ChVectorDynamic<> m_invdiag_c;               ///< inverse diagonal entries for the constraint rows
+};
+
+// ---------------------------------------------------------------------------
+
+/// Constraint-aware Schur preconditioner.\n
+/// Block-diagonal preconditioner for the saddle-point system, of the form
+/// <pre>
+///   | Hb   0 |
+///   | 0    S |
+/// </pre>
+/// where Hb is the node-block Jacobi approximation of H (see ChPreconditionerBlockJacobi) and S is the diagonal of the
+/// approximate Schur complement |Cq * Hb^(-1) * Cq' - E|. Being symmetric positive definite, it can be used with all
+/// iterative linear solvers, including MINRES.
+class ChApi ChPreconditionerSchur : public ChPreconditionerBlockJacobi {
+  public:
+    ChPreconditionerSchur() {}
+    virtual Type GetType() const override { return Type::SCHUR; }
+
+  private:
+    virtual void SetupConstraints(ChSystemDescriptor& sysd) override;
+
+    ChSparseMatrix m_Cq;  ///< constraint Jacobian (assembled at each setup)
+};
+
+// ---------------------------------------------------------------------------
+
+/// Incomplete LU factorization preconditioner with dual thresholding (ILUT).\n
+/// Requires assembly of the full system matrix at each setup. The amount of fill-in is controlled with
+/// SetDropTolerance() and SetFillFactor().\n
+/// Note that the resulting preconditioner is not symmetric; use it with GMRES or BiCGSTAB, but not with MINRES.
+class ChApi ChPreconditionerILUT : public ChPreconditionerLS {
+  public:
+    ChPreconditionerILUT() : m_droptol(1e-4), m_fillfactor(10) {}
+    virtual Type GetType() const override { return Type::ILUT; }
+    virtual bool RequiresMatrix() const override { return true; }
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+    virtual void Apply(const ChVectorDynamic<>& b, ChVectorDynamic<>& x) const override;
+
+    /// Set the threshold under which entries are dropped from the factors (default: 1e-4).
+    void SetDropTolerance(double droptol) { m_droptol = droptol; }
+
+    /// Set the fill factor, i.e. the maximum ratio of non-zeros in a factor row to non-zeros in the original row
+    /// (default: 10).
+    void SetFillFactor(int fillfactor) { m_fillfactor = fillfactor; }
+
+  private:
+    double m_droptol;
+    int m_fillfactor;
+    ChSparseMatrix m_Z;                        ///< assembled system matrix
+    Eigen::IncompleteLUT<double, int> m_ilut;  ///< incomplete factorization
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
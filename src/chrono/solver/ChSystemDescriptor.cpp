@@ -567,6 +567,10 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
         vstiffness[ik]->MultiplyAndAdd(result, x);
     }
 
+    // 1.2b) add also matrix-free K*x.q and R*x.q products, if any
+    if (krm_callback)
+        krm_callback->MultiplyAndAdd(result, x);
+
     // 1.3)  add also [Cq]'*x.l  (NON straight parallelizable - risk of concurrency in writing)
     for (size_t ic = 0; ic < vc_size; ic++) {
         if (vconstraints[ic]->IsActive()) {
@@ -15,6 +15,7 @@
 #ifndef CHSYSTEMDESCRIPTOR_H
 #define CHSYSTEMDESCRIPTOR_H
 
+#include <memory>
 #include <vector>
 
 #include "chrono/solver/ChConstraint.h"
@@ -77,6 +78,22 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+  public:
+    /// Class to be used as a callback interface for matrix-free products with the stiffness and damping terms.
+    /// If registered, SystemProduct() invokes this callback in addition to (or instead of) the ChKblock objects. This
+    /// allows applying the K and R contributions on the fly, without storing (or even computing) element matrices.
+    class ChApi KRMProductCallback {
+      public:
+        virtual ~KRMProductCallback() {}
+
+        /// Increment the 'q' part of the result with the product [c_k*K + c_r*R]*x.q.
+        /// Both vectors are system-level vectors of unknowns x={q,l}, in the descriptor ordering.
+        virtual void MultiplyAndAdd(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) = 0;
+    };
+
+  protected:
+    std::shared_ptr<KRMProductCallback> krm_callback;  ///< optional matrix-free K and R products
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
@@ -116,6 +133,15 @@ class ChApi ChSystemDescriptor {
     /// Insert reference to a ChKblock object (a piece of matrix)
     virtual void InsertKblock(ChKblock* mk) { vstiffness.push_back(mk); }
 
+    /// Specify a callback object for matrix-free products with the stiffness and damping terms.
+    /// Pass an empty pointer to unregister a previously specified callback.
+    /// Note that a registered callback is used by SystemProduct() only; the K and R terms it provides are not included
+    /// when the system matrix is assembled (see ConvertToMatrixForm).
+    void RegisterKRMProductCallback(std::shared_ptr<KRMProductCallback> callback) { krm_callback = callback; }
+
+    /// Return the currently registered callback for matrix-free K and R products (if any).
+    std::shared_ptr<KRMProductCallback> GetKRMProductCallback() const { return krm_callback; }
+
     /// End insertion of items.
     /// A derived class should always call UpdateCountsAndOffsets.
     virtual void EndInsertion() { UpdateCountsAndOffsets(); }
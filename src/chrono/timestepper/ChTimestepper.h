@@ -92,6 +92,13 @@ class ChApi ChTimestepper {
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive);
 
+    /// Write (in binary form) any internal data carried over from one step to the next (e.g., an adaptive step size).
+    /// Used to take a snapshot of the system state (see ChSystemSnapshot). The default implementation writes nothing.
+    virtual void WriteState(std::ostream& stream) const {}
+
+    /// Read the internal data written by WriteState().
+    virtual void ReadState(std::istream& stream) {}
+
   protected:
     ChIntegrable* integrable;
     double T;
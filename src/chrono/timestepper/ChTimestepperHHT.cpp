@@ -473,4 +473,14 @@ void ChTimestepperHHT::ArchiveIn(ChArchiveIn& archive) {
     archive >> CHNVP(modemapper(mode), "mode");
 }
 
-}  // end namespace chrono
\ No newline at end of file
+void ChTimestepperHHT::WriteState(std::ostream& stream) const {
+    stream.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    stream.write(reinterpret_cast<const char*>(&num_successful_steps), sizeof(num_successful_steps));
+}
+
+void ChTimestepperHHT::ReadState(std::istream& stream) {
+    stream.read(reinterpret_cast<char*>(&h), sizeof(h));
+    stream.read(reinterpret_cast<char*>(&num_successful_steps), sizeof(num_successful_steps));
+}
+
+}  // end namespace chrono
@@ -147,6 +147,12 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive) override;
 
+    /// Write the internal step size and the count of successful steps.
+    virtual void WriteState(std::ostream& stream) const override;
+
+    /// Read the internal step size and the count of successful steps.
+    virtual void ReadState(std::istream& stream) override;
+
   private:
     void Prepare(ChIntegrableIIorder* integrable, double scaling_factor);
     void Increment(ChIntegrableIIorder* integrable, double scaling_factor);
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Hashing utilities for content-addressed caches.
+//
+// =============================================================================
+
+#include <cstdint>
+#include <cstdio>
+
+#include "chrono/utils/ChUtilsHash.h"
+
+namespace chrono {
+namespace utils {
+
+// SHA-256 round constants (FIPS 180-4, section 4.2.2)
+static const uint32_t sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+static inline uint32_t RotR(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+// Process one 64-byte block.
+static void SHA256Block(uint32_t h[8], const unsigned char* block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) |
+               (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = RotR(w[i - 15], 7) ^ RotR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = RotR(w[i - 2], 17) ^ RotR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], k = h[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t S1 = RotR(e, 6) ^ RotR(e, 11) ^ RotR(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = k + S1 + ch + sha256_k[i] + w[i];
+        uint32_t S0 = RotR(a, 2) ^ RotR(a, 13) ^ RotR(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = S0 + maj;
+        k = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+    h[5] += f;
+    h[6] += g;
+    h[7] += k;
+}
+
+std::string HashSHA256(const void* data, size_t size) {
+    uint32_t h[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+    // Full blocks
+    auto bytes = static_cast<const unsigned char*>(data);
+    size_t num_full = size / 64;
+    for (size_t i = 0; i < num_full; i++)
+        SHA256Block(h, bytes + 64 * i);
+
+    // Last one or two blocks: remaining bytes, 0x80 terminator, zero padding, and message length in bits
+    unsigned char tail[128] = {0};
+    size_t rem = size - 64 * num_full;
+    for (size_t i = 0; i < rem; i++)
+        tail[i] = bytes[64 * num_full + i];
+    tail[rem] = 0x80;
+    size_t tail_size = (rem < 56) ? 64 : 128;
+    uint64_t num_bits = uint64_t(size) * 8;
+    for (int i = 0; i < 8; i++)
+        tail[tail_size - 1 - i] = (unsigned char)(num_bits >> (8 * i));
+    for (size_t i = 0; i < tail_size; i += 64)
+        SHA256Block(h, tail + i);
+
+    char hex[65];
+    for (int i = 0; i < 8; i++)
+        std::snprintf(hex + 8 * i, 9, "%08x", (unsigned int)h[i]);
+    return std::string(hex, 64);
+}
+
+std::string MakeContentKey(const std::string& type, const void* data, size_t size) {
+    return type + "_" + std::to_string(size) + "_" + HashSHA256(data, size);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
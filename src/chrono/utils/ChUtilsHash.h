@@ -0,0 +1,47 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Hashing utilities for content-addressed caches.
+//
+// =============================================================================
+
+#ifndef CH_UTILS_HASH_H
+#define CH_UTILS_HASH_H
+
+#include <cstddef>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Return the SHA-256 digest of the given data, as a string of 64 lowercase hexadecimal digits.
+ChApi std::string HashSHA256(const void* data, size_t size);
+
+/// Return a key identifying the given data for content-addressed caches.
+/// The key is the specified type (prefix), followed by the data size and its SHA-256 digest (in hexadecimal),
+/// separated by underscores. Different data result in different keys (barring a SHA-256 collision), so a cached
+/// entry can be identified by its key alone. The key can also be used as a file name.
+ChApi std::string MakeContentKey(const std::string& type, const void* data, size_t size);
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
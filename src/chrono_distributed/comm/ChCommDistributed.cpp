@@ -41,6 +41,7 @@ ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
     this->data_manager = my_sys->data_manager;
 
     ddm = my_sys->ddm;
+    nonblocking = false;
 
     /* Create and Commit all custom MPI Data Types */
     // Exchange
@@ -87,6 +88,17 @@ ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
 
 ChCommDistributed::~ChCommDistributed() {}
 
+// Receive a message of unknown length from the specified rank.
+template <typename T>
+static void RecvMessage(std::vector<T>& buf, MPI_Datatype type, int source, int tag, MPI_Comm comm) {
+    MPI_Status status;
+    int count;
+    MPI_Probe(source, tag, comm, &status);
+    MPI_Get_count(&status, type, &count);
+    buf.resize(count);
+    MPI_Recv(buf.data(), count, type, source, tag, comm, MPI_STATUS_IGNORE);
+}
+
 void ChCommDistributed::ProcessExchanges(int num_recv, BodyExchange* buf, int updown) {
     if (buf->gid == UINT_MAX) {
         return;
@@ -442,6 +454,12 @@ void ChCommDistributed::Exchange() {
         }      // End of update take loop
     }          // End of parallel sections
 
+    if (nonblocking) {
+        ExchangeNonBlocking(exchange_up_buf, exchange_down_buf, update_up_buf, update_down_buf, update_take_up,
+                            update_take_down, exchanges_up, exchanges_down);
+        return;
+    }
+
     // MPI_Status status_exchange_up;
     // MPI_Status status_exchange_down;
     // MPI_Status status_update_up;
@@ -935,4 +953,131 @@ int ChCommDistributed::PackShapes(std::vector<Shape>* buf, int index) {
 
 inline void ChCommDistributed::PackUpdateTake(uint* buf, int index) {
     *buf = ddm->global_id[index];
-}
\ No newline at end of file
+}
+
+void ChCommDistributed::ExchangeNonBlocking(std::vector<BodyExchange>& exchange_up_buf,
+                                            std::vector<BodyExchange>& exchange_down_buf,
+                                            std::vector<BodyUpdate>& update_up_buf,
+                                            std::vector<BodyUpdate>& update_down_buf,
+                                            std::vector<uint>& update_take_up,
+                                            std::vector<uint>& update_take_down,
+                                            const std::forward_list<int>& exchanges_up,
+                                            const std::forward_list<int>& exchanges_down) {
+    int my_rank = my_sys->my_rank;
+    bool has_up = (my_rank != my_sys->num_ranks - 1);
+    bool has_down = (my_rank != 0);
+
+    // Pack the shapes of the bodies sent for ghost creation (these do not depend on incoming messages and can
+    // therefore be sent together with the bodies)
+    std::vector<Shape> shapes_up;
+    std::vector<Shape> shapes_down;
+#pragma omp parallel sections
+    {
+#pragma omp section
+        {
+            for (auto itr_up = exchanges_up.begin(); itr_up != exchanges_up.end(); itr_up++)
+                PackShapes(&shapes_up, *itr_up);
+        }
+#pragma omp section
+        {
+            for (auto itr_down = exchanges_down.begin(); itr_down != exchanges_down.end(); itr_down++)
+                PackShapes(&shapes_down, *itr_down);
+        }
+    }
+
+    // Send empty message if there is nothing to send
+    BodyExchange b_e = {};
+    b_e.gid = UINT_MAX;
+    BodyUpdate b_u = {};
+    b_u.gid = UINT_MAX;
+    Shape shape = {};
+    shape.gid = UINT_MAX;
+    if (exchange_up_buf.empty())
+        exchange_up_buf.push_back(b_e);
+    if (exchange_down_buf.empty())
+        exchange_down_buf.push_back(b_e);
+    if (update_up_buf.empty())
+        update_up_buf.push_back(b_u);
+    if (update_down_buf.empty())
+        update_down_buf.push_back(b_u);
+    if (update_take_up.empty())
+        update_take_up.push_back(UINT_MAX);
+    if (update_take_down.empty())
+        update_take_down.push_back(UINT_MAX);
+    if (shapes_up.empty())
+        shapes_up.push_back(shape);
+    if (shapes_down.empty())
+        shapes_down.push_back(shape);
+
+    // Post all sends (same tags as the blocking exchange)
+    MPI_Request requests[8];
+    int num_requests = 0;
+    MPI_Comm world = my_sys->world;
+    if (has_up) {
+        MPI_Isend(exchange_up_buf.data(), (int)exchange_up_buf.size(), BodyExchangeType, my_rank + 1, 1, world,
+                  &requests[num_requests++]);
+        MPI_Isend(update_up_buf.data(), (int)update_up_buf.size(), BodyUpdateType, my_rank + 1, 3, world,
+                  &requests[num_requests++]);
+        MPI_Isend(update_take_up.data(), (int)update_take_up.size(), MPI_UNSIGNED, my_rank + 1, 5, world,
+                  &requests[num_requests++]);
+        MPI_Isend(shapes_up.data(), (int)shapes_up.size(), ShapeType, my_rank + 1, 7, world,
+                  &requests[num_requests++]);
+    }
+    if (has_down) {
+        MPI_Isend(exchange_down_buf.data(), (int)exchange_down_buf.size(), BodyExchangeType, my_rank - 1, 2, world,
+                  &requests[num_requests++]);
+        MPI_Isend(update_down_buf.data(), (int)update_down_buf.size(), BodyUpdateType, my_rank - 1, 4, world,
+                  &requests[num_requests++]);
+        MPI_Isend(update_take_down.data(), (int)update_take_down.size(), MPI_UNSIGNED, my_rank - 1, 6, world,
+                  &requests[num_requests++]);
+        MPI_Isend(shapes_down.data(), (int)shapes_down.size(), ShapeType, my_rank - 1, 8, world,
+                  &requests[num_requests++]);
+    }
+
+    // Receive and process incoming messages, in the same order as the blocking exchange (new bodies must exist
+    // before their shapes are processed). Later messages are in flight while earlier ones are processed.
+    std::vector<BodyExchange> recv_exchange;
+    std::vector<BodyUpdate> recv_update;
+    std::vector<uint> recv_take;
+    std::vector<Shape> recv_shapes;
+
+    if (has_down) {
+        RecvMessage(recv_exchange, BodyExchangeType, my_rank - 1, 1, world);
+        ProcessExchanges((int)recv_exchange.size(), recv_exchange.data(), 0);
+    }
+    if (has_up) {
+        RecvMessage(recv_exchange, BodyExchangeType, my_rank + 1, 2, world);
+        ProcessExchanges((int)recv_exchange.size(), recv_exchange.data(), 1);
+    }
+
+    if (has_down) {
+        RecvMessage(recv_update, BodyUpdateType, my_rank - 1, 3, world);
+        ProcessUpdates((int)recv_update.size(), recv_update.data());
+    }
+    if (has_up) {
+        RecvMessage(recv_update, BodyUpdateType, my_rank + 1, 4, world);
+        ProcessUpdates((int)recv_update.size(), recv_update.data());
+    }
+
+    if (has_down) {
+        RecvMessage(recv_take, MPI_UNSIGNED, my_rank - 1, 5, world);
+        ProcessTakes((int)recv_take.size(), recv_take.data());
+    }
+    if (has_up) {
+        RecvMessage(recv_take, MPI_UNSIGNED, my_rank + 1, 6, world);
+        ProcessTakes((int)recv_take.size(), recv_take.data());
+    }
+
+    if (has_down) {
+        RecvMessage(recv_shapes, ShapeType, my_rank - 1, 7, world);
+        ProcessShapes((int)recv_shapes.size(), recv_shapes.data());
+    }
+    if (has_up) {
+        RecvMessage(recv_shapes, ShapeType, my_rank + 1, 8, world);
+        ProcessShapes((int)recv_shapes.size(), recv_shapes.data());
+    }
+
+    // Make sure all sends are done before the send buffers are released. Since messages between two ranks with the
+    // same tag are non-overtaking, no barrier is needed between consecutive exchanges.
+    MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+}
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <forward_list>
 #include <memory>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 
@@ -115,6 +117,16 @@ class CH_DISTR_API ChCommDistributed {
     /// Processes incoming updates from other ranks
     void Exchange();
 
+    /// Enable/disable the non-blocking exchange (default: false).
+    /// If enabled, all messages to a neighbor rank (new bodies, updates, takes, and collision shapes) are posted at once
+    /// with non-blocking sends, so that an exchange requires a single communication round instead of four, and
+    /// incoming messages are processed while the remaining ones are still in flight. The final barrier is also
+    /// skipped. Must be set identically on all ranks.
+    void SetNonBlocking(bool val) { nonblocking = val; }
+
+    /// Return true if the non-blocking exchange is enabled.
+    bool IsNonBlocking() const { return nonblocking; }
+
   protected:
     ChSystemDistributed* my_sys;
 
@@ -129,7 +141,20 @@ class CH_DISTR_API ChCommDistributed {
     /// Set of data for scaffolding on top of Chrono::Multicore
     ChDistributedDataManager* ddm;
 
+    /// Flag indicating the use of the non-blocking exchange
+    bool nonblocking;
+
   private:
+    /// Send the packed buffers to the neighbor ranks and process the incoming messages, posting all sends at once.
+    void ExchangeNonBlocking(std::vector<BodyExchange>& exchange_up_buf,
+                             std::vector<BodyExchange>& exchange_down_buf,
+                             std::vector<BodyUpdate>& update_up_buf,
+                             std::vector<BodyUpdate>& update_down_buf,
+                             std::vector<uint>& update_take_up,
+                             std::vector<uint>& update_take_down,
+                             const std::forward_list<int>& exchanges_up,
+                             const std::forward_list<int>& exchanges_down);
+
     /// Helper function for processing incoming exchange messages.
     void ProcessExchanges(int num_recv, BodyExchange* buf, int updown);
 
@@ -17,11 +17,14 @@
 
 #include "chrono_multicore/ChDataManager.h"
 
+#include "chrono/core/ChMathematics.h"
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
 
 #include <mpi.h>
 #include <stdlib.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
 
@@ -32,6 +35,13 @@ ChDomainDistributed::ChDomainDistributed(ChSystemDistributed* sys) {
     split_axis = 0;
     split = false;
     axis_set = false;
+    balance_interval = 0;
+    balance_metric = LoadMetric::BODY_COUNT;
+    balance_tolerance = 0.1;
+    balance_steps = 0;
+    balance_time = 0;
+    imbalance = 0;
+    num_rebalances = 0;
 }
 
 ChDomainDistributed::~ChDomainDistributed() {}
@@ -70,25 +80,138 @@ void ChDomainDistributed::SetSimDomain(const ChVector<>& lo, const ChVector<>& h
 
 void ChDomainDistributed::SplitDomain() {
     // Length of this subdomain along the long axis
-    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
+    int num_ranks = my_sys->num_ranks;
+    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / num_ranks;
+
+    boundaries.resize(num_ranks + 1);
+    for (int i = 0; i < num_ranks; i++)
+        boundaries[i] = boxlo[split_axis] + i * sub_len;
+    boundaries[num_ranks] = boxhi[split_axis];
+
+    SetSubDomain();
+    split = true;
+}
 
+void ChDomainDistributed::SetSubDomain() {
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = boundaries[my_sys->my_rank];
+            subhi[i] = boundaries[my_sys->my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
         }
     }
-    split = true;
 }
 
 int ChDomainDistributed::GetRank(const ChVector<double>& pos) const {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+    // Index of the first interior boundary above the given position
+    auto itr = std::upper_bound(boundaries.begin() + 1, boundaries.end() - 1, pos[split_axis]);
+    return (int)(itr - boundaries.begin()) - 1;
+}
+
+void ChDomainDistributed::EnableLoadBalancing(int interval, LoadMetric metric, double tolerance) {
+    balance_interval = std::max(interval, 0);
+    balance_metric = metric;
+    balance_tolerance = tolerance;
+    balance_steps = 0;
+    balance_time = 0;
+}
+
+void ChDomainDistributed::UpdateLoadBalancing(double step_time) {
+    if (balance_interval <= 0 || my_sys->num_ranks == 1)
+        return;
+
+    balance_time += step_time;
+    if (++balance_steps < balance_interval)
+        return;
+
+    double load = balance_time;
+    if (balance_metric == LoadMetric::BODY_COUNT) {
+        load = 0;
+        for (uint i = 0; i < my_sys->data_manager->num_rigid_bodies; i++) {
+            int status = my_sys->ddm->comm_status[i];
+            if (status != distributed::EMPTY && status != distributed::GLOBAL)
+                load += 1;
+        }
+    }
+
+    Rebalance(load);
+    balance_steps = 0;
+    balance_time = 0;
+}
+
+bool ChDomainDistributed::Rebalance(double load) {
+    assert(split);
+    int num_ranks = my_sys->num_ranks;
+    if (num_ranks == 1)
+        return false;
+
+    std::vector<double> loads(num_ranks);
+    MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, my_sys->world);
+
+    // Note: all ranks perform the calculations below on identical data and therefore obtain identical boundaries.
+    double total = 0;
+    double max_load = 0;
+    for (int i = 0; i < num_ranks; i++) {
+        total += loads[i];
+        max_load = std::max(max_load, loads[i]);
+    }
+    if (total <= 0)
+        return false;
+
+    imbalance = max_load * num_ranks / total - 1;
+    if (imbalance <= balance_tolerance)
+        return false;
+
+    // Bisect the cumulative load distribution (piecewise linear over the current sub-domains)
+    std::vector<double> new_boundaries(boundaries);
+    double cumulative = 0;
+    int slab = 0;
+    for (int k = 1; k < num_ranks; k++) {
+        double target = total * k / num_ranks;
+        while (slab < num_ranks - 1 && cumulative + loads[slab] < target) {
+            cumulative += loads[slab];
+            slab++;
+        }
+        double len = boundaries[slab + 1] - boundaries[slab];
+        double frac = (loads[slab] > 0) ? (target - cumulative) / loads[slab] : 0.5;
+        new_boundaries[k] = boundaries[slab] + ChClamp(frac, 0.0, 1.0) * len;
+    }
+
+    // Limit the boundary displacements to half a ghost layer (to allow migration of bodies through the regular
+    // exchange protocol) and keep sub-domains wide enough to contain the shared regions on both sides.
+    double ghost_layer = my_sys->GetGhostLayer();
+    double max_shift = 0.5 * ghost_layer;
+    double min_len = 4 * ghost_layer;
+    for (int k = 1; k < num_ranks; k++) {
+        new_boundaries[k] = ChClamp(new_boundaries[k], boundaries[k] - max_shift, boundaries[k] + max_shift);
+        new_boundaries[k] = std::max(new_boundaries[k], new_boundaries[k - 1] + min_len);
+    }
+    for (int k = num_ranks - 1; k > 0; k--) {
+        new_boundaries[k] = std::min(new_boundaries[k], new_boundaries[k + 1] - min_len);
+    }
+
+    // Keep the current boundaries if the constraints cannot be satisfied
+    bool changed = false;
+    for (int k = 1; k <= num_ranks; k++) {
+        if (new_boundaries[k] - new_boundaries[k - 1] < min_len * (1 - 1e-10))
+            return false;
+    }
+    for (int k = 1; k < num_ranks; k++) {
+        if (std::abs(new_boundaries[k] - boundaries[k]) > max_shift * (1 + 1e-10))
+            return false;
+        if (new_boundaries[k] != boundaries[k])
+            changed = true;
+    }
+    if (!changed)
+        return false;
+
+    boundaries = new_boundaries;
+    SetSubDomain();
+    num_rebalances++;
 
-    return (int)(pt / sub_len);
+    return true;
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) const {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -105,8 +106,24 @@ class ChSystemDistributed;
 ///
 /// A body with a GHOST comm_status will become OWNED when it moves into the owned region of this rank.
 /// A body with a GHOST comm_status will be removed when it moves into the one of this rank's unowned regions.
+///
+///
+/// Load balancing:
+///
+/// By default, the sub-domains have equal lengths along the split axis and do not change during the simulation.
+/// If load balancing is enabled, the sub-domain boundaries are periodically moved so that each rank carries an equal
+/// share of the global load (measured by body counts or by compute times). The new boundaries are obtained by
+/// bisecting the cumulative load distribution, assuming a uniform load density within each current sub-domain.
+/// Each boundary moves by at most half a ghost layer per rebalancing, so that bodies are migrated to the new owner
+/// rank by the regular exchange protocol (through the shared and ghost states described above).
 class CH_DISTR_API ChDomainDistributed {
   public:
+    /// Measure of the load on each rank, used for load balancing.
+    enum class LoadMetric {
+        BODY_COUNT,  ///< number of bodies (owned, shared, and ghost) on the rank
+        STEP_TIME    ///< compute time (excluding inter-rank communication) since the last rebalancing
+    };
+
     ChDomainDistributed(ChSystemDistributed* sys);
     virtual ~ChDomainDistributed();
 
@@ -139,6 +156,30 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns the rank which has ownership of a body with the given position
     int GetRank(const ChVector<double>& pos) const;
 
+    /// Enable periodic load balancing, every 'interval' steps (0: disabled, default).
+    /// Rebalancing is triggered only if the load imbalance (maximum over average rank load, minus 1) exceeds the
+    /// specified tolerance. Sub-domains are kept at least 4 ghost layers wide. Must be called with the same arguments
+    /// on all ranks.
+    void EnableLoadBalancing(int interval, LoadMetric metric = LoadMetric::BODY_COUNT, double tolerance = 0.1);
+
+    /// Return true if periodic load balancing is enabled.
+    bool IsLoadBalancingEnabled() const { return balance_interval > 0; }
+
+    /// Recompute the sub-domain boundaries based on the load of this rank.
+    /// This is a collective call, which must be made on all ranks. Return true if the boundaries were changed.
+    /// Bodies are migrated to their new owner rank during the next exchange.
+    virtual bool Rebalance(double load);
+
+    /// Return the load imbalance (maximum over average rank load, minus 1) measured at the last rebalancing.
+    double GetImbalance() const { return imbalance; }
+
+    /// Return the number of times the sub-domain boundaries were changed.
+    int GetNumRebalances() const { return num_rebalances; }
+
+    /// Return the coordinates of the sub-domain boundaries along the split axis.
+    /// Rank i owns the interval [boundaries[i], boundaries[i+1]).
+    const std::vector<double>& GetBoundaries() const { return boundaries; }
+
     /// Returns true if the domain has been set.
     bool IsSplit() const { return split; }
 
@@ -163,10 +204,29 @@ class CH_DISTR_API ChDomainDistributed {
     bool split;     ///< Flag indicating that the domain has been divided into sub-domains.
     bool axis_set;  ///< Flag indicating that the splitting axis has been set.
 
+    std::vector<double> boundaries;  ///< Sub-domain boundaries along the split axis (num_ranks + 1 values)
+
+    int balance_interval;       ///< Number of steps between load balancing checks (0: disabled)
+    LoadMetric balance_metric;  ///< Measure of the rank load
+    double balance_tolerance;   ///< Imbalance below which the boundaries are not changed
+    int balance_steps;          ///< Number of steps since the last load balancing check
+    double balance_time;        ///< Accumulated compute time since the last load balancing check
+    double imbalance;           ///< Load imbalance at the last load balancing check
+    int num_rebalances;         ///< Number of boundary changes
+
+    /// Accumulate the compute time of the last step and rebalance if due.
+    /// Called by ChSystemDistributed at each step, before the inter-rank exchange.
+    void UpdateLoadBalancing(double step_time);
+
+    /// Set the limits of this sub-domain from the current boundaries.
+    void SetSubDomain();
+
   private:
     /// Helper function that is called by the public GetRegion methods to get
     /// the region classification for a body based on the center position.
     distributed::COMM_STATUS GetRegion(double pos) const;
+
+    friend class ChSystemDistributed;
 };
 /// @} distributed_physics
 
@@ -65,6 +65,7 @@ ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlaye
     comm = new ChCommDistributed(this);
 
     data_manager->system_timer.AddTimer("Exchange");
+    data_manager->system_timer.AddTimer("Balance");
 
     // Reserve starting space
     int init = maxobjects;  // / num_ranks;
@@ -124,8 +125,14 @@ bool ChSystemDistributed::Integrate_Y() {
     assert(domain->IsSplit());
     ddm->initial_add = false;
 
+    double t_start = MPI_Wtime();
     bool ret = ChSystemMulticoreSMC::Integrate_Y();
     if (num_ranks != 1) {
+        // Update sub-domain boundaries (if load balancing is enabled) before exchanging bodies
+        data_manager->system_timer.start("Balance");
+        domain->UpdateLoadBalancing(MPI_Wtime() - t_start);
+        data_manager->system_timer.stop("Balance");
+
         data_manager->system_timer.start("Exchange");
         comm->Exchange();
         data_manager->system_timer.stop("Exchange");
@@ -17,10 +17,12 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/core/ChTypes.h"
 
+#include "chrono/utils/ChOpenMP.h"
 #include "chrono/utils/ChUtilsCreators.h"
 #include "chrono/utils/ChUtilsGenerators.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
@@ -88,6 +90,9 @@ void ChSystemFsi::InitParams() {
 
     m_paramsH->output_length = 1;
 
+    // Number of OpenMP threads (CPU backend)
+    m_paramsH->num_threads = ChOMP::GetNumProcs();
+
     // Fluid properties
     m_paramsH->rho0 = Real(1000.0);
     m_paramsH->invrho0 = 1 / m_paramsH->rho0;
@@ -507,6 +512,10 @@ void ChSystemFsi::SetVerbose(bool verbose) {
     m_fsi_interface->m_verbose = verbose;
 }
 
+void ChSystemFsi::SetNumThreads(int num_threads) {
+    m_paramsH->num_threads = std::max(num_threads, 1);
+}
+
 void ChSystemFsi::SetSPHLinearSolver(SolverType lin_solver) {
     m_paramsH->LinearSolver = lin_solver;
 }
@@ -855,6 +864,13 @@ void ChSystemFsi::Initialize() {
             fluidIntegrator = TimeIntegrator::I2SPH;
             break;
     }
+#ifndef CHRONO_FSI_USE_CUDA
+    // The implicit SPH solvers (which rely on cuBLAS/cuSPARSE) are not available with the CPU backend
+    if (fluidIntegrator != TimeIntegrator::EXPLICITSPH) {
+        cout << "Implicit SPH not available with the Chrono::FSI CPU backend, reverting back to WCSPH" << endl;
+        fluidIntegrator = TimeIntegrator::EXPLICITSPH;
+    }
+#endif
     m_fluid_dynamics = chrono_types::make_unique<ChFluidDynamics>(m_bce_manager, *m_sysFSI, m_paramsH, m_num_objectsH,
                                                                   fluidIntegrator, m_verbose);
     m_fluid_dynamics->GetForceSystem()->SetLinearSolver(m_paramsH->LinearSolver);
@@ -20,10 +20,12 @@
 #ifndef CH_SYSTEM_FSI_H
 #define CH_SYSTEM_FSI_H
 
+#include "chrono/ChConfig.h"
+#include "chrono_fsi/ChConfigFSI.h"
+
 #include <thrust/host_vector.h>
 #include <thrust/device_vector.h>
 
-#include "chrono/ChConfig.h"
 #include "chrono/physics/ChSystem.h"
 
 #include "chrono_fsi/ChApiFsi.h"
@@ -106,6 +108,10 @@ class CH_FSI_API ChSystemFsi {
     /// Enable/disable verbose terminal output.
     void SetVerbose(bool verbose);
 
+    /// Set the number of OpenMP threads used by the CPU backend for this FSI system (default: number of available
+    /// processors). This setting is ignored if Chrono::FSI was built with the CUDA backend.
+    void SetNumThreads(int num_threads);
+
     /// Read Chrono::FSI parameters from the specified JSON file.
     void ReadParametersFromFile(const std::string& json_file);
 
@@ -0,0 +1,27 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono_fsi/cpu/ChFsiHostCompat.h"
+
+namespace chrono {
+namespace fsi {
+
+// Per-thread launch configuration seen by kernels executed on the host
+thread_local uint3 threadIdx = {0, 0, 0};
+thread_local uint3 blockIdx = {0, 0, 0};
+thread_local uint3 blockDim = {1, 1, 1};
+thread_local uint3 gridDim = {1, 1, 1};
+
+}  // end namespace fsi
+}  // end namespace chrono
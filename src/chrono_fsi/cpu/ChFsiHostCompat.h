@@ -0,0 +1,342 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host execution of the Chrono::FSI kernels with the CPU backend
+// (CHRONO_FSI_USE_CUDA not defined). Provides host versions of the CUDA
+// qualifiers, intrinsics, atomic operations and runtime API, and defines the
+// kernel launcher.
+//
+// Internal to the module (not installed): included, before any other module
+// header, by the implementation files of the CPU backend only. The public
+// headers use the types in ChFsiHostTypes.h, which this header brings into
+// the global namespace (where CUDA declares them).
+//
+// The SPH kernels are compiled unchanged as C++ and executed on the host by
+// the kernel launcher defined here (see CH_FSI_KERNEL in ChUtilsDevice.cuh):
+// the blocks of a launch are distributed over OpenMP threads and the threads
+// of a block are executed in sequence. Device vectors and algorithms are
+// provided by the Thrust OpenMP (or sequential) host system.
+//
+// =============================================================================
+
+#ifndef CH_FSI_HOST_COMPAT_H
+#define CH_FSI_HOST_COMPAT_H
+
+#include <chrono>
+#include <cmath>
+#include <math.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+#include "chrono_fsi/ChApiFsi.h"
+#include "chrono_fsi/ChFsiHostTypes.h"
+
+// -----------------------------------------------------------------------------
+// Function and variable qualifiers
+// -----------------------------------------------------------------------------
+
+#ifndef __host__
+    #define __host__
+#endif
+#ifndef __device__
+    #define __device__
+#endif
+#if defined(_MSC_VER) && !defined(__inline__)
+    #define __inline__ inline
+#endif
+
+#define __global__
+#define __constant__
+#define __shared__
+
+namespace chrono {
+namespace cuda_host {
+
+// -----------------------------------------------------------------------------
+// Intrinsics
+// -----------------------------------------------------------------------------
+
+inline double rsqrt(double x) {
+    return 1.0 / std::sqrt(x);
+}
+
+inline long long int __double_as_longlong(double x) {
+    long long int i;
+    std::memcpy(&i, &x, sizeof(double));
+    return i;
+}
+
+inline double __longlong_as_double(long long int i) {
+    double x;
+    std::memcpy(&x, &i, sizeof(double));
+    return x;
+}
+
+// Kernels are executed on the host thread by thread; they must not rely on synchronization within a block.
+inline void __syncthreads() {}
+
+// -----------------------------------------------------------------------------
+// Atomic operations (relaxed ordering; kernel launches are separated by OpenMP barriers)
+// -----------------------------------------------------------------------------
+
+inline unsigned int atomicCAS(unsigned int* address, unsigned int compare, unsigned int val) {
+#ifdef _MSC_VER
+    return (unsigned int)_InterlockedCompareExchange((volatile long*)address, (long)val, (long)compare);
+#else
+    // On failure, 'compare' is overwritten with the current value; on success it already equals the old value
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return compare;
+#endif
+}
+
+inline unsigned long long int atomicCAS(unsigned long long int* address,
+                                        unsigned long long int compare,
+                                        unsigned long long int val) {
+#ifdef _MSC_VER
+    return (unsigned long long int)_InterlockedCompareExchange64((volatile long long*)address, (long long)val,
+                                                                 (long long)compare);
+#else
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return compare;
+#endif
+}
+
+inline int atomicAdd(int* address, int val) {
+#ifdef _MSC_VER
+    return (int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#endif
+}
+
+inline unsigned int atomicAdd(unsigned int* address, unsigned int val) {
+#ifdef _MSC_VER
+    return (unsigned int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#endif
+}
+
+inline float atomicAdd(float* address, float val) {
+    static_assert(sizeof(float) == sizeof(unsigned int), "unexpected size of float");
+    unsigned int* address_as_uint = reinterpret_cast<unsigned int*>(address);
+    unsigned int old = *(volatile unsigned int*)address_as_uint;
+    unsigned int assumed;
+    float old_val;
+    do {
+        assumed = old;
+        std::memcpy(&old_val, &assumed, sizeof(float));
+        float new_val = old_val + val;
+        unsigned int new_bits;
+        std::memcpy(&new_bits, &new_val, sizeof(float));
+        old = atomicCAS(address_as_uint, assumed, new_bits);
+    } while (assumed != old);
+    return old_val;
+}
+
+// -----------------------------------------------------------------------------
+// Runtime API.
+// Device and managed memory is plain host memory, zero-initialized like freshly mapped CUDA managed pages (parts of
+// the code rely on this). Symbols are ordinary variables. Device synchronization is a no-op.
+// -----------------------------------------------------------------------------
+
+enum cudaMemcpyKind {
+    cudaMemcpyHostToHost = 0,
+    cudaMemcpyHostToDevice = 1,
+    cudaMemcpyDeviceToHost = 2,
+    cudaMemcpyDeviceToDevice = 3,
+    cudaMemcpyDefault = 4
+};
+
+constexpr unsigned int cudaMemAttachGlobal = 0x01;
+
+inline const char* cudaGetErrorString(cudaError_t error) {
+    switch (error) {
+        case cudaSuccess:
+            return "no error";
+        case cudaErrorMemoryAllocation:
+            return "out of memory";
+        default:
+            return "operation not supported";
+    }
+}
+
+inline cudaError_t cudaGetLastError() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaDeviceSynchronize() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMallocManaged(void** ptr, size_t size, unsigned int flags = cudaMemAttachGlobal) {
+    *ptr = std::calloc(size > 0 ? size : 1, 1);
+    return *ptr ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+template <class T>
+inline cudaError_t cudaMallocManaged(T** ptr, size_t size, unsigned int flags = cudaMemAttachGlobal) {
+    return cudaMallocManaged((void**)ptr, size, flags);
+}
+
+template <class T>
+inline cudaError_t cudaMalloc(T** ptr, size_t size) {
+    return cudaMallocManaged((void**)ptr, size, cudaMemAttachGlobal);
+}
+
+inline cudaError_t cudaFree(void* ptr) {
+    std::free(ptr);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemset(void* ptr, int value, size_t count) {
+    std::memset(ptr, value, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void* dst, const void* src, size_t count, cudaMemcpyKind kind) {
+    std::memcpy(dst, src, count);
+    return cudaSuccess;
+}
+
+template <class T>
+inline cudaError_t cudaMemcpyToSymbol(T& symbol,
+                                      const void* src,
+                                      size_t count,
+                                      size_t offset = 0,
+                                      cudaMemcpyKind kind = cudaMemcpyHostToDevice) {
+    std::memcpy(reinterpret_cast<char*>(&symbol) + offset, src, count);
+    return cudaSuccess;
+}
+
+template <class T>
+inline cudaError_t cudaMemcpyToSymbolAsync(T& symbol,
+                                           const void* src,
+                                           size_t count,
+                                           size_t offset = 0,
+                                           cudaMemcpyKind kind = cudaMemcpyHostToDevice,
+                                           cudaStream_t stream = 0) {
+    return cudaMemcpyToSymbol(symbol, src, count, offset, kind);
+}
+
+template <class T>
+inline cudaError_t cudaMemcpyFromSymbol(void* dst,
+                                        const T& symbol,
+                                        size_t count,
+                                        size_t offset = 0,
+                                        cudaMemcpyKind kind = cudaMemcpyDeviceToHost) {
+    std::memcpy(dst, reinterpret_cast<const char*>(&symbol) + offset, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventCreate(cudaEvent_t* event) {
+    *event = new std::chrono::high_resolution_clock::time_point();
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventDestroy(cudaEvent_t event) {
+    delete event;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventRecord(cudaEvent_t event, cudaStream_t stream = 0) {
+    *event = std::chrono::high_resolution_clock::now();
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventSynchronize(cudaEvent_t event) {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventElapsedTime(float* ms, cudaEvent_t start, cudaEvent_t end) {
+    *ms = std::chrono::duration<float, std::milli>(*end - *start).count();
+    return cudaSuccess;
+}
+
+}  // end namespace cuda_host
+}  // end namespace chrono
+
+using namespace chrono::cuda_host;
+
+namespace chrono {
+namespace fsi {
+
+// -----------------------------------------------------------------------------
+// Thread indices.
+// Each host thread executing a kernel sees its own (1D) launch configuration, set by the kernel launcher.
+// -----------------------------------------------------------------------------
+
+extern thread_local uint3 threadIdx;
+extern thread_local uint3 blockIdx;
+extern thread_local uint3 blockDim;
+extern thread_local uint3 gridDim;
+
+namespace cpu {
+
+/// Host execution of a kernel with a 1D launch configuration.
+/// Blocks are distributed dynamically over the specified number of OpenMP threads (set per FSI system, see
+/// ChSystemFsi::SetNumThreads); the threads of a block are executed in sequence by the
+/// same host thread. Kernels must therefore not rely on synchronization or shared memory within a block.
+/// The kernel is wrapped in a callable (see CH_FSI_KERNEL), so that overloaded kernels are resolved from the arguments.
+template <typename Kernel>
+class KernelLauncher {
+  public:
+    KernelLauncher(Kernel kernel, unsigned int num_blocks, unsigned int num_threads, int host_threads)
+        : m_kernel(kernel), m_num_blocks(num_blocks), m_num_threads(num_threads), m_host_threads(host_threads) {}
+
+    /// Execute the kernel with the specified arguments.
+    template <typename... Args>
+    void operator()(Args&&... args) const {
+        const int nthreads = m_host_threads;
+        const int nblocks = (int)m_num_blocks;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads) if (nthreads > 1 && nblocks > 1)
+        for (int b = 0; b < nblocks; b++) {
+            gridDim = {m_num_blocks, 1, 1};
+            blockDim = {m_num_threads, 1, 1};
+            blockIdx = {(unsigned int)b, 0, 0};
+            for (unsigned int t = 0; t < m_num_threads; t++) {
+                threadIdx = {t, 0, 0};
+                m_kernel(args...);
+            }
+        }
+    }
+
+  private:
+    Kernel m_kernel;
+    unsigned int m_num_blocks;
+    unsigned int m_num_threads;
+    int m_host_threads;
+};
+
+/// Create a host launcher for the given kernel and launch configuration.
+template <typename Kernel>
+KernelLauncher<Kernel> LaunchKernel(Kernel kernel,
+                                    unsigned int num_blocks,
+                                    unsigned int num_threads,
+                                    int host_threads) {
+    return KernelLauncher<Kernel>(kernel, num_blocks, num_threads, host_threads);
+}
+
+}  // end namespace cpu
+}  // end namespace fsi
+}  // end namespace chrono
+
+#endif
@@ -17,8 +17,7 @@
 #ifndef CH_SOLVER6X6_H_
 #define CH_SOLVER6X6_H_
 
-#include <cuda_runtime.h>
-#include "chrono_fsi/ChConfigFSI.h"
+#include "chrono_fsi/math/custom_math.h"
 
 namespace chrono {
 namespace fsi {
@@ -20,11 +20,18 @@
 #ifndef CHFSI_CUSTOM_MATH_H
 #define CHFSI_CUSTOM_MATH_H
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
 #include <cuda_runtime.h>
+#else
+// Thrust defines the __host__ and __device__ qualifiers (as empty) for host compilers
+#include <thrust/detail/config.h>
+#include "chrono_fsi/ChFsiHostTypes.h"
+#endif
 #ifndef __CUDACC__
 #include <cmath>
 #endif
-#include "chrono_fsi/ChConfigFSI.h"
 
 namespace chrono {
 namespace fsi {
@@ -45,6 +52,22 @@ typedef unsigned int uint;
 /// Define the unsigned short type used in FSI.
 typedef unsigned short ushort;
 
+#ifndef CHRONO_FSI_USE_CUDA
+// Host definitions of the CUDA vector types (CPU backend)
+using cuda_host::int2;
+using cuda_host::int3;
+using cuda_host::int4;
+using cuda_host::uint2;
+using cuda_host::uint3;
+using cuda_host::uint4;
+using cuda_host::float2;
+using cuda_host::float3;
+using cuda_host::float4;
+using cuda_host::double2;
+using cuda_host::double3;
+using cuda_host::double4;
+#endif
+
 /// Return the minimum of two single precision numbers.
 inline __host__ __device__ float fminf(float a, float b) {
     return a < b ? a : b;
@@ -96,6 +119,8 @@ inline __host__ __device__ Real quintic(Real a) {
 
 #if defined(__CUDACC_RTC__)
 #define __VECTOR_FUNCTIONS_DECL__ __host__ __device__
+#elif !defined(CHRONO_FSI_USE_CUDA)
+#define __VECTOR_FUNCTIONS_DECL__ static inline
 #else /* !__CUDACC_RTC__ */
 #define __VECTOR_FUNCTIONS_DECL__ static __inline__ __host__ __device__
 #endif /* __CUDACC_RTC__ */
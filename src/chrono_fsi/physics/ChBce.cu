@@ -16,6 +16,12 @@
 // in FSI system.
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include "chrono_fsi/physics/ChBce.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 #include <type_traits>
@@ -741,7 +747,7 @@ void ChBce::Populate_RigidSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMar
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
-    Populate_RigidSPH_MeshPos_LRF_D<<<nBlocks, nThreads>>>(
+    CH_FSI_KERNEL(Populate_RigidSPH_MeshPos_LRF_D, nBlocks, nThreads, paramsH->num_threads)(
         mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->rigidIdentifierD), mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR4CAST(fsiBodiesD->q_fsiBodies_D));
@@ -777,7 +783,7 @@ void ChBce::Populate_FlexSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMark
     computeGridSize((uint)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
     thrust::device_vector<Real3> FlexSPH_MeshPos_LRF_H = fsiGeneralData->FlexSPH_MeshPos_LRF_H;
-    Populate_FlexSPH_MeshPos_LRF_D<<<nBlocks, nThreads>>>(
+    CH_FSI_KERNEL(Populate_FlexSPH_MeshPos_LRF_D, nBlocks, nThreads, paramsH->num_threads)(
         mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), mR3CAST(FlexSPH_MeshPos_LRF_H), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->FlexIdentifierD), U2CAST(fsiGeneralData->CableElementsNodesD),
         U4CAST(fsiGeneralData->ShellElementsNodesD), mR3CAST(fsiMeshD->pos_fsi_fea_D));
@@ -821,7 +827,7 @@ void ChBce::ReCalcVelocityPressureStress_BCE(thrust::device_vector<Real3>& velMa
     uint numThreads, numBlocks;
     computeGridSize(numBCE, 256, numBlocks, numThreads);
 
-    BCE_VelocityPressureStress<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(BCE_VelocityPressureStress, numBlocks, numThreads, paramsH->num_threads)(
         mR3CAST(velMas_ModifiedBCE), mR4CAST(rhoPreMu_ModifiedBCE), mR3CAST(tauXxYyZz_ModifiedBCE),
         mR3CAST(tauXyXzYz_ModifiedBCE), mR4CAST(sortedPosRad), mR3CAST(sortedVelMas), mR4CAST(sortedRhoPreMu),
         mR3CAST(sortedTauXxYyZz), mR3CAST(sortedTauXyXzYz), U1CAST(cellStart), U1CAST(cellEnd),
@@ -850,7 +856,7 @@ void ChBce::CalcRigidBceAcceleration(thrust::device_vector<Real3>& bceAcc,
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, numBlocks, numThreads);
 
-    CalcRigidBceAccelerationD<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(CalcRigidBceAccelerationD, numBlocks, numThreads, paramsH->num_threads)(
         mR3CAST(bceAcc), mR4CAST(q_fsiBodies_D), mR3CAST(accRigid_fsiBodies_D), mR3CAST(omegaVelLRF_fsiBodies_D),
         mR3CAST(omegaAccLRF_fsiBodies_D), mR3CAST(rigidSPH_MeshPos_LRF_D), U1CAST(rigidIdentifierD));
 
@@ -869,9 +875,9 @@ void ChBce::CalcFlexBceAcceleration(thrust::device_vector<Real3>& bceAcc,
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numFlexMarkers, 256, numBlocks, numThreads);
 
-    CalcFlexBceAccelerationD<<<numBlocks, numThreads>>>(mR3CAST(bceAcc), mR3CAST(acc_fsi_fea_D),
-                                                        mR3CAST(FlexSPH_MeshPos_LRF_D), U2CAST(CableElementsNodesD),
-                                                        U4CAST(ShellElementsNodesD), U1CAST(FlexIdentifierD));
+    CH_FSI_KERNEL(CalcFlexBceAccelerationD, numBlocks, numThreads, paramsH->num_threads)(
+        mR3CAST(bceAcc), mR3CAST(acc_fsi_fea_D), mR3CAST(FlexSPH_MeshPos_LRF_D), U2CAST(CableElementsNodesD),
+        U4CAST(ShellElementsNodesD), U1CAST(FlexIdentifierD));
 
     cudaDeviceSynchronize();
     cudaCheckError();
@@ -991,7 +997,7 @@ void ChBce::Rigid_Forces_Torques(std::shared_ptr<SphMarkerDataD> sphMarkersD,
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
-    Calc_Rigid_FSI_Forces_Torques_D<<<nBlocks, nThreads>>>(
+    CH_FSI_KERNEL(Calc_Rigid_FSI_Forces_Torques_D, nBlocks, nThreads, paramsH->num_threads)(
         mR3CAST(fsiGeneralData->rigid_FSI_ForcesD), mR3CAST(fsiGeneralData->rigid_FSI_TorquesD),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR4CAST(fsiGeneralData->derivVelRhoD_old), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->rigidIdentifierD), mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
@@ -1011,7 +1017,7 @@ void ChBce::Flex_Forces(std::shared_ptr<SphMarkerDataD> sphMarkersD, std::shared
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
-    Calc_Flex_FSI_ForcesD<<<nBlocks, nThreads>>>(
+    CH_FSI_KERNEL(Calc_Flex_FSI_ForcesD, nBlocks, nThreads, paramsH->num_threads)(
         mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), U1CAST(fsiGeneralData->FlexIdentifierD),
         U2CAST(fsiGeneralData->CableElementsNodesD), U4CAST(fsiGeneralData->ShellElementsNodesD),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR4CAST(fsiGeneralData->derivVelRhoD_old),
@@ -1030,7 +1036,7 @@ void ChBce::UpdateRigidMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> s
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
-    UpdateRigidMarkersPositionVelocityD<<<nBlocks, nThreads>>>(
+    CH_FSI_KERNEL(UpdateRigidMarkersPositionVelocityD, nBlocks, nThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D),
         U1CAST(fsiGeneralData->rigidIdentifierD), mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR4CAST(fsiBodiesD->velMassRigid_fsiBodies_D), mR3CAST(fsiBodiesD->omegaVelLRF_fsiBodies_D),
@@ -1049,7 +1055,7 @@ void ChBce::UpdateFlexMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> sp
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
-    UpdateFlexMarkersPositionVelocityD<<<nBlocks, nThreads>>>(
+    CH_FSI_KERNEL(UpdateFlexMarkersPositionVelocityD, nBlocks, nThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), mR3CAST(sphMarkersD->velMasD),
         U1CAST(fsiGeneralData->FlexIdentifierD), U2CAST(fsiGeneralData->CableElementsNodesD),
         U4CAST(fsiGeneralData->ShellElementsNodesD), mR3CAST(fsiMeshD->pos_fsi_fea_D), mR3CAST(fsiMeshD->vel_fsi_fea_D),
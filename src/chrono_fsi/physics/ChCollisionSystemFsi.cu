@@ -15,6 +15,12 @@
 // Base class for processing proximity in fsi system.
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include <thrust/sort.h>
 #include "chrono_fsi/physics/ChCollisionSystemFsi.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
@@ -77,6 +83,7 @@ __global__ void calcHashD(uint* gridMarkerHashD,   // gridMarkerHash Store parti
     gridMarkerIndexD[index] = index;
 }
 // ------------------------------------------------------------------------------
+#ifdef CHRONO_FSI_USE_CUDA
 __global__ void reorderDataAndFindCellStartD(uint* cellStartD,          // output: cell start index
                                              uint* cellEndD,            // output: cell end index
                                              Real4* sortedPosRadD,      // output: sorted positions
@@ -213,6 +220,30 @@ __global__ void findCellStartEndD(uint* cellStartD,         // output: cell star
             cellEndD[hash] = index + 1;
     }
 }
+#else
+// Host variant of findCellStartEndD.
+// The threads of a block are executed in sequence, so the hash of the previous particle is read directly from the
+// sorted hash array instead of being staged in shared memory.
+__global__ void findCellStartEndD(uint* cellStartD,         // output: cell start index
+                                  uint* cellEndD,           // output: cell end index
+                                  uint* gridMarkerHashD,    // input: sorted grid hashes
+                                  uint* gridMarkerIndexD    // input: sorted particle indices
+                                  ) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numAllMarkers)
+        return;
+
+    uint hash = gridMarkerHashD[index];
+    if (index == 0 || hash != gridMarkerHashD[index - 1]) {
+        cellStartD[hash] = index;
+        if (index > 0)
+            cellEndD[gridMarkerHashD[index - 1]] = index;
+    }
+
+    if (index == numObjectsD.numAllMarkers - 1)
+        cellEndD[hash] = index + 1;
+}
+#endif
 // ------------------------------------------------------------------------------
 __global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted particle indices
                              uint* extendedActivityIdD,  // input: particles in an extended active sub-domain
@@ -340,7 +371,7 @@ void ChCollisionSystemFsi::calcHash() {
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
     // Execute Kernel
-    calcHashD<<<numBlocks, numThreads>>>(U1CAST(markersProximityD->gridMarkerHashD),
+    CH_FSI_KERNEL(calcHashD, numBlocks, numThreads, paramsH->num_threads)(U1CAST(markersProximityD->gridMarkerHashD),
         U1CAST(markersProximityD->gridMarkerIndexD), mR4CAST(sphMarkersD->posRadD), isErrorD);
 
     // Check for errors in kernel execution
@@ -375,22 +406,28 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
-    uint smemSize = sizeof(uint) * (numThreads + 1);
     // Find the start index and the end index of the sorted array in each cell
+#ifdef CHRONO_FSI_USE_CUDA
+    uint smemSize = sizeof(uint) * (numThreads + 1);
     findCellStartEndD<<<numBlocks, numThreads, smemSize>>>(
         U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),          
         U1CAST(markersProximityD->gridMarkerHashD), U1CAST(markersProximityD->gridMarkerIndexD));
+#else
+    CH_FSI_KERNEL(findCellStartEndD, numBlocks, numThreads, paramsH->num_threads)(
+        U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),
+        U1CAST(markersProximityD->gridMarkerHashD), U1CAST(markersProximityD->gridMarkerIndexD));
+#endif
     cudaDeviceSynchronize();
     cudaCheckError();
 
     // Launch a kernel to find the location of original particles in the sorted arrays.
     // This is faster than using thrust::sort_by_key()
-    OriginalToSortedD<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(OriginalToSortedD, numBlocks, numThreads, paramsH->num_threads)(
         U1CAST(markersProximityD->mapOriginalToSorted),
         U1CAST(markersProximityD->gridMarkerIndexD));
 
     // Reorder the arrays according to the sorted index of all particles
-    reorderDataD<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(reorderDataD, numBlocks, numThreads, paramsH->num_threads)(
         U1CAST(markersProximityD->gridMarkerIndexD),
         U1CAST(fsiGeneralData->extendedActivityIdD),
         U1CAST(markersProximityD->mapOriginalToSorted),
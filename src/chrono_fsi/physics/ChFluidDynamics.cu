@@ -15,6 +15,14 @@
 // Class for performing time integration in fluid system.
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
+#include <iostream>
+
 #include "chrono_fsi/physics/ChFluidDynamics.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
@@ -593,6 +601,7 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
       integrator_type(type),
       verbose(verb) {
     switch (integrator_type) {
+#ifdef CHRONO_FSI_USE_CUDA
         case TimeIntegrator::I2SPH:
             forceSystem = chrono_types::make_shared<ChFsiForceI2SPH>(
                 otherBceWorker, fsiSystem.sortedSphMarkersD, fsiSystem.markersProximityD, 
@@ -610,6 +619,7 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
                 cout << "====== Created an IISPH framework" << endl;
             }
             break;
+#endif
 
         case TimeIntegrator::EXPLICITSPH:
             forceSystem = chrono_types::make_shared<ChFsiForceExplicitSPH>(
@@ -679,7 +689,7 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
     //------------------------
     uint numBlocks, numThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
-    UpdateActivityD<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(UpdateActivityD, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD2->posRadD), mR3CAST(sphMarkersD1->velMasD), 
         mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR3CAST(fsiMeshD->pos_fsi_fea_D),
@@ -711,7 +721,7 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
     //------------------------
     uint numBlocks, numThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
-    UpdateFluidD<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(UpdateFluidD, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), 
         mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), 
@@ -752,7 +762,7 @@ void ChFluidDynamics::UpdateFluid_Implicit(std::shared_ptr<SphMarkerDataD> sphMa
     cudaMalloc((void**)&isErrorD, sizeof(bool));
     *isErrorH = false;
     cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
-    Update_Fluid_State<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(Update_Fluid_State, numBlocks, numThreads, paramsH->num_threads)(
         mR3CAST(fsiSystem.fsiGeneralData->vel_XSPH_D), 
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), updatePortion, paramsH->dT, isErrorD);
@@ -772,19 +782,19 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
     uint numBlocks, numThreads;
 
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
-    ApplyPeriodicBoundaryXKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ApplyPeriodicBoundaryXKernel, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryYKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ApplyPeriodicBoundaryYKernel, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryZKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ApplyPeriodicBoundaryZKernel, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
@@ -803,20 +813,20 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
 void ChFluidDynamics::ApplyModifiedBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> sphMarkersD) {
     uint numBlocks, numThreads;
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
-    ApplyInletBoundaryXKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ApplyInletBoundaryXKernel, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD),
         mR4CAST(sphMarkersD->rhoPresMuD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
     // these are useful anyway for out of bound particles
-    ApplyPeriodicBoundaryYKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ApplyPeriodicBoundaryYKernel, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryZKernel<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ApplyPeriodicBoundaryZKernel, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
@@ -831,7 +841,7 @@ void ChFluidDynamics::DensityReinitialization() {
     thrust::device_vector<Real4> dummySortedRhoPreMu(numObjectsH->numAllMarkers);
     thrust::fill(dummySortedRhoPreMu.begin(), dummySortedRhoPreMu.end(), mR4(0.0));
 
-    ReCalcDensityD_F1<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(ReCalcDensityD_F1, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(dummySortedRhoPreMu), 
         mR4CAST(fsiSystem.sortedSphMarkersD->posRadD),
         mR3CAST(fsiSystem.sortedSphMarkersD->velMasD), 
@@ -22,8 +22,10 @@
 #include "chrono_fsi/physics/ChFsiForce.cuh"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 #include "chrono_fsi/physics/ChFsiForceExplicitSPH.cuh"
+#ifdef CHRONO_FSI_USE_CUDA
 #include "chrono_fsi/physics/ChFsiForceI2SPH.cuh"
 #include "chrono_fsi/physics/ChFsiForceIISPH.cuh"
+#endif
 #include "chrono_fsi/physics/ChSystemFsi_impl.cuh"
 
 using chrono::fsi::TimeIntegrator;
@@ -15,6 +15,12 @@
 // Base class for processing sph force in fsi system.//
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include <thrust/extrema.h>
 #include <thrust/sort.h>
 #include "chrono_fsi/physics/ChFsiForce.cuh"
@@ -59,6 +65,7 @@ void ChFsiForce::Initialize() {
 ChFsiForce::~ChFsiForce() {}
 
 void ChFsiForce::SetLinearSolver(SolverType type) {
+#ifdef CHRONO_FSI_USE_CUDA
     switch (type) {
         case SolverType::BICGSTAB:
             myLinearSolver = chrono_types::make_shared<ChFsiLinearSolverBiCGStab>();
@@ -71,6 +78,10 @@ void ChFsiForce::SetLinearSolver(SolverType type) {
             std::cout << "The ChFsiLinearSolver you chose has not been implemented, reverting back to "
                          "ChFsiLinearSolverBiCGStab\n";
     }
+#else
+    // Linear solvers are only used by the implicit SPH solvers, which require the CUDA backend
+    myLinearSolver = nullptr;
+#endif
 }
 //--------------------------------------------------------------------------------------------------------------------------------
 // Use invasive to avoid one extra copy.
@@ -27,8 +27,10 @@
 #include "chrono_fsi/physics/ChSystemFsi_impl.cuh"
 #include "chrono_fsi/physics/ChCollisionSystemFsi.cuh"
 #include "chrono_fsi/math/ChFsiLinearSolver.h"
+#ifdef CHRONO_FSI_USE_CUDA
 #include "chrono_fsi/math/ChFsiLinearSolverBiCGStab.h"
 #include "chrono_fsi/math/ChFsiLinearSolverGMRES.h"
+#endif
 #include "chrono_fsi/math/ExactLinearSolvers.cuh"
 
 namespace chrono {
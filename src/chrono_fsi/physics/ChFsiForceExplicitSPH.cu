@@ -12,6 +12,12 @@
 // Author: Arman Pazouki, Wei Hu
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include <thrust/extrema.h>
 #include <thrust/remove.h>
 #include <thrust/sort.h>
@@ -508,6 +514,7 @@ __global__ void calcRho_kernel(Real4* sortedPosRad,
                 uint startIndex = cellStart[gridHash];
                 if (startIndex != 0xffffffff) {
                     uint endIndex = cellEnd[gridHash];
+                    CH_FSI_SIMD_REDUCTION(+ : sum_mW, sum_W, sum_mW_rho)
                     for (uint j = startIndex; j < endIndex; j++) {
                         Real3 posRadB = mR3(sortedPosRad[j]);
                         Real3 dist3 = Distance(posRadA, posRadB);
@@ -571,6 +578,7 @@ __global__ void calcKernelSupport(Real4* sortedPosRad,
                 uint startIndex = cellStart[gridHash];
                 if (startIndex != 0xffffffff) {
                     uint endIndex = cellEnd[gridHash];
+                    CH_FSI_SIMD_REDUCTION(+ : sum_W_all, sum_W_identical)
                     for (uint j = startIndex; j < endIndex; j++) {
                         Real3 posRadB = mR3(sortedPosRad[j]);
                         Real3 dist3 = Distance(posRadA, posRadB);
@@ -1651,7 +1659,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Calculate the kernel support of each particle
     if (paramsH->bceTypeWall == BceVersion::ADAMI || paramsH->bceType == BceVersion::ADAMI){
-        calcKernelSupport<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(calcKernelSupport, numBlocks, numThreads, paramsH->num_threads)(
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
             mR3CAST(sortedKernelSupport), U1CAST(markersProximityD->cellStartD),
             U1CAST(markersProximityD->cellEndD), isErrorD);
@@ -1662,7 +1670,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     if (density_initialization >= paramsH->densityReinit) {
         thrust::device_vector<Real4> rhoPresMuD_old = sortedSphMarkersD->rhoPresMuD;
         printf("Re-initializing density after %d steps.\n", paramsH->densityReinit);
-        calcRho_kernel<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(calcRho_kernel, numBlocks, numThreads, paramsH->num_threads)(
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD), 
             mR4CAST(rhoPresMuD_old), U1CAST(markersProximityD->cellStartD), 
             U1CAST(markersProximityD->cellEndD), density_initialization, isErrorD);
@@ -1677,7 +1685,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
         cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
 
         // execute the kernel Navier_Stokes and Shear_Stress_Rate in one kernel
-        NS_SSR<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(NS_SSR, numBlocks, numThreads, paramsH->num_threads)(
             U1CAST(fsiGeneralData->activityIdentifierD), mR4CAST(sortedDerivVelRho), 
             mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz), mR3CAST(sortedXSPHandShift), 
             mR3CAST(sortedKernelSupport), mR4CAST(sortedSphMarkersD->posRadD), 
@@ -1696,13 +1704,13 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
-        calIndexOfIndex<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(calIndexOfIndex, numBlocks, numThreads, paramsH->num_threads)(
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), U1CAST(markersProximityD->gridMarkerIndexD));
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // execute the kernel
-        Navier_Stokes<<<numBlocks1, numThreads1>>>(
+        CH_FSI_KERNEL(Navier_Stokes, numBlocks1, numThreads1, paramsH->num_threads)(
             U1CAST(indexOfIndex), mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
@@ -1713,7 +1721,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Launch a kernel to copy data from sorted arrays to original arrays.
     // This is faster than using thrust::sort_by_key()
-    CopySortedToOriginal_D<<<numBlocks, numThreads>>>(
+    CH_FSI_KERNEL(CopySortedToOriginal_D, numBlocks, numThreads, paramsH->num_threads)(
         mR4CAST(sortedDerivVelRho), mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR3CAST(fsiGeneralData->derivTauXxYyZzD),
         mR3CAST(fsiGeneralData->derivTauXyXzYzD), U1CAST(markersProximityD->gridMarkerIndexD),
@@ -1753,7 +1761,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
     //------------------------------------------------------------------------
     if (paramsH->elastic_SPH) {
         // The XSPH vector already included in the shifting vector
-        CopySortedToOriginal_XSPH_D<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(CopySortedToOriginal_XSPH_D, numBlocks, numThreads, paramsH->num_threads)(
             mR3CAST(sortedXSPHandShift), mR3CAST(fsiGeneralData->vel_XSPH_D),
             U1CAST(markersProximityD->gridMarkerIndexD), 
             U1CAST(fsiGeneralData->activityIdentifierD),
@@ -1768,14 +1776,14 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
-        calIndexOfIndex<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(calIndexOfIndex, numBlocks, numThreads, paramsH->num_threads)(
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), 
             U1CAST(markersProximityD->gridMarkerIndexD));
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // Execute the kernel
-        CalcVel_XSPH_D<<<numBlocks1, numThreads1>>>(
+        CH_FSI_KERNEL(CalcVel_XSPH_D, numBlocks1, numThreads1, paramsH->num_threads)(
             U1CAST(indexOfIndex), mR3CAST(vel_XSPH_Sorted_D),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(sortedXSPHandShift),
@@ -1783,7 +1791,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
             U1CAST(markersProximityD->cellEndD), isErrorD);
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "CalcVel_XSPH_D");
 
-        CopySortedToOriginal_XSPH_D<<<numBlocks, numThreads>>>(
+        CH_FSI_KERNEL(CopySortedToOriginal_XSPH_D, numBlocks, numThreads, paramsH->num_threads)(
             mR3CAST(vel_XSPH_Sorted_D), mR3CAST(fsiGeneralData->vel_XSPH_D),
             U1CAST(markersProximityD->gridMarkerIndexD), 
             U1CAST(fsiGeneralData->activityIdentifierD),
@@ -18,6 +18,12 @@
 #ifndef CH_SPH_GENERAL_CU
 #define CH_SPH_GENERAL_CU
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
 namespace chrono {
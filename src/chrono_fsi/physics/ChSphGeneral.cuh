@@ -17,10 +17,14 @@
 #ifndef CH_SPH_GENERAL_CUH
 #define CH_SPH_GENERAL_CUH
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
 #include <cuda.h>
 #include <cuda_runtime.h>
 #include <cuda_runtime_api.h>
 #include <device_launch_parameters.h>
+#endif
 
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
@@ -17,6 +17,15 @@
 //
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
+#include <cassert>
+#include <iostream>
+
 #include <thrust/copy.h>
 #include <thrust/gather.h>
 #include <thrust/for_each.h>
@@ -15,6 +15,12 @@
 // Utilities for changing device arrays in non-cuda files
 // =============================================================================
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 
 namespace chrono {
@@ -18,7 +18,13 @@
 #ifndef CH_UTILS_DEVICE_H
 #define CH_UTILS_DEVICE_H
 
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
 #include <cuda_runtime.h>
+#else
+#include "chrono_fsi/ChFsiHostTypes.h"
+#endif
 
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
@@ -85,6 +91,32 @@ typedef unsigned int uint;
     #define CUDA_KERNEL_DIM(...) << <__VA_ARGS__>>>
 #endif
 
+// ----------------------------------------------------------------------------
+// Kernel launch and vectorization hints
+// ----------------------------------------------------------------------------
+
+/// Launch a kernel with a 1D configuration: CH_FSI_KERNEL(kernel, numBlocks, numThreads, hostThreads)(args...).
+/// With the CPU backend, the kernel is executed on the host by chrono::fsi::cpu::KernelLauncher, using the specified
+/// number of OpenMP threads (see SimParams::num_threads); this last argument is ignored with the CUDA backend.
+#ifdef CHRONO_FSI_USE_CUDA
+    #define CH_FSI_KERNEL(kernel, num_blocks, num_threads, host_threads) kernel<<<num_blocks, num_threads>>>
+#else
+    #define CH_FSI_KERNEL(kernel, num_blocks, num_threads, host_threads)                                  \
+        chrono::fsi::cpu::LaunchKernel([](auto&&... kernel_args) { kernel(kernel_args...); }, num_blocks, \
+                                       num_threads, host_threads)
+#endif
+
+/// Request vectorization of a loop over neighbor particles which accumulates the specified reduction variables,
+/// e.g. CH_FSI_SIMD_REDUCTION(+ : sum_W). No-op with the CUDA backend or if OpenMP is not enabled.
+#if defined(CHRONO_FSI_USE_CUDA) || !defined(CHRONO_OPENMP_ENABLED)
+    #define CH_FSI_SIMD_REDUCTION(...)
+#elif defined(_MSC_VER)
+    #define CH_FSI_SIMD_REDUCTION(...) __pragma(omp simd reduction(__VA_ARGS__))
+#else
+    #define CH_FSI_PRAGMA(x) _Pragma(#x)
+    #define CH_FSI_SIMD_REDUCTION(...) CH_FSI_PRAGMA(omp simd reduction(__VA_ARGS__))
+#endif
+
 // ----------------------------------------------------------------------------
 // Values
 // ----------------------------------------------------------------------------
@@ -104,6 +136,12 @@ typedef unsigned int uint;
         }                                                                                    \
     }
 
+#ifndef CHRONO_FSI_USE_CUDA
+// Host definitions of the CUDA runtime types (CPU backend)
+using cuda_host::cudaStream_t;
+using cuda_host::cudaEvent_t;
+#endif
+
 /// Time recorder for cuda events.
 /// This utility class encapsulates a simple timer for recording the time between a start and stop event.
 class GpuTimer {
@@ -14,6 +14,12 @@
 //
 // Utility function to print the save fluid, bce, and boundary data to files
 // =============================================================================
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifndef CHRONO_FSI_USE_CUDA
+    #include "chrono_fsi/cpu/ChFsiHostCompat.h"
+#endif
+
 #include <thrust/reduce.h>
 #include <cstdio>
 #include <cstring>
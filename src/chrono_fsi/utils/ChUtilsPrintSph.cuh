@@ -16,6 +16,7 @@
 // =============================================================================
 #ifndef CHUTILSPRINTSPH_H
 #define CHUTILSPRINTSPH_H
+#include "chrono_fsi/ChConfigFSI.h"
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
 #include "chrono_fsi/ChApiFsi.h"
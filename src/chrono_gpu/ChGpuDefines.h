@@ -15,14 +15,35 @@
 #pragma once
 
 #include <climits>
-#include <cuda_runtime.h>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda_runtime.h>
+#else
+    #include "chrono_gpu/ChGpuHostTypes.h"
+#endif
+
 namespace chrono {
 namespace gpu {
 
+#ifndef CHRONO_GPU_USE_CUDA
+// Host definitions of the CUDA vector types (CPU backend)
+using cuda_host::int3;
+using cuda_host::uint3;
+using cuda_host::float3;
+using cuda_host::double3;
+using cuda_host::longlong3;
+using cuda_host::make_int3;
+using cuda_host::make_uint3;
+using cuda_host::make_float3;
+using cuda_host::make_double3;
+using cuda_host::make_longlong3;
+#endif
+
 /// Used to compute position as a function of time.
 typedef std::function<double3(float)> GranPositionFunction;
 
@@ -58,7 +79,11 @@ enum CHGPU_OUTPUT_FLAGS { ABSV = 1, VEL_COMPONENTS = 2, FIXITY = 4, ANG_VEL_COMP
 }  // namespace gpu
 }  // namespace chrono
 
+#ifdef CHRONO_GPU_USE_CUDA
 typedef longlong3 int64_t3;
+#else
+typedef chrono::cuda_host::longlong3 int64_t3;
+#endif
 
 constexpr size_t BD_WALL_ID_X_BOT = 0;
 constexpr size_t BD_WALL_ID_X_TOP = 1;
@@ -102,8 +127,10 @@ constexpr int warp_size = 32;
 /// href="https://stackoverflow.com/questions/14038589/what-is-the-canonical-way-to-check-for-errors-using-the-cuda-runtime-api">elsewhere</a>.
 ///  Some nice suggestions for how to use the mechanism are provided at the above link.
 ///
+/// With the CPU backend, gpuAssert is defined in cpu/ChGpuHostCompat.h.
 #define gpuErrchk(ans) \
     { gpuAssert((ans), __FILE__, __LINE__); }
+#ifdef CHRONO_GPU_USE_CUDA
 inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort = true) {
     if (code != cudaSuccess) {
         fprintf(stderr, "GPUassert: %s %s %d\n", cudaGetErrorString(code), file, line);
@@ -111,6 +138,7 @@ inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort =
             exit(code);
     }
 }
+#endif
 
 // Add verbose checks easily
 #define INFO_PRINTF(...)                                                               \
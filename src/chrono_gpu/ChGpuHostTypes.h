@@ -0,0 +1,120 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host definitions of the CUDA vector and runtime types that appear in the
+// public interface of Chrono::Gpu when it is built with the CPU backend
+// (instead of <cuda_runtime.h>).
+//
+// The types are declared in namespace chrono::cuda_host only; the public
+// headers of the module bring the ones they use into its namespace. The host
+// versions of the CUDA qualifiers, intrinsics and runtime API are internal to
+// the module (see cpu/ChGpuHostCompat.h).
+//
+// The same definitions (with the same include guard) are provided by
+// chrono_fsi/ChFsiHostTypes.h; keep the two files identical.
+//
+// =============================================================================
+
+#ifndef CH_CUDA_HOST_TYPES_H
+#define CH_CUDA_HOST_TYPES_H
+
+#include <chrono>
+
+namespace chrono {
+namespace cuda_host {
+
+// -----------------------------------------------------------------------------
+// Built-in vector types (same alignment as the CUDA types)
+// -----------------------------------------------------------------------------
+
+struct alignas(8) int2 {
+    int x, y;
+};
+struct int3 {
+    int x, y, z;
+};
+struct alignas(16) int4 {
+    int x, y, z, w;
+};
+
+struct alignas(8) uint2 {
+    unsigned int x, y;
+};
+struct uint3 {
+    unsigned int x, y, z;
+};
+struct alignas(16) uint4 {
+    unsigned int x, y, z, w;
+};
+
+struct alignas(8) float2 {
+    float x, y;
+};
+struct float3 {
+    float x, y, z;
+};
+struct alignas(16) float4 {
+    float x, y, z, w;
+};
+
+struct alignas(16) double2 {
+    double x, y;
+};
+struct double3 {
+    double x, y, z;
+};
+struct alignas(16) double4 {
+    double x, y, z, w;
+};
+
+struct longlong3 {
+    long long int x, y, z;
+};
+
+inline int3 make_int3(int x, int y, int z) {
+    return {x, y, z};
+}
+
+inline uint3 make_uint3(unsigned int x, unsigned int y, unsigned int z) {
+    return {x, y, z};
+}
+
+inline float3 make_float3(float x, float y, float z) {
+    return {x, y, z};
+}
+
+inline double3 make_double3(double x, double y, double z) {
+    return {x, y, z};
+}
+
+inline longlong3 make_longlong3(long long int x, long long int y, long long int z) {
+    return {x, y, z};
+}
+
+// -----------------------------------------------------------------------------
+// Runtime types
+// -----------------------------------------------------------------------------
+
+enum cudaError { cudaSuccess = 0, cudaErrorMemoryAllocation = 2, cudaErrorNotSupported = 801 };
+typedef enum cudaError cudaError_t;
+
+typedef struct CUstream_st* cudaStream_t;
+
+/// Events record host wall-clock time.
+typedef std::chrono::high_resolution_clock::time_point* cudaEvent_t;
+
+}  // end namespace cuda_host
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,274 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host execution of the Chrono::Gpu device code with the CPU backend
+// (CHRONO_GPU_USE_CUDA not defined). Provides host versions of the CUDA
+// qualifiers, intrinsics, atomic operations and runtime API, so that the
+// device functions and kernels can be compiled as C++.
+//
+// Internal to the module (not installed): included, before any other module
+// header, by the implementation files of the CPU backend only. The public
+// headers use the types in ChGpuHostTypes.h, which this header brings into
+// the global namespace (where CUDA declares them).
+//
+// =============================================================================
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <math.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+#include "chrono_gpu/ChGpuHostTypes.h"
+
+// -----------------------------------------------------------------------------
+// Function and variable qualifiers
+// -----------------------------------------------------------------------------
+
+#ifndef __host__
+    #define __host__
+#endif
+#ifndef __device__
+    #define __device__
+#endif
+#if defined(_MSC_VER) && !defined(__inline__)
+    #define __inline__ inline
+#endif
+
+// Kernels are defined in headers included by several translation units
+#define __global__ inline
+#define __shared__
+
+#define CUDART_PI_F 3.141592654f
+
+namespace chrono {
+namespace cuda_host {
+
+// -----------------------------------------------------------------------------
+// Intrinsics
+// -----------------------------------------------------------------------------
+
+inline double rsqrt(double x) {
+    return 1.0 / std::sqrt(x);
+}
+
+inline double __dmul_ru(double x, double y) {
+    return x * y;
+}
+
+inline double __drcp_ru(double x) {
+    return 1.0 / x;
+}
+
+inline long long int __double_as_longlong(double x) {
+    long long int i;
+    std::memcpy(&i, &x, sizeof(double));
+    return i;
+}
+
+inline double __longlong_as_double(long long int i) {
+    double x;
+    std::memcpy(&x, &i, sizeof(double));
+    return x;
+}
+
+// Kernels are executed on the host thread by thread; they must not rely on synchronization within a block.
+inline void __syncthreads() {}
+inline void __threadfence() {}
+
+// -----------------------------------------------------------------------------
+// Atomic operations (relaxed ordering; kernel launches are separated by OpenMP barriers)
+// -----------------------------------------------------------------------------
+
+inline unsigned int atomicCAS(unsigned int* address, unsigned int compare, unsigned int val) {
+#ifdef _MSC_VER
+    return (unsigned int)_InterlockedCompareExchange((volatile long*)address, (long)val, (long)compare);
+#else
+    // On failure, 'compare' is overwritten with the current value; on success it already equals the old value
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return compare;
+#endif
+}
+
+inline unsigned long long int atomicCAS(unsigned long long int* address,
+                                        unsigned long long int compare,
+                                        unsigned long long int val) {
+#ifdef _MSC_VER
+    return (unsigned long long int)_InterlockedCompareExchange64((volatile long long*)address, (long long)val,
+                                                                 (long long)compare);
+#else
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return compare;
+#endif
+}
+
+inline int atomicAdd(int* address, int val) {
+#ifdef _MSC_VER
+    return (int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#endif
+}
+
+inline unsigned int atomicAdd(unsigned int* address, unsigned int val) {
+#ifdef _MSC_VER
+    return (unsigned int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#endif
+}
+
+inline float atomicAdd(float* address, float val) {
+    static_assert(sizeof(float) == sizeof(unsigned int), "unexpected size of float");
+    unsigned int* address_as_uint = reinterpret_cast<unsigned int*>(address);
+    unsigned int old = *(volatile unsigned int*)address_as_uint;
+    unsigned int assumed;
+    float old_val;
+    do {
+        assumed = old;
+        std::memcpy(&old_val, &assumed, sizeof(float));
+        float new_val = old_val + val;
+        unsigned int new_bits;
+        std::memcpy(&new_bits, &new_val, sizeof(float));
+        old = atomicCAS(address_as_uint, assumed, new_bits);
+    } while (assumed != old);
+    return old_val;
+}
+
+// -----------------------------------------------------------------------------
+// Runtime API.
+// Device and managed memory is plain host memory, zero-initialized like freshly mapped CUDA managed pages (parts of
+// the code rely on this). Device synchronization and memory hints are no-ops.
+// -----------------------------------------------------------------------------
+
+enum cudaMemcpyKind {
+    cudaMemcpyHostToHost = 0,
+    cudaMemcpyHostToDevice = 1,
+    cudaMemcpyDeviceToHost = 2,
+    cudaMemcpyDeviceToDevice = 3,
+    cudaMemcpyDefault = 4
+};
+
+enum cudaMemoryAdvise { cudaMemAdviseSetReadMostly = 1, cudaMemAdviseUnsetReadMostly = 2 };
+
+constexpr unsigned int cudaMemAttachGlobal = 0x01;
+
+inline const char* cudaGetErrorString(cudaError_t error) {
+    switch (error) {
+        case cudaSuccess:
+            return "no error";
+        case cudaErrorMemoryAllocation:
+            return "out of memory";
+        default:
+            return "operation not supported";
+    }
+}
+
+inline cudaError_t cudaGetLastError() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaPeekAtLastError() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaGetDevice(int* device) {
+    *device = 0;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaDeviceSynchronize() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMallocManaged(void** ptr, size_t size, unsigned int flags = cudaMemAttachGlobal) {
+    *ptr = std::calloc(size > 0 ? size : 1, 1);
+    return *ptr ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+template <class T>
+inline cudaError_t cudaMallocManaged(T** ptr, size_t size, unsigned int flags = cudaMemAttachGlobal) {
+    return cudaMallocManaged((void**)ptr, size, flags);
+}
+
+template <class T>
+inline cudaError_t cudaMalloc(T** ptr, size_t size) {
+    return cudaMallocManaged((void**)ptr, size, cudaMemAttachGlobal);
+}
+
+inline cudaError_t cudaFree(void* ptr) {
+    std::free(ptr);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemset(void* ptr, int value, size_t count) {
+    std::memset(ptr, value, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void* dst, const void* src, size_t count, cudaMemcpyKind kind) {
+    std::memcpy(dst, src, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemAdvise(const void* ptr, size_t count, cudaMemoryAdvise advice, int device) {
+    return cudaSuccess;
+}
+
+}  // end namespace cuda_host
+}  // end namespace chrono
+
+using namespace chrono::cuda_host;
+
+namespace chrono {
+namespace gpu {
+
+// Per-thread (1D) launch configuration seen by kernels executed on the host; set by the CPU kernel launcher before
+// invoking a kernel for a given thread index.
+extern thread_local uint3 threadIdx;
+extern thread_local uint3 blockIdx;
+extern thread_local uint3 blockDim;
+
+}  // namespace gpu
+}  // namespace chrono
+
+// Kernels are defined at global scope
+using chrono::gpu::threadIdx;
+using chrono::gpu::blockIdx;
+using chrono::gpu::blockDim;
+
+namespace cub {
+/// Abort execution (host replacement of the CUB trap used in device error paths).
+inline void ThreadTrap() {
+    std::abort();
+}
+}  // namespace cub
+
+/// Host version of the CUDA error check (see gpuErrchk in ChGpuDefines.h).
+inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort = true) {
+    if (code != cudaSuccess) {
+        fprintf(stderr, "GPUassert: %s %s %d\n", cudaGetErrorString(code), file, line);
+        if (abort)
+            exit(code);
+    }
+}
@@ -0,0 +1,254 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// OpenMP (CPU) implementation of the ChSystemGpu_impl compute functions.
+// Counterpart of cuda/ChGpu_SMC.cu; uses the same data structures, so that
+// simulation states and checkpoints are interchangeable between backends.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "chrono_gpu/cpu/ChGpuHostCompat.h"
+
+#include "chrono_gpu/cpu/ChGpu_SMC_cpu.h"
+#include "chrono_gpu/utils/ChGpuUtilities.h"
+
+namespace chrono {
+namespace gpu {
+
+float ChSystemGpu_impl::computeArray3SquaredSum(std::vector<float, cudallocator<float>>& arrX,
+                                                std::vector<float, cudallocator<float>>& arrY,
+                                                std::vector<float, cudallocator<float>>& arrZ,
+                                                size_t nSpheres) {
+    float* buffer = sphere_data->sphere_stats_buffer;
+    cpu::launchKernel(num_threads, nSpheres, elementalArray3Squared<float>, buffer, (const float*)arrX.data(),
+                      (const float*)arrY.data(), (const float*)arrZ.data(), nSpheres);
+    return std::accumulate(buffer, buffer + nSpheres, 0.0f);
+}
+
+double ChSystemGpu_impl::GetMaxParticleZ(bool getMax) {
+    size_t nSpheres = sphere_local_pos_Z.size();
+    if (nSpheres == 0)
+        CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
+
+    float* buffer = sphere_data->sphere_stats_buffer;
+    cpu::launchKernel(num_threads, nSpheres, elementalZLocalToGlobal, buffer, sphere_data, (unsigned int)nSpheres,
+                      gran_params);
+    return getMax ? *std::max_element(buffer, buffer + nSpheres) : *std::min_element(buffer, buffer + nSpheres);
+}
+
+unsigned int ChSystemGpu_impl::GetNumParticleAboveZ(float ZValue) {
+    size_t nSpheres = sphere_local_pos_Z.size();
+    if (nSpheres == 0)
+        CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
+
+    unsigned int* buffer = sphere_data->sphere_stats_buffer_int;
+    cpu::launchKernel(num_threads, nSpheres, elementalZAboveValue, buffer, sphere_data, (unsigned int)nSpheres,
+                      gran_params, ZValue);
+    return std::accumulate(buffer, buffer + nSpheres, 0u);
+}
+
+unsigned int ChSystemGpu_impl::GetNumParticleAboveX(float XValue) {
+    size_t nSpheres = sphere_local_pos_X.size();
+    if (nSpheres == 0)
+        CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
+
+    unsigned int* buffer = sphere_data->sphere_stats_buffer_int;
+    cpu::launchKernel(num_threads, nSpheres, elementalXAboveValue, buffer, sphere_data, (unsigned int)nSpheres,
+                      gran_params, XValue);
+    return std::accumulate(buffer, buffer + nSpheres, 0u);
+}
+
+// Reset broadphase data structures
+void ChSystemGpu_impl::resetBroadphaseInformation() {
+    std::fill(SD_NumSpheresTouching.begin(), SD_NumSpheresTouching.end(), 0);
+    std::fill(SD_SphereCompositeOffsets.begin(), SD_SphereCompositeOffsets.end(), 0);
+    std::fill(spheres_in_SD_composite.begin(), spheres_in_SD_composite.end(), NULL_CHGPU_ID);
+}
+
+// Reset sphere acceleration data structures
+void ChSystemGpu_impl::resetSphereAccelerations() {
+    bool frictional = gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS;
+
+    // cache past acceleration data
+    if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
+        std::copy(sphere_acc_X.begin(), sphere_acc_X.begin() + nSpheres, sphere_acc_X_old.begin());
+        std::copy(sphere_acc_Y.begin(), sphere_acc_Y.begin() + nSpheres, sphere_acc_Y_old.begin());
+        std::copy(sphere_acc_Z.begin(), sphere_acc_Z.begin() + nSpheres, sphere_acc_Z_old.begin());
+        // if we have multistep AND friction, cache old alphas
+        if (frictional) {
+            std::copy(sphere_ang_acc_X.begin(), sphere_ang_acc_X.begin() + nSpheres, sphere_ang_acc_X_old.begin());
+            std::copy(sphere_ang_acc_Y.begin(), sphere_ang_acc_Y.begin() + nSpheres, sphere_ang_acc_Y_old.begin());
+            std::copy(sphere_ang_acc_Z.begin(), sphere_ang_acc_Z.begin() + nSpheres, sphere_ang_acc_Z_old.begin());
+        }
+    }
+
+    // reset current accelerations to zero
+    std::fill(sphere_acc_X.begin(), sphere_acc_X.begin() + nSpheres, 0.f);
+    std::fill(sphere_acc_Y.begin(), sphere_acc_Y.begin() + nSpheres, 0.f);
+    std::fill(sphere_acc_Z.begin(), sphere_acc_Z.begin() + nSpheres, 0.f);
+
+    // reset torques to zero, if applicable
+    if (frictional) {
+        std::fill(sphere_ang_acc_X.begin(), sphere_ang_acc_X.begin() + nSpheres, 0.f);
+        std::fill(sphere_ang_acc_Y.begin(), sphere_ang_acc_Y.begin() + nSpheres, 0.f);
+        std::fill(sphere_ang_acc_Z.begin(), sphere_ang_acc_Z.begin() + nSpheres, 0.f);
+    }
+}
+
+float ChSystemGpu_impl::get_max_vel() const {
+    float max_vel2 = 0;
+    for (unsigned int i = 0; i < nSpheres; i++) {
+        float v2 = pos_X_dt[i] * pos_X_dt[i] + pos_Y_dt[i] * pos_Y_dt[i] + pos_Z_dt[i] * pos_Z_dt[i];
+        max_vel2 = std::max(max_vel2, v2);
+    }
+    return std::sqrt(max_vel2);
+}
+
+int3 ChSystemGpu_impl::getSDTripletFromID(unsigned int SD_ID) const {
+    return SDIDTriplet(SD_ID, gran_params);
+}
+
+void ChSystemGpu_impl::setLocalPositions(int64_t* global_pos_X, int64_t* global_pos_Y, int64_t* global_pos_Z) {
+    cpu::launchKernel(num_threads, nSpheres, initializeLocalPositions, sphere_data, global_pos_X, global_pos_Y,
+                      global_pos_Z, nSpheres, gran_params);
+}
+
+void ChSystemGpu_impl::shiftLocalPositions(const int64_t3& offset_delta) {
+    cpu::launchKernel(num_threads, nSpheres, applyBDFrameChange, offset_delta, sphere_data, nSpheres, gran_params);
+}
+
+// Count the number of SDs touched by each sphere
+static void countSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                       unsigned int nSpheres,
+                                       ChSystemGpu_impl::GranParamsPtr gran_params) {
+    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    if (mySphereID < nSpheres) {
+        unsigned int SDsTouched[MAX_SDs_TOUCHED_BY_SPHERE] = {NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID};
+        int3 ownerSD_triplet = SDIDTriplet(sphere_data->sphere_owner_SDs[mySphereID], gran_params);
+        figureOutTouchedSD(sphere_data->sphere_local_pos_X[mySphereID], sphere_data->sphere_local_pos_Y[mySphereID],
+                           sphere_data->sphere_local_pos_Z[mySphereID], ownerSD_triplet, SDsTouched, gran_params);
+        for (unsigned int i = 0; i < MAX_SDs_TOUCHED_BY_SPHERE; i++) {
+            if (SDsTouched[i] != NULL_CHGPU_ID)
+                atomicAdd(sphere_data->SD_NumSpheresTouching + SDsTouched[i], 1u);
+        }
+    }
+}
+
+// The broadphase follows the same three stages as the CUDA implementation: count the spheres touching each SD, do an
+// exclusive prefix scan to obtain offsets in the composite array, and populate the composite array. Since the order in
+// which threads fill in the composite array is not deterministic, the sphere list of each SD is then sorted, so that
+// contact pairs are always processed in the same order. Note that force contributions to spheres touching several SDs
+// (and BC reaction forces) are still accumulated with atomic additions, in an order that depends on the scheduling of
+// the SDs over threads; results may therefore differ slightly between runs with more than one thread.
+void ChSystemGpu_impl::runSphereBroadphase() {
+    METRICS_PRINTF("Resetting broadphase info!\n");
+
+    // reset the number of spheres per SD, the offsets in the big composite array, and the big fat composite array
+    resetBroadphaseInformation();
+
+    // First stage: figure out how many spheres touch each SD
+    cpu::launchKernel(num_threads, nSpheres, countSpheresTouchingEachSD, sphere_data, nSpheres, gran_params);
+
+    // Second stage: exclusive prefix scan
+    unsigned int* out_ptr = SD_SphereCompositeOffsets.data();
+    const unsigned int* in_ptr = SD_NumSpheresTouching.data();
+    unsigned int num_entries = 0;
+    for (unsigned int i = 0; i < nSDs; i++) {
+        out_ptr[i] = num_entries;
+        num_entries += in_ptr[i];
+    }
+
+    // Last stage: assemble the big composite array
+    spheres_in_SD_composite.resize(num_entries, NULL_CHGPU_ID);
+    sphere_data->spheres_in_SD_composite = spheres_in_SD_composite.data();
+
+    // The populate kernel steps on the offsets, so work on a copy in the scratch pad
+    std::copy(SD_SphereCompositeOffsets.begin(), SD_SphereCompositeOffsets.begin() + nSDs,
+              SD_SphereCompositeOffsets_ScratchPad.begin());
+    cpu::launchKernel(num_threads, nSpheres, populateSpheresInEachSD, sphere_data, nSpheres, gran_params);
+
+    unsigned int* composite = spheres_in_SD_composite.data();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads) if (num_threads > 1)
+    for (int sd = 0; sd < (int)nSDs; sd++) {
+        if (in_ptr[sd] > 1)
+            std::sort(composite + out_ptr[sd], composite + out_ptr[sd] + in_ptr[sd]);
+    }
+}
+
+double ChSystemGpu_impl::AdvanceSimulation(float duration) {
+    // Settling simulation loop.
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+    float time_elapsed_SU = 0;  // time elapsed in this advance call
+
+    packSphereDataPointers();
+
+    unsigned int nBCs = (unsigned int)BC_params_list_SU.size();
+
+    for (unsigned int n = 0; n < nsteps; n++) {
+        updateBCPositions();
+        runSphereBroadphase();
+        resetSphereAccelerations();
+        resetBCForces();
+
+        METRICS_PRINTF("Starting computeSphereForces!\n");
+
+        if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            // Compute sphere-sphere forces
+            cpu::forEachSD(num_threads, nSDs, cpu::computeSphereForcesFrictionlessSD<true>, sphere_data, gran_params,
+                           BC_type_list.data(), BC_params_list_SU.data(), nBCs);
+        } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
+                   gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
+            // figure out who is contacting
+            cpu::forEachSD(num_threads, nSDs, cpu::determineContactPairsSD, sphere_data, gran_params);
+
+            if (gran_params->use_mat_based == true) {
+                cpu::launchKernel(num_threads, nSpheres, computeSphereContactForces_matBased, sphere_data, gran_params,
+                                  BC_type_list.data(), BC_params_list_SU.data(), nBCs, nSpheres);
+            } else {
+                cpu::launchKernel(num_threads, nSpheres, computeSphereContactForces, sphere_data, gran_params,
+                                  BC_type_list.data(), BC_params_list_SU.data(), nBCs, nSpheres);
+            }
+        }
+
+        METRICS_PRINTF("Starting integrateSpheres!\n");
+        cpu::launchKernel(num_threads, nSpheres, integrateSpheres, stepSize_SU, sphere_data, nSpheres, gran_params);
+
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+
+            METRICS_PRINTF("Update Friction Data!\n");
+            cpu::launchKernel(num_threads, fricMapSize, updateFrictionData, fricMapSize, sphere_data, gran_params);
+
+            METRICS_PRINTF("Update angular velocity.\n");
+            cpu::launchKernel(num_threads, nSpheres, updateAngVels, stepSize_SU, sphere_data, nSpheres, gran_params);
+        }
+
+        elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);  // Advance current time
+        time_elapsed_SU += stepSize_SU;
+    }
+
+    return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
+}
+
+}  // namespace gpu
+}  // namespace chrono
@@ -0,0 +1,211 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Support functions for the OpenMP (CPU) backend of Chrono::Gpu.
+//
+// Kernels that operate one thread per sphere (or per triangle, per contact
+// slot) are executed unchanged on the host through a parallel loop which sets
+// the kernel launch indices. Kernels that operate one block per subdomain (SD)
+// and stage data in shared memory are re-expressed here as per-SD functions
+// that cache the SD spheres in a local buffer and then loop over them.
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono_gpu/cuda/ChGpu_SMC.cuh"
+
+namespace chrono {
+namespace gpu {
+namespace cpu {
+
+/// Execute a one-thread-per-item kernel on the host, for item indices in [0, n).
+/// The kernel sees a launch configuration with one thread per block, so that threadIdx.x + blockIdx.x * blockDim.x
+/// evaluates to the item index.
+template <typename Kernel, typename... Args>
+void launchKernel(int num_threads, size_t n, Kernel kernel, Args... args) {
+#pragma omp parallel for schedule(static) num_threads(num_threads) if (num_threads > 1 && n > 256)
+    for (int64_t i = 0; i < (int64_t)n; i++) {
+        threadIdx = make_uint3(0, 0, 0);
+        blockDim = make_uint3(1, 1, 1);
+        blockIdx = make_uint3((unsigned int)i, 0, 0);
+        kernel(args...);
+    }
+}
+
+/// Local copy of the data of all spheres touching a given SD.
+/// Sphere positions are expressed relative to this SD (not relative to their owner SD).
+struct SDSpheres {
+    unsigned int count;                                  ///< number of spheres touching this SD
+    unsigned int IDs[MAX_COUNT_OF_SPHERES_PER_SD];       ///< global sphere IDs
+    int3 pos[MAX_COUNT_OF_SPHERES_PER_SD];               ///< sphere positions, local to this SD
+    float3 vel[MAX_COUNT_OF_SPHERES_PER_SD];             ///< sphere linear velocities
+    float3 omega[MAX_COUNT_OF_SPHERES_PER_SD];           ///< sphere angular velocities (if loaded)
+    not_stupid_bool fixed[MAX_COUNT_OF_SPHERES_PER_SD];  ///< sphere fixed flags
+};
+
+/// Load the data of the spheres touching the specified SD.
+/// Return false if there are no spheres in this SD.
+inline bool loadSDSpheres(unsigned int thisSD,
+                          ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                          ChSystemGpu_impl::GranParamsPtr gran_params,
+                          bool load_omega,
+                          SDSpheres& sd) {
+    sd.count = sphere_data->SD_NumSpheresTouching[thisSD];
+    if (sd.count == 0)
+        return false;
+
+    // If we overran, we have a major issue, time to crash before we make illegal memory accesses
+    if (sd.count > MAX_COUNT_OF_SPHERES_PER_SD) {
+        ABORTABORTABORT("TOO MANY SPHERES! SD %u has %u spheres\n", thisSD, sd.count);
+    }
+
+    size_t SD_composite_offset = sphere_data->SD_SphereCompositeOffsets[thisSD];
+    for (unsigned int i = 0; i < sd.count; i++) {
+        unsigned int sphereID = sphere_data->spheres_in_SD_composite[SD_composite_offset + i];
+        sd.IDs[i] = sphereID;
+        sd.pos[i] = make_int3(sphere_data->sphere_local_pos_X[sphereID], sphere_data->sphere_local_pos_Y[sphereID],
+                              sphere_data->sphere_local_pos_Z[sphereID]);
+        // if this SD doesn't own that sphere, add an offset to account
+        unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[sphereID];
+        if (sphere_owner_SD != thisSD) {
+            sd.pos[i] = sd.pos[i] + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
+        }
+        sd.vel[i] = make_float3(sphere_data->pos_X_dt[sphereID], sphere_data->pos_Y_dt[sphereID],
+                                sphere_data->pos_Z_dt[sphereID]);
+        if (load_omega) {
+            sd.omega[i] = make_float3(sphere_data->sphere_Omega_X[sphereID], sphere_data->sphere_Omega_Y[sphereID],
+                                      sphere_data->sphere_Omega_Z[sphereID]);
+        }
+        sd.fixed[i] = sphere_data->sphere_fixed[sphereID];
+    }
+
+    return true;
+}
+
+/// Find the spheres in the given SD which are in contact with sphere 'bodyA' of that SD.
+/// Return the number of contacts; the local indices of the contacting spheres are returned in 'bodyB_list'.
+inline unsigned int findSDContacts(unsigned int thisSD,
+                                   unsigned int bodyA,
+                                   const SDSpheres& sd,
+                                   ChSystemGpu_impl::GranParamsPtr gran_params,
+                                   unsigned int bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE]) {
+    unsigned int ncontacts = 0;
+    for (unsigned int bodyB = 0; bodyB < sd.count; bodyB++) {
+        if (bodyA == bodyB || (sd.fixed[bodyA] && sd.fixed[bodyB])) {
+            continue;
+        }
+        if (checkSpheresContacting_int(sd.pos[bodyA], sd.pos[bodyB], thisSD, gran_params)) {
+            if (ncontacts >= MAX_SPHERES_TOUCHED_BY_SPHERE) {
+                ABORTABORTABORT("Sphere %u is touching 12 spheres already and we just found another!!!\n",
+                                sd.IDs[bodyA]);
+            }
+            bodyB_list[ncontacts++] = bodyB;
+        }
+    }
+    return ncontacts;
+}
+
+/// Host counterpart of the determineContactPairs kernel, for a single SD.
+/// Marks all contact pairs in this SD in the contact partner map.
+inline void determineContactPairsSD(unsigned int thisSD,
+                                    ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                    ChSystemGpu_impl::GranParamsPtr gran_params) {
+    SDSpheres sd;
+    if (!loadSDSpheres(thisSD, sphere_data, gran_params, false, sd))
+        return;
+
+    unsigned int bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
+    for (unsigned int bodyA = 0; bodyA < sd.count; bodyA++) {
+        unsigned int ncontacts = findSDContacts(thisSD, bodyA, sd, gran_params, bodyB_list);
+        for (unsigned int contact_id = 0; contact_id < ncontacts; contact_id++) {
+            findContactPairInfo(sphere_data, gran_params, sd.IDs[bodyA], sd.IDs[bodyB_list[contact_id]]);
+        }
+    }
+}
+
+/// Host counterpart of the computeSphereForces_frictionless(_matBased) kernels, for a single SD.
+/// Accumulates sphere-sphere normal and cohesion forces and, for the spheres owned by this SD, the forces from BCs and
+/// gravity.
+template <bool MAT_BASED>
+void computeSphereForcesFrictionlessSD(unsigned int thisSD,
+                                       ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                       ChSystemGpu_impl::GranParamsPtr gran_params,
+                                       BC_type* bc_type_list,
+                                       BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                       unsigned int nBCs) {
+    SDSpheres sd;
+    if (!loadSDSpheres(thisSD, sphere_data, gran_params, false, sd))
+        return;
+
+    unsigned int bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
+    for (unsigned int bodyA = 0; bodyA < sd.count; bodyA++) {
+        unsigned int ncontacts = findSDContacts(thisSD, bodyA, sd, gran_params, bodyB_list);
+
+        // Force generated on this sphere
+        float3 bodyA_force = {0.f, 0.f, 0.f};
+        for (unsigned int idx = 0; idx < ncontacts; idx++) {
+            unsigned int bodyB = bodyB_list[idx];
+            float3 vrel_t;  // unused but needed for function signature
+            float3 force_accum;
+            if (MAT_BASED) {
+                float sqrt_Rd;  // unused but needed for function signature
+                float beta;
+                float3 contact_normal;
+                force_accum = computeSphereNormalForces_matBased(vrel_t, contact_normal, sqrt_Rd, beta, sd.pos[bodyA],
+                                                                 sd.pos[bodyB], sd.vel[bodyA], sd.vel[bodyB],
+                                                                 gran_params);
+                // Add cohesion term
+                force_accum =
+                    force_accum - gran_params->sphere_mass_SU * gran_params->cohesionAcc_s2s * contact_normal;
+            } else {
+                float reciplength;
+                float3 delta_r;
+                force_accum = computeSphereNormalForces(reciplength, vrel_t, delta_r, sd.pos[bodyA], sd.pos[bodyB],
+                                                        sd.vel[bodyA], sd.vel[bodyB], gran_params);
+                // Add cohesion term
+                force_accum =
+                    force_accum - gran_params->sphere_mass_SU * gran_params->cohesionAcc_s2s * delta_r * reciplength;
+            }
+            bodyA_force = bodyA_force + force_accum;
+        }
+
+        // Only the owner SD adds the wall, BC, and gravity forces (otherwise they would be double counted)
+        unsigned int mySphereID = sd.IDs[bodyA];
+        unsigned int myOwnerSD = sphere_data->sphere_owner_SDs[mySphereID];
+        if (myOwnerSD == thisSD) {
+            applyExternalForces_frictionless(myOwnerSD, sd.pos[bodyA], sd.vel[bodyA], bodyA_force, gran_params,
+                                             sphere_data, bc_type_list, bc_params_list, nBCs);
+        }
+
+        // A sphere touching several SDs receives contributions from each of them
+        atomicAdd(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU);
+        atomicAdd(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU);
+        atomicAdd(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU);
+    }
+}
+
+/// Execute a per-SD function for all SDs, in parallel.
+/// SDs have widely different loads (most are typically empty), so dynamic scheduling is used.
+template <typename Function, typename... Args>
+void forEachSD(int num_threads, unsigned int nSDs, Function func, Args... args) {
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads) if (num_threads > 1)
+    for (int sd = 0; sd < (int)nSDs; sd++) {
+        func((unsigned int)sd, args...);
+    }
+}
+
+}  // namespace cpu
+}  // namespace gpu
+}  // namespace chrono
@@ -0,0 +1,382 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// OpenMP (CPU) implementation of the ChSystemGpuMesh_impl compute functions.
+// Counterpart of cuda/ChGpu_SMC_trimesh.cu.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono_gpu/cpu/ChGpuHostCompat.h"
+
+#include "chrono_gpu/cuda/ChGpu_SMC_trimesh.cuh"
+#include "chrono_gpu/cpu/ChGpu_SMC_cpu.h"
+#include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
+#include "chrono_gpu/utils/ChGpuUtilities.h"
+
+namespace chrono {
+namespace gpu {
+
+// The CUDA implementation generates (SD, triangle) pairs, sorts them by SD with a radix sort, and run-length encodes
+// the sorted keys. Here, the pairs are bucketed by SD with a counting sort, which produces the same (stable) ordering.
+void ChSystemGpuMesh_impl::runTriangleBroadphase() {
+    METRICS_PRINTF("Resetting broadphase info!\n");
+
+    unsigned int numTriangles = meshSoup->nTrianglesInSoup;
+    cpu::launchKernel(num_threads, numTriangles, determineCountOfSDsTouchedByEachTriangle, meshSoup,
+                      Triangle_NumSDsTouching.data(), gran_params, tri_params);
+
+    // exclusive prefix scan to get the offsets of each triangle in the (SD, triangle) arrays
+    unsigned int numOfTriangleTouchingSD_instances = 0;
+    for (unsigned int i = 0; i < numTriangles; i++) {
+        Triangle_SDsCompositeOffsets[i] = numOfTriangleTouchingSD_instances;
+        numOfTriangleTouchingSD_instances += Triangle_NumSDsTouching[i];
+    }
+
+    // resize, if need be, the arrays of (SD, triangle) pairs
+    SDsTouchedByEachTriangle_composite_out.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+    SDsTouchedByEachTriangle_composite.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+    TriangleIDS_ByMultiplicity_out.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+    TriangleIDS_ByMultiplicity.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+
+    cpu::launchKernel(num_threads, numTriangles, storeSDsTouchedByEachTriangle, meshSoup,
+                      (const unsigned int*)Triangle_NumSDsTouching.data(),
+                      (const unsigned int*)Triangle_SDsCompositeOffsets.data(),
+                      SDsTouchedByEachTriangle_composite.data(), TriangleIDS_ByMultiplicity.data(), gran_params,
+                      tri_params);
+
+    // count how many triangles touch each SD
+    std::fill(SD_numTrianglesTouching.begin(), SD_numTrianglesTouching.begin() + nSDs, 0);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++) {
+        unsigned int SD = SDsTouchedByEachTriangle_composite[i];
+        if (SD < nSDs)
+            SD_numTrianglesTouching[SD]++;
+    }
+
+    // assert that no SD has over max amount of triangles; if there is one, exit graciously
+    unsigned int maxTriCount = *std::max_element(SD_numTrianglesTouching.begin(), SD_numTrianglesTouching.begin() + nSDs);
+    if (maxTriCount > MAX_TRIANGLE_COUNT_PER_SD)
+        CHGPU_ERROR("ERROR! %u triangles are found in one of the SDs! The max allowance is %u.\n", maxTriCount,
+                    MAX_TRIANGLE_COUNT_PER_SD);
+
+    // exclusive prefix scan to get the offsets in the big composite array
+    unsigned int offset = 0;
+    for (unsigned int SD = 0; SD < nSDs; SD++) {
+        SD_TrianglesCompositeOffsets[SD] = offset;
+        offset += SD_numTrianglesTouching[SD];
+    }
+
+    // bucket the triangles SD by SD, preserving their order (i.e., ordered by triangle ID within each SD)
+    SD_trianglesInEachSD_composite.resize(numOfTriangleTouchingSD_instances);
+    std::vector<unsigned int> cursor(SD_TrianglesCompositeOffsets.begin(), SD_TrianglesCompositeOffsets.begin() + nSDs);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++) {
+        unsigned int SD = SDsTouchedByEachTriangle_composite[i];
+        if (SD < nSDs)
+            SD_trianglesInEachSD_composite[cursor[SD]++] = TriangleIDS_ByMultiplicity[i];
+    }
+}
+
+// Host counterpart of the interactionGranMat_TriangleSoup(_matBased) kernels, for a single SD.
+template <bool MAT_BASED>
+static void interactionGranMat_TriangleSoup_SD(unsigned int thisSD,
+                                               ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                               ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                               const unsigned int* SD_trianglesInEachSD_composite,
+                                               const unsigned int* SD_numTrianglesTouching,
+                                               const unsigned int* SD_TrianglesCompositeOffsets,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                               ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+                                               unsigned int triangleFamilyHistmapOffset) {
+    unsigned int numSDTriangles = SD_numTrianglesTouching[thisSD];
+    if (numSDTriangles == 0)
+        return;  // no triangle touches this SD
+
+    bool frictional = gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS;
+
+    cpu::SDSpheres sd;
+    if (!cpu::loadSDSpheres(thisSD, sphere_data, gran_params, frictional, sd))
+        return;  // no sphere touches this SD
+
+    // Load the triangles touching this SD, expressed in the global frame (SU)
+    unsigned int triangleIDs[MAX_TRIANGLE_COUNT_PER_SD];
+    double3 node1[MAX_TRIANGLE_COUNT_PER_SD];
+    double3 node2[MAX_TRIANGLE_COUNT_PER_SD];
+    double3 node3[MAX_TRIANGLE_COUNT_PER_SD];
+
+    size_t SD_composite_offset = SD_TrianglesCompositeOffsets[thisSD];
+    for (unsigned int i = 0; i < numSDTriangles; i++) {
+        unsigned int globalID = SD_trianglesInEachSD_composite[SD_composite_offset + i];
+        triangleIDs[i] = globalID;
+
+        unsigned int fam = d_triangleSoup->triangleFamily_ID[globalID];
+        node1[i] = apply_frame_transform<double, float3, double3>(
+            d_triangleSoup->node1[globalID], mesh_params->fam_frame_narrow[fam].pos,
+            mesh_params->fam_frame_narrow[fam].rot_mat);
+        node2[i] = apply_frame_transform<double, float3, double3>(
+            d_triangleSoup->node2[globalID], mesh_params->fam_frame_narrow[fam].pos,
+            mesh_params->fam_frame_narrow[fam].rot_mat);
+        node3[i] = apply_frame_transform<double, float3, double3>(
+            d_triangleSoup->node3[globalID], mesh_params->fam_frame_narrow[fam].pos,
+            mesh_params->fam_frame_narrow[fam].rot_mat);
+
+        convert_pos_UU2SU<double3>(node1[i], gran_params);
+        convert_pos_UU2SU<double3>(node2[i], gran_params);
+        convert_pos_UU2SU<double3>(node3[i], gran_params);
+    }
+
+    for (unsigned int sphereIDLocal = 0; sphereIDLocal < sd.count; sphereIDLocal++) {
+        unsigned int sphereIDGlobal = sd.IDs[sphereIDLocal];
+        float3 sphere_force = {0.f, 0.f, 0.f};
+        float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+
+        // NOTE sphere_pos_local is relative to THIS SD, not its owner SD
+        double3 sphCntr = int64_t3_to_double3(convertPosLocalToGlobal(thisSD, sd.pos[sphereIDLocal], gran_params));
+
+        for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
+            float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
+            float depth;    // Negative in overlap
+            double3 pt1;    // Contact point on triangle
+
+            bool valid_contact = face_sphere_cd(node1[triangleLocalID], node2[triangleLocalID], node3[triangleLocalID],
+                                                sphCntr, gran_params->sphereRadius_SU, normal, depth, pt1);
+
+            // Only the SD containing the contact point processes this contact
+            valid_contact =
+                valid_contact && SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params), gran_params) == thisSD;
+            if (!valid_contact)
+                continue;
+
+            const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
+            float3 pt1_float = make_float3(pt1.x, pt1.y, pt1.z);
+
+            // vector from center of mesh body to contact point, assume this can be held in a float
+            double3 meshCenter_double =
+                make_double3(mesh_params->fam_frame_narrow[fam].pos[0], mesh_params->fam_frame_narrow[fam].pos[1],
+                             mesh_params->fam_frame_narrow[fam].pos[2]);
+            convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
+            double3 fromCenter_double = pt1 - meshCenter_double;
+            float3 fromCenter = make_float3(fromCenter_double.x, fromCenter_double.y, fromCenter_double.z);
+
+            // normal points from triangle to sphere
+            float3 delta = -depth * normal;
+
+            // effective mass = mass_mesh * mass_sphere / (m_mesh + mass_sphere)
+            float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
+            const float sphere_mass_SU = gran_params->sphere_mass_SU;
+            float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
+
+            // relative velocity = v_sphere - v_mesh
+            float3 v_rel = sd.vel[sphereIDLocal] - d_triangleSoup->vel[fam];
+
+            // assumes pos is the center of mass of the mesh
+            float3 meshCenter =
+                make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
+                            mesh_params->fam_frame_broad[fam].pos[2]);
+            convert_pos_UU2SU<float3>(meshCenter, gran_params);
+
+            // NOTE depth is negative and normal points from triangle to sphere center
+            float3 r = pt1_float + normal * (depth / 2) - meshCenter;
+
+            // Add angular velocity contribution from mesh
+            v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
+
+            // add tangential components if they exist
+            if (frictional) {
+                // Vector from the center of sphere to center of contact volume
+                float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                v_rel = v_rel + Cross(sd.omega[sphereIDLocal], r_A);
+            }
+
+            float3 force_accum;
+            float3 tangent_force = {0.f, 0.f, 0.f};
+            unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
+
+            if (MAT_BASED) {
+                float sqrt_Rd = std::sqrt(std::abs(depth) * gran_params->sphereRadius_SU);
+                float Sn = 2.f * mesh_params->E_eff_s2m_SU * sqrt_Rd;
+
+                float loge = (mesh_params->COR_s2m_SU < EPSILON) ? std::log(EPSILON) : std::log(mesh_params->COR_s2m_SU);
+                float beta = loge / std::sqrt(loge * loge + CUDART_PI_F * CUDART_PI_F);
+
+                // stiffness and damping coefficient
+                float kn = (2.f / 3.f) * Sn;
+                float gn = 2 * std::sqrt(5.f / 6.f) * beta * std::sqrt(Sn * m_eff);
+
+                // normal and tangential components of relative velocity
+                float projection = Dot(v_rel, normal);
+                float3 vrel_t = v_rel - projection * normal;
+
+                float forceN_mag = -kn * depth + gn * projection;
+                force_accum = forceN_mag * normal;
+
+                // adhesion term, opposite the spring term
+                force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+                if (frictional) {
+                    tangent_force = computeFrictionForces_matBased(
+                        gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                        mesh_params->static_friction_coeff_s2m, mesh_params->E_eff_s2m_SU, mesh_params->G_eff_s2m_SU,
+                        sqrt_Rd, beta, force_accum, vrel_t, normal, m_eff);
+                }
+            } else {
+                // effective radius is just sphere radius -- assume meshes are locally flat
+                float hertz_force_factor = std::sqrt(std::abs(depth) / gran_params->sphereRadius_SU);
+
+                force_accum = hertz_force_factor * mesh_params->K_n_s2m_SU * delta;
+
+                // adhesion term, opposite the spring term
+                force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+                // normal damping term
+                float3 vrel_n = Dot(v_rel, normal) * normal;
+                v_rel = v_rel - vrel_n;  // v_rel is now tangential relative velocity
+                force_accum = force_accum - hertz_force_factor * mesh_params->Gamma_n_s2m_SU * m_eff * vrel_n;
+
+                if (frictional) {
+                    tangent_force = computeFrictionForces(gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                                                          mesh_params->static_friction_coeff_s2m,
+                                                          mesh_params->K_t_s2m_SU, mesh_params->Gamma_t_s2m_SU,
+                                                          hertz_force_factor, m_eff, force_accum, v_rel, normal);
+                }
+            }
+
+            if (frictional) {
+                // radius pointing from the contact point to the center of particle
+                // (rolling resistance uses the normal force only, as in the CUDA kernels)
+                float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                sphere_AngAcc =
+                    sphere_AngAcc + computeRollingAngAcc(sphere_data, gran_params, mesh_params->rolling_coeff_s2m_SU,
+                                                         mesh_params->spinning_coeff_s2m_SU, force_accum,
+                                                         sd.omega[sphereIDLocal], d_triangleSoup->omega[fam], Rc);
+
+                force_accum = force_accum + tangent_force;
+                sphere_AngAcc = sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
+            }
+
+            sphere_force = sphere_force + force_accum;
+
+            // Force on the mesh is opposite the force on the sphere
+            float3 force_total = -1.f * force_accum;
+            float3 torque = Cross(fromCenter, force_total);
+            atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
+            atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
+            atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
+            atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
+            atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
+            atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
+        }
+
+        // write back sphere forces
+        atomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
+        atomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
+        atomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
+
+        if (frictional) {
+            atomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
+            atomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
+            atomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
+        }
+    }
+}
+
+double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
+    // Settling simulation loop.
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+
+    packSphereDataPointers();
+
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+
+    METRICS_PRINTF("Starting Main Simulation loop!\n");
+
+    unsigned int nBCs = (unsigned int)BC_params_list_SU.size();
+
+    float time_elapsed_SU = 0.f;  // time elapsed in this call (SU)
+    for (; time_elapsed_SU < stepSize_SU * nsteps; time_elapsed_SU += stepSize_SU) {
+        updateBCPositions();
+        runSphereBroadphase();
+
+        resetSphereAccelerations();
+        resetBCForces();
+        if (meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled) {
+            std::fill(meshSoup->generalizedForcesPerFamily,
+                      meshSoup->generalizedForcesPerFamily + 6 * meshSoup->numTriangleFamilies, 0.f);
+            runTriangleBroadphase();
+        }
+
+        METRICS_PRINTF("Starting computeSphereForces!\n");
+
+        if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            // Compute sphere-sphere forces
+            if (gran_params->use_mat_based == true) {
+                cpu::forEachSD(num_threads, nSDs, cpu::computeSphereForcesFrictionlessSD<true>, sphere_data,
+                               gran_params, BC_type_list.data(), BC_params_list_SU.data(), nBCs);
+            } else {
+                cpu::forEachSD(num_threads, nSDs, cpu::computeSphereForcesFrictionlessSD<false>, sphere_data,
+                               gran_params, BC_type_list.data(), BC_params_list_SU.data(), nBCs);
+            }
+        } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
+                   gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
+            // figure out who is contacting
+            cpu::forEachSD(num_threads, nSDs, cpu::determineContactPairsSD, sphere_data, gran_params);
+            if (gran_params->use_mat_based == true) {
+                cpu::launchKernel(num_threads, nSpheres, computeSphereContactForces_matBased, sphere_data, gran_params,
+                                  BC_type_list.data(), BC_params_list_SU.data(), nBCs, nSpheres);
+            } else {
+                cpu::launchKernel(num_threads, nSpheres, computeSphereContactForces, sphere_data, gran_params,
+                                  BC_type_list.data(), BC_params_list_SU.data(), nBCs, nSpheres);
+            }
+        }
+
+        if (meshSoup->numTriangleFamilies != 0 && mesh_collision_enabled) {
+            // triangle labels come after BC labels numerically
+            unsigned int triangleFamilyHistmapOffset = gran_params->nSpheres + 1 + nBCs + 1;
+            // compute sphere-triangle forces
+            if (tri_params->use_mat_based == true) {
+                cpu::forEachSD(num_threads, nSDs, interactionGranMat_TriangleSoup_SD<true>, meshSoup, sphere_data,
+                               (const unsigned int*)SD_trianglesInEachSD_composite.data(),
+                               (const unsigned int*)SD_numTrianglesTouching.data(),
+                               (const unsigned int*)SD_TrianglesCompositeOffsets.data(), gran_params, tri_params,
+                               triangleFamilyHistmapOffset);
+            } else {
+                cpu::forEachSD(num_threads, nSDs, interactionGranMat_TriangleSoup_SD<false>, meshSoup, sphere_data,
+                               (const unsigned int*)SD_trianglesInEachSD_composite.data(),
+                               (const unsigned int*)SD_numTrianglesTouching.data(),
+                               (const unsigned int*)SD_TrianglesCompositeOffsets.data(), gran_params, tri_params,
+                               triangleFamilyHistmapOffset);
+            }
+        }
+
+        METRICS_PRINTF("Starting integrateSpheres!\n");
+        cpu::launchKernel(num_threads, nSpheres, integrateSpheres, stepSize_SU, sphere_data, nSpheres, gran_params);
+
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+            cpu::launchKernel(num_threads, fricMapSize, updateFrictionData, fricMapSize, sphere_data, gran_params);
+            cpu::launchKernel(num_threads, nSpheres, updateAngVels, stepSize_SU, sphere_data, nSpheres, gran_params);
+        }
+
+        elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);  // Advance current time
+    }
+
+    return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
+}
+
+}  // namespace gpu
+}  // namespace chrono
@@ -18,7 +18,6 @@
 #ifndef CUDALLOC_HPP
 #define CUDALLOC_HPP
 
-#include <cuda_runtime_api.h>
 #include <climits>
 #include <iostream>
 #include <memory>
@@ -26,6 +25,14 @@
 #include <type_traits>
 #include <utility>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda_runtime_api.h>
+#else
+    #include <cstdlib>
+#endif
+
 #if (__cplusplus >= 201703L)  // C++17 or newer
 template <class T>
 struct cudallocator {
@@ -82,6 +89,7 @@ class cudallocator {
     void destroy(T* p) { p->~T(); }
 #endif
 
+#ifdef CHRONO_GPU_USE_CUDA
     pointer allocate(size_type n, std::allocator<void>::const_pointer hint = 0) {
         void* vptr;
         cudaError_t err = cudaMallocManaged(&vptr, n * sizeof(T), cudaMemAttachGlobal);
@@ -92,6 +100,18 @@ class cudallocator {
     }
 
     void deallocate(pointer p, size_type n) { cudaFree(p); }
+#else
+    // Host memory, zero-initialized like freshly mapped managed memory (parts of the code rely on this)
+    pointer allocate(size_type n, std::allocator<void>::const_pointer hint = 0) {
+        void* vptr = std::calloc(n > 0 ? n : 1, sizeof(T));
+        if (!vptr) {
+            throw std::bad_alloc();
+        }
+        return (T*)vptr;
+    }
+
+    void deallocate(pointer p, size_type n) { std::free(p); }
+#endif
 
     bool operator==(const cudallocator& other) const { return true; }
     bool operator!=(const cudallocator& other) const { return false; }
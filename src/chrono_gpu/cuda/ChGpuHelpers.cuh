@@ -20,7 +20,9 @@
 #include "chrono_gpu/cuda/ChCudaMathUtils.cuh"
 #include "chrono_gpu/ChGpuDefines.h"
 
-#include <cub/cub.cuh>
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cub/cub.cuh>
+#endif
 
 using chrono::gpu::ChSystemGpu_impl;
 using chrono::gpu::CHGPU_TIME_INTEGRATOR;
@@ -108,13 +110,13 @@ inline __device__ unsigned int SDTripletID(const int i,
                                            const int k,
                                            ChSystemGpu_impl::GranParamsPtr gran_params) {
     // if we're outside the BD in any direction, this is an invalid SD
-    if (i < 0 || i >= gran_params->nSDs_X) {
+    if (i < 0 || (unsigned int)i >= gran_params->nSDs_X) {
         return NULL_CHGPU_ID;
     }
-    if (j < 0 || j >= gran_params->nSDs_Y) {
+    if (j < 0 || (unsigned int)j >= gran_params->nSDs_Y) {
         return NULL_CHGPU_ID;
     }
-    if (k < 0 || k >= gran_params->nSDs_Z) {
+    if (k < 0 || (unsigned int)k >= gran_params->nSDs_Z) {
         return NULL_CHGPU_ID;
     }
     return i * gran_params->nSDs_Y * gran_params->nSDs_Z + j * gran_params->nSDs_Z + k;
@@ -177,8 +179,8 @@ inline __device__ bool checkLocalPointInSD(const int3& point, ChSystemGpu_impl::
     // TODO verify that this is correct
     // TODO optimize me
     bool ret = (point.x >= 0) && (point.y >= 0) && (point.z >= 0);
-    ret = ret && (point.x <= gran_params->SD_size_X_SU) && (point.y <= gran_params->SD_size_Y_SU) &&
-          (point.z <= gran_params->SD_size_Z_SU);
+    ret = ret && ((unsigned int)point.x <= gran_params->SD_size_X_SU) &&
+          ((unsigned int)point.y <= gran_params->SD_size_Y_SU) && ((unsigned int)point.z <= gran_params->SD_size_Z_SU);
     return ret;
 }
 
@@ -271,7 +273,6 @@ inline __device__ void computeSingleStepDisplacement(ChSystemGpu_impl::GranParam
                                                      const float3& rel_vel,
                                                      float3& delta_t) {
     delta_t = rel_vel * gran_params->stepSize_SU;
-    float ut = Length(delta_t);
 }    
 
 // Compute multi-step friction displacement
@@ -16,9 +16,6 @@
 
 #pragma once
 
-#include <cub/cub.cuh>
-
-#include <cuda.h>
 #include <cassert>
 #include <cstdio>
 #include <fstream>
@@ -30,6 +27,12 @@
 #include <algorithm>
 
 #include "chrono_gpu/ChGpuDefines.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cub/cub.cuh>
+    #include <cuda.h>
+#endif
+
 #include "chrono_gpu/physics/ChSystemGpu_impl.h"
 #include "chrono_gpu/cuda/ChCudaMathUtils.cuh"
 #include "chrono_gpu/cuda/ChGpuHelpers.cuh"
@@ -87,9 +90,9 @@ inline __device__ void figureOutTouchedSD(int sphCenter_X_local,
     nz[0] = (sphCenter_Z_local - sphereRadius_SU) > 0 ? 0 : -1;
 
     // if the sphere touches the SD to the positive directions of its owner
-    nx[1] = (sphCenter_X_local + sphereRadius_SU) < gran_params->SD_size_X_SU ? 0 : 1;
-    ny[1] = (sphCenter_Y_local + sphereRadius_SU) < gran_params->SD_size_Y_SU ? 0 : 1;
-    nz[1] = (sphCenter_Z_local + sphereRadius_SU) < gran_params->SD_size_Z_SU ? 0 : 1;
+    nx[1] = (sphCenter_X_local + sphereRadius_SU) < (signed int)gran_params->SD_size_X_SU ? 0 : 1;
+    ny[1] = (sphCenter_Y_local + sphereRadius_SU) < (signed int)gran_params->SD_size_Y_SU ? 0 : 1;
+    nz[1] = (sphCenter_Z_local + sphereRadius_SU) < (signed int)gran_params->SD_size_Z_SU ? 0 : 1;
     // figure out what
     // number of iterations in each direction
     int num_x = (nx[0] == nx[1]) ? 1 : 2;
@@ -174,6 +177,7 @@ static __global__ void elementalXAboveValue(unsigned int* YorN,
     }
 }
 
+#ifdef CHRONO_GPU_USE_CUDA
 /**
  * Template arguments:
  *   - CUB_THREADS: the number of threads used in this kernel, comes into play when invoking CUB block collectives
@@ -266,6 +270,7 @@ __global__ void getNumberOfSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDat
         }
     }
 }
+#endif
 
 /// <summary>
 /// Kernel figures out whether a sphere touches an SD. Since a sphere can touch at most 8 SDs, the number of threads
@@ -481,6 +486,10 @@ inline __device__ void applyExternalForces_frictionless(unsigned int ownerSD,
                                                       bc_params_list[BC_id], bc_params_list[BC_id].track_forces);
                 break;
             }
+            case BC_type::PLATE: {
+                // no sphere force model for plates
+                break;
+            }
         }
     }
     applyGravity(sphere_force, gran_params);
@@ -532,6 +541,10 @@ inline __device__ void applyExternalForces(unsigned int currSphereID,
                                   gran_params, sphere_data, bc_params_list[BC_id], bc_params_list[BC_id].track_forces);
                 break;
             }
+            case BC_type::PLATE: {
+                // no sphere force model for plates
+                break;
+            }
         }
     }
     applyGravity(sphere_force, gran_params);
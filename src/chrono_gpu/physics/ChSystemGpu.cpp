@@ -15,6 +15,12 @@
 #include <string>
 #include <cmath>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifndef CHRONO_GPU_USE_CUDA
+    #include "chrono_gpu/cpu/ChGpuHostCompat.h"
+#endif
+
 #include "chrono_gpu/physics/ChSystemGpu.h"
 #include "chrono_gpu/physics/ChSystemGpu_impl.h"
 #include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
@@ -319,6 +325,10 @@ void ChSystemGpu::SetVerbosity(CHGPU_VERBOSITY level) {
     m_sys->verbosity = level;
 }
 
+void ChSystemGpu::SetNumThreads(int num_threads) {
+    m_sys->num_threads = std::max(num_threads, 1);
+}
+
 void ChSystemGpuMesh::SetMeshVerbosity(CHGPU_MESH_VERBOSITY level) {
     mesh_verbosity = level;
 }
@@ -184,6 +184,12 @@ class CH_GPU_API ChSystemGpu {
     /// Set simualtion verbosity level.
     void SetVerbosity(CHGPU_VERBOSITY level);
 
+    /// Set the number of OpenMP threads used by the CPU backend (default: number of available processors).
+    /// This setting is ignored if Chrono::Gpu was built with the CUDA backend.
+    /// As with the CUDA backend, forces are accumulated with atomic operations, so that multithreaded results are not
+    /// bitwise reproducible.
+    void SetNumThreads(int num_threads);
+
     /// Create an axis-aligned sphere boundary condition.
     size_t CreateBCSphere(const ChVector<float>& center,
                           float radius,
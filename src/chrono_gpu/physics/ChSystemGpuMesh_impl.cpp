@@ -23,6 +23,12 @@
 #include "chrono/core/ChQuaternion.h"
 #include "chrono/core/ChMatrix33.h"
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifndef CHRONO_GPU_USE_CUDA
+    #include "chrono_gpu/cpu/ChGpuHostCompat.h"
+#endif
+
 #include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
 #include "chrono_gpu/utils/ChGpuUtilities.h"
 
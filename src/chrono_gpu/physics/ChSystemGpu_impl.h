@@ -54,11 +54,8 @@ class ChSolverStateData {
     float crntStepSize_SU;  // DN: needs to be brought here from GranParams
     float crntSimTime_SU;   // DN: needs to be brought here from GranParams
   public:
-    ChSolverStateData() {
-        cudaMallocManaged(&pMaxNumberSpheresInAnySD, sizeof(unsigned int));
-        largestMaxNumberSpheresInAnySD_thusFar = 0;
-    }
-    ~ChSolverStateData() { cudaFree(pMaxNumberSpheresInAnySD); }
+    ChSolverStateData();
+    ~ChSolverStateData();
     inline unsigned int* pMM_maxNumberSpheresInAnySD() {
         return pMaxNumberSpheresInAnySD;  ///< returns pointer to managed memory
     }
@@ -450,6 +447,14 @@ class ChSystemGpu_impl {
     /// Setup sphere data, initialize local coords
     void setupSphereDataStructures();
 
+    /// Convert sphere positions from 64-bit global to 32-bit local coordinates and set the owner SDs.
+    /// Implemented by the compute backend (CUDA or CPU).
+    void setLocalPositions(int64_t* global_pos_X, int64_t* global_pos_Y, int64_t* global_pos_Z);
+
+    /// Update local sphere positions and owner SDs after a change of the big domain frame.
+    /// Implemented by the compute backend (CUDA or CPU).
+    void shiftLocalPositions(const int64_t3& offset_delta);
+
     /// Helper function to convert a position in UU to its SU representation while also changing data type
     template <typename T1, typename T2>
     T1 convertToPosSU(T2 val) {
@@ -557,6 +562,9 @@ class ChSystemGpu_impl {
     /// each other
     bool defragment_on_start = true;
 
+    /// Number of OpenMP threads used by the CPU backend (ignored by the CUDA backend)
+    int num_threads;
+
     /// Bit flags indicating what fields to write out during WriteParticleFile
     /// Set with the CHGPU_OUTPUT_FLAGS enum
     unsigned int output_flags;
@@ -169,4 +169,37 @@ void ChContactContainerMulticoreSMC::AddContact(int index, int b1, int s1, int b
     data_manager->host_data.smc_rigid_rigid[index] = real4(cmat.kn, cmat.kt, cmat.gn, cmat.gt);
 }
 
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void WriteHistory(std::ostream& stream, const custom_vector<T>& vec) {
+    uint64_t size = vec.size();
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(reinterpret_cast<const char*>(vec.data()), size * sizeof(T));
+}
+
+template <typename T>
+static void ReadHistory(std::istream& stream, custom_vector<T>& vec) {
+    uint64_t size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    vec.resize(size);
+    stream.read(reinterpret_cast<char*>(vec.data()), size * sizeof(T));
+}
+
+void ChContactContainerMulticoreSMC::WriteExtraState(std::ostream& stream) const {
+    const auto& host_data = data_manager->host_data;
+    WriteHistory(stream, host_data.shear_neigh);
+    WriteHistory(stream, host_data.shear_disp);
+    WriteHistory(stream, host_data.contact_relvel_init);
+    WriteHistory(stream, host_data.contact_duration);
+}
+
+void ChContactContainerMulticoreSMC::ReadExtraState(std::istream& stream) {
+    auto& host_data = data_manager->host_data;
+    ReadHistory(stream, host_data.shear_neigh);
+    ReadHistory(stream, host_data.shear_disp);
+    ReadHistory(stream, host_data.contact_relvel_init);
+    ReadHistory(stream, host_data.contact_duration);
+}
+
 }  // end namespace chrono
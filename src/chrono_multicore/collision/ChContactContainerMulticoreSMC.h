@@ -50,6 +50,12 @@ class CH_MULTICORE_API ChContactContainerMulticoreSMC : public ChContactContaine
     /// Process the contact between the two specified collision shapes on the two specified bodies
     /// (compute composite material properties and load in global data structure).
     virtual void AddContact(int index, int b1, int s1, int b2, int s2) override;
+
+    /// Write the contact history (shear displacements and contact durations) used by the SMC force models.
+    virtual void WriteExtraState(std::ostream& stream) const override;
+
+    /// Read the contact history written by WriteExtraState().
+    virtual void ReadExtraState(std::istream& stream) override;
 };
 
 /// @} multicore_colision
@@ -0,0 +1,489 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Cache of collision geometry processed from mesh files referenced in model
+// description files (URDF, ...).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "chrono_parsers/ChParserMeshCache.h"
+
+#include "chrono/collision/ChCollisionUtilsBullet.h"
+#include "chrono/utils/ChUtilsHash.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+namespace chrono {
+namespace parsers {
+
+// -----------------------------------------------------------------------------
+
+// Cache storage (shared by all threads)
+struct MeshCacheStorage {
+    std::atomic<bool> enabled{false};
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> disk_hits{0};
+    std::mutex mutex;
+    std::string dir;
+    std::unordered_map<std::string, std::shared_ptr<const void>> entries;
+};
+
+static MeshCacheStorage& storage() {
+    static MeshCacheStorage cache;
+    return cache;
+}
+
+// Identification of files in the on-disk cache.
+static const char disk_magic[4] = {'C', 'H', 'M', 'C'};
+static const uint32_t disk_version = 2;
+
+// Size and SHA-256 digest (64 hexadecimal digits) of the mesh file from which a cache entry is created.
+// This information is stored in files of the on-disk cache and checked when they are loaded.
+struct SourceInfo {
+    uint64_t size;
+    std::string digest;
+};
+
+static const size_t source_record_size = sizeof(uint64_t) + 64;
+
+// Read the entire contents of the specified file.
+static bool ReadContents(const std::string& filename, std::string& contents) {
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs.good())
+        return false;
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    contents = oss.str();
+    return true;
+}
+
+// Return the identification of a mesh file with the given contents.
+static SourceInfo GetSourceInfo(const std::string& contents) {
+    return {contents.size(), utils::HashSHA256(contents.data(), contents.size())};
+}
+
+// Construct a key from the data type and the mesh file identification (see utils::MakeContentKey).
+static std::string MakeKey(const std::string& type, const SourceInfo& source) {
+    return type + "_" + std::to_string(source.size) + "_" + source.digest;
+}
+
+// Write the mesh file identification to a file in the on-disk cache.
+static void WriteSource(std::ofstream& ofs, const SourceInfo& source) {
+    ofs.write((const char*)&source.size, sizeof(source.size));
+    ofs.write(source.digest.data(), 64);
+}
+
+// Read the mesh file identification from a file in the on-disk cache and check it against the given one.
+static bool CheckSource(std::ifstream& ifs, const SourceInfo& source) {
+    uint64_t size;
+    char digest[64];
+    ifs.read((char*)&size, sizeof(size));
+    ifs.read(digest, sizeof(digest));
+    return ifs.good() && size == source.size && source.digest.compare(0, 64, digest, 64) == 0;
+}
+
+// Return the lower-case extension of the specified file.
+static std::string GetExtension(const std::string& filename) {
+    auto ext = filesystem::path(filename).extension();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+    return ext;
+}
+
+// Load a triangle mesh from an OBJ or STL file.
+static std::shared_ptr<geometry::ChTriangleMeshConnected> LoadMeshFile(const std::string& filename,
+                                                                       bool load_normals,
+                                                                       bool load_uv) {
+    auto ext = GetExtension(filename);
+    if (ext == "obj")
+        return geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(filename, load_normals, load_uv);
+    if (ext == "stl")
+        return geometry::ChTriangleMeshConnected::CreateFromSTLFile(filename, load_normals);
+    return nullptr;
+}
+
+static std::shared_ptr<const void> Find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    auto it = storage().entries.find(key);
+    if (it == storage().entries.end())
+        return nullptr;
+    storage().hits++;
+    return it->second;
+}
+
+static std::shared_ptr<const void> Insert(const std::string& key, std::shared_ptr<const void> data) {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    auto res = storage().entries.insert({key, data});
+    return res.first->second;
+}
+
+// -----------------------------------------------------------------------------
+
+// Return the name of the on-disk cache file for the given key (empty if the on-disk cache is disabled).
+static std::string DiskFilename(const std::string& key) {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    if (storage().dir.empty())
+        return "";
+    return storage().dir + "/" + key + ".bin";
+}
+
+// Read vertices and (optionally) face indices from a file in the on-disk cache (convex hulls).
+// The file starts with a header with the identification of the source mesh file, followed by the arrays.
+static bool ReadDisk(const std::string& filename,
+                     const SourceInfo& source,
+                     std::vector<ChVector<>>& vertices,
+                     std::vector<ChVector<int>>& faces) {
+    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+    if (!ifs.good())
+        return false;
+    uint64_t size = (uint64_t)ifs.tellg();
+    ifs.seekg(0);
+
+    char magic[4];
+    uint32_t version;
+    uint64_t nv, nf;
+    ifs.read(magic, sizeof(magic));
+    ifs.read((char*)&version, sizeof(version));
+    if (!ifs.good() || std::memcmp(magic, disk_magic, sizeof(magic)) != 0 || version != disk_version)
+        return false;
+    if (!CheckSource(ifs, source))
+        return false;
+
+    // Check the array sizes against the file size before allocating (protects against truncated files)
+    ifs.read((char*)&nv, sizeof(nv));
+    if (!ifs.good() || nv > size / (3 * sizeof(double)))
+        return false;
+    std::vector<double> v(3 * nv);
+    ifs.read((char*)v.data(), v.size() * sizeof(double));
+    ifs.read((char*)&nf, sizeof(nf));
+    if (!ifs.good() || nf > size / (3 * sizeof(int32_t)))
+        return false;
+    std::vector<int32_t> f(3 * nf);
+    ifs.read((char*)f.data(), f.size() * sizeof(int32_t));
+    if (!ifs.good())
+        return false;
+
+    vertices.resize(nv);
+    for (size_t i = 0; i < nv; i++)
+        vertices[i] = ChVector<>(v[3 * i + 0], v[3 * i + 1], v[3 * i + 2]);
+    faces.resize(nf);
+    for (size_t i = 0; i < nf; i++) {
+        for (int k = 0; k < 3; k++) {
+            if (f[3 * i + k] < 0 || f[3 * i + k] >= (int32_t)nv)
+                return false;
+        }
+        faces[i] = ChVector<int>(f[3 * i + 0], f[3 * i + 1], f[3 * i + 2]);
+    }
+
+    return true;
+}
+
+// Return a temporary file name for writing the specified file in the on-disk cache.
+// The data is first written to the temporary file which is then renamed, so that other threads or processes never see
+// a partially written file.
+static std::string TmpFilename(const std::string& filename) {
+    auto thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return filename + "." + std::to_string(thread_id) + ".tmp";
+}
+
+// Write vertices and face indices to a file in the on-disk cache (convex hulls).
+static void WriteDisk(const std::string& filename,
+                      const SourceInfo& source,
+                      const std::vector<ChVector<>>& vertices,
+                      const std::vector<ChVector<int>>& faces) {
+    std::vector<double> v(3 * vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        v[3 * i + 0] = vertices[i].x();
+        v[3 * i + 1] = vertices[i].y();
+        v[3 * i + 2] = vertices[i].z();
+    }
+    std::vector<int32_t> f(3 * faces.size());
+    for (size_t i = 0; i < faces.size(); i++) {
+        f[3 * i + 0] = faces[i].x();
+        f[3 * i + 1] = faces[i].y();
+        f[3 * i + 2] = faces[i].z();
+    }
+    uint64_t nv = vertices.size();
+    uint64_t nf = faces.size();
+
+    auto tmp_filename = TmpFilename(filename);
+    {
+        std::ofstream ofs(tmp_filename, std::ios::binary | std::ios::trunc);
+        if (!ofs.good())
+            return;
+        ofs.write(disk_magic, sizeof(disk_magic));
+        ofs.write((const char*)&disk_version, sizeof(disk_version));
+        WriteSource(ofs, source);
+        ofs.write((const char*)&nv, sizeof(nv));
+        ofs.write((const char*)v.data(), v.size() * sizeof(double));
+        ofs.write((const char*)&nf, sizeof(nf));
+        ofs.write((const char*)f.data(), f.size() * sizeof(int32_t));
+        if (!ofs.good()) {
+            ofs.close();
+            std::remove(tmp_filename.c_str());
+            return;
+        }
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+        std::remove(tmp_filename.c_str());
+}
+
+// Files in the on-disk cache with triangle meshes are in the Chrono binary mesh format (which ignores any trailing data),
+// followed by a trailer with the identification of the source mesh file and of the cache file.
+static const size_t mesh_trailer_size = source_record_size + sizeof(disk_magic) + sizeof(disk_version);
+
+// Read a triangle mesh from a file in the on-disk cache.
+static bool ReadDisk(const std::string& filename,
+                     const SourceInfo& source,
+                     bool load_normals,
+                     bool load_uv,
+                     geometry::ChTriangleMeshConnected& trimesh) {
+    {
+        std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+        if (!ifs.good())
+            return false;
+        uint64_t size = (uint64_t)ifs.tellg();
+        if (size < mesh_trailer_size)
+            return false;
+        ifs.seekg(size - mesh_trailer_size);
+
+        char magic[4];
+        uint32_t version;
+        if (!CheckSource(ifs, source))
+            return false;
+        ifs.read(magic, sizeof(magic));
+        ifs.read((char*)&version, sizeof(version));
+        if (!ifs.good() || std::memcmp(magic, disk_magic, sizeof(magic)) != 0 || version != disk_version)
+            return false;
+    }
+
+    return geometry::ChTriangleMeshConnected::IsBinaryMeshFile(filename) &&
+           trimesh.LoadBinaryMesh(filename, load_normals, load_uv);
+}
+
+// Write a triangle mesh (with all its vertex data) to a file in the on-disk cache.
+static void WriteDisk(const std::string& filename,
+                      const SourceInfo& source,
+                      const geometry::ChTriangleMeshConnected& trimesh) {
+    auto tmp_filename = TmpFilename(filename);
+    bool ok = trimesh.WriteBinaryMesh(tmp_filename);
+    if (ok) {
+        std::ofstream ofs(tmp_filename, std::ios::binary | std::ios::app);
+        WriteSource(ofs, source);
+        ofs.write(disk_magic, sizeof(disk_magic));
+        ofs.write((const char*)&disk_version, sizeof(disk_version));
+        ok = ofs.good();
+    }
+    if (!ok || std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+        std::remove(tmp_filename.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+void ChParserMeshCache::Enable(bool val) {
+    storage().enabled = val;
+    if (!val)
+        Clear();
+}
+
+bool ChParserMeshCache::IsEnabled() {
+    return storage().enabled;
+}
+
+void ChParserMeshCache::SetCacheDirectory(const std::string& dir) {
+    if (!dir.empty())
+        filesystem::create_subdirectory(filesystem::path(dir));
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    storage().dir = dir;
+}
+
+std::string ChParserMeshCache::GetCacheDirectory() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    return storage().dir;
+}
+
+void ChParserMeshCache::Clear() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    storage().entries.clear();
+    storage().hits = 0;
+    storage().disk_hits = 0;
+}
+
+size_t ChParserMeshCache::GetNumEntries() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    return storage().entries.size();
+}
+
+size_t ChParserMeshCache::GetNumHits() {
+    return storage().hits;
+}
+
+size_t ChParserMeshCache::GetNumDiskHits() {
+    return storage().disk_hits;
+}
+
+// -----------------------------------------------------------------------------
+
+// Return the triangle mesh loaded with the given flags from the mesh file with the given name and identification.
+static std::shared_ptr<const geometry::ChTriangleMeshConnected> FindMesh(const std::string& filename,
+                                                                         const SourceInfo& source,
+                                                                         bool load_normals,
+                                                                         bool load_uv) {
+    // Texture coordinates are only available in OBJ files
+    if (GetExtension(filename) == "stl")
+        load_uv = false;
+
+    bool enabled = ChParserMeshCache::IsEnabled();
+    auto key = MakeKey(std::string("TRIMESH") + (load_normals ? "N" : "") + (load_uv ? "UV" : ""), source);
+    if (enabled) {
+        if (auto data = Find(key))
+            return std::static_pointer_cast<const geometry::ChTriangleMeshConnected>(data);
+    }
+
+    std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh;
+    auto disk_filename = DiskFilename(key);
+    if (!disk_filename.empty()) {
+        auto mesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+        if (ReadDisk(disk_filename, source, load_normals, load_uv, *mesh)) {
+            storage().disk_hits++;
+            trimesh = mesh;
+        }
+    }
+
+    if (!trimesh) {
+        trimesh = LoadMeshFile(filename, load_normals, load_uv);
+        if (!trimesh)
+            return nullptr;
+        if (!disk_filename.empty())
+            WriteDisk(disk_filename, source, *trimesh);
+    }
+
+    if (!enabled)
+        return trimesh;
+
+    return std::static_pointer_cast<const geometry::ChTriangleMeshConnected>(Insert(key, trimesh));
+}
+
+// Return the convex hull of the mesh file with the given name and identification.
+// If provided, the given triangle mesh (loaded from that file) is used to calculate the hull.
+static std::shared_ptr<const std::vector<ChVector<>>> FindHull(
+    const std::string& filename,
+    const SourceInfo& source,
+    std::shared_ptr<const geometry::ChTriangleMeshConnected> trimesh) {
+    bool enabled = ChParserMeshCache::IsEnabled();
+    auto key = MakeKey("HULL", source);
+    if (enabled) {
+        if (auto data = Find(key))
+            return std::static_pointer_cast<const std::vector<ChVector<>>>(data);
+    }
+
+    std::shared_ptr<std::vector<ChVector<>>> hull;
+    auto disk_filename = DiskFilename(key);
+    if (!disk_filename.empty()) {
+        auto points = chrono_types::make_shared<std::vector<ChVector<>>>();
+        std::vector<ChVector<int>> faces;
+        if (ReadDisk(disk_filename, source, *points, faces)) {
+            storage().disk_hits++;
+            hull = points;
+        }
+    }
+
+    if (!hull) {
+        // Only the mesh vertices are needed for the hull
+        if (!trimesh)
+            trimesh = LoadMeshFile(filename, false, false);
+        if (!trimesh)
+            return nullptr;
+        geometry::ChTriangleMeshConnected hull_mesh;
+        collision::bt_utils::ChConvexHullLibraryWrapper lh;
+        lh.ComputeHull(trimesh->getCoordsVertices(), hull_mesh);
+        hull = chrono_types::make_shared<std::vector<ChVector<>>>(hull_mesh.getCoordsVertices());
+        // Fall back on the mesh vertices if the hull could not be calculated
+        if (hull->empty())
+            *hull = trimesh->getCoordsVertices();
+        if (!disk_filename.empty())
+            WriteDisk(disk_filename, source, *hull, std::vector<ChVector<int>>());
+    }
+
+    if (!enabled)
+        return hull;
+
+    return std::static_pointer_cast<const std::vector<ChVector<>>>(Insert(key, hull));
+}
+
+std::shared_ptr<const geometry::ChTriangleMeshConnected> ChParserMeshCache::GetTriangleMesh(
+    const std::string& filename,
+    bool load_normals,
+    bool load_uv) {
+    auto ext = GetExtension(filename);
+    if (ext != "obj" && ext != "stl")
+        return nullptr;
+
+    std::string contents;
+    if (!ReadContents(filename, contents))
+        return nullptr;
+
+    return FindMesh(filename, GetSourceInfo(contents), load_normals, load_uv);
+}
+
+std::shared_ptr<const std::vector<ChVector<>>> ChParserMeshCache::GetConvexHull(const std::string& filename) {
+    auto ext = GetExtension(filename);
+    if (ext != "obj" && ext != "stl")
+        return nullptr;
+
+    std::string contents;
+    if (!ReadContents(filename, contents))
+        return nullptr;
+
+    return FindHull(filename, GetSourceInfo(contents), nullptr);
+}
+
+void ChParserMeshCache::Load(const std::vector<std::string>& filenames,
+                             const std::vector<bool>& hulls,
+                             int num_threads,
+                             std::vector<std::shared_ptr<const geometry::ChTriangleMeshConnected>>& trimeshes,
+                             std::vector<std::shared_ptr<const std::vector<ChVector<>>>>& convex_hulls,
+                             bool load_normals,
+                             bool load_uv) {
+    int n = (int)filenames.size();
+    trimeshes.assign(n, nullptr);
+    convex_hulls.assign(n, nullptr);
+
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads) if (num_threads > 1 && n > 1)
+    for (int i = 0; i < n; i++) {
+        auto ext = GetExtension(filenames[i]);
+        std::string contents;
+        if ((ext != "obj" && ext != "stl") || !ReadContents(filenames[i], contents))
+            continue;
+        auto source = GetSourceInfo(contents);
+        trimeshes[i] = FindMesh(filenames[i], source, load_normals, load_uv);
+        if (trimeshes[i] && i < (int)hulls.size() && hulls[i])
+            convex_hulls[i] = FindHull(filenames[i], source, trimeshes[i]);
+    }
+}
+
+}  // end namespace parsers
+}  // end namespace chrono
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Cache of collision geometry processed from mesh files referenced in model
+// description files (URDF, ...).
+//
+// =============================================================================
+
+#ifndef CH_PARSER_MESH_CACHE_H
+#define CH_PARSER_MESH_CACHE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono_parsers/ChApiParsers.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+namespace chrono {
+namespace parsers {
+
+/// @addtogroup parsers_module
+/// @{
+
+/// Process-wide cache of collision geometry processed from mesh files (Wavefront OBJ or STL).\n
+/// Entries are content-addressed: they are identified by the type of processed data (triangle mesh or convex hull)
+/// and by the size and SHA-256 digest of the contents of the mesh file (not by the file name). As such, all models
+/// referencing identical mesh files share the same data, while a mesh file modified on disk results in a new entry.\n
+/// Two cache levels are available, both disabled by default:
+/// - an in-memory cache (see Enable), which shares processed geometry between all models loaded in the same process;
+/// - an on-disk cache (see SetCacheDirectory), which stores processed geometry in a compact binary format so that
+///   subsequent runs do not need to re-parse mesh files or re-compute convex hulls. Each file records the size and
+///   digest of its source mesh file, which are checked when the file is loaded; files that do not match or that are
+///   truncated are ignored and rewritten.
+///
+/// Triangle meshes are cached separately for each combination of load flags (normals, texture coordinates). Cached
+/// data is shared and therefore returned as read-only; copy a mesh to modify it.\n
+/// All functions of this class are thread safe.
+class ChApiParsers ChParserMeshCache {
+  public:
+    ChParserMeshCache(ChParserMeshCache const&) = delete;
+    void operator=(ChParserMeshCache const&) = delete;
+
+    /// Enable/disable the in-memory cache (default: false).
+    /// Disabling the cache also clears all cached entries.
+    static void Enable(bool val);
+
+    /// Return true if the in-memory cache is enabled.
+    static bool IsEnabled();
+
+    /// Set the directory for the on-disk cache (default: none).
+    /// The directory is created if it does not exist. An empty string disables the on-disk cache.
+    static void SetCacheDirectory(const std::string& dir);
+
+    /// Return the directory of the on-disk cache (empty if disabled).
+    static std::string GetCacheDirectory();
+
+    /// Remove all entries from the in-memory cache and reset the hit counters.
+    /// Files in the on-disk cache are not affected.
+    static void Clear();
+
+    /// Return the number of entries in the in-memory cache.
+    static size_t GetNumEntries();
+
+    /// Return the number of in-memory cache hits since the cache was last cleared.
+    static size_t GetNumHits();
+
+    /// Return the number of on-disk cache hits since the cache was last cleared.
+    static size_t GetNumDiskHits();
+
+    /// Return a triangle mesh loaded from the specified OBJ or STL file.
+    /// The load flags have the same meaning as in ChTriangleMeshConnected::CreateFromWavefrontFile and
+    /// ChTriangleMeshConnected::CreateFromSTLFile (texture coordinates are only loaded from OBJ files).
+    /// An empty pointer is returned if the file does not exist or has an unsupported format.
+    static std::shared_ptr<const geometry::ChTriangleMeshConnected> GetTriangleMesh(const std::string& filename,
+                                                                                    bool load_normals = true,
+                                                                                    bool load_uv = false);
+
+    /// Return the vertices of the convex hull of the mesh in the specified OBJ or STL file.
+    /// An empty pointer is returned if the file does not exist or has an unsupported format.
+    static std::shared_ptr<const std::vector<ChVector<>>> GetConvexHull(const std::string& filename);
+
+    /// Process the specified mesh files, using up to the given number of threads.
+    /// For each file, the triangle mesh (loaded with the given flags, see GetTriangleMesh) and, if requested, the
+    /// convex hull are calculated and returned. Entries of the output vectors corresponding to files that cannot be
+    /// loaded are empty pointers.
+    static void Load(const std::vector<std::string>& filenames,
+                     const std::vector<bool>& hulls,
+                     int num_threads,
+                     std::vector<std::shared_ptr<const geometry::ChTriangleMeshConnected>>& trimeshes,
+                     std::vector<std::shared_ptr<const std::vector<ChVector<>>>>& convex_hulls,
+                     bool load_normals = true,
+                     bool load_uv = false);
+
+  private:
+    ChParserMeshCache() {}
+};
+
+/// @} parsers_module
+
+}  // end namespace parsers
+}  // end namespace chrono
+
+#endif
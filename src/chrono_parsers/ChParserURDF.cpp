@@ -23,6 +23,7 @@
 #include <algorithm>
 
 #include "chrono_parsers/ChParserURDF.h"
+#include "chrono_parsers/ChParserMeshCache.h"
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChSphereShape.h"
@@ -49,7 +50,8 @@ using std::endl;
 // Threshold for identifying bodies with zero inertia properties.
 const double inertia_threshold = 1e-6;
 
-ChParserURDF::ChParserURDF(const std::string& filename) : m_filename(filename), m_vis_collision(false), m_sys(nullptr) {
+ChParserURDF::ChParserURDF(const std::string& filename)
+    : m_filename(filename), m_vis_collision(false), m_sys(nullptr), m_num_threads(1) {
     // Read input file into XML string
     std::fstream xml_file(filename, std::fstream::in);
     while (xml_file.good()) {
@@ -171,12 +173,19 @@ void ChParserURDF::EnableCollisionVisualization() {
     m_vis_collision = true;
 }
 
+void ChParserURDF::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChParserURDF::PopulateSystem(ChSystem& sys) {
     // Cache the containing Chrono system
     m_sys = &sys;
 
+    // Load all collision meshes (in parallel)
+    loadCollisionMeshes();
+
     // Start at the root body, create the root (if necessary),
     // then traverse all links recursively to populate the Chrono system
     auto root_link = m_model->getRoot();
@@ -340,13 +349,10 @@ void ChParserURDF::attachCollision(std::shared_ptr<ChBody> body,
                 case urdf::Geometry::MESH: {
                     auto mesh = std::static_pointer_cast<urdf::Mesh>(collision->geometry);
                     auto mesh_filename = m_filepath + "/" + mesh->filename;
-                    auto ext = filesystem::path(mesh->filename).extension();
 
-                    std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh;
-                    if (ext == "obj" || ext == "OBJ")
-                        trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_filename, false);
-                    else if (ext == "stl" || ext == "STL")
-                        trimesh = geometry::ChTriangleMeshConnected::CreateFromSTLFile(mesh_filename, true);
+                    auto mesh_itr = m_coll_meshes.find(mesh_filename);
+                    auto trimesh = mesh_itr != m_coll_meshes.end() ? mesh_itr->second
+                                                                   : ChParserMeshCache::GetTriangleMesh(mesh_filename);
 
                     if (!trimesh) {
                         cout << "Warning: Unsupported format for collision mesh file <" << mesh_filename << ">." << endl;
@@ -358,17 +364,28 @@ void ChParserURDF::attachCollision(std::shared_ptr<ChBody> body,
                                                       ? m_coll_type.find(link_name)->second
                                                       : MeshCollisionType::TRIANGLE_MESH;
                     switch (coll_type) {
-                        case MeshCollisionType::TRIANGLE_MESH:
+                        case MeshCollisionType::TRIANGLE_MESH: {
+                            // Cached meshes are shared; the collision shape gets its own copy
+                            auto coll_mesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(*trimesh);
                             collision_model->AddTriangleMesh(contact_material,              //
-                                                             trimesh, false, false,         //
+                                                             coll_mesh, false, false,       //
                                                              frame.GetPos(), frame.GetA(),  //
                                                              0.002);
                             break;
-                        case MeshCollisionType::CONVEX_HULL:
-                            collision_model->AddConvexHull(contact_material,              //
-                                                           trimesh->getCoordsVertices(),  //
-                                                           frame.GetPos(), frame.GetA());
+                        }
+                        case MeshCollisionType::CONVEX_HULL: {
+                            auto hull_itr = m_coll_hulls.find(mesh_filename);
+                            std::shared_ptr<const std::vector<ChVector<>>> hull;
+                            if (hull_itr != m_coll_hulls.end())
+                                hull = hull_itr->second;
+                            else
+                                hull = ChParserMeshCache::GetConvexHull(mesh_filename);
+                            if (hull)
+                                collision_model->AddConvexHull(contact_material,  //
+                                                               *hull,             //
+                                                               frame.GetPos(), frame.GetA());
                             break;
+                        }
                         case MeshCollisionType::NODE_CLOUD:
                             for (const auto& v : trimesh->getCoordsVertices()) {
                                 collision_model->AddSphere(contact_material, 0.002, v);
@@ -396,6 +413,46 @@ bool Discard(urdf::LinkConstSharedPtr link) {
     return false;
 }
 
+void ChParserURDF::loadCollisionMeshes() {
+    // Collect the mesh files referenced by collision shapes and flag those for which a convex hull is needed
+    std::vector<std::string> filenames;
+    std::vector<bool> hulls;
+    std::map<std::string, size_t> index;
+    for (const auto& link : m_model->links_) {
+        // The collision shapes of a discarded body are attached to its parent body
+        auto body_name = link.first;
+        if (Discard(link.second) && link.second->parent_joint)
+            body_name = link.second->parent_joint->parent_link_name;
+        auto coll_type = m_coll_type.find(body_name);
+        bool hull = coll_type != m_coll_type.end() && coll_type->second == MeshCollisionType::CONVEX_HULL;
+
+        for (const auto& collision : link.second->collision_array) {
+            if (!collision || collision->geometry->type != urdf::Geometry::MESH)
+                continue;
+            auto mesh = std::static_pointer_cast<urdf::Mesh>(collision->geometry);
+            auto mesh_filename = m_filepath + "/" + mesh->filename;
+            auto res = index.insert(std::make_pair(mesh_filename, filenames.size()));
+            if (res.second) {
+                filenames.push_back(mesh_filename);
+                hulls.push_back(hull);
+            } else if (hull) {
+                hulls[res.first->second] = true;
+            }
+        }
+    }
+
+    // Load meshes and calculate convex hulls
+    std::vector<std::shared_ptr<const geometry::ChTriangleMeshConnected>> trimeshes;
+    std::vector<std::shared_ptr<const std::vector<ChVector<>>>> convex_hulls;
+    ChParserMeshCache::Load(filenames, hulls, m_num_threads, trimeshes, convex_hulls);
+
+    for (size_t i = 0; i < filenames.size(); i++) {
+        m_coll_meshes[filenames[i]] = trimeshes[i];
+        if (convex_hulls[i])
+            m_coll_hulls[filenames[i]] = convex_hulls[i];
+    }
+}
+
 // Create a body (with default collision model type) from the provided URDF link.
 // This is called in a base-to-tip traversal, so the parent Chrono body exists.
 std::shared_ptr<ChBodyAuxRef> ChParserURDF::toChBody(urdf::LinkConstSharedPtr link) {
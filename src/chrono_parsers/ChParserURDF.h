@@ -19,6 +19,9 @@
 #ifndef CH_PARSER_URDF_H
 #define CH_PARSER_URDF_H
 
+#include <map>
+#include <vector>
+
 #include "chrono_parsers/ChApiParsers.h"
 
 #include "chrono/physics/ChSystem.h"
@@ -26,6 +29,7 @@
 #include "chrono/physics/ChLinkBase.h"
 #include "chrono/physics/ChLinkMotor.h"
 #include "chrono/physics/ChMaterialSurface.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
 
 #include <urdf_parser/urdf_parser.h>
 
@@ -107,6 +111,12 @@ class ChApiParsers ChParserURDF {
     /// Enable visualization of collision shapes (default: visualization shapes).
     void EnableCollisionVisualization();
 
+    /// Set the number of threads used to load and process collision meshes (default: 1).
+    /// All mesh files referenced by collision shapes are loaded (and their convex hulls calculated, if needed) in
+    /// parallel, before the Chrono model is created. See ChParserMeshCache for caching of processed collision meshes
+    /// across models and across runs.
+    void SetNumThreads(int num_threads);
+
     /// Create the Chrono model in the given system from the parsed URDF model.
     void PopulateSystem(ChSystem& sys);
 
@@ -164,6 +174,9 @@ class ChApiParsers ChParserURDF {
     /// Attach collision assets to a Chrono body.
     void attachCollision(std::shared_ptr<ChBody> body, urdf::LinkConstSharedPtr link, const ChFrame<>& ref_frame);
 
+    /// Load and process all mesh files referenced by collision shapes.
+    void loadCollisionMeshes();
+
     std::string m_filename;                                   ///< URDF file name
     std::string m_filepath;                                   ///< path of URDF file
     std::string m_xml_string;                                 ///< raw model XML string
@@ -177,6 +190,11 @@ class ChApiParsers ChParserURDF {
     std::map<std::string, MeshCollisionType> m_coll_type;     ///< mesh collision type
     std::map<std::string, ActuationType> m_actuated_joints;   ///< actuated joints
     ChContactMaterialData m_default_mat_data;                 ///< default contact material data
+    int m_num_threads;                                        ///< number of threads for loading collision meshes
+
+    /// Collision meshes and convex hulls, keyed by mesh file name.
+    std::map<std::string, std::shared_ptr<const geometry::ChTriangleMeshConnected>> m_coll_meshes;
+    std::map<std::string, std::shared_ptr<const std::vector<ChVector<>>>> m_coll_hulls;
 };
 
 /// @} parsers_module
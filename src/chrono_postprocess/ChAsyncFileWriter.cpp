@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_postprocess/ChAsyncFileWriter.h"
+
+namespace chrono {
+namespace postprocess {
+
+ChAsyncFileWriter::ChAsyncFileWriter(int num_threads, int max_pending)
+    : m_pending(0), m_max_pending(std::max(1, max_pending)), m_stop(false) {
+    num_threads = std::max(1, num_threads);
+    m_queues.resize(num_threads);
+    for (int i = 0; i < num_threads; i++)
+        m_threads.push_back(std::thread(&ChAsyncFileWriter::Run, this, i));
+}
+
+ChAsyncFileWriter::~ChAsyncFileWriter() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_done.wait(lock, [this]() { return m_pending == 0; });
+        m_stop = true;
+    }
+    m_cv_work.notify_all();
+    for (auto& t : m_threads)
+        t.join();
+}
+
+void ChAsyncFileWriter::Write(const std::string& filename, std::vector<char>&& data, bool append) {
+    Queue({filename, std::move(data), nullptr, append});
+}
+
+void ChAsyncFileWriter::Write(const std::string& filename, Formatter formatter, bool append) {
+    Queue({filename, std::vector<char>(), std::move(formatter), append});
+}
+
+void ChAsyncFileWriter::Queue(Job&& job) {
+    size_t worker = std::hash<std::string>()(job.filename) % m_queues.size();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        CheckError();
+        m_cv_done.wait(lock, [this]() { return m_pending < m_max_pending; });
+        m_queues[worker].push_back(std::move(job));
+        m_pending++;
+    }
+    m_cv_work.notify_all();
+}
+
+void ChAsyncFileWriter::Flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_done.wait(lock, [this]() { return m_pending == 0; });
+    CheckError();
+}
+
+int ChAsyncFileWriter::GetNumPending() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending;
+}
+
+// Must be called with the mutex locked.
+void ChAsyncFileWriter::CheckError() {
+    if (!m_error.empty()) {
+        std::string msg = m_error;
+        m_error.clear();
+        throw ChException(msg);
+    }
+}
+
+void ChAsyncFileWriter::Run(int worker) {
+    auto& queue = m_queues[worker];
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_work.wait(lock, [&]() { return m_stop || !queue.empty(); });
+            if (queue.empty())
+                return;
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        std::string error;
+        try {
+            if (job.formatter)
+                job.formatter(job.data);
+            WriteNow(job.filename, job.data, job.append);
+        } catch (const ChException& e) {
+            error = e.what();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!error.empty() && m_error.empty())
+                m_error = error;
+            m_pending--;
+        }
+        m_cv_done.notify_all();
+    }
+}
+
+void ChAsyncFileWriter::WriteNow(const std::string& filename, const std::vector<char>& data, bool append) {
+    std::ofstream file(filename, append ? std::ios::app : std::ios::trunc);
+    if (!file.is_open())
+        throw ChException("Can't open file " + filename + " for writing.");
+    file.write(data.data(), data.size());
+    if (!file.good())
+        throw ChException("Can't write to file " + filename);
+}
+
+void ChAsyncFileWriter::WriteNow(const std::string& filename, const Formatter& formatter, bool append) {
+    std::vector<char> data;
+    formatter(data);
+    WriteNow(filename, data, append);
+}
+
+}  // end namespace postprocess
+}  // end namespace chrono
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHASYNCFILEWRITER_H
+#define CHASYNCFILEWRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono_postprocess/ChApiPostProcess.h"
+
+namespace chrono {
+namespace postprocess {
+
+/// @addtogroup postprocess_module
+/// @{
+
+/// Writer of output files on background threads.
+/// Data already formatted in memory (or a function formatting it) is queued and written to disk by a set of worker
+/// threads, so that the caller does not wait for formatting and file I/O. Files are assigned to workers based on their name, so that all writes to the same file (e.g.,
+/// successive appends to an assets file) are performed in the order in which they were queued. To limit memory usage,
+/// queuing a new file blocks while the number of pending files exceeds a given limit.
+class ChApiPostProcess ChAsyncFileWriter {
+  public:
+    /// Function generating the contents of a file.
+    /// It is invoked on a worker thread and therefore must only access data owned by the function object itself.
+    typedef std::function<void(std::vector<char>& data)> Formatter;
+
+    /// Create a writer with the given number of worker threads and limit on the number of pending files.
+    ChAsyncFileWriter(int num_threads = 1, int max_pending = 16);
+
+    /// Destroy the writer, after writing all pending files.
+    ~ChAsyncFileWriter();
+
+    /// Queue the given data to be written to the specified file (the data is moved into the queue).
+    /// If append is true, the data is appended to the file; otherwise the file is overwritten.
+    /// If an earlier write failed, a ChException is thrown.
+    void Write(const std::string& filename, std::vector<char>&& data, bool append = false);
+
+    /// Queue the given formatter to generate, on a worker thread, the data to be written to the specified file.
+    /// If the formatter throws a ChException, this is reported as a failed write.
+    void Write(const std::string& filename, Formatter formatter, bool append = false);
+
+    /// Wait until all pending files were written.
+    /// If any write failed, a ChException is thrown.
+    void Flush();
+
+    /// Return the number of files queued and not yet written.
+    int GetNumPending();
+
+    /// Write the given data to the specified file, on the calling thread.
+    /// A ChException is thrown if the file cannot be written.
+    static void WriteNow(const std::string& filename, const std::vector<char>& data, bool append = false);
+
+    /// Generate the data with the given formatter and write it to the specified file, on the calling thread.
+    static void WriteNow(const std::string& filename, const Formatter& formatter, bool append = false);
+
+  private:
+    struct Job {
+        std::string filename;
+        std::vector<char> data;
+        Formatter formatter;  ///< if set, generates the data before writing
+        bool append;
+    };
+
+    void Queue(Job&& job);
+    void Run(int worker);
+    void CheckError();
+
+    std::vector<std::thread> m_threads;       ///< worker threads
+    std::vector<std::deque<Job>> m_queues;    ///< per-worker queues of pending jobs
+    std::mutex m_mutex;                       ///< protects queues, counters, and error message
+    std::condition_variable m_cv_work;        ///< signals workers that jobs are available (or stop requested)
+    std::condition_variable m_cv_done;        ///< signals producers that jobs were completed
+    int m_pending;                            ///< number of queued or in-progress jobs
+    int m_max_pending;                        ///< maximum number of pending jobs before Write blocks
+    bool m_stop;                              ///< request workers to exit
+    std::string m_error;                      ///< message of the first failed write
+};
+
+/// @} postprocess_module
+
+}  // end namespace postprocess
+}  // end namespace chrono
+
+#endif
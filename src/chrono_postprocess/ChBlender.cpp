@@ -259,6 +259,9 @@ const std::string ChBlender::unique_bl_id(size_t mpointer) const {
 
 
 void ChBlender::ExportScript(const std::string& filename) {
+    // Make sure that any pending asynchronous output was written
+    Flush();
+
     // Regenerate the list of objects that need Blender rendering
     UpdateRenderList();
 
@@ -359,15 +362,15 @@ void ChBlender::ExportScript(const std::string& filename) {
     this->framenumber--;  // so that it starts again from 0 when calling ExportData() in the simulation while() loop:
 }
 
-void ChBlender::ExportAssets(ChStreamOutAsciiFile& assets_file, ChStreamOutAsciiFile& state_file) {
+void ChBlender::ExportAssets(ChStreamOutAscii& assets_file, ChStreamOutAscii& state_file) {
     for (const auto& item : m_items) {
         ExportShapes(assets_file, state_file, item);
     }
 }
 
 // Write geometries and materials in the Blender assets script for all physics items with a visual model
-void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
-                             ChStreamOutAsciiFile& state_file,
+void ChBlender::ExportShapes(ChStreamOutAscii& assets_file,
+                             ChStreamOutAscii& state_file,
                              std::shared_ptr<ChPhysicsItem> item) {
     // Nothing to do if the item does not have a visual model
     if (!item->GetVisualModel())
@@ -377,7 +380,7 @@ void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
     for (const auto& shape_instance : item->GetVisualModel()->GetShapes()) {
         const auto& shape = shape_instance.first;
 
-        ChStreamOutAsciiFile* mfile;
+        ChStreamOutAscii* mfile;
         std::unordered_map<size_t, std::shared_ptr<ChVisualShape>>* m_shapes;
         std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>* m_materials;
         std::string collection;
@@ -893,7 +896,7 @@ void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
         if (this->m_blender_cameras.find((size_t)camera_instance.get()) != this->m_blender_cameras.end())
             continue;
 
-        ChStreamOutAsciiFile* mfile;
+        ChStreamOutAscii* mfile;
         mfile = &assets_file;
 
         std::string cameraname("camera_" + unique_bl_id((size_t)camera_instance.get()));
@@ -918,7 +921,7 @@ void ChBlender::ExportShapes(ChStreamOutAsciiFile& assets_file,
     }
 }
 
-void ChBlender::ExportMaterials(ChStreamOutAsciiFile& mfile,
+void ChBlender::ExportMaterials(ChStreamOutAscii& mfile,
                                 std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>& m_materials,
                                 const std::vector<std::shared_ptr<ChVisualMaterial>>& materials,
                                 bool per_frame,
@@ -983,9 +986,92 @@ void ChBlender::ExportMaterials(ChStreamOutAsciiFile& mfile,
     }
 }
 
-void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
+// Per-frame state output (the .py file). Text is formatted immediately, while particle frames and contact data are only
+// copied and formatted when the file is written (possibly on a background thread, see SetAsyncOutput).
+class ChBlender::StateOutput {
+  public:
+    struct Contact {
+        ChVector<> pos;
+        ChQuaternion<> rot;
+        ChVector<> force;
+    };
+
+    /// Formatted text, followed by particle frames and contacts.
+    struct Segment {
+        std::vector<char> text;
+        std::vector<ChCoordsys<>> particles;
+        std::vector<Contact> contacts;
+    };
+
+    StateOutput() : m_stream(&m_text) {}
+    StateOutput(const StateOutput&) = delete;
+    StateOutput& operator=(const StateOutput&) = delete;
+
+    /// Stream for the text of the state file.
+    ChStreamOutAscii& Text() { return m_stream; }
+
+    /// End the current segment after the text written so far, and return it for adding particles or contacts.
+    /// The returned reference is valid until the next call.
+    Segment& Split() {
+        m_segments.push_back({std::move(m_text), {}, {}});
+        m_text.clear();
+        return m_segments.back();
+    }
+
+    /// Move the output of the other object at the end of this one.
+    void Append(StateOutput& other) {
+        Split();
+        other.Split();
+        for (auto& segment : other.m_segments)
+            m_segments.push_back(std::move(segment));
+        other.m_segments.clear();
+    }
+
+    /// Return all segments (this object is left empty).
+    std::vector<Segment> Release() {
+        Split();
+        return std::move(m_segments);
+    }
+
+    /// Format the given segments.
+    static void Format(const std::vector<Segment>& segments, std::vector<char>& data) {
+        ChStreamOutAsciiVector state_file(&data);
+        for (const auto& segment : segments) {
+            data.insert(data.end(), segment.text.begin(), segment.text.end());
+            for (const auto& partframe : segment.particles) {
+                state_file << "[(" << partframe.pos.x() << "," << partframe.pos.y() << "," << partframe.pos.z() << "),";
+                state_file << "(" << partframe.rot.e0() << "," << partframe.rot.e1() << "," << partframe.rot.e2() << ","
+                           << partframe.rot.e3() << ")], \n";
+            }
+            for (const auto& contact : segment.contacts) {
+                state_file << "\t\t[";
+                state_file << contact.pos.x() << ", ";
+                state_file << contact.pos.y() << ", ";
+                state_file << contact.pos.z();
+                state_file << ",";
+                state_file << contact.rot.e0() << ", ";
+                state_file << contact.rot.e1() << ", ";
+                state_file << contact.rot.e2() << ", ";
+                state_file << contact.rot.e3();
+                state_file << ",";
+                state_file << contact.force.x() << ", ";
+                state_file << contact.force.y() << ", ";
+                state_file << contact.force.z();
+                state_file << "],\n";
+            }
+        }
+    }
+
+  private:
+    std::vector<char> m_text;
+    ChStreamOutAsciiVector m_stream;
+    std::vector<Segment> m_segments;
+};
+
+void ChBlender::ExportItemState(StateOutput& state,
                                 std::shared_ptr<ChPhysicsItem> item,
                                 const ChFrame<>& parentframe) {
+    ChStreamOutAscii& state_file = state.Text();
     auto vis_model = item->GetVisualModel();
 
     bool has_stored_assets = false;
@@ -1082,13 +1168,11 @@ void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
 
         if (auto particleclones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
             state_file << " [";
-            for (unsigned int m = 0; m < particleclones->GetNparticles(); ++m) {
-                // Get the current coordinate frame of the i-th particle
-                ChCoordsys<> partframe = particleclones->GetParticle(m).GetCoord();
-                state_file << "[(" << partframe.pos.x() << "," << partframe.pos.y() << "," << partframe.pos.z() << "),";
-                state_file << "(" << partframe.rot.e0() << "," << partframe.rot.e1() << "," << partframe.rot.e2() << ","
-                           << partframe.rot.e3() << ")], \n";
-            }
+            // the particle frames are formatted when the state file is written
+            auto& particles = state.Split().particles;
+            particles.reserve(particleclones->GetNparticles());
+            for (unsigned int m = 0; m < particleclones->GetNparticles(); ++m)
+                particles.push_back(particleclones->GetParticle(m).GetCoord());
             state_file << "]\n";
         }
         state_file << ") \n\n";
@@ -1135,18 +1219,70 @@ void ChBlender::ExportData() {
     ExportData(out_path + "/" + std::string(fullname));
 }
 
+// Write the time-dependent data of the given physics item in the state file.
+// Note: this function may be called concurrently for different items and must not modify any shared data.
+void ChBlender::ExportItemData(StateOutput& state, std::shared_ptr<ChPhysicsItem> item) {
+    ChStreamOutAscii& state_file = state.Text();
+
+    // saving a body?
+    if (const auto& body = std::dynamic_pointer_cast<ChBody>(item)) {
+        // Get the current coordinate frame of the i-th object
+        const ChFrame<>& bodyframe = body->GetFrame_REF_to_abs();
+
+        // Dump the POV macro that generates the contained asset(s) tree
+        ExportItemState(state, body, bodyframe >> blender_frame);
+    }
+
+    // saving a cluster of particles?
+    if (const auto& clones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
+        ExportItemState(state, clones, blender_frame);
+    }
+
+    // saving an FEA mesh?
+    if (auto fea_mesh = std::dynamic_pointer_cast<fea::ChMesh>(item)) {
+        ExportItemState(state, fea_mesh, blender_frame);
+    }
+
+    // saving a ChLinkMateGeneric constraint?
+    if (auto linkmate = std::dynamic_pointer_cast<ChLinkMateGeneric>(item)) {
+        if (linkmate->GetBody1() && linkmate->GetBody2() && frames_links_show) {
+            ChFrame<> frAabs = linkmate->GetFrame1() >> *linkmate->GetBody1() >> blender_frame;
+            ChFrame<> frBabs = linkmate->GetFrame2() >> *linkmate->GetBody2() >> blender_frame;
+            state_file << "if chrono_view_links_csys:\n";
+            state_file << "\tmcsysA = make_chrono_csys(";
+            state_file << "(" << frAabs.GetPos().x() << ", " << frAabs.GetPos().y() << ", "
+                       << frAabs.GetPos().z() << "),";
+            state_file << "(" << frAabs.GetRot().e0() << "," << frAabs.GetRot().e1() << ","
+                       << frAabs.GetRot().e2() << "," << frAabs.GetRot().e3() << "),";
+            state_file << "None, chrono_view_links_csys_size) \n";
+            state_file << "\tmcsysA.name = '" << linkmate->GetName() << "_frame_A" << "'\n";
+            state_file << "\tchrono_frame_objects.objects.link(mcsysA)\n";
+            state_file << "\tmcsysB = make_chrono_csys(";
+            state_file << "(" << frBabs.GetPos().x() << ", " << frBabs.GetPos().y() << ", "
+                       << frBabs.GetPos().z() << "),";
+            state_file << "(" << frBabs.GetRot().e0() << "," << frBabs.GetRot().e1() << ","
+                       << frBabs.GetRot().e2() << "," << frBabs.GetRot().e3() << "),";
+            state_file << "None, chrono_view_links_csys_size) \n";
+            state_file << "\tmcsysB.name = '" << linkmate->GetName() << "_frame_B" << "'\n";
+            state_file << "\tchrono_frame_objects.objects.link(mcsysB)\n";
+        }
+    }
+}
+
 void ChBlender::ExportData(const std::string& filename) {
     // Regenerate the list of objects that need POV rendering
     UpdateRenderList();
 
-    // Open the non-mutable single assets file in "append" mode:
-    std::string assets_filename = out_script_filename + ".assets.py";
-    ChStreamOutAsciiFile assets_file((base_path + assets_filename).c_str(), std::ios::app);
+    // All output is first generated in memory and then written to files (possibly asynchronously, see SetAsyncOutput)
+    std::vector<char> assets_buffer;
+    std::vector<char> data_buffer;
+    StateOutput state;
 
     // Generate the nnnnn.dat and nnnnn.py files:
     try {
-        ChStreamOutAsciiFile data_file((base_path + filename + ".dat").c_str());
-        ChStreamOutAsciiFile state_file((base_path + filename + ".py").c_str());
+        // The non-mutable assets are appended to the single assets file
+        ChStreamOutAsciiVector assets_file(&assets_buffer);
+        ChStreamOutAscii& state_file = state.Text();
 
         // reset the maps of mutable (per-frame) assets, so that these will be saved at ExportAssets()
         m_blender_frame_shapes.clear();
@@ -1164,59 +1300,30 @@ void ChBlender::ExportData(const std::string& filename) {
             state_file << "\n\n";
         }
 
-        // Save time-dependent data for the geometry of objects in ...nnnn.POV and in ...nnnn.DAT file
+        // Collect the items with a visual model
+        std::vector<std::shared_ptr<ChPhysicsItem>> items;
+        items.reserve(m_items.size());
         for (const auto& item : m_items) {
-            // Nothing to do if no visual model attached to this physics item
-            if (!item->GetVisualModel())
-                continue;
-
-            // saving a body?
-            if (const auto& body = std::dynamic_pointer_cast<ChBody>(item)) {
-                // Get the current coordinate frame of the i-th object
-                const ChFrame<>& bodyframe = body->GetFrame_REF_to_abs();
-
-                // Dump the POV macro that generates the contained asset(s) tree
-                ExportItemState(state_file, body, bodyframe >> blender_frame);
-            }
-
-            // saving a cluster of particles?
-            if (const auto& clones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
-                ExportItemState(state_file, clones, blender_frame);
-            }
-
-            // saving an FEA mesh?
-            if (auto fea_mesh = std::dynamic_pointer_cast<fea::ChMesh>(item)) {
-                ExportItemState(state_file, fea_mesh, blender_frame);
-            }
+            if (item->GetVisualModel())
+                items.push_back(item);
+        }
 
-            // saving a ChLinkMateGeneric constraint?
-            if (auto linkmate = std::dynamic_pointer_cast<ChLinkMateGeneric>(item)) {
-                if (linkmate->GetBody1() && linkmate->GetBody2() && frames_links_show) {
-                    ChFrame<> frAabs = linkmate->GetFrame1() >> *linkmate->GetBody1() >> blender_frame;
-                    ChFrame<> frBabs = linkmate->GetFrame2() >> *linkmate->GetBody2() >> blender_frame;
-                    state_file << "if chrono_view_links_csys:\n";
-                    state_file << "\tmcsysA = make_chrono_csys(";
-                    state_file << "(" << frAabs.GetPos().x() << ", " << frAabs.GetPos().y() << ", "
-                               << frAabs.GetPos().z() << "),";
-                    state_file << "(" << frAabs.GetRot().e0() << "," << frAabs.GetRot().e1() << ","
-                               << frAabs.GetRot().e2() << "," << frAabs.GetRot().e3() << "),";
-                    state_file << "None, chrono_view_links_csys_size) \n";
-                    state_file << "\tmcsysA.name = '" << linkmate->GetName() << "_frame_A"
-                               << "'\n";
-                    state_file << "\tchrono_frame_objects.objects.link(mcsysA)\n";
-                    state_file << "\tmcsysB = make_chrono_csys(";
-                    state_file << "(" << frBabs.GetPos().x() << ", " << frBabs.GetPos().y() << ", "
-                               << frBabs.GetPos().z() << "),";
-                    state_file << "(" << frBabs.GetRot().e0() << "," << frBabs.GetRot().e1() << ","
-                               << frBabs.GetRot().e2() << "," << frBabs.GetRot().e3() << "),";
-                    state_file << "None, chrono_view_links_csys_size) \n";
-                    state_file << "\tmcsysB.name = '" << linkmate->GetName() << "_frame_B"
-                               << "'\n";
-                    state_file << "\tchrono_frame_objects.objects.link(mcsysB)\n";
-                }
-            }
+        // Save time-dependent data for the geometry of objects in ...nnnn.py file.
+        // Items are split in contiguous chunks, formatted in parallel, and concatenated in order.
+        int num_items = (int)items.size();
+        int num_chunks = std::max(1, std::min(m_num_threads, num_items));
+        std::vector<StateOutput> state_chunks(num_chunks);
+
+#pragma omp parallel for num_threads(num_chunks) if (num_chunks > 1)
+        for (int ic = 0; ic < num_chunks; ic++) {
+            int start = (int)((long long)num_items * ic / num_chunks);
+            int end = (int)((long long)num_items * (ic + 1) / num_chunks);
+            for (int i = start; i < end; i++)
+                ExportItemData(state_chunks[ic], items[i]);
+        }
 
-        }  // end loop on objects
+        for (int ic = 0; ic < num_chunks; ic++)
+            state.Append(state_chunks[ic]);
 
         // #) saving contacts ?
         if (this->mSystem->GetNcontacts() &&
@@ -1242,32 +1349,20 @@ void ChBlender::ExportData(const std::string& filename) {
                         ChQuaternion<> q = plane_coord.Get_A_quaternion();
                         // ChVector<> n1 = localmatr.Get_A_Xaxis();
                         // ChVector<> absreac = localmatr * react_forces;
-                        (*mfile) << "\t\t[";
-                        (*mfile) << pA.x() << ", ";
-                        (*mfile) << pA.y() << ", ";
-                        (*mfile) << pA.z();
-                        (*mfile) << ",";
-                        (*mfile) << q.e0() << ", ";
-                        (*mfile) << q.e1() << ", ";
-                        (*mfile) << q.e2() << ", ";
-                        (*mfile) << q.e3();
-                        (*mfile) << ",";
-                        (*mfile) << react_forces.x() << ", ";
-                        (*mfile) << react_forces.y() << ", ";
-                        (*mfile) << react_forces.z();
-                        (*mfile) << "],\n";
+                        mcontacts->push_back({pA, q, react_forces});
                     }
                     return true;  // to continue scanning contacts
                 }
                 // Data
-                ChStreamOutAsciiFile* mfile;
+                std::vector<StateOutput::Contact>* mcontacts;
             };
 
             state_file << "if chrono_view_contacts:\n";
             state_file << "\tcontacts= np.array([ \n";
 
+            // the contacts are formatted when the state file is written
             auto my_contact_reporter = chrono_types::make_shared<_reporter_class>();
-            my_contact_reporter->mfile = &state_file;
+            my_contact_reporter->mcontacts = &state.Split().contacts;
 
             // scan all contacts
             mSystem->GetContactContainer()->ReportAllContacts(my_contact_reporter);
@@ -1335,6 +1430,12 @@ void ChBlender::ExportData(const std::string& filename) {
             state_file << "\t\t) \n";
         }
 
+        // Write the output files
+        WriteFile(base_path + out_script_filename + ".assets.py", assets_buffer, true);
+        WriteFile(base_path + filename + ".dat", data_buffer);
+        WriteFile(base_path + filename + ".py", [segments = state.Release()](std::vector<char>& data) {
+            StateOutput::Format(segments, data);
+        });
     } catch (const ChException&) {
         char error[400];
         sprintf(error, "Can't save data into file %s.py (or .dat)", filename.c_str());
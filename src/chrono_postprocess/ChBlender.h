@@ -246,18 +246,18 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
 
   private:
     void UpdateRenderList();
-    void ExportAssets(ChStreamOutAsciiFile& assets_file, ChStreamOutAsciiFile& state_file);
-    void ExportShapes(ChStreamOutAsciiFile& assets_file,
-                      ChStreamOutAsciiFile& state_file,
+    void ExportAssets(ChStreamOutAscii& assets_file, ChStreamOutAscii& state_file);
+    void ExportShapes(ChStreamOutAscii& assets_file,
+                      ChStreamOutAscii& state_file,
                       std::shared_ptr<ChPhysicsItem> item);
-    void ExportMaterials(ChStreamOutAsciiFile& mfile,
+    void ExportMaterials(ChStreamOutAscii& mfile,
                          std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>& m_materials,
                          const std::vector<std::shared_ptr<ChVisualMaterial>>& materials,
                          bool per_frame,
                          std::shared_ptr<ChVisualShape> mshape);
-    void ExportItemState(ChStreamOutAsciiFile& state_file,
-                         std::shared_ptr<ChPhysicsItem> item,
-                         const ChFrame<>& parentframe);
+    class StateOutput;
+    void ExportItemState(StateOutput& state, std::shared_ptr<ChPhysicsItem> item, const ChFrame<>& parentframe);
+    void ExportItemData(StateOutput& state, std::shared_ptr<ChPhysicsItem> item);
 
     const std::string unique_bl_id(size_t mpointer) const;
 
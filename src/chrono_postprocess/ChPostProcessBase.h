@@ -15,12 +15,16 @@
 #ifndef CHPOSTPROCESSBASE_H
 #define CHPOSTPROCESSBASE_H
 
+#include <algorithm>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <sstream>
+#include <vector>
 
 #include "chrono/physics/ChSystem.h"
 #include "chrono_postprocess/ChApiPostProcess.h"
+#include "chrono_postprocess/ChAsyncFileWriter.h"
 
 namespace chrono {
 namespace postprocess {
@@ -31,7 +35,7 @@ namespace postprocess {
 /// Base class for post processing implementations
 class ChApiPostProcess ChPostProcessBase {
   public:
-    ChPostProcessBase(ChSystem* system) { mSystem = system; }
+    ChPostProcessBase(ChSystem* system) : m_num_threads(1) { mSystem = system; }
     virtual ~ChPostProcessBase() {}
 
     virtual void SetSystem(ChSystem* system) { mSystem = system; }
@@ -50,8 +54,46 @@ class ChApiPostProcess ChPostProcessBase {
     /// (Must be implemented by children classes)
     virtual void ExportData(const std::string& filename) = 0;
 
+    /// Enable or disable asynchronous output (default: disabled).
+    /// If enabled, the per-frame output generated by ExportData is written to disk by the specified number of
+    /// background threads, so that the simulation does not wait for file I/O. Bulk per-frame data (e.g., particle and
+    /// contact frames) is only copied by ExportData and formatted on the background threads. At most max_pending frames are kept in
+    /// memory; ExportData blocks if the background threads fall behind. Call Flush to wait for all pending output.
+    void SetAsyncOutput(bool async, int num_writers = 1, int max_pending = 16) {
+        m_writer.reset(async ? new ChAsyncFileWriter(num_writers, max_pending) : nullptr);
+    }
+
+    /// Wait until all pending output files were written (no-op if asynchronous output is disabled).
+    void Flush() {
+        if (m_writer)
+            m_writer->Flush();
+    }
+
+    /// Set the number of threads used to format the per-frame output (default: 1).
+    /// The generated output does not depend on the number of threads.
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(1, num_threads); }
+
   protected:
+    /// Write the given output data to a file, either immediately or through the background writer (if enabled).
+    void WriteFile(const std::string& filename, std::vector<char>& data, bool append = false) {
+        if (m_writer)
+            m_writer->Write(filename, std::move(data), append);
+        else
+            ChAsyncFileWriter::WriteNow(filename, data, append);
+    }
+
+    /// Write the output data generated by the given formatter to a file, either immediately or through the background
+    /// writer (if enabled). In the latter case, the formatter runs on a background thread.
+    void WriteFile(const std::string& filename, ChAsyncFileWriter::Formatter formatter, bool append = false) {
+        if (m_writer)
+            m_writer->Write(filename, std::move(formatter), append);
+        else
+            ChAsyncFileWriter::WriteNow(filename, formatter, append);
+    }
+
     ChSystem* mSystem;
+    int m_num_threads;                            ///< number of threads for formatting per-frame output
+    std::unique_ptr<ChAsyncFileWriter> m_writer;  ///< background writer (if asynchronous output enabled)
 };
 
 /// @} postprocess_module
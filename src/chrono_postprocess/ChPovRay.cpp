@@ -195,6 +195,9 @@ void ChPovRay::SetShowContacts(bool show,
 }
 
 void ChPovRay::ExportScript(const std::string& filename) {
+    // Make sure that any pending asynchronous output was written
+    Flush();
+
     // Regenerate the list of objects that need POV rendering
     UpdateRenderList();
 
@@ -393,13 +396,13 @@ void ChPovRay::ExportScript(const std::string& filename) {
     }
 }
 
-void ChPovRay::ExportAssets(ChStreamOutAsciiFile& assets_file) {
+void ChPovRay::ExportAssets(ChStreamOutAscii& assets_file) {
     for (const auto& item : m_items) {
         ExportShapes(assets_file, item);
     }
 }
 
-void ApplyMaterials(ChStreamOutAsciiFile& assets_file,
+void ApplyMaterials(ChStreamOutAscii& assets_file,
                     const std::vector<std::shared_ptr<ChVisualMaterial>>& materials) {
     for (const auto& mat : materials) {
         assets_file << "mt_" << (size_t)mat.get() << "()\n";
@@ -407,7 +410,7 @@ void ApplyMaterials(ChStreamOutAsciiFile& assets_file,
 }
 
 // Write geometries and materials in the POV assets script for all physics items with a visual model
-void ChPovRay::ExportShapes(ChStreamOutAsciiFile& assets_file, std::shared_ptr<ChPhysicsItem> item) {
+void ChPovRay::ExportShapes(ChStreamOutAscii& assets_file, std::shared_ptr<ChPhysicsItem> item) {
     // Nothing to do if the item does not have a visual model
     if (!item->GetVisualModel())
         return;
@@ -631,7 +634,7 @@ void ChPovRay::ExportShapes(ChStreamOutAsciiFile& assets_file, std::shared_ptr<C
     }
 }
 
-void ChPovRay::ExportMaterials(ChStreamOutAsciiFile& assets_file,
+void ChPovRay::ExportMaterials(ChStreamOutAscii& assets_file,
                                const std::vector<std::shared_ptr<ChVisualMaterial>>& materials) {
     for (const auto& mat : materials) {
         // Do nothing if the material was already processed (because it is shared)
@@ -669,7 +672,7 @@ void ChPovRay::ExportMaterials(ChStreamOutAsciiFile& assets_file,
     }
 }
 
-void ChPovRay::ExportObjData(ChStreamOutAsciiFile& pov_file,
+void ChPovRay::ExportObjData(ChStreamOutAscii& pov_file,
                              std::shared_ptr<ChPhysicsItem> item,
                              const ChFrame<>& parentframe) {
     // Check for custom command for this item
@@ -708,18 +711,6 @@ void ChPovRay::ExportObjData(ChStreamOutAsciiFile& pov_file,
     }
     */
 
-    // Check for any cameras attached to the physics item
-    //// RADU TODO: allow using more than one camera at a time?
-    for (const auto& camera : item->GetCameras()) {
-        camera_found_in_assets = true;
-
-        camera_location = camera->GetPosition() >> parentframe;
-        camera_aim = camera->GetAimPoint() >> parentframe;
-        camera_up = camera->GetUpVector() >> parentframe;
-        camera_angle = camera->GetAngle();
-        camera_orthographic = camera->IsOrthographic();
-    }
-
     // Invoke the custom commands string (if any)
     if (num_commands > 0) {
         pov_file << "cm_" << (size_t)item.get() << "()\n";
@@ -751,27 +742,112 @@ void ChPovRay::ExportData() {
     ExportData(out_path + "/" + std::string(fullname));
 }
 
+// Write the time-dependent data of the given physics item in the .pov file, and collect the frames of its particles (if
+// any) for the .dat file. Particle frames are only copied here and formatted when the .dat file is written.
+// Note: this function may be called concurrently for different items and must not modify any shared data.
+void ChPovRay::ExportItemData(ChStreamOutAscii& pov_file,
+                              std::vector<ChCoordsys<>>& particles,
+                              std::shared_ptr<ChPhysicsItem> item) {
+    // saving a body?
+    if (const auto& body = std::dynamic_pointer_cast<ChBody>(item)) {
+        // Get the current coordinate frame of the i-th object
+        ChCoordsys<> assetcsys = CSYSNORM;
+        const ChFrame<>& bodyframe = body->GetFrame_REF_to_abs();
+        assetcsys = bodyframe.GetCoord();
+
+        // Dump the POV macro that generates the contained asset(s) tree
+        ExportObjData(pov_file, body, bodyframe);
+
+        // Show body COG?
+        if (COGs_show) {
+            const ChCoordsys<>& cogcsys = body->GetFrame_COG_to_abs().GetCoord();
+            pov_file << "sh_csysCOG(";
+            pov_file << cogcsys.pos.x() << "," << cogcsys.pos.y() << "," << cogcsys.pos.z() << ",";
+            pov_file << cogcsys.rot.e0() << "," << cogcsys.rot.e1() << "," << cogcsys.rot.e2() << ","
+                     << cogcsys.rot.e3() << ",";
+            pov_file << COGs_size << ")\n";
+        }
+        // Show body frame ref?
+        if (frames_show) {
+            pov_file << "sh_csysFRM(";
+            pov_file << assetcsys.pos.x() << "," << assetcsys.pos.y() << "," << assetcsys.pos.z() << ",";
+            pov_file << assetcsys.rot.e0() << "," << assetcsys.rot.e1() << "," << assetcsys.rot.e2() << ","
+                     << assetcsys.rot.e3() << ",";
+            pov_file << frames_size << ")\n";
+        }
+    }
+
+    // saving a cluster of particles?
+    if (const auto& clones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
+        pov_file << " \n";
+        pov_file << "#declare Index = 0; \n";
+        pov_file << "#while(Index < " << clones->GetNparticles() << ") \n";
+        pov_file << "  #read (MyDatFile, apx, apy, apz, aq0, aq1, aq2, aq3) \n";
+        pov_file << "  object{\n";
+        ChFrame<> nullframe(CSYSNORM);
+        ExportObjData(pov_file, clones, nullframe);
+        pov_file << "  quatRotation(<aq0,aq1,aq2,aq3>)\n";
+        pov_file << "  translate(<apx,apy,apz>)\n";
+        pov_file << "  }\n";
+        pov_file << "  #declare Index = Index + 1; \n";
+        pov_file << "#end \n";
+        pov_file << " \n";
+
+        // Loop on all particle clones
+        particles.reserve(particles.size() + clones->GetNparticles());
+        for (unsigned int m = 0; m < clones->GetNparticles(); ++m)
+            particles.push_back(clones->GetParticle(m).GetCoord());
+    }
+
+    //// RADU TODO: add capability for springs and dampers
+    //// RADU TODO: why only MateGeneric links?!?
+
+    // saving a ChLinkMateGeneric constraint?
+    if (auto linkmate = std::dynamic_pointer_cast<ChLinkMateGeneric>(item)) {
+        if (linkmate->GetBody1() && linkmate->GetBody2() && links_show) {
+            ChFrame<> frAabs = linkmate->GetFrame1() >> *linkmate->GetBody1();
+            ChFrame<> frBabs = linkmate->GetFrame2() >> *linkmate->GetBody2();
+            pov_file << "sh_csysFRM(";
+            pov_file << frAabs.GetPos().x() << "," << frAabs.GetPos().y() << "," << frAabs.GetPos().z() << ",";
+            pov_file << frAabs.GetRot().e0() << "," << frAabs.GetRot().e1() << "," << frAabs.GetRot().e2()
+                     << "," << frAabs.GetRot().e3() << ",";
+            pov_file << links_size * 0.7 << ")\n";  // smaller, as 'slave' csys.
+            pov_file << "sh_csysFRM(";
+            pov_file << frBabs.GetPos().x() << "," << frBabs.GetPos().y() << "," << frBabs.GetPos().z() << ",";
+            pov_file << frBabs.GetRot().e0() << "," << frBabs.GetRot().e1() << "," << frBabs.GetRot().e2()
+                     << "," << frBabs.GetRot().e3() << ",";
+            pov_file << links_size << ")\n";
+        }
+    }
+
+    // saving an FEA mesh?
+    if (auto fea_mesh = std::dynamic_pointer_cast<fea::ChMesh>(item)) {
+        ExportObjData(pov_file, fea_mesh, ChFrame<>());
+    }
+}
+
 void ChPovRay::ExportData(const std::string& filename) {
     // Regenerate the list of objects that need POV rendering
     UpdateRenderList();
 
+    // All output is first generated in memory and then written to files (possibly asynchronously, see SetAsyncOutput).
+    // The .pov file is formatted here; the particle and contact frames for the .dat and .contacts files are only copied
+    // here, and formatted when the files are written.
+    std::vector<char> assets_buffer;
+    std::vector<char> pov_buffer;
+    std::vector<ChCoordsys<>> particles;
+    std::vector<ChVector<>> contacts;  // contact point, normal, and reaction force of each contact
+
     // If using a single-file asset, update it (in case new visual shapes were created during simulation)
     if (single_asset_file) {
-        // open asset file in append mode
-        std::string assets_filename = out_script_filename + ".assets";
-        ChStreamOutAsciiFile assets_file((base_path + assets_filename).c_str(), std::ios::app);
         // populate assets (already present assets will not be appended)
+        ChStreamOutAsciiVector assets_file(&assets_buffer);
         ExportAssets(assets_file);
     }
 
     // Generate the nnnn.dat and nnnn.pov files:
     try {
-        char pathdat[200];
-        sprintf(pathdat, "%s.dat", filename.c_str());
-        ChStreamOutAsciiFile data_file((base_path + filename + ".dat").c_str());
-        ChStreamOutAsciiFile pov_file((base_path + filename + ".pov").c_str());
-
-        camera_found_in_assets = false;
+        ChStreamOutAsciiVector pov_file(&pov_buffer);
 
         // If embedding assets in the .pov file:
         if (!single_asset_file) {
@@ -792,105 +868,57 @@ void ChPovRay::ExportData(const std::string& filename) {
         pov_file << "#declare dat_file = \"" << (filename + ".dat").c_str() << "\"\n";
         pov_file << "#fopen MyDatFile dat_file read \n\n";
 
-        // Save time-dependent data for the geometry of objects in ...nnnn.POV and in ...nnnn.DAT file
+        // Collect the items with a visual model
+        std::vector<std::shared_ptr<ChPhysicsItem>> items;
+        items.reserve(m_items.size());
         for (const auto& item : m_items) {
-            // Nothing to do if no visual model attached to this physics item
-            if (!item->GetVisualModel())
-                continue;
-
-            // saving a body?
-            if (const auto& body = std::dynamic_pointer_cast<ChBody>(item)) {
-                // Get the current coordinate frame of the i-th object
-                ChCoordsys<> assetcsys = CSYSNORM;
-                const ChFrame<>& bodyframe = body->GetFrame_REF_to_abs();
-                assetcsys = bodyframe.GetCoord();
-
-                // Dump the POV macro that generates the contained asset(s) tree
-                ExportObjData(pov_file, body, bodyframe);
-
-                // Show body COG?
-                if (COGs_show) {
-                    const ChCoordsys<>& cogcsys = body->GetFrame_COG_to_abs().GetCoord();
-                    pov_file << "sh_csysCOG(";
-                    pov_file << cogcsys.pos.x() << "," << cogcsys.pos.y() << "," << cogcsys.pos.z() << ",";
-                    pov_file << cogcsys.rot.e0() << "," << cogcsys.rot.e1() << "," << cogcsys.rot.e2() << ","
-                             << cogcsys.rot.e3() << ",";
-                    pov_file << COGs_size << ")\n";
-                }
-                // Show body frame ref?
-                if (frames_show) {
-                    pov_file << "sh_csysFRM(";
-                    pov_file << assetcsys.pos.x() << "," << assetcsys.pos.y() << "," << assetcsys.pos.z() << ",";
-                    pov_file << assetcsys.rot.e0() << "," << assetcsys.rot.e1() << "," << assetcsys.rot.e2() << ","
-                             << assetcsys.rot.e3() << ",";
-                    pov_file << frames_size << ")\n";
-                }
-            }
-
-            // saving a cluster of particles?
-            if (const auto& clones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
-                pov_file << " \n";
-                pov_file << "#declare Index = 0; \n";
-                pov_file << "#while(Index < " << clones->GetNparticles() << ") \n";
-                pov_file << "  #read (MyDatFile, apx, apy, apz, aq0, aq1, aq2, aq3) \n";
-                pov_file << "  object{\n";
-                ChFrame<> nullframe(CSYSNORM);
-                ExportObjData(pov_file, clones, nullframe);
-                pov_file << "  quatRotation(<aq0,aq1,aq2,aq3>)\n";
-                pov_file << "  translate(<apx,apy,apz>)\n";
-                pov_file << "  }\n";
-                pov_file << "  #declare Index = Index + 1; \n";
-                pov_file << "#end \n";
-                pov_file << " \n";
-
-                // Loop on all particle clones
-                for (unsigned int m = 0; m < clones->GetNparticles(); ++m) {
-                    // Get the current coordinate frame of the i-th particle
-                    ChCoordsys<> assetcsys = CSYSNORM;
-                    assetcsys = clones->GetParticle(m).GetCoord();
-
-                    data_file << assetcsys.pos.x() << ", ";
-                    data_file << assetcsys.pos.y() << ", ";
-                    data_file << assetcsys.pos.z() << ", ";
-                    data_file << assetcsys.rot.e0() << ", ";
-                    data_file << assetcsys.rot.e1() << ", ";
-                    data_file << assetcsys.rot.e2() << ", ";
-                    data_file << assetcsys.rot.e3() << ", \n";
-                }  // end loop on particles
-            }
+            if (item->GetVisualModel())
+                items.push_back(item);
+        }
 
-            //// RADU TODO: add capability for springs and dampers
-            //// RADU TODO: why only MateGeneric links?!?
-
-            // saving a ChLinkMateGeneric constraint?
-            if (auto linkmate = std::dynamic_pointer_cast<ChLinkMateGeneric>(item)) {
-                if (linkmate->GetBody1() && linkmate->GetBody2() && links_show) {
-                    ChFrame<> frAabs = linkmate->GetFrame1() >> *linkmate->GetBody1();
-                    ChFrame<> frBabs = linkmate->GetFrame2() >> *linkmate->GetBody2();
-                    pov_file << "sh_csysFRM(";
-                    pov_file << frAabs.GetPos().x() << "," << frAabs.GetPos().y() << "," << frAabs.GetPos().z() << ",";
-                    pov_file << frAabs.GetRot().e0() << "," << frAabs.GetRot().e1() << "," << frAabs.GetRot().e2()
-                             << "," << frAabs.GetRot().e3() << ",";
-                    pov_file << links_size * 0.7 << ")\n";  // smaller, as 'slave' csys.
-                    pov_file << "sh_csysFRM(";
-                    pov_file << frBabs.GetPos().x() << "," << frBabs.GetPos().y() << "," << frBabs.GetPos().z() << ",";
-                    pov_file << frBabs.GetRot().e0() << "," << frBabs.GetRot().e1() << "," << frBabs.GetRot().e2()
-                             << "," << frBabs.GetRot().e3() << ",";
-                    pov_file << links_size << ")\n";
-                }
+        // Check for any cameras attached to the physics items
+        //// RADU TODO: allow using more than one camera at a time?
+        camera_found_in_assets = false;
+        for (const auto& item : items) {
+            ChFrame<> parentframe;
+            if (const auto& body = std::dynamic_pointer_cast<ChBody>(item))
+                parentframe = body->GetFrame_REF_to_abs();
+            else if (!std::dynamic_pointer_cast<ChParticleCloud>(item) && !std::dynamic_pointer_cast<fea::ChMesh>(item))
+                continue;
+            for (const auto& camera : item->GetCameras()) {
+                camera_found_in_assets = true;
+
+                camera_location = camera->GetPosition() >> parentframe;
+                camera_aim = camera->GetAimPoint() >> parentframe;
+                camera_up = camera->GetUpVector() >> parentframe;
+                camera_angle = camera->GetAngle();
+                camera_orthographic = camera->IsOrthographic();
             }
+        }
 
-            // saving an FEA mesh?
-            if (auto fea_mesh = std::dynamic_pointer_cast<fea::ChMesh>(item)) {
-                ExportObjData(pov_file, fea_mesh, ChFrame<>());
-            }
+        // Save time-dependent data for the geometry of objects in ...nnnn.POV and in ...nnnn.DAT file.
+        // Items are split in contiguous chunks, formatted in parallel, and concatenated in order.
+        int num_items = (int)items.size();
+        int num_chunks = std::max(1, std::min(m_num_threads, num_items));
+        std::vector<std::vector<char>> pov_chunks(num_chunks);
+        std::vector<std::vector<ChCoordsys<>>> particle_chunks(num_chunks);
+
+#pragma omp parallel for num_threads(num_chunks) if (num_chunks > 1)
+        for (int ic = 0; ic < num_chunks; ic++) {
+            ChStreamOutAsciiVector pov_chunk(&pov_chunks[ic]);
+            int start = (int)((long long)num_items * ic / num_chunks);
+            int end = (int)((long long)num_items * (ic + 1) / num_chunks);
+            for (int i = start; i < end; i++)
+                ExportItemData(pov_chunk, particle_chunks[ic], items[i]);
+        }
 
-        }  // end loop on objects
+        for (int ic = 0; ic < num_chunks; ic++) {
+            pov_buffer.insert(pov_buffer.end(), pov_chunks[ic].begin(), pov_chunks[ic].end());
+            particles.insert(particles.end(), particle_chunks[ic].begin(), particle_chunks[ic].end());
+        }
 
         // #) saving contacts ?
         if (contacts_show) {
-            ChStreamOutAsciiFile data_contacts((base_path + filename + ".contacts").c_str());
-
             class _reporter_class : public ChContactContainer::ReportContactCallback {
               public:
                 virtual bool OnReportContact(
@@ -907,26 +935,18 @@ void ChPovRay::ExportData(const std::string& filename) {
                     if (fabs(react_forces.x()) > 1e-8 || fabs(react_forces.y()) > 1e-8 ||
                         fabs(react_forces.z()) > 1e-8) {
                         ChMatrix33<> localmatr(plane_coord);
-                        ChVector<> n1 = localmatr.Get_A_Xaxis();
-                        ChVector<> absreac = localmatr * react_forces;
-                        (*mfile) << pA.x() << ", ";
-                        (*mfile) << pA.y() << ", ";
-                        (*mfile) << pA.z() << ", ";
-                        (*mfile) << n1.x() << ", ";
-                        (*mfile) << n1.y() << ", ";
-                        (*mfile) << n1.z() << ", ";
-                        (*mfile) << absreac.x() << ", ";
-                        (*mfile) << absreac.y() << ", ";
-                        (*mfile) << absreac.z() << ", \n";
+                        mcontacts->push_back(pA);
+                        mcontacts->push_back(localmatr.Get_A_Xaxis());
+                        mcontacts->push_back(localmatr * react_forces);
                     }
                     return true;  // to continue scanning contacts
                 }
                 // Data
-                ChStreamOutAsciiFile* mfile;
+                std::vector<ChVector<>>* mcontacts;
             };
 
             auto my_contact_reporter = chrono_types::make_shared<_reporter_class>();
-            my_contact_reporter->mfile = &data_contacts;
+            my_contact_reporter->mcontacts = &contacts;
 
             // scan all contacts
             mSystem->GetContactContainer()->ReportAllContacts(my_contact_reporter);
@@ -956,6 +976,42 @@ void ChPovRay::ExportData(const std::string& filename) {
 
         // At the end of the .pov file, remember to close the .dat
         pov_file << "\n\n#fclose MyDatFile \n";
+
+        // Write the output files
+        if (single_asset_file)
+            WriteFile(base_path + out_script_filename + ".assets", assets_buffer, true);
+        WriteFile(base_path + filename + ".dat", [particles = std::move(particles)](std::vector<char>& data) {
+            ChStreamOutAsciiVector data_file(&data);
+            for (const auto& csys : particles) {
+                data_file << csys.pos.x() << ", ";
+                data_file << csys.pos.y() << ", ";
+                data_file << csys.pos.z() << ", ";
+                data_file << csys.rot.e0() << ", ";
+                data_file << csys.rot.e1() << ", ";
+                data_file << csys.rot.e2() << ", ";
+                data_file << csys.rot.e3() << ", \n";
+            }
+        });
+        WriteFile(base_path + filename + ".pov", pov_buffer);
+        if (contacts_show) {
+            WriteFile(base_path + filename + ".contacts", [contacts = std::move(contacts)](std::vector<char>& data) {
+                ChStreamOutAsciiVector data_contacts(&data);
+                for (size_t i = 0; i < contacts.size(); i += 3) {
+                    const ChVector<>& pA = contacts[i];
+                    const ChVector<>& n1 = contacts[i + 1];
+                    const ChVector<>& absreac = contacts[i + 2];
+                    data_contacts << pA.x() << ", ";
+                    data_contacts << pA.y() << ", ";
+                    data_contacts << pA.z() << ", ";
+                    data_contacts << n1.x() << ", ";
+                    data_contacts << n1.y() << ", ";
+                    data_contacts << n1.z() << ", ";
+                    data_contacts << absreac.x() << ", ";
+                    data_contacts << absreac.y() << ", ";
+                    data_contacts << absreac.z() << ", \n";
+                }
+            });
+        }
     } catch (const ChException&) {
         char error[400];
         sprintf(error, "Can't save data into file %s.pov (or .dat)", filename.c_str());
@@ -204,13 +204,14 @@ class ChApiPostProcess ChPovRay : public ChPostProcessBase {
 
   private:
     void UpdateRenderList();
-    void ExportAssets(ChStreamOutAsciiFile& assets_file);
-    void ExportShapes(ChStreamOutAsciiFile& assets_file, std::shared_ptr<ChPhysicsItem> item);
-    void ExportMaterials(ChStreamOutAsciiFile& assets_file,
+    void ExportAssets(ChStreamOutAscii& assets_file);
+    void ExportShapes(ChStreamOutAscii& assets_file, std::shared_ptr<ChPhysicsItem> item);
+    void ExportMaterials(ChStreamOutAscii& assets_file,
                          const std::vector<std::shared_ptr<ChVisualMaterial>>& materials);
-    void ExportObjData(ChStreamOutAsciiFile& pov_file,
-                       std::shared_ptr<ChPhysicsItem> item,
-                       const ChFrame<>& parentframe);
+    void ExportObjData(ChStreamOutAscii& pov_file, std::shared_ptr<ChPhysicsItem> item, const ChFrame<>& parentframe);
+    void ExportItemData(ChStreamOutAscii& pov_file,
+                        std::vector<ChCoordsys<>>& particles,
+                        std::shared_ptr<ChPhysicsItem> item);
 
     /// List of physics items in the rendering list.
     std::unordered_set<std::shared_ptr<ChPhysicsItem>> m_items;
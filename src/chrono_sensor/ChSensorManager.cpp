@@ -19,6 +19,7 @@
 #include "chrono_sensor/ChSensorManager.h"
 
 #include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
 #include <iomanip>
 #include <iostream>
 
@@ -50,6 +51,10 @@ CH_SENSOR_API void ChSensorManager::Update() {
         pEngine->UpdateSensors(scene);
     }
 
+    // lidars on the CPU backend are rendered synchronously
+    if (m_cpu_engine)
+        m_cpu_engine->UpdateSensors();
+
     // have the sensormanager update all of the non-optix sensor (IMU and GPS).
     // TODO: perhaps create a thread that takes care of this? Tradeoff since IMU should require some data from EVERY
     // step
@@ -70,6 +75,14 @@ CH_SENSOR_API void ChSensorManager::ReconstructScenes() {
     for (auto eng : m_engines) {
         eng->ConstructScene();
     }
+    if (m_cpu_engine)
+        m_cpu_engine->ConstructScene();
+}
+
+CH_SENSOR_API void ChSensorManager::SetNumCpuThreads(int num_threads) {
+    m_num_cpu_threads = num_threads;
+    if (m_cpu_engine && m_num_cpu_threads > 0)
+        m_cpu_engine->SetNumThreads(m_num_cpu_threads);
 }
 
 CH_SENSOR_API void ChSensorManager::SetMaxEngines(int num_groups) {
@@ -91,7 +104,16 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
     }
     m_sensor_list.push_back(sensor);
 
-    if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
+    auto pLidar = std::dynamic_pointer_cast<ChLidarSensor>(sensor);
+    if (pLidar && pLidar->GetRenderBackend() == RenderBackend::CPU) {
+        m_render_sensor.push_back(sensor);
+        if (!m_cpu_engine) {
+            m_cpu_engine = chrono_types::make_shared<ChCpuLidarEngine>(m_system, m_verbose);
+            if (m_num_cpu_threads > 0)
+                m_cpu_engine->SetNumThreads(m_num_cpu_threads);
+        }
+        m_cpu_engine->AssignSensor(pLidar);
+    } else if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
         m_render_sensor.push_back(sensor);
         //******** give each render group all sensor with same update rate *************//
         bool found_group = false;
@@ -26,6 +26,7 @@
 
 #include "chrono_sensor/sensors/ChSensor.h"
 #include "chrono_sensor/optix/ChOptixEngine.h"
+#include "chrono_sensor/cpu/ChCpuLidarEngine.h"
 #include "chrono_sensor/ChDynamicsManager.h"
 #include "chrono_sensor/optix/scene/ChScene.h"
 
@@ -79,6 +80,14 @@ class CH_SENSOR_API ChSensorManager {
     /// @return A shared pointer to an OptiX engine the manager is using
     std::shared_ptr<ChOptixEngine> GetEngine(int context_id);
 
+    /// Get the engine that renders lidars using RenderBackend::CPU
+    /// @return A shared pointer to the CPU lidar engine, or nullptr if no such lidar has been added
+    std::shared_ptr<ChCpuLidarEngine> GetCpuEngine() { return m_cpu_engine; }
+
+    /// Set the number of threads used to render lidars with the CPU backend. Defaults to the number of processors.
+    /// @param num_threads The number of OpenMP threads
+    void SetNumCpuThreads(int num_threads);
+
     /// Calls on the sensor manager to rebuild the scene, translating all objects from the Chrono system into their
     /// appropriate optix objects.
     void ReconstructScenes();
@@ -123,6 +132,8 @@ class CH_SENSOR_API ChSensorManager {
     ChSystem* m_system;                                     ///< Chrono system the manager is attached to
     std::vector<std::shared_ptr<ChOptixEngine>> m_engines;  ///< The optix engine(s) used for rendered sensors
     std::shared_ptr<ChDynamicsManager> m_dynamics_manager;  ///< Container for updating dynamic sensors
+    std::shared_ptr<ChCpuLidarEngine> m_cpu_engine;         ///< Engine for lidars rendered on the CPU
+    int m_num_cpu_threads = 0;                              ///< Threads for the CPU engine (0 for engine default)
 
     int m_allowable_groups = 1;  ///< Default maximum number of allowable engines
 
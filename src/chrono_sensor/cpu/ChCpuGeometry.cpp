@@ -0,0 +1,556 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host-side scene geometry and BVH for ray traced sensors
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChCpuGeometry.h"
+
+namespace chrono {
+namespace sensor {
+
+// subtrees larger than this are built as separate OpenMP tasks
+static const int BVH_TASK_THRESHOLD = 4096;
+// number of bins used when evaluating SAH split candidates
+static const int BVH_NUM_BINS = 16;
+// past this depth, splits fall back to the object median to bound the traversal stack
+static const int BVH_MAX_SAH_DEPTH = 48;
+
+// -----------------------------------------------------------------------------
+// BVH construction
+// -----------------------------------------------------------------------------
+void ChCpuBVH::Build(const std::vector<ChCpuAABB>& prim_boxes, int max_leaf_size) {
+    m_max_leaf_size = std::max(1, max_leaf_size);
+    int n = static_cast<int>(prim_boxes.size());
+
+    m_nodes.clear();
+    m_prim_ids.resize(n);
+    if (n == 0)
+        return;
+
+    // a subtree over n primitives never needs more than 2n-1 nodes, so reserving that many slots up front lets the
+    // two children of any node be built independently
+    m_nodes.resize(2 * n - 1);
+    std::vector<ChVector<float>> centroids(n);
+    for (int i = 0; i < n; i++) {
+        m_prim_ids[i] = i;
+        centroids[i] = prim_boxes[i].Center();
+    }
+
+    BuildRecursive(prim_boxes, centroids, 0, 0, n, 0);
+}
+
+void ChCpuBVH::BuildRecursive(const std::vector<ChCpuAABB>& prim_boxes,
+                              const std::vector<ChVector<float>>& centroids,
+                              int node_id,
+                              int begin,
+                              int end,
+                              int depth) {
+    Node& node = m_nodes[node_id];
+    int n = end - begin;
+
+    ChCpuAABB centroid_box;
+    node.box = ChCpuAABB();
+    for (int i = begin; i < end; i++) {
+        node.box.Extend(prim_boxes[m_prim_ids[i]]);
+        centroid_box.Extend(centroids[m_prim_ids[i]]);
+    }
+
+    if (n <= m_max_leaf_size) {
+        node.first = begin;
+        node.count = n;
+        return;
+    }
+
+    // split along the axis with the largest centroid extent
+    ChVector<float> extent = centroid_box.max - centroid_box.min;
+    unsigned int axis = 0;
+    if (extent.y() > extent[axis])
+        axis = 1;
+    if (extent.z() > extent[axis])
+        axis = 2;
+    int mid = begin + n / 2;
+
+    if (extent[axis] > 0) {
+        bool split_found = false;
+
+        if (depth < BVH_MAX_SAH_DEPTH) {
+            // binned surface area heuristic
+            float bin_scale = BVH_NUM_BINS * 0.9999f / extent[axis];
+            auto bin_of = [&](int id) {
+                return std::min(BVH_NUM_BINS - 1, (int)((centroids[id][axis] - centroid_box.min[axis]) * bin_scale));
+            };
+
+            ChCpuAABB bin_box[BVH_NUM_BINS];
+            int bin_count[BVH_NUM_BINS] = {0};
+            for (int i = begin; i < end; i++) {
+                int b = bin_of(m_prim_ids[i]);
+                bin_count[b]++;
+                bin_box[b].Extend(prim_boxes[m_prim_ids[i]]);
+            }
+
+            float right_area[BVH_NUM_BINS];
+            int right_count[BVH_NUM_BINS];
+            ChCpuAABB acc;
+            int count = 0;
+            for (int b = BVH_NUM_BINS - 1; b > 0; b--) {
+                acc.Extend(bin_box[b]);
+                count += bin_count[b];
+                right_area[b] = acc.HalfArea();
+                right_count[b] = count;
+            }
+
+            acc = ChCpuAABB();
+            count = 0;
+            float best_cost = std::numeric_limits<float>::max();
+            int best_bin = -1;
+            for (int b = 0; b < BVH_NUM_BINS - 1; b++) {
+                acc.Extend(bin_box[b]);
+                count += bin_count[b];
+                if (count == 0 || right_count[b + 1] == 0)
+                    continue;
+                float cost = acc.HalfArea() * count + right_area[b + 1] * right_count[b + 1];
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_bin = b;
+                }
+            }
+
+            if (best_bin >= 0) {
+                auto split = std::partition(m_prim_ids.begin() + begin, m_prim_ids.begin() + end,
+                                            [&](int id) { return bin_of(id) <= best_bin; });
+                mid = static_cast<int>(split - m_prim_ids.begin());
+                split_found = (mid > begin && mid < end);
+            }
+        }
+
+        if (!split_found) {
+            mid = begin + n / 2;
+            std::nth_element(m_prim_ids.begin() + begin, m_prim_ids.begin() + mid, m_prim_ids.begin() + end,
+                             [&](int a, int b) { return centroids[a][axis] < centroids[b][axis]; });
+        }
+    }
+    // else: all centroids coincide and any partition is as good as another
+
+    int left_id = node_id + 1;
+    int right_id = node_id + 2 * (mid - begin);
+    node.count = 0;
+    node.right = right_id;
+
+    if (n > BVH_TASK_THRESHOLD) {
+#pragma omp task default(shared) firstprivate(left_id, begin, mid, depth)
+        BuildRecursive(prim_boxes, centroids, left_id, begin, mid, depth + 1);
+        BuildRecursive(prim_boxes, centroids, right_id, mid, end, depth + 1);
+#pragma omp taskwait
+    } else {
+        BuildRecursive(prim_boxes, centroids, left_id, begin, mid, depth + 1);
+        BuildRecursive(prim_boxes, centroids, right_id, mid, end, depth + 1);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Primitive intersection, in the local frame of the instance
+// -----------------------------------------------------------------------------
+static inline bool IntersectBox(const ChVector<float>& o,
+                                const ChVector<float>& d,
+                                const ChVector<float>& half_size,
+                                float tmin,
+                                float& t,
+                                ChVector<float>& n) {
+    float t0 = -std::numeric_limits<float>::max();
+    float t1 = std::numeric_limits<float>::max();
+    unsigned int axis0 = 0;
+    unsigned int axis1 = 0;
+    for (unsigned int k = 0; k < 3; k++) {
+        if (std::abs(d[k]) < 1e-12f) {
+            if (std::abs(o[k]) > half_size[k])
+                return false;
+            continue;
+        }
+        float inv = 1.f / d[k];
+        float ta = (-half_size[k] - o[k]) * inv;
+        float tb = (half_size[k] - o[k]) * inv;
+        if (ta > tb)
+            std::swap(ta, tb);
+        if (ta > t0) {
+            t0 = ta;
+            axis0 = k;
+        }
+        if (tb < t1) {
+            t1 = tb;
+            axis1 = k;
+        }
+    }
+    if (t0 > t1)
+        return false;
+
+    float t_hit;
+    unsigned int axis;
+    if (t0 >= tmin) {
+        t_hit = t0;
+        axis = axis0;
+    } else if (t1 >= tmin) {  // ray starts inside the box
+        t_hit = t1;
+        axis = axis1;
+    } else {
+        return false;
+    }
+    if (t_hit >= t)
+        return false;
+
+    t = t_hit;
+    n = ChVector<float>(0, 0, 0);
+    n[axis] = (o[axis] + t_hit * d[axis] > 0) ? 1.f : -1.f;
+    return true;
+}
+
+static inline bool IntersectSphere(const ChVector<float>& o,
+                                   const ChVector<float>& d,
+                                   float radius,
+                                   float tmin,
+                                   float& t,
+                                   ChVector<float>& n) {
+    float b = o.Dot(d);
+    float c = o.Dot(o) - radius * radius;
+    float disc = b * b - c;
+    if (disc < 0)
+        return false;
+    float sq = std::sqrt(disc);
+    float t_hit = -b - sq;
+    if (t_hit < tmin)
+        t_hit = -b + sq;
+    if (t_hit < tmin || t_hit >= t)
+        return false;
+
+    t = t_hit;
+    n = o + d * t_hit;
+    return true;
+}
+
+static inline bool IntersectCylinder(const ChVector<float>& o,
+                                     const ChVector<float>& d,
+                                     float radius,
+                                     float half_height,
+                                     float tmin,
+                                     float& t,
+                                     ChVector<float>& n) {
+    bool found = false;
+
+    // side of the cylinder
+    float a = d.x() * d.x() + d.y() * d.y();
+    if (a > 1e-12f) {
+        float b = o.x() * d.x() + o.y() * d.y();
+        float c = o.x() * o.x() + o.y() * o.y() - radius * radius;
+        float disc = b * b - a * c;
+        if (disc >= 0) {
+            float sq = std::sqrt(disc);
+            float roots[2] = {(-b - sq) / a, (-b + sq) / a};
+            for (float root : roots) {
+                if (root >= tmin && root < t && std::abs(o.z() + root * d.z()) <= half_height) {
+                    t = root;
+                    n = ChVector<float>(o.x() + root * d.x(), o.y() + root * d.y(), 0);
+                    found = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // end caps
+    if (std::abs(d.z()) > 1e-12f) {
+        for (float side : {-1.f, 1.f}) {
+            float t_cap = (side * half_height - o.z()) / d.z();
+            if (t_cap >= tmin && t_cap < t) {
+                float px = o.x() + t_cap * d.x();
+                float py = o.y() + t_cap * d.y();
+                if (px * px + py * py <= radius * radius) {
+                    t = t_cap;
+                    n = ChVector<float>(0, 0, side);
+                    found = true;
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+static inline bool IntersectTriangle(const ChVector<float>& o,
+                                     const ChVector<float>& d,
+                                     const ChVector<float>& v0,
+                                     const ChVector<float>& v1,
+                                     const ChVector<float>& v2,
+                                     float tmin,
+                                     float& t,
+                                     ChVector<float>& n) {
+    ChVector<float> e1 = v1 - v0;
+    ChVector<float> e2 = v2 - v0;
+    ChVector<float> p = d.Cross(e2);
+    float det = e1.Dot(p);
+    if (std::abs(det) < 1e-12f)
+        return false;
+    float inv_det = 1.f / det;
+
+    ChVector<float> s = o - v0;
+    float u = s.Dot(p) * inv_det;
+    if (u < 0 || u > 1)
+        return false;
+    ChVector<float> q = s.Cross(e1);
+    float v = d.Dot(q) * inv_det;
+    if (v < 0 || u + v > 1)
+        return false;
+    float t_hit = e2.Dot(q) * inv_det;
+    if (t_hit < tmin || t_hit >= t)
+        return false;
+
+    t = t_hit;
+    n = e1.Cross(e2);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Scene construction
+// -----------------------------------------------------------------------------
+void ChCpuGeometry::Clear() {
+    m_instances.clear();
+    m_meshes.clear();
+    m_top_bvh = ChCpuBVH();
+}
+
+void ChCpuGeometry::AddBox(std::shared_ptr<ChBody> body,
+                           const ChFrame<double>& asset_frame,
+                           const ChVector<double>& lengths) {
+    ChCpuInstance inst;
+    inst.type = ChCpuShapeType::BOX;
+    inst.body = body;
+    inst.asset_frame = asset_frame;
+    inst.size = ChVector<float>(0.5 * lengths);
+    inst.mesh_id = -1;
+    inst.lidar_intensity = 1.f;
+    m_instances.push_back(inst);
+}
+
+void ChCpuGeometry::AddSphere(std::shared_ptr<ChBody> body, const ChFrame<double>& asset_frame, double radius) {
+    ChCpuInstance inst;
+    inst.type = ChCpuShapeType::SPHERE;
+    inst.body = body;
+    inst.asset_frame = asset_frame;
+    inst.size = ChVector<float>((float)radius);
+    inst.mesh_id = -1;
+    inst.lidar_intensity = 1.f;
+    m_instances.push_back(inst);
+}
+
+void ChCpuGeometry::AddCylinder(std::shared_ptr<ChBody> body,
+                                const ChFrame<double>& asset_frame,
+                                double radius,
+                                double height) {
+    ChCpuInstance inst;
+    inst.type = ChCpuShapeType::CYLINDER;
+    inst.body = body;
+    inst.asset_frame = asset_frame;
+    inst.size = ChVector<float>((float)radius, (float)radius, (float)(0.5 * height));
+    inst.mesh_id = -1;
+    inst.lidar_intensity = 1.f;
+    m_instances.push_back(inst);
+}
+
+void ChCpuGeometry::AddMesh(std::shared_ptr<ChBody> body,
+                            const ChFrame<double>& asset_frame,
+                            std::shared_ptr<ChTriangleMeshShape> mesh_shape) {
+    // reuse the hierarchy of a known rigid mesh with the same data and scale
+    int mesh_id = -1;
+    if (!mesh_shape->IsMutable()) {
+        for (int i = 0; i < (int)m_meshes.size(); i++) {
+            const auto& known = m_meshes[i].shape;
+            if (!m_meshes[i].is_mutable && known->GetMesh() == mesh_shape->GetMesh() &&
+                known->GetScale() == mesh_shape->GetScale()) {
+                mesh_id = i;
+                break;
+            }
+        }
+    }
+
+    if (mesh_id < 0) {
+        m_meshes.emplace_back();
+        ChCpuMesh& mesh = m_meshes.back();
+        mesh.shape = mesh_shape;
+        mesh.is_mutable = mesh_shape->IsMutable();
+        LoadMesh(mesh);
+        mesh_id = static_cast<int>(m_meshes.size() - 1);
+    }
+
+    ChCpuInstance inst;
+    inst.type = ChCpuShapeType::MESH;
+    inst.body = body;
+    inst.asset_frame = asset_frame;
+    inst.size = ChVector<float>(1.f);
+    inst.mesh_id = mesh_id;
+    inst.lidar_intensity = 1.f;
+    m_instances.push_back(inst);
+}
+
+void ChCpuGeometry::LoadMesh(ChCpuMesh& mesh) {
+    auto trimesh = mesh.shape->GetMesh();
+    const ChVector<double>& scale = mesh.shape->GetScale();
+    const auto& vertices = trimesh->getCoordsVertices();
+
+    mesh.vertices.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        mesh.vertices[i] = ChVector<float>((float)(vertices[i].x() * scale.x()), (float)(vertices[i].y() * scale.y()),
+                                           (float)(vertices[i].z() * scale.z()));
+    }
+    mesh.triangles = trimesh->getIndicesVertexes();
+    mesh.needs_build = true;
+}
+
+// -----------------------------------------------------------------------------
+// Per-frame update
+// -----------------------------------------------------------------------------
+void ChCpuGeometry::Update(const ChVector<double>& origin, int num_threads) {
+    // refresh deformable meshes
+    for (auto& mesh : m_meshes) {
+        if (mesh.is_mutable)
+            LoadMesh(mesh);
+    }
+
+    // build outdated mesh hierarchies, one task per mesh with large meshes spawning additional subtree tasks
+#pragma omp parallel num_threads(num_threads)
+#pragma omp single
+    {
+        for (auto& mesh : m_meshes) {
+            if (!mesh.needs_build)
+                continue;
+            ChCpuMesh* pmesh = &mesh;
+#pragma omp task firstprivate(pmesh)
+            {
+                std::vector<ChCpuAABB> tri_boxes(pmesh->triangles.size());
+                for (size_t i = 0; i < pmesh->triangles.size(); i++) {
+                    const ChVector<int>& tri = pmesh->triangles[i];
+                    tri_boxes[i].Extend(pmesh->vertices[tri.x()]);
+                    tri_boxes[i].Extend(pmesh->vertices[tri.y()]);
+                    tri_boxes[i].Extend(pmesh->vertices[tri.z()]);
+                }
+                pmesh->bvh.Build(tri_boxes, 4);
+                pmesh->needs_build = false;
+            }
+        }
+    }
+
+    // place all instances relative to the origin
+    std::vector<ChCpuAABB> inst_boxes(m_instances.size());
+    int num_instances = static_cast<int>(m_instances.size());
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < num_instances; i++) {
+        ChCpuInstance& inst = m_instances[i];
+        ChFrame<double> frame = inst.body ? inst.body->GetFrame_REF_to_abs() * inst.asset_frame : inst.asset_frame;
+
+        inst.pos = ChVector<float>(frame.GetPos() - origin);
+        inst.axis_x = ChVector<float>(frame.GetA().Get_A_Xaxis());
+        inst.axis_y = ChVector<float>(frame.GetA().Get_A_Yaxis());
+        inst.axis_z = ChVector<float>(frame.GetA().Get_A_Zaxis());
+
+        ChCpuAABB local_box;
+        if (inst.type == ChCpuShapeType::MESH) {
+            const ChCpuBVH& bvh = m_meshes[inst.mesh_id].bvh;
+            if (!bvh.IsEmpty())
+                local_box = bvh.GetBounds();
+        } else {
+            local_box.min = -inst.size;
+            local_box.max = inst.size;
+        }
+
+        // bounds of the rotated local box
+        inst.box = ChCpuAABB();
+        if (local_box.max.x() >= local_box.min.x()) {
+            ChVector<float> c = local_box.Center();
+            ChVector<float> e = local_box.max - c;
+            ChVector<float> center = inst.pos + inst.axis_x * c.x() + inst.axis_y * c.y() + inst.axis_z * c.z();
+            ChVector<float> half;
+            for (unsigned int k = 0; k < 3; k++) {
+                half[k] = std::abs(inst.axis_x[k]) * e.x() + std::abs(inst.axis_y[k]) * e.y() +
+                          std::abs(inst.axis_z[k]) * e.z();
+            }
+            inst.box.min = center - half;
+            inst.box.max = center + half;
+        } else {
+            // empty mesh: degenerate box at the instance origin that no ray can hit through a primitive
+            inst.box.min = inst.pos;
+            inst.box.max = inst.pos;
+        }
+        inst_boxes[i] = inst.box;
+    }
+
+#pragma omp parallel num_threads(num_threads)
+#pragma omp single
+    m_top_bvh.Build(inst_boxes, 2);
+}
+
+// -----------------------------------------------------------------------------
+// Ray queries
+// -----------------------------------------------------------------------------
+bool ChCpuGeometry::IntersectInstance(const ChCpuInstance& inst,
+                                      const ChCpuRay& ray,
+                                      float& t_closest,
+                                      ChCpuHit& hit) const {
+    // transform the ray into the instance frame (rigid transform, so distances are preserved)
+    ChVector<float> rel = ray.origin - inst.pos;
+    ChVector<float> o(rel.Dot(inst.axis_x), rel.Dot(inst.axis_y), rel.Dot(inst.axis_z));
+    ChVector<float> d(ray.dir.Dot(inst.axis_x), ray.dir.Dot(inst.axis_y), ray.dir.Dot(inst.axis_z));
+
+    float t = t_closest;
+    ChVector<float> n;
+    bool found = false;
+    switch (inst.type) {
+        case ChCpuShapeType::BOX:
+            found = IntersectBox(o, d, inst.size, ray.tmin, t, n);
+            break;
+        case ChCpuShapeType::SPHERE:
+            found = IntersectSphere(o, d, inst.size.x(), ray.tmin, t, n);
+            break;
+        case ChCpuShapeType::CYLINDER:
+            found = IntersectCylinder(o, d, inst.size.x(), inst.size.z(), ray.tmin, t, n);
+            break;
+        case ChCpuShapeType::MESH: {
+            const ChCpuMesh& mesh = m_meshes[inst.mesh_id];
+            ChCpuRay local_ray(o, d, ray.tmin, t_closest);
+            found = mesh.bvh.Intersect(local_ray, t, [&](int tri_id, float& t_tri) {
+                const ChVector<int>& tri = mesh.triangles[tri_id];
+                return IntersectTriangle(o, d, mesh.vertices[tri.x()], mesh.vertices[tri.y()],
+                                         mesh.vertices[tri.z()], ray.tmin, t_tri, n);
+            });
+            break;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    t_closest = t;
+    hit.t = t;
+    hit.normal = (inst.axis_x * n.x() + inst.axis_y * n.y() + inst.axis_z * n.z()).GetNormalized();
+    hit.lidar_intensity = inst.lidar_intensity;
+    return true;
+}
+
+bool ChCpuGeometry::Intersect(const ChCpuRay& ray, ChCpuHit& hit) const {
+    float t_closest = ray.tmax;
+    return m_top_bvh.Intersect(ray, t_closest, [&](int inst_id, float& t_inst) {
+        return IntersectInstance(m_instances[inst_id], ray, t_inst, hit);
+    });
+}
+
+}  // namespace sensor
+}  // namespace chrono
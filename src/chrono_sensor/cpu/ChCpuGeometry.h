@@ -0,0 +1,276 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host-side scene geometry for ray traced sensors that run without OptiX. The
+// scene is a two-level BVH: one bottom-level tree per triangle mesh (shared by
+// all instances of the same rigid mesh) and a top-level tree over the object
+// instances that is rebuilt every frame.
+//
+// =============================================================================
+
+#ifndef CHCPUGEOMETRY_H
+#define CHCPUGEOMETRY_H
+
+#include <memory>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_sensor/ChApiSensor.h"
+
+#include "chrono/core/ChVector.h"
+#include "chrono/core/ChFrame.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Ray used by the CPU ray tracer. The direction is expected to be normalized.
+struct ChCpuRay {
+    ChCpuRay(const ChVector<float>& o, const ChVector<float>& d, float t_min, float t_max)
+        : origin(o), dir(d), tmin(t_min), tmax(t_max) {
+        // avoid inf * 0 in the slab tests for axis aligned rays
+        inv_dir.x() = 1.f / (std::abs(d.x()) > 1e-20f ? d.x() : 1e-20f);
+        inv_dir.y() = 1.f / (std::abs(d.y()) > 1e-20f ? d.y() : 1e-20f);
+        inv_dir.z() = 1.f / (std::abs(d.z()) > 1e-20f ? d.z() : 1e-20f);
+    }
+    ChVector<float> origin;   ///< ray origin
+    ChVector<float> dir;      ///< normalized ray direction
+    ChVector<float> inv_dir;  ///< component-wise inverse of the direction
+    float tmin;               ///< near end of the valid ray interval
+    float tmax;               ///< far end of the valid ray interval
+};
+
+/// Closest hit information returned by the CPU ray tracer
+struct ChCpuHit {
+    float t;                 ///< distance along the ray
+    ChVector<float> normal;  ///< unit world space normal at the hit
+    float lidar_intensity;   ///< reflectivity of the hit object in the lidar wavelength
+};
+
+/// Axis aligned bounding box
+struct ChCpuAABB {
+    ChCpuAABB() : min(std::numeric_limits<float>::max()), max(-std::numeric_limits<float>::max()) {}
+    void Extend(const ChVector<float>& p) {
+        min = ChVector<float>(std::min(min.x(), p.x()), std::min(min.y(), p.y()), std::min(min.z(), p.z()));
+        max = ChVector<float>(std::max(max.x(), p.x()), std::max(max.y(), p.y()), std::max(max.z(), p.z()));
+    }
+    void Extend(const ChCpuAABB& b) {
+        Extend(b.min);
+        Extend(b.max);
+    }
+    ChVector<float> Center() const { return 0.5f * (min + max); }
+    /// Half of the surface area, used by the SAH cost
+    float HalfArea() const {
+        ChVector<float> d = max - min;
+        return (d.x() < 0) ? 0.f : d.x() * d.y() + d.y() * d.z() + d.z() * d.x();
+    }
+
+    ChVector<float> min;  ///< lower corner
+    ChVector<float> max;  ///< upper corner
+};
+
+/// Slab test of a ray against a bounding box. Returns true if the box is hit in [ray.tmin, tmax].
+inline bool IntersectAABB(const ChCpuAABB& b, const ChCpuRay& ray, float tmax, float& tnear) {
+    float tx1 = (b.min.x() - ray.origin.x()) * ray.inv_dir.x();
+    float tx2 = (b.max.x() - ray.origin.x()) * ray.inv_dir.x();
+    float ty1 = (b.min.y() - ray.origin.y()) * ray.inv_dir.y();
+    float ty2 = (b.max.y() - ray.origin.y()) * ray.inv_dir.y();
+    float tz1 = (b.min.z() - ray.origin.z()) * ray.inv_dir.z();
+    float tz2 = (b.max.z() - ray.origin.z()) * ray.inv_dir.z();
+    float t0 = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::min(tz1, tz2));
+    float t1 = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::max(tz1, tz2));
+    tnear = t0;
+    return t1 >= std::max(t0, ray.tmin) && t0 <= tmax;
+}
+
+/// Bounding volume hierarchy over a set of primitive bounding boxes. Nodes are stored depth first in a flat array
+/// where the left child of an inner node immediately follows its parent. Construction uses binned SAH splits and, when
+/// called from within an OpenMP parallel region, builds large subtrees as concurrent tasks.
+class CH_SENSOR_API ChCpuBVH {
+  public:
+    struct Node {
+        ChCpuAABB box;  ///< bounds of the subtree
+        int right;      ///< index of the right child (inner nodes only)
+        int first;      ///< first entry in the primitive index list (leaves only)
+        int count;      ///< number of primitives in the leaf, 0 for inner nodes
+    };
+
+    /// Build the hierarchy over the given primitive bounds.
+    /// @param prim_boxes Bounding box of each primitive
+    /// @param max_leaf_size Maximum number of primitives stored in a leaf
+    void Build(const std::vector<ChCpuAABB>& prim_boxes, int max_leaf_size = 4);
+
+    /// Find the closest intersection along the ray. The callback is invoked as hit_prim(prim_id, t_closest) for every
+    /// candidate primitive and must return true (and update t_closest) when it finds a closer hit.
+    template <typename PrimIntersect>
+    bool Intersect(const ChCpuRay& ray, float& t_closest, PrimIntersect&& hit_prim) const;
+
+    /// Bounds of the full hierarchy
+    const ChCpuAABB& GetBounds() const { return m_nodes[0].box; }
+
+    bool IsEmpty() const { return m_nodes.empty(); }
+
+  private:
+    void BuildRecursive(const std::vector<ChCpuAABB>& prim_boxes,
+                        const std::vector<ChVector<float>>& centroids,
+                        int node_id,
+                        int begin,
+                        int end,
+                        int depth);
+
+    std::vector<Node> m_nodes;    ///< node array, a subtree over n primitives occupies 2n-1 consecutive slots
+    std::vector<int> m_prim_ids;  ///< primitive indices referenced by the leaves
+    int m_max_leaf_size = 4;      ///< maximum number of primitives per leaf
+};
+
+template <typename PrimIntersect>
+inline bool ChCpuBVH::Intersect(const ChCpuRay& ray, float& t_closest, PrimIntersect&& hit_prim) const {
+    float tnear;
+    if (m_nodes.empty() || !IntersectAABB(m_nodes[0].box, ray, t_closest, tnear))
+        return false;
+
+    // nodes waiting to be visited together with the entry distance into their bounds
+    int stack_node[128];
+    float stack_tnear[128];
+    int stack_size = 0;
+    stack_node[stack_size] = 0;
+    stack_tnear[stack_size++] = tnear;
+    bool hit = false;
+
+    while (stack_size > 0) {
+        stack_size--;
+        if (stack_tnear[stack_size] > t_closest)
+            continue;  // a closer hit was found after this node was pushed
+        int node_id = stack_node[stack_size];
+        const Node& node = m_nodes[node_id];
+
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++) {
+                if (hit_prim(m_prim_ids[i], t_closest))
+                    hit = true;
+            }
+        } else {
+            // push the farther child first so that the nearer one is visited first and shrinks the interval early
+            int left = node_id + 1;
+            int right = node.right;
+            float t_left, t_right;
+            bool hit_left = IntersectAABB(m_nodes[left].box, ray, t_closest, t_left);
+            bool hit_right = IntersectAABB(m_nodes[right].box, ray, t_closest, t_right);
+            if (hit_left && hit_right && t_left < t_right) {
+                std::swap(left, right);
+                std::swap(t_left, t_right);
+                std::swap(hit_left, hit_right);
+            }
+            if (hit_left) {
+                stack_node[stack_size] = left;
+                stack_tnear[stack_size++] = t_left;
+            }
+            if (hit_right) {
+                stack_node[stack_size] = right;
+                stack_tnear[stack_size++] = t_right;
+            }
+        }
+    }
+    return hit;
+}
+
+/// Triangle mesh used by the CPU ray tracer, with vertices in the frame of the visual shape (scale applied)
+struct ChCpuMesh {
+    std::shared_ptr<ChTriangleMeshShape> shape;  ///< source visual shape
+    std::vector<ChVector<float>> vertices;       ///< scaled vertex positions
+    std::vector<ChVector<int>> triangles;        ///< vertex indices of each triangle
+    ChCpuBVH bvh;                                ///< hierarchy over the triangles
+    bool is_mutable;                             ///< true if the vertices must be refreshed each frame
+    bool needs_build;                            ///< true if the hierarchy is out of date
+};
+
+/// Type of the primitive referenced by an instance
+enum class ChCpuShapeType { BOX, SPHERE, CYLINDER, MESH };
+
+/// Object instance placed in the scene. Analytic shapes are intersected in the instance frame.
+struct ChCpuInstance {
+    ChCpuShapeType type;           ///< shape referenced by the instance
+    std::shared_ptr<ChBody> body;  ///< body the shape is attached to
+    ChFrame<double> asset_frame;   ///< frame of the shape relative to the body reference frame
+    ChVector<float> size;          ///< box half lengths, sphere radius, or cylinder (radius, radius, half height)
+    int mesh_id;                   ///< index of the mesh for MESH instances
+    float lidar_intensity;         ///< reflectivity in the lidar wavelength
+
+    // per-frame placement, relative to the scene origin
+    ChVector<float> pos;     ///< instance origin
+    ChVector<float> axis_x;  ///< instance x axis
+    ChVector<float> axis_y;  ///< instance y axis
+    ChVector<float> axis_z;  ///< instance z axis
+    ChCpuAABB box;           ///< bounds relative to the scene origin
+};
+
+/// Scene geometry for the CPU ray tracer
+class CH_SENSOR_API ChCpuGeometry {
+  public:
+    ChCpuGeometry() {}
+    ~ChCpuGeometry() {}
+
+    /// Remove all instances and meshes from the scene
+    void Clear();
+
+    /// Add a box with the given full lengths
+    void AddBox(std::shared_ptr<ChBody> body, const ChFrame<double>& asset_frame, const ChVector<double>& lengths);
+
+    /// Add a sphere with the given radius
+    void AddSphere(std::shared_ptr<ChBody> body, const ChFrame<double>& asset_frame, double radius);
+
+    /// Add a cylinder aligned with the z axis of the asset frame and centered on its origin
+    void AddCylinder(std::shared_ptr<ChBody> body, const ChFrame<double>& asset_frame, double radius, double height);
+
+    /// Add a triangle mesh. Rigid meshes that share the same mesh data and scale share a single hierarchy.
+    void AddMesh(std::shared_ptr<ChBody> body,
+                 const ChFrame<double>& asset_frame,
+                 std::shared_ptr<ChTriangleMeshShape> mesh_shape);
+
+    /// Refresh deformable meshes, rebuild outdated mesh hierarchies, and place all instances relative to the given
+    /// origin before rebuilding the top-level hierarchy.
+    /// @param origin World position subtracted from all geometry to keep single precision coordinates small
+    /// @param num_threads Number of OpenMP threads used for the update
+    void Update(const ChVector<double>& origin, int num_threads);
+
+    /// Find the closest hit of a ray expressed relative to the origin passed to Update
+    bool Intersect(const ChCpuRay& ray, ChCpuHit& hit) const;
+
+    /// Number of object instances in the scene
+    size_t GetNumInstances() const { return m_instances.size(); }
+
+    /// Number of unique meshes in the scene
+    size_t GetNumMeshes() const { return m_meshes.size(); }
+
+  private:
+    void LoadMesh(ChCpuMesh& mesh);
+    bool IntersectInstance(const ChCpuInstance& inst, const ChCpuRay& ray, float& t_closest, ChCpuHit& hit) const;
+
+    std::vector<ChCpuInstance> m_instances;  ///< all object instances
+    std::vector<ChCpuMesh> m_meshes;         ///< unique triangle meshes
+    ChCpuBVH m_top_bvh;                      ///< hierarchy over the instance bounds
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,198 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Engine that renders lidar sensors by ray tracing on the host
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChCpuLidarEngine.h"
+
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterLidarReduce.h"
+#include "chrono_sensor/filters/ChFilterPCfromDepth.h"
+#include "chrono_sensor/filters/ChFilterLidarNoise.h"
+#include "chrono_sensor/filters/ChFilterLidarIntensityClip.h"
+#include "chrono_sensor/filters/ChFilterSavePtCloud.h"
+
+#include "chrono/assets/ChBoxShape.h"
+#include "chrono/assets/ChSphereShape.h"
+#include "chrono/assets/ChCylinderShape.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChCpuLidarEngine::ChCpuLidarEngine(ChSystem* sys, bool verbose)
+    : m_system(sys), m_verbose(verbose), m_num_threads(ChOMP::GetNumProcs()), m_scene_constructed(false) {
+    m_geometry = chrono_types::make_shared<ChCpuGeometry>();
+}
+
+CH_SENSOR_API void ChCpuLidarEngine::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+    for (auto sensor : m_assignedSensor)
+        sensor->m_num_cpu_threads = m_num_threads;
+    for (auto renderer : m_assignedRenderers)
+        renderer->m_num_threads = m_num_threads;
+}
+
+CH_SENSOR_API void ChCpuLidarEngine::AssignSensor(std::shared_ptr<ChLidarSensor> sensor) {
+    if (std::find(m_assignedSensor.begin(), m_assignedSensor.end(), sensor) != m_assignedSensor.end()) {
+        std::cerr << "WARNING: This sensor already exists in manager. Ignoring this addition\n";
+        return;
+    }
+
+    // only filters with a host implementation can follow the CPU renderer
+    for (auto f : sensor->GetFilterList()) {
+        if (!std::dynamic_pointer_cast<ChFilterLidarReduce>(f) && !std::dynamic_pointer_cast<ChFilterPCfromDepth>(f) &&
+            !std::dynamic_pointer_cast<ChFilterLidarNoiseXYZI>(f) &&
+            !std::dynamic_pointer_cast<ChFilterLidarIntensityClip>(f) &&
+            !std::dynamic_pointer_cast<ChFilterSavePtCloud>(f) && !std::dynamic_pointer_cast<ChFilterDIAccess>(f) &&
+            !std::dynamic_pointer_cast<ChFilterXYZIAccess>(f)) {
+            throw std::runtime_error("Filter '" + f->Name() + "' on sensor '" + sensor->GetName() +
+                                     "' is not supported by the CPU lidar backend");
+        }
+    }
+
+    m_assignedSensor.push_back(sensor);
+    sensor->m_num_cpu_threads = m_num_threads;
+    m_cameraStartFrames.push_back(sensor->GetParent()->GetVisualModelFrame());
+    m_cameraStartFrames_set.push_back(false);
+
+    // create the render filter and push to front of filter list
+    auto render_filter = chrono_types::make_shared<ChFilterCpuLidarRender>();
+    render_filter->m_geometry = m_geometry;
+    render_filter->m_num_threads = m_num_threads;
+    m_assignedRenderers.push_back(render_filter);
+    sensor->PushFilterFront(render_filter);
+    sensor->LockFilterList();
+
+    std::shared_ptr<SensorBuffer> buffer;
+    for (auto f : sensor->GetFilterList()) {
+        f->Initialize(sensor, buffer);
+    }
+
+    if (m_verbose)
+        std::cout << "Sensor " << sensor->GetName() << " assigned to the CPU lidar engine\n";
+}
+
+CH_SENSOR_API void ChCpuLidarEngine::UpdateSensors() {
+    if (!m_scene_constructed) {
+        ConstructScene();
+    }
+
+    double time = m_system->GetChTime();
+
+    // record the sensor pose at the start of the collection window
+    for (int i = 0; i < m_assignedSensor.size(); i++) {
+        auto sensor = m_assignedSensor[i];
+        if (time > sensor->GetNumLaunches() / sensor->GetUpdateRate() - 1e-7 && !m_cameraStartFrames_set[i]) {
+            m_cameraStartFrames[i] = sensor->GetParent()->GetVisualModelFrame();
+            m_cameraStartFrames_set[i] = true;
+        }
+    }
+
+    // check which sensors need to be updated this step
+    std::vector<int> to_be_updated;
+    for (int i = 0; i < m_assignedSensor.size(); i++) {
+        auto sensor = m_assignedSensor[i];
+        if (time > sensor->GetNumLaunches() / sensor->GetUpdateRate() + sensor->GetCollectionWindow() - 1e-7) {
+            to_be_updated.push_back(i);
+        }
+    }
+
+    if (to_be_updated.empty())
+        return;
+
+    // geometry is placed relative to the first sensor so that single precision coordinates stay small
+    ChVector<double> origin =
+        (m_cameraStartFrames[to_be_updated[0]] * m_assignedSensor[to_be_updated[0]]->GetOffsetPose()).GetPos();
+    m_geometry->Update(origin, m_num_threads);
+
+    float t = (float)time;
+    for (auto i : to_be_updated) {
+        auto sensor = m_assignedSensor[i];
+        auto renderer = m_assignedRenderers[i];
+
+        ChFrame<double> f_offset = sensor->GetOffsetPose();
+        ChFrame<double> global_loc_0 = m_cameraStartFrames[i] * f_offset;
+        ChFrame<double> global_loc_1 = sensor->GetParent()->GetVisualModelFrame() * f_offset;
+        m_cameraStartFrames_set[i] = false;  // reset this frame so that we know it should be packed again
+
+        ChQuaternion<double> rot_0 = global_loc_0.GetRot();
+        ChQuaternion<double> rot_1 = global_loc_1.GetRot();
+        if (rot_0.Dot(rot_1) < 0)
+            rot_1 = -rot_1;  // interpolate along the shorter arc
+
+        renderer->m_pos0 = ChVector<float>(global_loc_0.GetPos() - origin);
+        renderer->m_pos1 = ChVector<float>(global_loc_1.GetPos() - origin);
+        renderer->m_rot0 = ChQuaternion<float>((float)rot_0.e0(), (float)rot_0.e1(), (float)rot_0.e2(), (float)rot_0.e3());
+        renderer->m_rot1 = ChQuaternion<float>((float)rot_1.e0(), (float)rot_1.e1(), (float)rot_1.e2(), (float)rot_1.e3());
+        renderer->m_time_stamp = t;
+
+        sensor->IncrementNumLaunches();
+
+        // run through the filter graph of the sensor, starting with the renderer
+        for (auto f : sensor->GetFilterList()) {
+            f->Apply();
+        }
+    }
+}
+
+CH_SENSOR_API void ChCpuLidarEngine::ConstructScene() {
+    m_geometry->Clear();
+
+    for (auto body : m_system->Get_bodylist()) {
+        if (body->GetVisualModel())
+            AddVisualModel(body, body->GetVisualModel());
+    }
+
+    // other physics items have their shapes defined in the absolute frame
+    for (auto item : m_system->Get_otherphysicslist()) {
+        if (item->GetVisualModel())
+            AddVisualModel(nullptr, item->GetVisualModel());
+    }
+
+    m_scene_constructed = true;
+    if (m_verbose)
+        std::cout << "CPU lidar scene: " << m_geometry->GetNumInstances() << " instances, "
+                  << m_geometry->GetNumMeshes() << " unique meshes\n";
+}
+
+void ChCpuLidarEngine::AddVisualModel(std::shared_ptr<ChBody> body, std::shared_ptr<ChVisualModel> model) {
+    for (auto& shape_instance : model->GetShapes()) {
+        const auto& shape = shape_instance.first;
+        const auto& shape_frame = shape_instance.second;
+
+        if (!shape->IsVisible()) {
+            continue;
+        } else if (auto box_shape = std::dynamic_pointer_cast<ChBoxShape>(shape)) {
+            m_geometry->AddBox(body, shape_frame, box_shape->GetLengths());
+        } else if (auto sphere_shape = std::dynamic_pointer_cast<ChSphereShape>(shape)) {
+            m_geometry->AddSphere(body, shape_frame, sphere_shape->GetRadius());
+        } else if (auto cylinder_shape = std::dynamic_pointer_cast<ChCylinderShape>(shape)) {
+            m_geometry->AddCylinder(body, shape_frame, cylinder_shape->GetRadius(), cylinder_shape->GetHeight());
+        } else if (auto trimesh_shape = std::dynamic_pointer_cast<ChTriangleMeshShape>(shape)) {
+            m_geometry->AddMesh(body, shape_frame, trimesh_shape);
+        }
+        // other shapes are not rendered, matching ChOptixEngine
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Engine that renders lidar sensors by ray tracing on the host
+//
+// =============================================================================
+
+#ifndef CHCPULIDARENGINE_H
+#define CHCPULIDARENGINE_H
+
+#include "chrono_sensor/ChApiSensor.h"
+
+#include <memory>
+#include <vector>
+
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/cpu/ChCpuGeometry.h"
+#include "chrono_sensor/cpu/ChFilterCpuLidarRender.h"
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/assets/ChVisualModel.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Engine responsible for lidar sensors that use RenderBackend::CPU. Builds a host copy of the scene from the visual
+/// shapes of the system (boxes, spheres, cylinders, and triangle meshes), traces the lidar beams in parallel with
+/// OpenMP, and runs the filter graph of each sensor on host memory. Rendering is synchronous with UpdateSensors.
+class CH_SENSOR_API ChCpuLidarEngine {
+  public:
+    /// Class constructor
+    /// @param sys Pointer to the ChSystem that defines the simulation
+    /// @param verbose Sets verbose level for the engine
+    ChCpuLidarEngine(ChSystem* sys, bool verbose = false);
+
+    /// Class destructor
+    ~ChCpuLidarEngine() {}
+
+    /// Add a sensor for this engine to manage and update. Throws if the filter graph of the sensor contains a filter
+    /// that cannot operate on host buffers.
+    /// @param sensor A shared pointer to a lidar using the CPU render backend
+    void AssignSensor(std::shared_ptr<ChLidarSensor> sensor);
+
+    /// Updates the sensors if they need to be updated based on simulation time and last update time.
+    void UpdateSensors();
+
+    /// Construct the scene from scratch, translating all visual shapes of the system into host geometry
+    void ConstructScene();
+
+    /// Set the number of OpenMP threads used for scene updates, ray tracing, and the filters of the assigned sensors.
+    /// Defaults to the number of processors.
+    /// @param num_threads Number of threads
+    void SetNumThreads(int num_threads);
+
+    /// Get the number of OpenMP threads used for scene updates, ray tracing, and filtering
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Gives the user access to the list of sensors being managed by this engine.
+    /// @return the vector of lidar sensors
+    std::vector<std::shared_ptr<ChLidarSensor>> GetSensor() { return m_assignedSensor; }
+
+  private:
+    /// Adds all supported shapes of a visual model to the scene geometry
+    void AddVisualModel(std::shared_ptr<ChBody> body, std::shared_ptr<ChVisualModel> model);
+
+    ChSystem* m_system;                         ///< the chrono system to render
+    bool m_verbose;                             ///< whether to print info
+    int m_num_threads;                          ///< number of OpenMP threads
+    bool m_scene_constructed;                   ///< whether the scene has been built
+    std::shared_ptr<ChCpuGeometry> m_geometry;  ///< host copy of the scene geometry
+
+    std::vector<std::shared_ptr<ChLidarSensor>> m_assignedSensor;  ///< list of sensors to render
+    std::vector<std::shared_ptr<ChFilterCpuLidarRender>>
+        m_assignedRenderers;                           ///< render filter of each sensor
+    std::vector<ChFrame<double>> m_cameraStartFrames;  ///< sensor parent frames at the start of the collection window
+    std::vector<bool> m_cameraStartFrames_set;         ///< whether the start frame is set for the current window
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
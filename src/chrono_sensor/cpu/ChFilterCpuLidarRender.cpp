@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Filter that generates raw lidar data by ray tracing on the host
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChFilterCpuLidarRender.h"
+#include "chrono_sensor/utils/CudaMallocHelper.h"
+
+#include <cmath>
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChFilterCpuLidarRender::ChFilterCpuLidarRender()
+    : m_time_stamp(0), m_num_threads(1), ChFilter("CpuLidarRenderer") {}
+
+CH_SENSOR_API void ChFilterCpuLidarRender::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                      std::shared_ptr<SensorBuffer>& bufferInOut) {
+    auto lidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor);
+    if (!lidar) {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+    m_lidar = lidar;
+
+    m_width = lidar->GetWidth();
+    m_height = lidar->GetHeight();
+    m_beam_samples = 2 * lidar->GetSampleRadius() - 1;
+    m_clip_near = lidar->GetClipNear();
+    m_max_distance = lidar->GetMaxDistance();
+
+    // the beam pattern is fixed, so the ray directions in the sensor frame are computed once (see shaders/lidar.cu)
+    const float hfov = lidar->GetHFOV();
+    const float max_vert = lidar->GetMaxVertAngle();
+    const float min_vert = lidar->GetMinVertAngle();
+    const float hdiv = lidar->GetHorizDivAngle();
+    const float vdiv = lidar->GetVertDivAngle();
+    const int d = static_cast<int>(m_beam_samples);
+    const int beams_x = static_cast<int>(m_width) / d;
+    const int beams_y = static_cast<int>(m_height) / d;
+
+    m_local_dirs.resize(m_width * m_height);
+    for (int y = 0; y < (int)m_height; y++) {
+        for (int x = 0; x < (int)m_width; x++) {
+            int beam_x = x / d;
+            int beam_y = y / d;
+            float phi = (beam_y / (float)(std::max(1, beams_y - 1))) * (max_vert - min_vert) + min_vert;
+            float theta = (beam_x / (float)(std::max(1, beams_x - 1))) * hfov - hfov / 2.f;
+
+            if (d > 1) {
+                // offset of this sample within the beam, in [-1,1]
+                float frac_x = ((x % d) + 0.5f) / d * 2.f - 1.f;
+                float frac_y = ((y % d) + 0.5f) / d * 2.f - 1.f;
+                if (lidar->GetBeamShape() == LidarBeamShape::ELLIPTICAL) {
+                    theta += frac_x * hdiv / 2.f;
+                    phi += frac_y * vdiv / 2.f;
+                } else {
+                    float angle = std::atan2(frac_y, frac_x);
+                    float ring = std::max(std::abs(frac_x), std::abs(frac_y));
+                    float axis_x = vdiv / 2.f * ring;
+                    float axis_y = hdiv / 2.f * ring;
+                    float radius = 0;
+                    if (axis_x != 0 || axis_y != 0) {
+                        radius = (axis_x * axis_y) / std::sqrt(axis_x * axis_x * std::sin(angle) * std::sin(angle) +
+                                                               axis_y * axis_y * std::cos(angle) * std::cos(angle));
+                    }
+                    theta += radius * std::sin(angle);
+                    phi += radius * std::cos(angle);
+                }
+            }
+
+            m_local_dirs[y * m_width + x] =
+                ChVector<float>(std::cos(phi) * std::cos(theta), std::cos(phi) * std::sin(theta), std::sin(phi));
+        }
+    }
+
+    m_buffer_out = chrono_types::make_shared<SensorHostDIBuffer>();
+    std::shared_ptr<PixelDI[]> b(hostMallocHelper<PixelDI>(m_width * m_height), hostFreeHelper<PixelDI>);
+    m_buffer_out->Buffer = std::move(b);
+    m_buffer_out->Width = m_width;
+    m_buffer_out->Height = m_height;
+    bufferInOut = m_buffer_out;
+}
+
+CH_SENSOR_API void ChFilterCpuLidarRender::Apply() {
+    auto lidar = m_lidar.lock();
+    PixelDI* buf = m_buffer_out->Buffer.get();
+    const int w = static_cast<int>(m_width);
+    const int h = static_cast<int>(m_height);
+    const int beams_x = w / static_cast<int>(m_beam_samples);
+    const float tmax = 1.5f * m_max_distance;
+
+    // all rays of a column share the sensor pose, which is interpolated over the collection window
+#pragma omp parallel for schedule(dynamic, 4) num_threads(m_num_threads)
+    for (int x = 0; x < w; x++) {
+        const float t_frac = (x / (int)m_beam_samples) / (float)beams_x;
+        ChVector<float> origin = m_pos0 + (m_pos1 - m_pos0) * t_frac;
+        ChQuaternion<float> rot(m_rot0.e0() + t_frac * (m_rot1.e0() - m_rot0.e0()),
+                                m_rot0.e1() + t_frac * (m_rot1.e1() - m_rot0.e1()),
+                                m_rot0.e2() + t_frac * (m_rot1.e2() - m_rot0.e2()),
+                                m_rot0.e3() + t_frac * (m_rot1.e3() - m_rot0.e3()));
+        rot.Normalize();
+        ChVector<float> forward = rot.GetXaxis();
+        ChVector<float> left = rot.GetYaxis();
+        ChVector<float> up = rot.GetZaxis();
+
+        for (int y = 0; y < h; y++) {
+            const ChVector<float>& local = m_local_dirs[y * w + x];
+            ChVector<float> dir = (forward * local.x() + left * local.y() + up * local.z()).GetNormalized();
+
+            ChCpuRay ray(origin, dir, m_clip_near, tmax);
+            ChCpuHit hit;
+            PixelDI& px = buf[y * w + x];
+            if (m_geometry && m_geometry->Intersect(ray, hit)) {
+                px.range = hit.t;
+                px.intensity = hit.lidar_intensity * std::abs(hit.normal.Dot(dir));
+            } else {
+                px.range = 0.f;
+                px.intensity = 0.f;
+            }
+        }
+    }
+
+    m_buffer_out->LaunchedCount = lidar->GetNumLaunches();
+    m_buffer_out->TimeStamp = m_time_stamp;
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,83 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Filter that generates raw lidar data by ray tracing on the host
+//
+// =============================================================================
+
+#ifndef CHFILTERCPULIDARRENDER_H
+#define CHFILTERCPULIDARRENDER_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/cpu/ChCpuGeometry.h"
+
+#include "chrono/core/ChQuaternion.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// A filter that generates depth/intensity data for a ChLidarSensor rendered by the CPU backend. Traces the same beam
+/// pattern as the OptiX lidar programs, including the divergence sampling of multi-sample beams, and writes a host
+/// buffer that the remaining filters of the graph consume.
+class CH_SENSOR_API ChFilterCpuLidarRender : public ChFilter {
+  public:
+    /// Class constructor
+    ChFilterCpuLidarRender();
+
+    /// Class destructor
+    virtual ~ChFilterCpuLidarRender() {}
+
+    /// Apply function. Traces all lidar rays against the scene geometry.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut A pointer to the process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+  private:
+    std::weak_ptr<ChLidarSensor> m_lidar;              ///< for holding a weak reference to parent sensor
+    std::shared_ptr<SensorHostDIBuffer> m_buffer_out;  ///< output depth/intensity buffer
+    std::vector<ChVector<float>> m_local_dirs;         ///< ray directions in the sensor frame
+    unsigned int m_width;                              ///< number of rays horizontally
+    unsigned int m_height;                             ///< number of rays vertically
+    unsigned int m_beam_samples;                       ///< rays per beam along each axis (2*radius-1)
+    float m_clip_near;                                 ///< near end of the ray interval
+    float m_max_distance;                              ///< maximum lidar distance
+
+    // Special handles that will be set by ChCpuLidarEngine before each launch
+    std::shared_ptr<ChCpuGeometry> m_geometry;  ///< scene to trace against
+    ChVector<float> m_pos0;                     ///< sensor position at the start of the collection window
+    ChVector<float> m_pos1;                     ///< sensor position at the end of the collection window
+    ChQuaternion<float> m_rot0;                 ///< sensor orientation at the start of the collection window
+    ChQuaternion<float> m_rot1;                 ///< sensor orientation at the end of the collection window
+    float m_time_stamp;                         ///< time stamp for when the data (render) was launched
+    int m_num_threads;                          ///< number of OpenMP threads used for tracing
+
+    friend class ChCpuLidarEngine;  ///< ChCpuLidarEngine is allowed to set and use the private members
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,289 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host implementations of the lidar kernels
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/lidar_ops.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace chrono {
+namespace sensor {
+
+// Kernel-weighted intensity of the sample at in_index: its own intensity plus the weighted intensity of the other
+// samples in the beam whose range lies within kernel_radius, as a portion of the full beam
+static inline float beam_kernel_intensity(const float* bufIn, int in_index, int out_h, int out_v, int d, int w) {
+    const float kernel_radius = .05f;  // 10 cm total kernel width
+    float local_range = bufIn[2 * in_index];
+    float local_intensity = bufIn[2 * in_index + 1];
+    for (int k = 0; k < d; k++) {
+        for (int l = 0; l < d; l++) {
+            int inner_in_index = (d * out_v + k) * d * w + (d * out_h + l);
+            float range = bufIn[2 * inner_in_index];
+            float intensity = bufIn[2 * inner_in_index + 1];
+            if (inner_in_index != in_index && std::abs(range - local_range) < kernel_radius) {
+                float weight = (kernel_radius - std::abs(range - local_range)) / kernel_radius;
+                local_intensity += weight * intensity;
+            }
+        }
+    }
+    return local_intensity / (d * d);
+}
+
+void cpu_lidar_mean_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads) {
+    const float* in = (const float*)bufIn;
+    float* out = (float*)bufOut;
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_h = out_index % w;
+        int out_v = out_index / w;
+
+        float sum_range = 0.f;
+        float sum_intensity = 0.f;
+        int n_contributing = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_v + i) * d * w + (d * out_h + j);
+                sum_intensity += in[2 * in_index + 1];
+                if (in[2 * in_index + 1] > 1e-6) {
+                    sum_range += in[2 * in_index];
+                    n_contributing++;
+                }
+            }
+        }
+
+        out[2 * out_index] = 0;
+        out[2 * out_index + 1] = 0;
+        if (n_contributing > 0) {
+            out[2 * out_index] = sum_range / n_contributing;
+            out[2 * out_index + 1] = sum_intensity / (d * d);
+        }
+    }
+}
+
+void cpu_lidar_strong_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads) {
+    const float* in = (const float*)bufIn;
+    float* out = (float*)bufOut;
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_h = out_index % w;
+        int out_v = out_index / w;
+
+        float strongest = 0;
+        float intensity_at_strongest = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_v + i) * d * w + (d * out_h + j);
+                float local_intensity = beam_kernel_intensity(in, in_index, out_h, out_v, d, w);
+                if (local_intensity > intensity_at_strongest) {
+                    intensity_at_strongest = local_intensity;
+                    strongest = in[2 * in_index];
+                }
+            }
+        }
+        out[2 * out_index] = strongest;
+        out[2 * out_index + 1] = intensity_at_strongest;
+    }
+}
+
+void cpu_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads) {
+    const float* in = (const float*)bufIn;
+    float* out = (float*)bufOut;
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_h = out_index % w;
+        int out_v = out_index / w;
+
+        float shortest = 1e10;
+        float intensity_at_shortest = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_v + i) * d * w + (d * out_h + j);
+                float local_range = in[2 * in_index];
+                float ray_intensity = in[2 * in_index + 1];
+                if (shortest > local_range && ray_intensity > 0) {
+                    intensity_at_shortest = beam_kernel_intensity(in, in_index, out_h, out_v, d, w);
+                    shortest = local_range;
+                }
+            }
+        }
+        out[2 * out_index] = shortest;
+        out[2 * out_index + 1] = intensity_at_shortest;
+    }
+}
+
+void cpu_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads) {
+    const float* in = (const float*)bufIn;
+    float* out = (float*)bufOut;
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_h = out_index % w;
+        int out_v = out_index / w;
+
+        float shortest = 1e10;
+        float intensity_at_shortest = 0;
+        float strongest = 0;
+        float intensity_at_strongest = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_v + i) * d * w + (d * out_h + j);
+                float local_range = in[2 * in_index];
+                float ray_intensity = in[2 * in_index + 1];
+                float local_intensity = beam_kernel_intensity(in, in_index, out_h, out_v, d, w);
+                if (shortest > local_range && ray_intensity > 0) {
+                    intensity_at_shortest = local_intensity;
+                    shortest = local_range;
+                }
+                if (local_intensity > intensity_at_strongest) {
+                    intensity_at_strongest = local_intensity;
+                    strongest = local_range;
+                }
+            }
+        }
+        out[4 * out_index] = strongest;
+        out[4 * out_index + 1] = intensity_at_strongest;
+        out[4 * out_index + 2] = shortest;
+        out[4 * out_index + 3] = intensity_at_shortest;
+    }
+}
+
+void cpu_pointcloud_from_depth(void* bufDI,
+                               void* bufOut,
+                               int width,
+                               int height,
+                               float hfov,
+                               float max_v_angle,
+                               float min_v_angle,
+                               int num_threads) {
+    const float* in = (const float*)bufDI;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int index = 0; index < width * height; index++) {
+        int h_index = index % width;
+        int v_index = index / width;
+        float v_angle = (v_index / (float)(std::max(1, height - 1))) * (max_v_angle - min_v_angle) + min_v_angle;
+        float h_angle = (h_index / (float)(std::max(1, width - 1))) * hfov - hfov / 2.f;
+
+        float range = in[2 * index];
+        float proj_xy = range * std::cos(v_angle);
+        out[4 * index] = proj_xy * std::cos(h_angle);
+        out[4 * index + 1] = proj_xy * std::sin(h_angle);
+        out[4 * index + 2] = range * std::sin(v_angle);
+        out[4 * index + 3] = in[2 * index + 1];
+    }
+}
+
+void cpu_pointcloud_from_depth_dual_return(void* bufDI,
+                                           void* bufOut,
+                                           int width,
+                                           int height,
+                                           float hfov,
+                                           float max_v_angle,
+                                           float min_v_angle,
+                                           int num_threads) {
+    const float* in = (const float*)bufDI;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int index = 0; index < width * height; index++) {
+        int h_index = index % width;
+        int v_index = index / width;
+        float v_angle = (v_index / (float)(std::max(1, height - 1))) * (max_v_angle - min_v_angle) + min_v_angle;
+        float h_angle = (h_index / (float)(std::max(1, width - 1))) * hfov - hfov / 2.f;
+
+        for (int r = 0; r < 2; r++) {
+            float range = in[4 * index + 2 * r];
+            float proj_xy = range * std::cos(v_angle);
+            out[8 * index + 4 * r] = proj_xy * std::cos(h_angle);
+            out[8 * index + 4 * r + 1] = proj_xy * std::sin(h_angle);
+            out[8 * index + 4 * r + 2] = range * std::sin(v_angle);
+            out[8 * index + 4 * r + 3] = in[4 * index + 2 * r + 1];
+        }
+    }
+}
+
+void cpu_lidar_noise_normal(float* bufPtr,
+                            int width,
+                            int height,
+                            float stdev_range,
+                            float stdev_v_angle,
+                            float stdev_h_angle,
+                            float stdev_intensity,
+                            std::mt19937& rng) {
+    std::normal_distribution<float> normal(0.f, 1.f);
+
+    // serial so that the sequence of draws, and therefore the noise, only depends on the seed
+    for (int index = 0; index < width * height; index++) {
+        float i = bufPtr[index * 4 + 3];
+        if (i > 1e-6) {
+            float x = bufPtr[index * 4];
+            float y = bufPtr[index * 4 + 1];
+            float z = bufPtr[index * 4 + 2];
+
+            // convert to spherical coordinates
+            float range = std::sqrt(x * x + y * y + z * z);
+            // small values here to prevent div by 0 and to prevent acos and asin outside valid ranges
+            if (range > 1e-6) {
+                float phi = std::asin(z / (range + 1e-6f));
+                float theta = std::acos(x / ((range + 1e-6f) * std::cos(phi)));
+                if (y < 0)
+                    theta = -theta;
+
+                range += normal(rng) * stdev_range;
+                theta += normal(rng) * stdev_h_angle;
+                phi += normal(rng) * stdev_v_angle;
+                i += normal(rng) * stdev_intensity;
+
+                bufPtr[index * 4] = std::cos(theta) * std::cos(phi) * range;
+                bufPtr[index * 4 + 1] = std::sin(theta) * std::cos(phi) * range;
+                bufPtr[index * 4 + 2] = std::sin(phi) * range;
+                bufPtr[index * 4 + 3] = i > 0 ? i : 0;
+            }
+        }
+    }
+}
+
+void cpu_lidar_clip(float* buf, int width, int height, float threshold, float default_dist, int num_threads) {
+#pragma omp parallel for num_threads(num_threads)
+    for (int index = 0; index < width * height; index++) {
+        // data is packed range,intensity
+        if (buf[2 * index + 1] < threshold) {
+            buf[2 * index + 1] = 0;
+            buf[2 * index] = default_dist;
+        }
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
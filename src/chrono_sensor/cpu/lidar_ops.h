@@ -0,0 +1,136 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Host implementations of the lidar kernels, used by the filters when the
+// lidar is rendered by the CPU backend. Each function matches the semantics
+// of the CUDA function of the same name in chrono_sensor/cuda.
+//
+// =============================================================================
+
+#ifndef LIDAR_OPS_H
+#define LIDAR_OPS_H
+
+#include <random>
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Host version of cuda_lidar_mean_reduce.
+/// @param bufIn Host pointer to raw lidar data.
+/// @param bufOut Host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+/// @param num_threads Number of OpenMP threads.
+void cpu_lidar_mean_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads);
+
+/// Host version of cuda_lidar_strong_reduce.
+/// @param bufIn Host pointer to raw lidar data.
+/// @param bufOut Host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+/// @param num_threads Number of OpenMP threads.
+void cpu_lidar_strong_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads);
+
+/// Host version of cuda_lidar_first_reduce.
+/// @param bufIn Host pointer to raw lidar data.
+/// @param bufOut Host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+/// @param num_threads Number of OpenMP threads.
+void cpu_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads);
+
+/// Host version of cuda_lidar_dual_reduce. Output is packed as [strongest, first] per beam.
+/// @param bufIn Host pointer to raw lidar data.
+/// @param bufOut Host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+/// @param num_threads Number of OpenMP threads.
+void cpu_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, int radius, int num_threads);
+
+/// Host version of cuda_pointcloud_from_depth.
+/// @param bufDI Host pointer to depth/intensity data.
+/// @param bufOut Host pointer for the XYZI point cloud.
+/// @param width Width of the data.
+/// @param height Height of the data.
+/// @param hfov Horizontal field of view of the lidar.
+/// @param max_v_angle Maximum vertical angle of the lidar.
+/// @param min_v_angle Minimum vertical angle of the lidar.
+/// @param num_threads Number of OpenMP threads.
+void cpu_pointcloud_from_depth(void* bufDI,
+                               void* bufOut,
+                               int width,
+                               int height,
+                               float hfov,
+                               float max_v_angle,
+                               float min_v_angle,
+                               int num_threads);
+
+/// Host version of cuda_pointcloud_from_depth_dual_return.
+/// @param bufDI Host pointer to dual return depth/intensity data.
+/// @param bufOut Host pointer for the XYZI point cloud (two points per beam).
+/// @param width Width of the data.
+/// @param height Height of the data.
+/// @param hfov Horizontal field of view of the lidar.
+/// @param max_v_angle Maximum vertical angle of the lidar.
+/// @param min_v_angle Minimum vertical angle of the lidar.
+/// @param num_threads Number of OpenMP threads.
+void cpu_pointcloud_from_depth_dual_return(void* bufDI,
+                                           void* bufOut,
+                                           int width,
+                                           int height,
+                                           float hfov,
+                                           float max_v_angle,
+                                           float min_v_angle,
+                                           int num_threads);
+
+/// Host version of cuda_lidar_noise_normal.
+/// @param bufPtr Host pointer to XYZI point cloud data.
+/// @param width Width of the data.
+/// @param height Height of the data.
+/// @param stdev_range Standard deviation for lidar range.
+/// @param stdev_v_angle Standard deviation of noise for vertical angle measurement.
+/// @param stdev_h_angle Standard deviation of noise for horizontal angle measurement.
+/// @param stdev_intensity Standard deviation of noise for the intensity.
+/// @param rng Random number generator owned by the calling filter.
+void cpu_lidar_noise_normal(float* bufPtr,
+                            int width,
+                            int height,
+                            float stdev_range,
+                            float stdev_v_angle,
+                            float stdev_h_angle,
+                            float stdev_intensity,
+                            std::mt19937& rng);
+
+/// Host version of cuda_lidar_clip.
+/// @param buf Host pointer to depth/intensity data, modified in place.
+/// @param width Width of the data.
+/// @param height Height of the data.
+/// @param threshold Intensity below which a return is discarded.
+/// @param default_dist Range assigned to discarded returns.
+/// @param num_threads Number of OpenMP threads.
+void cpu_lidar_clip(float* buf, int width, int height, float threshold, float default_dist, int num_threads);
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
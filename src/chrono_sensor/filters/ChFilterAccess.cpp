@@ -19,6 +19,7 @@
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 #include <cuda.h>
+#include <cstring>
 
 namespace chrono {
 namespace sensor {
@@ -147,9 +148,15 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
-        std::shared_ptr<PixelXYZI[]> b(cudaHostMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
-                                       cudaHostFreeHelper<PixelXYZI>);
-        tmp_buffer->Buffer = std::move(b);
+        if (m_cpu_backend) {
+            std::shared_ptr<PixelXYZI[]> b(hostMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
+                                           hostFreeHelper<PixelXYZI>);
+            tmp_buffer->Buffer = std::move(b);
+        } else {
+            std::shared_ptr<PixelXYZI[]> b(cudaHostMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
+                                           cudaHostFreeHelper<PixelXYZI>);
+            tmp_buffer->Buffer = std::move(b);
+        }
     }
 
     tmp_buffer->Width = m_bufferIn->Beam_return_count;
@@ -157,8 +164,14 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), cudaMemcpyDeviceToHost, m_cuda_stream);
+    if (m_cpu_backend) {
+        std::memcpy(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI));
+    } else {
+        cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                        m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), cudaMemcpyDeviceToHost,
+                        m_cuda_stream);
+    }
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -172,7 +185,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_cpu_backend)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -185,9 +199,15 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostDIBuffer>();
-        std::shared_ptr<PixelDI[]> b(cudaHostMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
-                                     cudaHostFreeHelper<PixelDI>);
-        tmp_buffer->Buffer = std::move(b);
+        if (m_cpu_backend) {
+            std::shared_ptr<PixelDI[]> b(hostMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
+                                         hostFreeHelper<PixelDI>);
+            tmp_buffer->Buffer = std::move(b);
+        } else {
+            std::shared_ptr<PixelDI[]> b(cudaHostMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
+                                         cudaHostFreeHelper<PixelDI>);
+            tmp_buffer->Buffer = std::move(b);
+        }
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -195,8 +215,14 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), cudaMemcpyDeviceToHost, m_cuda_stream);
+    if (m_cpu_backend) {
+        std::memcpy(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI));
+    } else {
+        cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                        m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), cudaMemcpyDeviceToHost,
+                        m_cuda_stream);
+    }
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -210,7 +236,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_cpu_backend)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
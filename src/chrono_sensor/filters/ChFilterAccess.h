@@ -74,6 +74,7 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
 
         if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
             m_cuda_stream = pOpx->GetCudaStream();
+            m_cpu_backend = pOpx->GetRenderBackend() == RenderBackend::CPU;
         }
 
         m_sensor = pSensor;  // save handle to the parent sensor (weak ptr to not cause loop dependency)
@@ -125,6 +126,7 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
     std::weak_ptr<ChSensor> m_sensor;        ///< pointer to the sensor to which this filter is attached
     std::shared_ptr<BufferType> m_bufferIn;  ///< shared pointer to the buffer coming in
     CUstream m_cuda_stream;                  ///< reference to the cuda stream for device-side buffers
+    bool m_cpu_backend = false;              ///< whether the incoming buffer lives on the host (CPU render backend)
 
     std::queue<std::shared_ptr<BufferType>>
         m_lag_buffers;  ///< buffers that are time stamped and held until past their lag time
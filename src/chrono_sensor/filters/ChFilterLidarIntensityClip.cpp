@@ -17,13 +17,14 @@
 #include "chrono_sensor/filters/ChFilterLidarIntensityClip.h"
 #include "chrono_sensor/sensors/ChSensor.h"
 #include "chrono_sensor/cuda/lidar_clip.cuh"
+#include "chrono_sensor/cpu/lidar_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 namespace chrono {
 namespace sensor {
 
 ChFilterLidarIntensityClip::ChFilterLidarIntensityClip(float intensity_thresh, float default_value, std::string name)
-    : m_intensity_thresh(intensity_thresh), m_default_dist(default_value), ChFilter(name) {}
+    : m_intensity_thresh(intensity_thresh), m_default_dist(default_value), m_cpu_backend(false), ChFilter(name) {}
 
 CH_SENSOR_API void ChFilterLidarIntensityClip::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                           std::shared_ptr<SensorBuffer>& bufferInOut) {
@@ -36,6 +37,8 @@ CH_SENSOR_API void ChFilterLidarIntensityClip::Initialize(std::shared_ptr<ChSens
 
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+        m_cpu_backend = pOpx->GetRenderBackend() == RenderBackend::CPU;
+        m_sensor = pOpx;
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
@@ -44,6 +47,11 @@ CH_SENSOR_API void ChFilterLidarIntensityClip::Initialize(std::shared_ptr<ChSens
 }
 
 CH_SENSOR_API void ChFilterLidarIntensityClip::Apply() {
+    if (m_cpu_backend) {
+        cpu_lidar_clip((float*)m_bufferInOut->Buffer.get(), (int)m_bufferInOut->Width, (int)m_bufferInOut->Height,
+                       m_intensity_thresh, m_default_dist, m_sensor.lock()->GetNumCpuThreads());
+        return;
+    }
     cuda_lidar_clip((float*)m_bufferInOut->Buffer.get(), (int)m_bufferInOut->Width, (int)m_bufferInOut->Height,
                     m_intensity_thresh, m_default_dist, m_cuda_stream);
 }
@@ -55,6 +55,8 @@ class CH_SENSOR_API ChFilterLidarIntensityClip : public ChFilter {
                                ///< for object with 90% return -> see ChLidarSensor.cpp
     float m_default_dist;      ///< default distance value used when intensity fall below threshold
     CUstream m_cuda_stream;    ///< cuda stream for the filter graph
+    bool m_cpu_backend;        ///< whether buffers live on the host (CPU render backend)
+    std::weak_ptr<ChOptixSensor> m_sensor;  ///< parent lidar (number of threads of the CPU backend)
 };
 
 /// @}
@@ -18,6 +18,7 @@
 #include "chrono_sensor/sensors/ChOptixSensor.h"
 #include "chrono_sensor/cuda/lidar_noise.cuh"
 #include "chrono_sensor/cuda/curand_utils.cuh"
+#include "chrono_sensor/cpu/lidar_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 #include <chrono>
 
@@ -33,6 +34,7 @@ ChFilterLidarNoiseXYZI::ChFilterLidarNoiseXYZI(float stdev_range,
       m_stdev_v_angle(stdev_v_angle),
       m_stdev_h_angle(stdev_h_angle),
       m_stdev_intensity(stdev_intensity),
+      m_cpu_backend(false),
       ChFilter(name) {}
 
 void ChFilterLidarNoiseXYZI::Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut) {
@@ -47,10 +49,16 @@ void ChFilterLidarNoiseXYZI::Initialize(std::shared_ptr<ChSensor> pSensor, std::
 
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+        m_cpu_backend = pOpx->GetRenderBackend() == RenderBackend::CPU;
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
+    if (m_cpu_backend) {
+        m_host_rng.seed((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+        return;
+    }
+
     m_rng = std::shared_ptr<curandState_t>(
         cudaMallocHelper<curandState_t>(m_bufferInOut->Width * m_bufferInOut->Height), cudaFreeHelper<curandState_t>);
     init_cuda_rng((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()), m_rng.get(),
@@ -58,6 +66,12 @@ void ChFilterLidarNoiseXYZI::Initialize(std::shared_ptr<ChSensor> pSensor, std::
 }
 
 void ChFilterLidarNoiseXYZI::Apply() {
+    if (m_cpu_backend) {
+        cpu_lidar_noise_normal((float*)m_bufferInOut->Buffer.get(), (int)m_bufferInOut->Width,
+                               (int)m_bufferInOut->Height, m_stdev_range, m_stdev_v_angle, m_stdev_h_angle,
+                               m_stdev_intensity, m_host_rng);
+        return;
+    }
     cuda_lidar_noise_normal((float*)m_bufferInOut->Buffer.get(), (int)m_bufferInOut->Width, (int)m_bufferInOut->Height,
                             m_stdev_range, m_stdev_v_angle, m_stdev_h_angle, m_stdev_intensity, m_rng.get(),
                             m_cuda_stream);
@@ -23,6 +23,8 @@
 #include <curand.h>
 #include <curand_kernel.h>
 
+#include <random>
+
 namespace chrono {
 namespace sensor {
 
@@ -60,6 +62,8 @@ class CH_SENSOR_API ChFilterLidarNoiseXYZI : public ChFilter {
     std::shared_ptr<curandState_t> m_rng;                   ///< cuda random number generator
     std::shared_ptr<SensorDeviceXYZIBuffer> m_bufferInOut;  ///< buffer for applying noise to point cloud
     CUstream m_cuda_stream;                                 ///< reference to the cuda stream
+    bool m_cpu_backend;                                     ///< whether buffers live on the host (CPU render backend)
+    std::mt19937 m_host_rng;                                ///< random number generator for host buffers
 };
 
 /// @}
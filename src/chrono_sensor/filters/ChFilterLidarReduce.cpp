@@ -17,13 +17,14 @@
 #include "chrono_sensor/filters/ChFilterLidarReduce.h"
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/cuda/lidar_reduce.cuh"
+#include "chrono_sensor/cpu/lidar_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 namespace chrono {
 namespace sensor {
 
 ChFilterLidarReduce::ChFilterLidarReduce(LidarReturnMode ret, int reduce_radius, std::string name)
-    : m_ret(ret), m_reduce_radius(reduce_radius), ChFilter(name) {}
+    : m_ret(ret), m_reduce_radius(reduce_radius), m_cpu_backend(false), ChFilter(name) {}
 CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                    std::shared_ptr<SensorBuffer>& bufferInOut) {
     if (!bufferInOut)
@@ -35,6 +36,8 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
 
     if (auto pOpx = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+        m_cpu_backend = pOpx->GetRenderBackend() == RenderBackend::CPU;
+        m_sensor = pOpx;
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
@@ -42,9 +45,13 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
     switch (m_ret) {
         case LidarReturnMode::DUAL_RETURN: {
             m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
-            DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_buffer_in->Width * m_buffer_in->Height * 2 /
-                                                          ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
-                                cudaFreeHelper<PixelDI>);
+            unsigned int sz = m_buffer_in->Width * m_buffer_in->Height * 2 /
+                              ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1));
+            DeviceDIBufferPtr b;
+            if (m_cpu_backend)
+                b = DeviceDIBufferPtr(hostMallocHelper<PixelDI>(sz), hostFreeHelper<PixelDI>);
+            else
+                b = DeviceDIBufferPtr(cudaMallocHelper<PixelDI>(sz), cudaFreeHelper<PixelDI>);
             m_buffer_out->Buffer = std::move(b);
             m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
             m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
@@ -54,9 +61,13 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
 
         default: {  // all other returns are single, regardless of type
             m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
-            DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_buffer_in->Width * m_buffer_in->Height /
-                                                          ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
-                                cudaFreeHelper<PixelDI>);
+            unsigned int sz = m_buffer_in->Width * m_buffer_in->Height /
+                              ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1));
+            DeviceDIBufferPtr b;
+            if (m_cpu_backend)
+                b = DeviceDIBufferPtr(hostMallocHelper<PixelDI>(sz), hostFreeHelper<PixelDI>);
+            else
+                b = DeviceDIBufferPtr(cudaMallocHelper<PixelDI>(sz), cudaFreeHelper<PixelDI>);
             m_buffer_out->Buffer = std::move(b);
             m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
             m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
@@ -67,6 +78,31 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
 }
 
 CH_SENSOR_API void ChFilterLidarReduce::Apply() {
+    if (m_cpu_backend) {
+        int num_threads = m_sensor.lock()->GetNumCpuThreads();
+        switch (m_ret) {
+            case LidarReturnMode::DUAL_RETURN:
+                cpu_lidar_dual_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+                                      (int)m_buffer_in->Height, m_reduce_radius, num_threads);
+                break;
+            case LidarReturnMode::STRONGEST_RETURN:
+                cpu_lidar_strong_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+                                        (int)m_buffer_in->Height, m_reduce_radius, num_threads);
+                break;
+            case LidarReturnMode::FIRST_RETURN:
+                cpu_lidar_first_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+                                       (int)m_buffer_in->Height, m_reduce_radius, num_threads);
+                break;
+            default:  // LidarReturnMode::MEAN_RETURN:
+                cpu_lidar_mean_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+                                      (int)m_buffer_in->Height, m_reduce_radius, num_threads);
+                break;
+        }
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+        return;
+    }
+
     switch (m_ret) {
         case LidarReturnMode::DUAL_RETURN:
             cuda_lidar_dual_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
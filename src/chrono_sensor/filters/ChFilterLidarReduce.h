@@ -52,6 +52,8 @@ class CH_SENSOR_API ChFilterLidarReduce : public ChFilter {
     LidarReturnMode m_ret;                               ///< for holding the return mode
     int m_reduce_radius;                                 ///< for holding the sample radius
     CUstream m_cuda_stream;                              ///< reference to the cuda stream
+    bool m_cpu_backend;                                  ///< whether buffers live on the host (CPU render backend)
+    std::weak_ptr<ChOptixSensor> m_sensor;               ///< parent lidar (number of threads of the CPU backend)
 };
 
 /// @}
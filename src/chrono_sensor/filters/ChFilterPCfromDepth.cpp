@@ -17,6 +17,7 @@
 #include "chrono_sensor/filters/ChFilterPCfromDepth.h"
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/cuda/pointcloud.cuh"
+#include "chrono_sensor/cpu/lidar_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 // #include <cuda_runtime_api.h>
@@ -24,7 +25,7 @@
 namespace chrono {
 namespace sensor {
 
-ChFilterPCfromDepth::ChFilterPCfromDepth(std::string name) : ChFilter(name) {}
+ChFilterPCfromDepth::ChFilterPCfromDepth(std::string name) : m_cpu_backend(false), ChFilter(name) {}
 
 CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSensor,
                                                    std::shared_ptr<SensorBuffer>& bufferInOut) {
@@ -37,15 +38,20 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
         m_min_vert_angle = pLidar->GetMinVertAngle();
         m_max_vert_angle = pLidar->GetMaxVertAngle();
         m_cuda_stream = pLidar->GetCudaStream();
+        m_cpu_backend = pLidar->GetRenderBackend() == RenderBackend::CPU;
+        m_sensor = pLidar;
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
     // allocate output buffer
     m_buffer_out = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
-    DeviceXYZIBufferPtr b(
-        cudaMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaFreeHelper<PixelXYZI>);
+    unsigned int sz = m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1);
+    DeviceXYZIBufferPtr b;
+    if (m_cpu_backend)
+        b = DeviceXYZIBufferPtr(hostMallocHelper<PixelXYZI>(sz), hostFreeHelper<PixelXYZI>);
+    else
+        b = DeviceXYZIBufferPtr(cudaMallocHelper<PixelXYZI>(sz), cudaFreeHelper<PixelXYZI>);
     m_buffer_out->Buffer = std::move(b);
     m_buffer_out->Width = m_buffer_in->Width;
     m_buffer_out->Height = m_buffer_in->Height;
@@ -54,6 +60,11 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
 }
 
 CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
+    if (m_cpu_backend) {
+        ApplyHost();
+        return;
+    }
+
     // carry out the conversion from depth to point cloud
     if (m_buffer_in->Dual_return) {
         cuda_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
@@ -84,5 +95,32 @@ CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
     m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
     m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
 }
+
+void ChFilterPCfromDepth::ApplyHost() {
+    int num_threads = m_sensor.lock()->GetNumCpuThreads();
+    if (m_buffer_in->Dual_return) {
+        cpu_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
+                                              (int)m_buffer_in->Width, (int)m_buffer_in->Height, m_hFOV,
+                                              m_max_vert_angle, m_min_vert_angle, num_threads);
+    } else {
+        cpu_pointcloud_from_depth(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+                                  (int)m_buffer_in->Height, m_hFOV, m_max_vert_angle, m_min_vert_angle, num_threads);
+    }
+
+    // the buffer is already on the host, so returns are compacted in place without staging copies
+    PixelXYZI* buf = m_buffer_out->Buffer.get();
+    unsigned int size = m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1);
+    m_buffer_out->Beam_return_count = 0;
+    for (unsigned int i = 0; i < size; i++) {
+        if (buf[i].intensity > 0) {
+            buf[m_buffer_out->Beam_return_count] = buf[i];
+            m_buffer_out->Beam_return_count++;
+        }
+    }
+
+    m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+    m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+}
+
 }  // namespace sensor
 }  // namespace chrono
@@ -25,6 +25,7 @@ namespace sensor {
 
 // forward declaration
 class ChSensor;
+class ChOptixSensor;
 
 /// @addtogroup sensor_filters
 /// @{
@@ -45,10 +46,15 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
   private:
+    /// Conversion and compaction of host buffers for lidars using the CPU render backend
+    void ApplyHost();
+
     float m_hFOV;                                          ///< field of view of the parent lidar
     float m_min_vert_angle;                                ///< mimimum vertical angle of parent lidar
     float m_max_vert_angle;                                ///< maximum vetical angle of parent lidar
     CUstream m_cuda_stream;                                ///< reference to the cuda stream
+    bool m_cpu_backend;                                    ///< whether buffers live on the host (CPU render backend)
+    std::weak_ptr<ChOptixSensor> m_sensor;                 ///< parent lidar (number of threads of the CPU backend)
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;     ///< holder of the input buffer
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_out;  ///< holder of the output buffer
 };
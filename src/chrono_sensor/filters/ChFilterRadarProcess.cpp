@@ -17,7 +17,6 @@
 #include "chrono_sensor/filters/ChFilterRadarProcess.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 #include "chrono_sensor/cuda/radarprocess.cuh"
-#include "chrono_sensor/utils/Dbscan.h"
 #include <random>
 
 namespace chrono {
@@ -126,19 +125,17 @@ CH_SENSOR_API void ChFilterRadarProcess::Apply() {
     auto start = std::chrono::high_resolution_clock::now();
     std::cout << "DBSCAN initiated with " << points.size() << " points" << std::endl;
 
-    auto dbscan = DBSCAN();
-    dbscan.Run(&points, epsilon, minimum_points);
+    m_dbscan.Run(&points, epsilon, minimum_points);
 
     auto elapsed = std::chrono::high_resolution_clock::now() - start;
     auto milli = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
     std::cout << "DBScan time = " << milli << "ms" << std::endl;
 #else
-    auto dbscan = DBSCAN();
-    dbscan.Run(&points, epsilon, minimum_points);
+    m_dbscan.Run(&points, epsilon, minimum_points);
 #endif
 
     // Grab the clustered points from DBSCAN
-    auto clusters = dbscan.getClusters();
+    const auto& clusters = m_dbscan.getClusters();
 
     // vectors are populated with last scans values, clear them out
     m_buffer_out->avg_velocity.clear();
@@ -21,6 +21,7 @@
 
     #include "chrono_sensor/filters/ChFilter.h"
     #include "chrono_sensor/sensors/ChRadarSensor.h"
+    #include "chrono_sensor/utils/Dbscan.h"
     #include <cuda.h>
 
 namespace chrono {
@@ -55,6 +56,7 @@ class CH_SENSOR_API ChFilterRadarProcess : public ChFilter {
     CUstream m_cuda_stream;                                        /// reference to the cuda stream
     float m_hFOV;                                                  /// horizontal field of view of the radar
     float m_vFOV;                                        /// mimimum vertical angle of the radar
+    DBSCAN m_dbscan;                                     /// clustering, reused so its buffers persist across scans
     #if PROFILE
     unsigned int m_scan_number = 0;
     #endif
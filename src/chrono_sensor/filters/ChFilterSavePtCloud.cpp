@@ -36,14 +36,18 @@ CH_SENSOR_API ChFilterSavePtCloud::ChFilterSavePtCloud(std::string data_path, st
 CH_SENSOR_API ChFilterSavePtCloud::~ChFilterSavePtCloud() {}
 
 CH_SENSOR_API void ChFilterSavePtCloud::Apply() {
-    cudaMemcpyAsync(m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(),
-                    sizeof(PixelXYZI) * m_host_buffer->Width * m_host_buffer->Height * (m_host_buffer->Dual_return + 1),
-                    cudaMemcpyDeviceToHost, m_cuda_stream);
+    if (!m_cpu_backend) {
+        cudaMemcpyAsync(
+            m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(),
+            sizeof(PixelXYZI) * m_host_buffer->Width * m_host_buffer->Height * (m_host_buffer->Dual_return + 1),
+            cudaMemcpyDeviceToHost, m_cuda_stream);
+    }
 
     std::string filename = m_path + "frame_" + std::to_string(m_frame_number) + ".csv";
     m_frame_number++;
     utils::CSV_writer csv_writer(",");
-    cudaStreamSynchronize(m_cuda_stream);
+    if (!m_cpu_backend)
+        cudaStreamSynchronize(m_cuda_stream);
     std::cout << "Beam count: " << m_buffer_in->Beam_return_count << std::endl;
     for (unsigned int i = 0; i < m_buffer_in->Beam_return_count; i++) {
         csv_writer << m_host_buffer->Buffer[i].x << m_host_buffer->Buffer[i].y << m_host_buffer->Buffer[i].z
@@ -63,17 +67,23 @@ CH_SENSOR_API void ChFilterSavePtCloud::Initialize(std::shared_ptr<ChSensor> pSe
 
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+        m_cpu_backend = pOpx->GetRenderBackend() == RenderBackend::CPU;
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
-    m_host_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
-    std::shared_ptr<PixelXYZI[]> b(
-        cudaHostMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaHostFreeHelper<PixelXYZI>);
-    m_host_buffer->Buffer = std::move(b);
-    m_host_buffer->Width = m_buffer_in->Width;
-    m_host_buffer->Height = m_buffer_in->Height;
+    if (m_cpu_backend) {
+        // the point cloud is already in host memory and can be written directly
+        m_host_buffer = m_buffer_in;
+    } else {
+        m_host_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
+        std::shared_ptr<PixelXYZI[]> b(
+            cudaHostMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
+            cudaHostFreeHelper<PixelXYZI>);
+        m_host_buffer->Buffer = std::move(b);
+        m_host_buffer->Width = m_buffer_in->Width;
+        m_host_buffer->Height = m_buffer_in->Height;
+    }
 
     std::vector<std::string> split_string;
 #ifdef _WIN32
@@ -56,6 +56,7 @@ class CH_SENSOR_API ChFilterSavePtCloud : public ChFilter {
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_in;  ///< input buffer for point cloud
     std::shared_ptr<SensorHostXYZIBuffer> m_host_buffer;  ///< input buffer for point cloud
     CUstream m_cuda_stream;
+    bool m_cpu_backend = false;  ///< whether the input buffer already lives on the host (CPU render backend)
 };
 
 /// @}
@@ -114,6 +114,12 @@ class CH_SENSOR_API ChLidarSensor : public ChOptixSensor {
     /// @return the vertical beam divergence angle
     float GetVertDivAngle() const { return m_vert_divergence_angle; }
 
+    /// Select the backend that traces the lidar beams. The CPU backend traces the beam pattern on the host with a
+    /// multithreaded BVH and runs the lidar filters on host memory, so no GPU work is launched for this sensor. Must be
+    /// called before the sensor is added to the ChSensorManager.
+    /// @param backend The backend used to render this lidar
+    void SetRenderBackend(RenderBackend backend) { m_render_backend = backend; }
+
     bool DualReturnFlag() const {
       switch (m_return_mode){
       case LidarReturnMode::DUAL_RETURN:
@@ -30,6 +30,14 @@ namespace sensor {
 /// @addtogroup sensor_sensors
 /// @{
 
+/// Backend responsible for generating the raw data of a ray traced sensor
+enum class RenderBackend {
+    OPTIX,  ///< rendered on the GPU through a ChOptixEngine (default)
+    CPU     ///< ray traced on the host through a ChCpuLidarEngine (lidar only)
+};
+
+class ChCpuLidarEngine;
+
 /// Optix sensor class - the base class for all sensors that interface with OptiX to generate and render their data
 class CH_SENSOR_API ChOptixSensor : public ChSensor {
   public:
@@ -56,13 +64,24 @@ class CH_SENSOR_API ChOptixSensor : public ChSensor {
     unsigned int GetHeight() { return m_height; }
     CUstream GetCudaStream() { return m_cuda_stream; }
 
+    /// Get the backend that generates the raw data of this sensor
+    RenderBackend GetRenderBackend() const { return m_render_backend; }
+
+    /// Get the number of OpenMP threads used to render and filter the data of this sensor with the CPU backend.
+    /// This is set by the ChCpuLidarEngine to which the sensor is assigned (see ChSensorManager::SetNumCpuThreads).
+    int GetNumCpuThreads() const { return m_num_cpu_threads; }
+
   protected:
-    PipelineType m_pipeline_type;  ///< the type of pipeline for rendering
+    PipelineType m_pipeline_type;    ///< the type of pipeline for rendering
+    RenderBackend m_render_backend;  ///< the backend that renders this sensor
 
   private:
     unsigned int m_width;    ///< to hold reference to the width for rendering
     unsigned int m_height;   ///< to hold reference to the height for rendering
     CUstream m_cuda_stream;  ///< cuda stream for this buffer when applicable
+    int m_num_cpu_threads;   ///< number of OpenMP threads for the CPU backend
+
+    friend class ChCpuLidarEngine;  ///< ChCpuLidarEngine sets the number of threads of its sensors
 };
 
 /// @} sensor_sensors
@@ -69,6 +69,22 @@ inline void cudaHostFreeHelper(T* ptr) {
         CUDA_ERROR_CHECK(cudaFreeHost(reinterpret_cast<void*>(ptr)));
 }
 
+/// Function for creating a chunk of pageable host memory for filter graphs that run entirely on the CPU.
+/// @param size The number of values for which we should have space. Full memory length will be size*sizeof(T)
+template <class T>
+inline T* hostMallocHelper(unsigned int size) {
+    T* ret = new T[size];
+    memset(ret, 0, size * sizeof(T));
+    return ret;
+}
+
+/// The desconstructor that will be called to free memory allocated with hostMallocHelper.
+/// @param ptr The pointer to the object that should be freed.
+template <class T>
+inline void hostFreeHelper(T* ptr) {
+    delete[] ptr;
+}
+
 /// @}
 
 }  // namespace sensor
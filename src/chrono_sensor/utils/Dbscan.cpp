@@ -23,7 +23,20 @@ OF SUCH DAMAGE.
 */
 #include "Dbscan.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/utils/ChOpenMP.h"
+
+// upper bound on grid cells along an axis, so that cell keys fit in 64 bits
+static const uint64_t MAX_AXIS_CELLS = (uint64_t)1 << 20;
+static const int RADIX_BITS = 11;
+
 int DBSCAN::Run(std::vector<vec3f>* V, const float eps, const uint min) {
+    // results of a previous run are dropped even if this one fails
+    this->clusters.clear();
+    this->noise.clear();
+
     // Validate
     if (V->size() < 1)
         return ERROR_TYPE::FAILED;
@@ -32,101 +45,196 @@ int DBSCAN::Run(std::vector<vec3f>* V, const float eps, const uint min) {
 
     // initialization
     this->datalen = (uint)V->size();
-    this->visited = std::vector<bool>(this->datalen, false);
-    this->assigned = std::vector<bool>(this->datalen, false);
-    this->clusters.clear();
-    this->noise.clear();
     this->minpts = min;
     this->data = V;
     this->epsilon = eps;
 
-    this->buildKdtree(this->data);
+    this->keys.resize(this->datalen);
+    this->keys_tmp.resize(this->datalen);
+    this->order.resize(this->datalen);
+    this->order_tmp.resize(this->datalen);
+    this->points.resize(this->datalen);
+    this->point_cell.resize(this->datalen);
+    this->core.resize(this->datalen);
+    if (this->capacity < this->datalen) {
+        this->parent.reset(new std::atomic<uint>[this->datalen]);
+        this->capacity = this->datalen;
+    }
 
-    for (uint pid = 0; pid < this->datalen; ++pid) {
-        this->borderset.clear();
-        if (!this->visited[pid]) {
-            this->visited[pid] = true;
+    this->buildGrid();
+    this->findCorePoints();
+    this->mergeCorePoints();
+    this->collectClusters();
 
-            const std::vector<uint> neightbors = this->regionQuery(pid);
-            if (neightbors.size() < this->minpts) {
-                continue;
-            } else {
-                uint cid = (uint)this->clusters.size();
-                this->clusters.push_back(std::vector<uint>());
-                this->addToBorderSet(pid);
-                this->addToCluster(pid, cid);
-                this->expandCluster(cid, neightbors);
-            }
+    return ERROR_TYPE::SUCCESS;
+}
+
+void DBSCAN::buildGrid() {
+    const std::vector<vec3f>& V = *this->data;
+    const int n = (int)this->datalen;
+    const int nthreads = this->numthreads > 0 ? this->numthreads : chrono::ChOMP::GetNumProcs();
+
+    float upper[3];
+    for (int c = 0; c < 3; ++c) {
+        this->lower[c] = V[0][c];
+        upper[c] = V[0][c];
+    }
+    for (int i = 1; i < n; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            this->lower[c] = std::min(this->lower[c], V[i][c]);
+            upper[c] = std::max(upper[c], V[i][c]);
         }
     }
 
-    for (uint pid = 0; pid < this->datalen; ++pid) {
-        if (!this->assigned[pid]) {
-            this->noise.push_back(pid);
+    // cells no smaller than epsilon keep every neighbor within the 27 surrounding cells
+    float extent = std::max(upper[0] - this->lower[0], std::max(upper[1] - this->lower[1], upper[2] - this->lower[2]));
+    this->cellsize = std::max(this->epsilon, extent / (float)(MAX_AXIS_CELLS - 1));
+    if (!(this->cellsize > 0))
+        this->cellsize = 1;
+    for (int c = 0; c < 3; ++c)
+        this->dims[c] = std::min((uint64_t)((upper[c] - this->lower[c]) / this->cellsize) + 1, MAX_AXIS_CELLS);
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < n; ++i) {
+        uint64_t cell[3];
+        for (int c = 0; c < 3; ++c)
+            cell[c] = std::min((uint64_t)((V[i][c] - this->lower[c]) / this->cellsize), this->dims[c] - 1);
+        this->keys[i] = (cell[0] * this->dims[1] + cell[1]) * this->dims[2] + cell[2];
+        this->order[i] = (uint)i;
+    }
+
+    // LSD radix sort of the points by cell key
+    uint64_t max_key = this->dims[0] * this->dims[1] * this->dims[2] - 1;
+    uint count[1 << RADIX_BITS];
+    for (int shift = 0; shift == 0 || (max_key >> shift) > 0; shift += RADIX_BITS) {
+        std::fill(count, count + (1 << RADIX_BITS), 0);
+        for (int i = 0; i < n; ++i)
+            count[(this->keys[i] >> shift) & ((1 << RADIX_BITS) - 1)]++;
+        uint sum = 0;
+        for (int d = 0; d < (1 << RADIX_BITS); ++d) {
+            uint c = count[d];
+            count[d] = sum;
+            sum += c;
+        }
+        for (int i = 0; i < n; ++i) {
+            uint dst = count[(this->keys[i] >> shift) & ((1 << RADIX_BITS) - 1)]++;
+            this->keys_tmp[dst] = this->keys[i];
+            this->order_tmp[dst] = this->order[i];
         }
+        this->keys.swap(this->keys_tmp);
+        this->order.swap(this->order_tmp);
     }
 
-    this->destroyKdtree();
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < n; ++i)
+        this->points[i] = V[this->order[i]];
 
-    return ERROR_TYPE::SUCCESS;
+    // occupied cells and their point ranges
+    this->cell_keys.clear();
+    this->cell_start.clear();
+    for (int i = 0; i < n; ++i) {
+        if (i == 0 || this->keys[i] != this->keys[i - 1]) {
+            this->cell_keys.push_back(this->keys[i]);
+            this->cell_start.push_back((uint)i);
+        }
+        this->point_cell[i] = (uint)this->cell_keys.size() - 1;
+    }
+    this->cell_start.push_back((uint)n);
 }
 
-void DBSCAN::destroyKdtree() {
-    kd_free(this->tree);
-}
+int DBSCAN::gatherNeighborCells(uint cell, uint* begin, uint* end) const {
+    uint64_t key = this->cell_keys[cell];
+    int64_t cz = (int64_t)(key % this->dims[2]);
+    int64_t cy = (int64_t)((key / this->dims[2]) % this->dims[1]);
+    int64_t cx = (int64_t)(key / (this->dims[2] * this->dims[1]));
 
-void DBSCAN::buildKdtree(const std::vector<vec3f>* V) {
-    this->tree = kd_create();
-    std::shared_ptr<float[]> v(new float[3]);
-    for (uint r = 0; r < this->datalen; ++r) {
-        for (uint c = 0; c < 3; ++c) {
-            v[c] = (float)(*V)[r][c];
+    // the cell itself comes first, as it holds the most likely neighbors
+    begin[0] = this->cell_start[cell];
+    end[0] = this->cell_start[cell + 1];
+    int count = 1;
+    int64_t z0 = std::max(cz - 1, (int64_t)0);
+    int64_t z1 = std::min(cz + 1, (int64_t)this->dims[2] - 1);
+    for (int64_t x = cx - 1; x <= cx + 1; ++x) {
+        if (x < 0 || x >= (int64_t)this->dims[0])
+            continue;
+        for (int64_t y = cy - 1; y <= cy + 1; ++y) {
+            if (y < 0 || y >= (int64_t)this->dims[1])
+                continue;
+            // the cells along z have consecutive keys, so a single search finds the whole column
+            uint64_t k0 = ((uint64_t)x * this->dims[1] + (uint64_t)y) * this->dims[2];
+            size_t c = std::lower_bound(this->cell_keys.begin(), this->cell_keys.end(), k0 + z0) -
+                       this->cell_keys.begin();
+            for (; c < this->cell_keys.size() && this->cell_keys[c] <= k0 + z1; ++c) {
+                if (c == cell)
+                    continue;
+                begin[count] = this->cell_start[c];
+                end[count] = this->cell_start[c + 1];
+                count++;
+            }
         }
-        kd_insert(this->tree, v.get(), (void*)&(*V)[r]);
     }
+    return count;
 }
 
-std::vector<uint> DBSCAN::regionQuery(const uint pid) const {
-    std::vector<uint> neighbors;
+void DBSCAN::findCorePoints() {
+    const int ncells = (int)this->cell_keys.size();
+    const int nthreads = this->numthreads > 0 ? this->numthreads : chrono::ChOMP::GetNumProcs();
+    const float eps2 = this->epsilon * this->epsilon;
 
-    std::shared_ptr<float[]> v(new float[3]);
-    for (uint c = 0; c < 3; ++c) {
-        v[c] = (float)((*this->data)[pid][c]);
-    }
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads)
+    for (int cell = 0; cell < ncells; ++cell) {
+        uint begin[27], end[27];
+        int nranges = this->gatherNeighborCells((uint)cell, begin, end);
 
-    kdres* presults = kd_nearest_range(this->tree, v.get(), this->epsilon);
-    while (!kd_res_end(presults)) {
-        vec3f* pch = (vec3f*)kd_res_item(presults, v.get());
-        uint pnpid = (uint)(pch - &(*this->data)[0]);
-        if (pid != pnpid)
-            neighbors.push_back(pnpid);
-        kd_res_next(presults);
+        for (uint i = this->cell_start[cell]; i < this->cell_start[cell + 1]; ++i) {
+            const vec3f& p = this->points[i];
+            uint neighbors = 0;
+            for (int r = 0; r < nranges && neighbors < this->minpts; ++r) {
+                for (uint j = begin[r]; j < end[r] && neighbors < this->minpts; ++j) {
+                    float dx = this->points[j][0] - p[0];
+                    float dy = this->points[j][1] - p[1];
+                    float dz = this->points[j][2] - p[2];
+                    if (j != i && dx * dx + dy * dy + dz * dz <= eps2)
+                        neighbors++;
+                }
+            }
+            this->core[i] = neighbors >= this->minpts;
+        }
     }
-    kd_res_free(presults);
-
-    return neighbors;
 }
 
-void DBSCAN::expandCluster(const uint cid, const std::vector<uint>& neighbors) {
-    std::queue<uint> border;
-    for (uint pid : neighbors)
-        border.push(pid);
-    this->addToBorderSet(neighbors);
-
-    while (border.size() > 0) {
-        const uint pid = border.front();
-        border.pop();
-
-        if (!this->visited[pid]) {
-            this->visited[pid] = true;
-            const std::vector<uint> pidneighbors = this->regionQuery(pid);
-
-            if (pidneighbors.size() >= this->minpts) {
-                this->addToCluster(pid, cid);
-                for (uint pidnid : pidneighbors) {
-                    if (!this->isInBorderSet(pidnid)) {
-                        border.push(pidnid);
-                        this->addToBorderSet(pidnid);
+void DBSCAN::mergeCorePoints() {
+    const int n = (int)this->datalen;
+    const int ncells = (int)this->cell_keys.size();
+    const int nthreads = this->numthreads > 0 ? this->numthreads : chrono::ChOMP::GetNumProcs();
+    const float eps2 = this->epsilon * this->epsilon;
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < n; ++i)
+        this->parent[i].store((uint)i, std::memory_order_relaxed);
+
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads)
+    for (int cell = 0; cell < ncells; ++cell) {
+        uint begin[27], end[27];
+        int nranges = this->gatherNeighborCells((uint)cell, begin, end);
+
+        for (uint i = this->cell_start[cell]; i < this->cell_start[cell + 1]; ++i) {
+            if (!this->core[i])
+                continue;
+            const vec3f& p = this->points[i];
+            uint root = this->find(i);
+            // each pair is linked once, from its lower index
+            for (int r = 0; r < nranges; ++r) {
+                for (uint j = std::max(begin[r], i + 1); j < end[r]; ++j) {
+                    // points already known to be in the same set need no distance test
+                    if (!this->core[j] || this->parent[j].load(std::memory_order_relaxed) == root)
+                        continue;
+                    float dx = this->points[j][0] - p[0];
+                    float dy = this->points[j][1] - p[1];
+                    float dz = this->points[j][2] - p[2];
+                    if (dx * dx + dy * dy + dz * dz <= eps2) {
+                        this->unite(i, j);
+                        root = this->find(i);
                     }
                 }
             }
@@ -134,7 +242,59 @@ void DBSCAN::expandCluster(const uint cid, const std::vector<uint>& neighbors) {
     }
 }
 
-void DBSCAN::addToCluster(const uint pid, const uint cid) {
-    this->clusters[cid].push_back(pid);
-    this->assigned[pid] = true;
+void DBSCAN::collectClusters() {
+    const int n = (int)this->datalen;
+    const int nthreads = this->numthreads > 0 ? this->numthreads : chrono::ChOMP::GetNumProcs();
+
+    // flatten the sets and map each original index back to its sorted position
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < n; ++i) {
+        if (this->core[i])
+            this->parent[i].store(this->find((uint)i), std::memory_order_relaxed);
+        this->order_tmp[this->order[i]] = (uint)i;
+    }
+
+    // clusters are numbered in order of their smallest point index, like a sequential scan would
+    this->root_cluster.assign(this->datalen, -1);
+    for (uint pid = 0; pid < this->datalen; ++pid) {
+        uint i = this->order_tmp[pid];
+        if (!this->core[i]) {
+            this->noise.push_back(pid);
+            continue;
+        }
+        uint root = this->parent[i].load(std::memory_order_relaxed);
+        if (this->root_cluster[root] < 0) {
+            this->root_cluster[root] = (int)this->clusters.size();
+            this->clusters.push_back(std::vector<uint>());
+        }
+        this->clusters[this->root_cluster[root]].push_back(pid);
+    }
+}
+
+uint DBSCAN::find(uint i) {
+    // path halving: parents only ever move to ancestors, so concurrent updates stay valid
+    while (true) {
+        uint p = this->parent[i].load(std::memory_order_relaxed);
+        if (p == i)
+            return i;
+        uint gp = this->parent[p].load(std::memory_order_relaxed);
+        if (gp != p)
+            this->parent[i].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+        i = gp;
+    }
+}
+
+void DBSCAN::unite(uint a, uint b) {
+    while (true) {
+        a = this->find(a);
+        b = this->find(b);
+        if (a == b)
+            return;
+        // link the larger root below the smaller one so that roots stay the smallest index of their set
+        if (a < b)
+            std::swap(a, b);
+        uint expected = a;
+        if (this->parent[a].compare_exchange_strong(expected, b))
+            return;
+    }
 }
@@ -24,16 +24,17 @@ OF SUCH DAMAGE.
 #ifndef __DBSCAN_H__
 #define __DBSCAN_H__
 
-#include <vector>
-#include <queue>
-#include <set>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <functional>
+#include <vector>
 #include "Kdtree.h"
 
 /**
- * If big epsilon value and dense points, the kdtree becomes a bottleneck of performance (Han 5/18/2021)
- *
+ * Points are binned into a uniform grid with cells of at least epsilon, so all neighbors of a point lie in the 27
+ * surrounding cells. Core points are found in parallel and merged with a lock-free union-find. Clusters contain the
+ * core points of each connected component, ordered by their smallest point index; all other points are noise.
+ * Work buffers are kept between runs, so clustering every frame does not allocate once the point count settles.
  */
 
 typedef unsigned int uint;
@@ -42,33 +43,50 @@ class DBSCAN final {
     enum ERROR_TYPE { SUCCESS = 0, FAILED, COUNT };
 
   public:
-    DBSCAN() {}
+    DBSCAN() : numthreads(0), capacity(0) {}
     ~DBSCAN() {}
     int Run(std::vector<vec3f>* V, const float eps, const uint min);
-    std::vector<std::vector<uint>> getClusters() { return this->clusters; };
+    const std::vector<std::vector<uint>>& getClusters() const { return this->clusters; };
+    const std::vector<uint>& getNoise() const { return this->noise; };
+
+    /// Number of OpenMP threads used by Run (0 uses all processors)
+    void setNumThreads(int n) { this->numthreads = n; }
 
   private:
-    std::vector<uint> regionQuery(const uint pid) const;
-    void addToCluster(const uint pid, const uint cid);
-    void expandCluster(const uint cid, const std::vector<uint>& neighbors);
-    void addToBorderSet(const uint pid) { this->borderset.insert(pid); }
-    void addToBorderSet(const std::vector<uint>& pids) {
-        for (uint pid : pids)
-            this->borderset.insert(pid);
-    }
-    bool isInBorderSet(const uint pid) const { return this->borderset.end() != this->borderset.find(pid); }
-    void buildKdtree(const std::vector<vec3f>* V);
-    void destroyKdtree();
+    void buildGrid();
+    int gatherNeighborCells(uint cell, uint* begin, uint* end) const;
+    void findCorePoints();
+    void mergeCorePoints();
+    void collectClusters();
+    uint find(uint i);
+    void unite(uint a, uint b);
 
   private:
-    std::vector<bool> visited;
-    std::vector<bool> assigned;
-    std::set<uint> borderset;
+    int numthreads;
     uint datalen;
     uint minpts;
     float epsilon;
-    kdtree* tree;
+    float cellsize;
+    float lower[3];
+    uint64_t dims[3];
     std::vector<vec3f>* data;
+
+    // grid, in cell order
+    std::vector<uint64_t> keys;       // cell key of each point
+    std::vector<uint64_t> keys_tmp;   // radix sort scratch
+    std::vector<uint> order;          // original index of each sorted point
+    std::vector<uint> order_tmp;      // radix sort scratch
+    std::vector<vec3f> points;        // point positions in sorted order
+    std::vector<uint64_t> cell_keys;  // key of each occupied cell
+    std::vector<uint> cell_start;     // first sorted point of each occupied cell (plus end sentinel)
+    std::vector<uint> point_cell;     // occupied cell of each sorted point
+    std::vector<unsigned char> core;  // whether each sorted point is a core point
+
+    // union-find over sorted points, roots are the smallest index of their set
+    std::unique_ptr<std::atomic<uint>[]> parent;
+    uint capacity;
+
+    std::vector<int> root_cluster;  // cluster id of each root
     std::vector<std::vector<uint>> clusters;
     std::vector<uint> noise;
 };
@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <thread>
+
 #include "chrono_synchrono/SynChronoManager.h"
 
 #include "chrono_synchrono/SynConfig.h"
 #include "chrono_synchrono/utils/SynLog.h"
 #include "chrono_synchrono/agent/SynAgentFactory.h"
 #include "chrono_synchrono/flatbuffer/message/SynSimulationMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynCopterMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
 
 #ifdef CHRONO_FASTDDS
 #undef ALIVE
@@ -18,6 +24,30 @@
 namespace chrono {
 namespace synchrono {
 
+// Return true if the message is an agent state that can be extrapolated in time
+static bool IsAgentState(const std::shared_ptr<SynMessage>& message) {
+    return std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message) ||
+           std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message) ||
+           std::dynamic_pointer_cast<SynCopterStateMessage>(message);
+}
+
+// Extrapolate all poses in an agent state message over the given time interval
+static void ExtrapolateState(const std::shared_ptr<SynMessage>& message, double dt) {
+    if (auto wv_msg = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+        wv_msg->chassis.Extrapolate(dt);
+        for (auto& pose : wv_msg->wheels)
+            pose.Extrapolate(dt);
+    } else if (auto tv_msg = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
+        tv_msg->chassis.Extrapolate(dt);
+        for (auto* poses : {&tv_msg->track_shoes, &tv_msg->sprockets, &tv_msg->idlers, &tv_msg->road_wheels})
+            for (auto& pose : *poses)
+                pose.Extrapolate(dt);
+    } else if (auto cp_msg = std::dynamic_pointer_cast<SynCopterStateMessage>(message)) {
+        cp_msg->chassis.Extrapolate(dt);
+        for (auto& pose : cp_msg->props)
+            pose.Extrapolate(dt);
+    }
+}
 
 #ifdef CHRONO_FASTDDS
 
@@ -54,7 +84,10 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
       m_time_update(0),
       m_time_msg_gather(0),
       m_time_communication(0),
-      m_time_msg_process(0) {
+      m_time_msg_process(0),
+      m_async(false),
+      m_max_lag(0.1),
+      m_lag(0) {
     if (communicator)
         SetCommunicator(communicator);
 
@@ -180,6 +213,11 @@ void SynChronoManager::Synchronize(double time) {
     if (time < m_next_sync)
         return;
 
+    if (m_async && m_communicator->SupportsAsync()) {
+        SynchronizeAsync(time);
+        return;
+    }
+
     // Reset timers
     m_timer_update.reset();
     m_timer_msg_gather.reset();
@@ -223,6 +261,54 @@ void SynChronoManager::Synchronize(double time) {
     m_next_sync += m_heartbeat;  // Set next sync to a point in the future
 }
 
+void SynChronoManager::SynchronizeAsync(double time) {
+    // Reset timers
+    m_timer_update.reset();
+    m_timer_msg_gather.reset();
+    m_timer_communication.reset();
+    m_timer_msg_process.reset();
+
+    // Call update for each underlying agent
+    m_timer_update.start();
+    UpdateAgents();
+    m_timer_update.stop();
+
+    // Gather messages from each node and add those to the communicator
+    m_timer_msg_gather.start();
+    SynMessageList messages = GatherMessages();
+    m_communicator->AddOutgoingMessages(messages);
+    m_timer_msg_gather.stop();
+
+    // Publish the messages and collect whatever was received so far, without waiting for the other nodes.
+    // Only block (waiting for more data) while the state of some remote agent is too old.
+    m_timer_communication.start();
+    m_communicator->SynchronizeAsync();
+    m_lag = ProcessReceivedMessagesAsync(time);
+    while (m_is_ok && m_lag > m_max_lag) {
+        if (!m_communicator->ReceiveAsync()) {
+            std::this_thread::yield();
+            continue;
+        }
+        m_lag = ProcessReceivedMessagesAsync(time);
+    }
+    m_timer_communication.stop();
+
+    // Update zombies and agents with the remote states extrapolated to the current time
+    m_timer_msg_process.start();
+    ExtrapolateRemoteStates(time);
+    DistributeMessages();
+    m_timer_msg_process.stop();
+
+    // Accumulate timers
+    m_time_update += m_timer_update();
+    m_time_msg_gather += m_timer_msg_gather();
+    m_time_communication += m_timer_communication();
+    m_time_msg_process += m_timer_msg_process();
+
+    m_messages.clear();          // clean the message map
+    m_next_sync += m_heartbeat;  // Set next sync to a point in the future
+}
+
 void SynChronoManager::UpdateAgents() {
     for (auto& agent_pair : m_agents)
         agent_pair.second->Update();
@@ -231,7 +317,10 @@ void SynChronoManager::UpdateAgents() {
 void SynChronoManager::QuitSimulation() {
     if (m_is_ok) {
         m_communicator->AddQuitMessage();
-        m_communicator->Synchronize();
+        if (m_async && m_communicator->SupportsAsync())
+            m_communicator->SynchronizeAsync();
+        else
+            m_communicator->Synchronize();
         m_is_ok = false;
     }
 }
@@ -242,6 +331,8 @@ void SynChronoManager::PrintStepStatistics(std::ostream& os) const {
     os << "   Msg. generation: " << 1e3 * m_timer_msg_gather() << "  [" << m_time_msg_gather << "]" << std::endl;
     os << "   Communication:   " << 1e3 * m_timer_communication() << "  [" << m_time_communication << "]" << std::endl;
     os << "   Msg. processing: " << 1e3 * m_timer_msg_process() << "  [" << m_time_msg_process << "]" << std::endl;
+    if (m_async)
+        os << " Remote state lag (s): " << m_lag << std::endl;
 }
 
 // --------------------------------------------------------------------------------------------------------------
@@ -281,6 +372,52 @@ void SynChronoManager::ProcessReceivedMessages() {
     }
 }
 
+double SynChronoManager::ProcessReceivedMessagesAsync(double time) {
+    for (auto& message : m_communicator->GetMessages()) {
+        if (message->GetMessageType() == SynFlatBuffers::Type_Simulation_State) {
+            auto sim_msg = std::dynamic_pointer_cast<SynSimulationMessage>(message);
+            m_is_ok = !(sim_msg->m_quit_sim);
+        } else if (IsAgentState(message)) {
+            // Keep only the most recent state of each remote agent
+            auto& remote = m_remote_states[message->GetSourceKey()];
+            if (!remote.message || message->time >= remote.time)
+                remote = {message, message->time, message->time};
+        } else {
+            for (const auto& agent_pair : m_agents)
+                m_messages[agent_pair.second].push_back(message);
+        }
+    }
+    m_communicator->Reset();
+
+    // Remote agents without any state received yet lag since the first asynchronous synchronization
+    double lag = 0;
+    for (const auto& zombie_pair : m_zombies) {
+        if (!zombie_pair.second)
+            continue;
+        auto it = m_remote_states.find(zombie_pair.first);
+        if (it == m_remote_states.end())
+            it = m_remote_states.insert({zombie_pair.first, {nullptr, time, time}}).first;
+        lag = std::max(lag, time - it->second.time);
+    }
+
+    return lag;
+}
+
+void SynChronoManager::ExtrapolateRemoteStates(double time) {
+    for (auto& state_pair : m_remote_states) {
+        auto& remote = state_pair.second;
+        if (!remote.message)
+            continue;
+
+        ExtrapolateState(remote.message, time - remote.current);
+        remote.message->time = time;
+        remote.current = time;
+
+        for (const auto& agent_pair : m_agents)
+            m_messages[agent_pair.second].push_back(remote.message);
+    }
+}
+
 void SynChronoManager::DistributeMessages() {
     for (auto& message_agent_pair : m_messages) {
         // For readibility
@@ -56,6 +56,8 @@ class SYN_API SynChronoManager {
     /// A manager is responsible for maintaining time and space coherence,
     /// so each node and it's agent should be at the same time within the simulation
     ///
+    /// In asynchronous mode (see SetAsynchronous), this method does not wait for the other nodes.
+    ///
     ///@param time timestamp to synchronize each node at
     void Synchronize(double time);
 
@@ -79,6 +81,27 @@ class SYN_API SynChronoManager {
     ///
     void SetHeartbeat(double heartbeat) { m_heartbeat = heartbeat; }
 
+    ///@brief Enable asynchronous (lagged) synchronization (default: false)
+    /// In asynchronous mode, a node publishes the state of its agents at each heartbeat without waiting for the other
+    /// nodes, and updates each zombie with the latest state received from the corresponding remote agent, extrapolated
+    /// to the current time (dead reckoning). A node only blocks if the latest state received from some remote agent
+    /// lags behind the current time by more than max_lag; the simulation throughput then follows the average, rather
+    /// than the slowest, node. max_lag should be larger than the heartbeat.
+    /// Requires a communicator supporting asynchronous exchange (otherwise, synchronization remains blocking).
+    ///
+    ///@param val enable/disable asynchronous synchronization
+    ///@param max_lag maximum allowed lag of remote agent states
+    void SetAsynchronous(bool val, double max_lag = 0.1) {
+        m_async = val;
+        m_max_lag = max_lag;
+    }
+
+    ///@brief Is asynchronous synchronization enabled?
+    bool IsAsynchronous() const { return m_async; }
+
+    ///@brief Get the largest lag of remote agent states at the last synchronization (asynchronous mode only)
+    double GetLag() const { return m_lag; }
+
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
@@ -115,6 +138,20 @@ class SYN_API SynChronoManager {
     ///
     void ProcessReceivedMessages();
 
+    ///@brief Asynchronous counterpart of Synchronize
+    ///
+    void SynchronizeAsync(double time);
+
+    ///@brief Process the messages received in asynchronous mode
+    /// Keeps the most recent state message of each remote agent and queues any other message for distribution.
+    /// Returns the largest lag (relative to the given time) of the remote agent states.
+    ///
+    double ProcessReceivedMessagesAsync(double time);
+
+    ///@brief Extrapolate the latest state of each remote agent to the given time and queue it for distribution
+    ///
+    void ExtrapolateRemoteStates(double time);
+
     ///@brief This method passes out each received message to it's intended agent
     ///
 
@@ -158,6 +195,18 @@ class SYN_API SynChronoManager {
     std::map<std::shared_ptr<SynAgent>, SynMessageList> m_messages;  ///< Messages associated with each agent
 
     std::shared_ptr<SynCommunicator> m_communicator;  ///< Underlying communicator used for inter-node comm
+
+    /// Latest state received from a remote agent (asynchronous mode)
+    struct RemoteState {
+        std::shared_ptr<SynMessage> message;  ///< latest state message (null if none received yet)
+        double time;                          ///< time stamp of the latest state message
+        double current;                       ///< time to which the message was extrapolated
+    };
+
+    bool m_async;                                      ///< asynchronous (lagged) synchronization
+    double m_max_lag;                                  ///< maximum lag of remote states in asynchronous mode
+    double m_lag;                                      ///< largest lag of remote states at last synchronization
+    std::map<AgentKey, RemoteState> m_remote_states;  ///< latest state of each remote agent
 };
 
 /// @} synchrono_core
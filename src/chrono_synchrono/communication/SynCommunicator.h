@@ -58,10 +58,25 @@ class SYN_API SynCommunicator {
     ///@brief This method is responsible for continuous synchronous synchronization steps
     /// This method is the blocking form of the communication interface.
     /// This method could use synchronous method calls to implement its communication interface.
-    /// For asynchronous method cases, please use/implement Asynchronize()
+    /// For asynchronous method cases, please use/implement SynchronizeAsync()
     ///
     virtual void Synchronize() = 0;
 
+    ///@brief Non-blocking counterpart of Synchronize
+    /// Sends the outgoing messages and collects the messages received so far, without waiting for the other nodes.
+    /// Communicators that do not support asynchronous exchange (see SupportsAsync) fall back to Synchronize.
+    ///
+    virtual void SynchronizeAsync() { Synchronize(); }
+
+    ///@brief Collect the messages received so far, without sending anything and without blocking
+    ///
+    ///@return true if any new data was received
+    virtual bool ReceiveAsync() { return false; }
+
+    ///@brief Does this communicator implement SynchronizeAsync and ReceiveAsync?
+    ///
+    virtual bool SupportsAsync() const { return false; }
+
     ///@brief This method is responsible for blocking until an action is received or done.
     /// For example, a process may call Barrier to wait until another process has established
     /// certain classes and initialized certain quantities. This functionality should be implemented
@@ -79,10 +94,10 @@ class SYN_API SynCommunicator {
     ///@brief Add the messages to the outgoing message buffer
     ///
     ///@param messages a list of handles to messages to add to the outgoing buffer
-    void AddOutgoingMessages(SynMessageList& messages);
+    virtual void AddOutgoingMessages(SynMessageList& messages);
 
     /// @brief Adds a quit message to the queue telling other nodes to end the simulation
-    void AddQuitMessage();
+    virtual void AddQuitMessage();
 
     ///@brief Add the messages to the incoming message buffer
     ///
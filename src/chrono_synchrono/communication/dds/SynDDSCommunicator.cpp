@@ -133,6 +133,20 @@ void SynDDSCommunicator::Synchronize() {
     Listen();
 }
 
+void SynDDSCommunicator::SynchronizeAsync() {
+    m_flatbuffers_manager.Finish();
+    Publish();
+    ReceiveAsync();
+}
+
+bool SynDDSCommunicator::ReceiveAsync() {
+    bool received = false;
+    for (auto subscriber : m_subscribers)
+        if (subscriber->IsSynchronous())
+            received |= subscriber->Poll();
+    return received;
+}
+
 void SynDDSCommunicator::Barrier() {
     for (auto subscriber : m_subscribers)
         subscriber->WaitForMatches(1);
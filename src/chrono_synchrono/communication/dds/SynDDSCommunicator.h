@@ -91,6 +91,20 @@ class SYN_API SynDDSCommunicator : public SynCommunicator {
     ///
     virtual void Synchronize() override;
 
+    ///@brief Publish the outgoing messages and take the samples already received by the synchronous subscribers,
+    /// without waiting for new ones
+    ///
+    virtual void SynchronizeAsync() override;
+
+    ///@brief Take the samples already received by the synchronous subscribers, without publishing and without waiting
+    ///
+    ///@return true if any new sample was received
+    virtual bool ReceiveAsync() override;
+
+    ///@brief The DDS communicator supports asynchronous exchange
+    ///
+    virtual bool SupportsAsync() const override { return true; }
+
     ///@brief This function is responsible for blocking until an action is received or done.
     /// For example, a process may call Barrier to wait until another process has established
     /// certain classes and initialized certain quantities. This functionality should be implemented
@@ -74,6 +74,22 @@ void SynDDSSubscriber::Receive(long double wait_time) {
     }
 }
 
+bool SynDDSSubscriber::Poll() {
+    if (!m_callback || !m_message)
+        return false;
+
+    bool received = false;
+    SampleInfo info;
+    while (m_reader->take_next_sample(m_message, &info) == ReturnCode_t::RETCODE_OK) {
+        if (info.instance_state == ALIVE_INSTANCE_STATE) {
+            m_callback(m_message);
+            received = true;
+        }
+    }
+
+    return received;
+}
+
 void SynDDSSubscriber::AsyncReceive() {
     if (!m_callback) {
         std::cerr << "WARNING: Subscriber callback has not been defined! Asynchronous read is ignored." << std::endl;
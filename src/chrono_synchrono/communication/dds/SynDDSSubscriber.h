@@ -88,6 +88,12 @@ class SYN_API SynDDSSubscriber {
     ///@param wait_time timeout of the synchronous waiting
     void Receive(long double wait_time = 20.0);
 
+    ///@brief Take all the messages already received, without waiting
+    /// The passed function is called for each message taken.
+    ///
+    ///@return true if any message was taken
+    bool Poll();
+
     ////@brief This function is responsible for asynchronous receiving
     /// This function will return immediately. Underlying calls are asynchronous/non-blocking.
     /// When a message is received, the passed function is called and the received data
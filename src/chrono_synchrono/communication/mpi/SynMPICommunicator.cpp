@@ -21,12 +21,141 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
 
+#include "chrono_synchrono/flatbuffer/message/SynCopterMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynTrackedVehicleMessage.h"
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
+
 namespace chrono {
 namespace synchrono {
 
-SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
+// Tags of point-to-point messages (blocking selective exchange and asynchronous exchange)
+static const int kSelectiveTag = 0;
+static const int kAsyncTag = 1;
+
+// -----------------------------------------------------------------------------------------------
+// Buffer encoding
+//
+// An encoded buffer starts with a one-byte header. A raw buffer follows the header unchanged. A delta buffer stores
+// the byte-wise XOR with the reference buffer (of equal size) as a sequence of (zero run length, literal length,
+// literal bytes) records, with lengths encoded as variable-length integers.
+
+static const uint8_t kRawBuffer = 0;
+static const uint8_t kDeltaBuffer = 1;
+
+static void PutVarint(std::vector<uint8_t>& out, size_t val) {
+    while (val >= 0x80) {
+        out.push_back(static_cast<uint8_t>(val | 0x80));
+        val >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(val));
+}
+
+static size_t GetVarint(const uint8_t*& ptr, const uint8_t* end) {
+    size_t val = 0;
+    int shift = 0;
+    while (ptr < end) {
+        uint8_t byte = *ptr++;
+        val |= static_cast<size_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            break;
+        shift += 7;
+    }
+    return val;
+}
+
+static void EncodeBuffer(const std::vector<uint8_t>& buf, const std::vector<uint8_t>& ref, std::vector<uint8_t>& out) {
+    out.clear();
+    size_t n = buf.size();
+    if (ref.size() == n) {
+        out.push_back(kDeltaBuffer);
+        size_t i = 0;
+        while (i < n) {
+            size_t start = i;
+            while (i < n && buf[i] == ref[i])
+                i++;
+            size_t lit = i;
+            while (i < n && buf[i] != ref[i])
+                i++;
+            PutVarint(out, lit - start);
+            PutVarint(out, i - lit);
+            for (size_t k = lit; k < i; k++)
+                out.push_back(buf[k] ^ ref[k]);
+            // Fall back to a raw buffer if the delta encoding is not smaller
+            if (out.size() > n)
+                break;
+        }
+        if (out.size() <= n)
+            return;
+        out.clear();
+    }
+    out.push_back(kRawBuffer);
+    out.insert(out.end(), buf.begin(), buf.end());
+}
+
+static void DecodeBuffer(const std::vector<uint8_t>& in, const std::vector<uint8_t>& ref, std::vector<uint8_t>& buf) {
+    buf.clear();
+    if (in.empty())
+        return;
+    if (in[0] == kRawBuffer) {
+        buf.assign(in.begin() + 1, in.end());
+        return;
+    }
+    buf = ref;
+    const uint8_t* ptr = in.data() + 1;
+    const uint8_t* end = in.data() + in.size();
+    size_t i = 0;
+    while (ptr < end) {
+        i += GetVarint(ptr, end);
+        size_t lit = GetVarint(ptr, end);
+        for (size_t k = 0; k < lit && ptr < end && i < buf.size(); k++)
+            buf[i++] ^= *ptr++;
+    }
+}
+
+static double Quantize(double val, double res) {
+    return res * std::round(val / res);
+}
+
+// Note: the frame rotation matrix is not updated, as only the frame coordinates are serialized.
+static void QuantizePose(SynPose& pose, double pos_res, double rot_res) {
+    auto& frame = pose.GetFrame();
+    if (pos_res > 0) {
+        for (int i = 0; i < 3; i++) {
+            frame.coord.pos[i] = Quantize(frame.coord.pos[i], pos_res);
+            frame.coord_dt.pos[i] = Quantize(frame.coord_dt.pos[i], pos_res);
+            frame.coord_dtdt.pos[i] = Quantize(frame.coord_dtdt.pos[i], pos_res);
+        }
+    }
+    if (rot_res > 0) {
+        for (int i = 0; i < 4; i++) {
+            frame.coord.rot[i] = Quantize(frame.coord.rot[i], rot_res);
+            frame.coord_dt.rot[i] = Quantize(frame.coord_dt.rot[i], rot_res);
+            frame.coord_dtdt.rot[i] = Quantize(frame.coord_dtdt.rot[i], rot_res);
+        }
+    }
+}
+
+static void QuantizePoses(std::vector<SynPose>& poses, double pos_res, double rot_res) {
+    for (auto& pose : poses)
+        QuantizePose(pose, pos_res, rot_res);
+}
+
+// -----------------------------------------------------------------------------------------------
+
+SynMPICommunicator::SynMPICommunicator(int argc, char* argv[])
+    : m_interest_radius(0),
+      m_delta_encoding(false),
+      m_pos_resolution(0),
+      m_rot_resolution(0),
+      m_selective(false),
+      m_async(false),
+      m_bytes_sent(0) {
     // mpi initialization
     MPI_Init(&argc, &argv);
     // set rank
@@ -38,18 +167,133 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+
+    m_send_data.resize(m_num_ranks);
+    m_recv_data.resize(m_num_ranks);
+    m_sent_ref.resize(m_num_ranks);
+    m_recv_ref.resize(m_num_ranks);
+    m_async_requests.resize(m_num_ranks, MPI_REQUEST_NULL);
+    m_async_data.resize(m_num_ranks);
+    m_async_queue.resize(m_num_ranks);
+
+    m_extents = {{DBL_MAX, DBL_MAX, DBL_MAX}, {-DBL_MAX, -DBL_MAX, -DBL_MAX}, 0, 0};
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
     delete[] m_msg_lengths;
     delete[] m_msg_displs;
 
+    // Complete all asynchronous sends (including the queued ones) before finalizing. Incoming asynchronous messages
+    // are drained meanwhile, so that ranks still sending to this one can complete too. The non-blocking barrier is
+    // entered once the sends of this rank are complete, and it completes once this holds for all ranks.
+    MPI_Request barrier = MPI_REQUEST_NULL;
+    std::vector<uint8_t> discard;
+    bool sent = false;
+    while (true) {
+        int flag;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, kAsyncTag, MPI_COMM_WORLD, &flag, &status);
+        if (flag) {
+            int count;
+            MPI_Get_count(&status, MPI_BYTE, &count);
+            discard.resize(count);
+            MPI_Recv(discard.data(), count, MPI_BYTE, status.MPI_SOURCE, kAsyncTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            continue;
+        }
+
+        if (!sent) {
+            sent = true;
+            for (int i = 0; i < m_num_ranks; i++)
+                sent = FlushAsync(i) && sent;
+            if (sent)
+                MPI_Ibarrier(MPI_COMM_WORLD, &barrier);
+        } else {
+            MPI_Test(&barrier, &flag, MPI_STATUS_IGNORE);
+            if (flag)
+                break;
+        }
+    }
+
     MPI_Finalize();
 }
 
+void SynMPICommunicator::SetDeltaEncoding(bool val) {
+    m_delta_encoding = val;
+    // Serialize all fields (including those with default values), so that buffers with the same messages have the
+    // same layout
+    m_flatbuffers_manager.GetBuilder().ForceDefaults(val);
+}
+
+void SynMPICommunicator::SetQuantization(double pos_resolution, double rot_resolution) {
+    m_pos_resolution = pos_resolution;
+    m_rot_resolution = rot_resolution;
+}
+
+void SynMPICommunicator::AddPosition(const ChVector<>& pos) {
+    for (int i = 0; i < 3; i++) {
+        m_extents.lo[i] = std::min(m_extents.lo[i], pos[i]);
+        m_extents.hi[i] = std::max(m_extents.hi[i], pos[i]);
+    }
+    m_extents.valid = 1;
+}
+
+void SynMPICommunicator::AddOutgoingMessages(SynMessageList& messages) {
+    bool quantize = m_pos_resolution > 0 || m_rot_resolution > 0;
+
+    for (auto message : messages) {
+        // Quantize a copy of the agent state messages (these are owned and reused by the agents)
+        if (auto wv_msg = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+            AddPosition(wv_msg->chassis.GetFrame().GetPos());
+            if (quantize) {
+                auto copy = chrono_types::make_shared<SynWheeledVehicleStateMessage>(*wv_msg);
+                QuantizePose(copy->chassis, m_pos_resolution, m_rot_resolution);
+                QuantizePoses(copy->wheels, m_pos_resolution, m_rot_resolution);
+                message = copy;
+            }
+        } else if (auto tv_msg = std::dynamic_pointer_cast<SynTrackedVehicleStateMessage>(message)) {
+            AddPosition(tv_msg->chassis.GetFrame().GetPos());
+            if (quantize) {
+                auto copy = chrono_types::make_shared<SynTrackedVehicleStateMessage>(*tv_msg);
+                QuantizePose(copy->chassis, m_pos_resolution, m_rot_resolution);
+                QuantizePoses(copy->track_shoes, m_pos_resolution, m_rot_resolution);
+                QuantizePoses(copy->sprockets, m_pos_resolution, m_rot_resolution);
+                QuantizePoses(copy->idlers, m_pos_resolution, m_rot_resolution);
+                QuantizePoses(copy->road_wheels, m_pos_resolution, m_rot_resolution);
+                message = copy;
+            }
+        } else if (auto cp_msg = std::dynamic_pointer_cast<SynCopterStateMessage>(message)) {
+            AddPosition(cp_msg->chassis.GetFrame().GetPos());
+            if (quantize) {
+                auto copy = chrono_types::make_shared<SynCopterStateMessage>(*cp_msg);
+                QuantizePose(copy->chassis, m_pos_resolution, m_rot_resolution);
+                QuantizePoses(copy->props, m_pos_resolution, m_rot_resolution);
+                message = copy;
+            }
+        } else {
+            m_extents.broadcast = 1;
+        }
+
+        m_flatbuffers_manager.AddMessage(message);
+    }
+}
+
+void SynMPICommunicator::AddQuitMessage() {
+    m_extents.broadcast = 1;
+    SynCommunicator::AddQuitMessage();
+}
+
 void SynMPICommunicator::Synchronize() {
     m_flatbuffers_manager.Finish();
 
+    m_async = false;
+    m_selective = m_interest_radius > 0 || m_delta_encoding;
+    if (m_selective) {
+        SynchronizeSelective();
+        m_flatbuffers_manager.Reset();
+        m_extents = {{DBL_MAX, DBL_MAX, DBL_MAX}, {-DBL_MAX, -DBL_MAX, -DBL_MAX}, 0, 0};
+        return;
+    }
+
     int msg_length = m_flatbuffers_manager.GetSize();
 
     // Get the length of message from each agent
@@ -77,10 +321,154 @@ void SynMPICommunicator::Synchronize() {
                    MPI_BYTE,  // Receiving pointer, lengths, displacements, type
                    MPI_COMM_WORLD);
 
+    m_bytes_sent += (size_t)msg_length * (m_num_ranks - 1);
+    m_flatbuffers_manager.Reset();
+    m_extents = {{DBL_MAX, DBL_MAX, DBL_MAX}, {-DBL_MAX, -DBL_MAX, -DBL_MAX}, 0, 0};
+}
+
+bool SynMPICommunicator::IsRelevant(const RankExtents& receiver, const RankExtents& sender) const {
+    if (m_interest_radius <= 0 || sender.broadcast || !receiver.valid || !sender.valid)
+        return true;
+
+    // Distance between the two bounding boxes
+    double dist2 = 0;
+    for (int i = 0; i < 3; i++) {
+        double gap = std::max(0.0, std::max(sender.lo[i] - receiver.hi[i], receiver.lo[i] - sender.hi[i]));
+        dist2 += gap * gap;
+    }
+    return dist2 <= m_interest_radius * m_interest_radius;
+}
+
+void SynMPICommunicator::SynchronizeSelective() {
+    // Exchange the extents of all ranks (small, fixed-size messages). All ranks evaluate the same relevance function
+    // on this data, so senders and receivers agree on which buffers are exchanged.
+    std::vector<RankExtents> extents(m_num_ranks);
+    MPI_Allgather(&m_extents, sizeof(RankExtents), MPI_BYTE, extents.data(), sizeof(RankExtents), MPI_BYTE,
+                  MPI_COMM_WORLD);
+
+    uint8_t* ptr = m_flatbuffers_manager.GetBufferPointer();
+    std::vector<uint8_t> buffer(ptr, ptr + m_flatbuffers_manager.GetSize());
+    static const std::vector<uint8_t> no_ref;
+
+    // Post sends to all ranks interested in this rank's agents
+    std::vector<MPI_Request> requests;
+    requests.reserve(m_num_ranks);
+    for (int i = 0; i < m_num_ranks; i++) {
+        if (i == m_rank || !IsRelevant(extents[i], extents[m_rank]))
+            continue;
+        EncodeBuffer(buffer, m_delta_encoding ? m_sent_ref[i] : no_ref, m_send_data[i]);
+        if (m_delta_encoding)
+            m_sent_ref[i] = buffer;
+
+        requests.emplace_back();
+        MPI_Isend(m_send_data[i].data(), (int)m_send_data[i].size(), MPI_BYTE, i, kSelectiveTag, MPI_COMM_WORLD,
+                  &requests.back());
+        m_bytes_sent += m_send_data[i].size();
+    }
+
+    // Receive from all ranks relevant to this rank's agents
+    std::vector<uint8_t> encoded;
+    for (int i = 0; i < m_num_ranks; i++) {
+        m_recv_data[i].clear();
+        if (i == m_rank || !IsRelevant(extents[m_rank], extents[i]))
+            continue;
+
+        MPI_Status status;
+        int count;
+        MPI_Probe(i, kSelectiveTag, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, MPI_BYTE, &count);
+        encoded.resize(count);
+        MPI_Recv(encoded.data(), count, MPI_BYTE, i, kSelectiveTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        DecodeBuffer(encoded, m_recv_ref[i], m_recv_data[i]);
+        if (m_delta_encoding)
+            m_recv_ref[i] = m_recv_data[i];
+    }
+
+    MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+void SynMPICommunicator::SynchronizeAsync() {
+    m_flatbuffers_manager.Finish();
+
+    m_async = true;
+
+    // All pending sends share the same copy of the outgoing buffer
+    uint8_t* ptr = m_flatbuffers_manager.GetBufferPointer();
+    auto buffer = chrono_types::make_shared<std::vector<uint8_t>>(ptr, ptr + m_flatbuffers_manager.GetSize());
+
+    for (int i = 0; i < m_num_ranks; i++) {
+        if (i == m_rank)
+            continue;
+
+        // A buffer that must be delivered is queued behind the previous ones. A buffer with agent states only is
+        // dropped if the rank is still busy with previous buffers.
+        if (m_extents.broadcast || FlushAsync(i)) {
+            m_async_queue[i].push_back(buffer);
+            FlushAsync(i);
+        }
+    }
+
     m_flatbuffers_manager.Reset();
+    m_extents = {{DBL_MAX, DBL_MAX, DBL_MAX}, {-DBL_MAX, -DBL_MAX, -DBL_MAX}, 0, 0};
+
+    ReceiveAsync();
+}
+
+bool SynMPICommunicator::FlushAsync(int rank) {
+    auto& queue = m_async_queue[rank];
+    while (true) {
+        int done;
+        MPI_Test(&m_async_requests[rank], &done, MPI_STATUS_IGNORE);
+        if (!done)
+            return false;
+        if (queue.empty())
+            return true;
+
+        // Keep the buffer alive until the send completes
+        m_async_data[rank] = queue.front();
+        queue.pop_front();
+        const auto& data = *m_async_data[rank];
+        MPI_Isend(data.data(), (int)data.size(), MPI_BYTE, rank, kAsyncTag, MPI_COMM_WORLD, &m_async_requests[rank]);
+        m_bytes_sent += data.size();
+    }
+}
+
+bool SynMPICommunicator::ReceiveAsync() {
+    bool received = false;
+
+    while (true) {
+        int flag;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, kAsyncTag, MPI_COMM_WORLD, &flag, &status);
+        if (!flag)
+            break;
+
+        int count;
+        MPI_Get_count(&status, MPI_BYTE, &count);
+        std::vector<uint8_t> data(count);
+        MPI_Recv(data.data(), count, MPI_BYTE, status.MPI_SOURCE, kAsyncTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        // Messages are deserialized as they arrive (all buffers received since the last reset are kept)
+        m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
+        received = true;
+    }
+
+    return received;
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
+    if (m_async)
+        return m_incoming_messages;
+
+    if (m_selective) {
+        for (int i = 0; i < m_num_ranks; i++) {
+            if (i != m_rank && !m_recv_data[i].empty())
+                m_flatbuffers_manager.ProcessBuffer(m_recv_data[i], m_incoming_messages);
+        }
+        return m_incoming_messages;
+    }
+
     for (int i = 0; i < m_num_ranks; i++) {
         if (i != m_rank) {
             std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
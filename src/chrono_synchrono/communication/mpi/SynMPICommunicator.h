@@ -26,6 +26,10 @@
 
 #include <mpi.h>
 
+#include <deque>
+
+#include "chrono/core/ChVector.h"
+
 #include "chrono_synchrono/communication/SynCommunicator.h"
 
 namespace chrono {
@@ -61,6 +65,24 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual void Synchronize() override;
 
+    ///@brief Send the outgoing messages to all ranks and collect the messages received so far, without waiting
+    /// Buffers are sent with point-to-point non-blocking messages. If the buffer previously sent to a rank has not been
+    /// received yet, a buffer containing only agent states is not sent to that rank (the rank will receive a more
+    /// recent state at a later call); any other buffer (e.g., with a quit message) is queued and sent, in order, once
+    /// the previous ones were received. This function never blocks.
+    /// Interest management and delta encoding only apply to the blocking Synchronize.
+    ///
+    virtual void SynchronizeAsync() override;
+
+    ///@brief Collect the messages received so far from any rank, without sending anything and without blocking
+    ///
+    ///@return true if any new data was received
+    virtual bool ReceiveAsync() override;
+
+    ///@brief The MPI communicator supports asynchronous exchange
+    ///
+    virtual bool SupportsAsync() const override { return true; }
+
     ///@brief This method is responsible for blocking until an action is received or done.
     /// For example, a process may call Barrier to wait until another process has established
     /// certain classes and initialized certain quantities. This functionality should be implemented
@@ -68,6 +90,48 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual void Barrier() override { MPI_Barrier(MPI_COMM_WORLD); }
 
+    ///@brief Add the messages to the outgoing message buffer
+    /// State messages of vehicles and copters are used to determine the region occupied by the agents of this rank
+    /// (for interest management) and are quantized if requested. Any other message is sent to all ranks.
+    ///
+    ///@param messages a list of handles to messages to add to the outgoing buffer
+    virtual void AddOutgoingMessages(SynMessageList& messages) override;
+
+    ///@brief Adds a quit message to the queue telling other nodes to end the simulation
+    /// The quit message is always sent to all ranks.
+    ///
+    virtual void AddQuitMessage() override;
+
+    // -----------------------------------------------------------------------------------------------
+
+    ///@brief Enable spatial interest management (default: disabled)
+    /// If enabled (positive radius), a rank only receives the messages of ranks whose agents are within the specified
+    /// distance of its own agents (measured between the bounding boxes of the agent positions). Zombies of agents
+    /// outside this radius are not updated. Ranks without positioned agents, and ranks sending messages other than
+    /// agent states (descriptions, environment, terrain, quit), communicate with all ranks.
+    /// Must be set identically on all ranks.
+    ///
+    ///@param radius the interest radius (a non-positive value disables interest management)
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Enable delta encoding of the exchanged buffers (default: false)
+    /// If enabled, the buffer sent to a rank is encoded as the difference with respect to the previous buffer sent to
+    /// the same rank, whenever the two buffers have the same layout. Unchanged message fields then cost almost
+    /// nothing. Must be set identically on all ranks.
+    ///
+    void SetDeltaEncoding(bool val);
+
+    ///@brief Set the resolution used to quantize outgoing agent states (default: 0, no quantization)
+    /// Positions (and their derivatives) are rounded to multiples of pos_resolution and quaternion components (and
+    /// their derivatives) to multiples of rot_resolution. Quantization makes small state changes exactly zero, which
+    /// improves the efficiency of delta encoding.
+    ///
+    void SetQuantization(double pos_resolution, double rot_resolution);
+
+    ///@brief Get the total number of bytes sent by this rank
+    ///
+    size_t GetNumBytesSent() const { return m_bytes_sent; }
+
     // -----------------------------------------------------------------------------------------------
 
     ///@brief Get the messages received by the communicator
@@ -86,6 +150,27 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     // -----------------------------------------------------------------------------------------------
 
   private:
+    /// Summary of the outgoing data of a rank, used for interest management
+    struct RankExtents {
+        double lo[3];   ///< lower corner of the bounding box of agent positions
+        double hi[3];   ///< upper corner of the bounding box of agent positions
+        int valid;      ///< the rank has positioned agents
+        int broadcast;  ///< the rank sends messages that must reach all ranks
+    };
+
+    /// Exchange buffers with the relevant ranks only, using point-to-point messages
+    void SynchronizeSelective();
+
+    /// Return true if the receiving rank needs the messages of the sending rank
+    bool IsRelevant(const RankExtents& receiver, const RankExtents& sender) const;
+
+    /// Include the given position in the extents of this rank
+    void AddPosition(const ChVector<>& pos);
+
+    /// Send the queued asynchronous buffers to the given rank, as long as the previous send has completed.
+    /// Return true if no send to that rank is pending.
+    bool FlushAsync(int rank);
+
     int m_rank;
     int m_num_ranks;
 
@@ -96,6 +181,25 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
 
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
+
+    double m_interest_radius;  ///< interest radius (non-positive: disabled)
+    bool m_delta_encoding;     ///< encode buffers relative to the previous ones
+    double m_pos_resolution;   ///< quantization resolution for positions (non-positive: disabled)
+    double m_rot_resolution;   ///< quantization resolution for rotations (non-positive: disabled)
+
+    bool m_selective;       ///< last synchronization used point-to-point messages
+    bool m_async;           ///< last synchronization was asynchronous
+    RankExtents m_extents;  ///< extents of the outgoing data of this rank
+    size_t m_bytes_sent;    ///< total number of bytes sent
+
+    std::vector<std::vector<uint8_t>> m_send_data;  ///< encoded buffers sent to each rank
+    std::vector<std::vector<uint8_t>> m_recv_data;  ///< decoded buffers received from each rank
+    std::vector<std::vector<uint8_t>> m_sent_ref;   ///< last buffer sent to each rank (delta reference)
+    std::vector<std::vector<uint8_t>> m_recv_ref;   ///< last buffer received from each rank (delta reference)
+
+    std::vector<MPI_Request> m_async_requests;                      ///< pending asynchronous send to each rank
+    std::vector<std::shared_ptr<std::vector<uint8_t>>> m_async_data;  ///< buffer of the pending send to each rank
+    std::vector<std::deque<std::shared_ptr<std::vector<uint8_t>>>> m_async_queue;  ///< buffers to deliver to each rank
 };
 
 /// @} synchrono_communication
@@ -90,5 +90,21 @@ flatbuffers::Offset<SynFlatBuffers::Pose> SynPose::ToFlatBuffers(flatbuffers::Fl
     return fb_pose;
 }
 
+void SynPose::Extrapolate(double dt) {
+    const ChVector<>& vel = m_frame.GetPos_dt();
+    const ChVector<>& acc = m_frame.GetPos_dtdt();
+    ChVector<> wvel = m_frame.GetWvel_par();
+
+    ChQuaternion<> q;
+    q.Q_from_Rotv(wvel * dt);
+    ChQuaternion<> rot = q * m_frame.GetRot();
+    rot.Normalize();
+
+    m_frame.SetPos(m_frame.GetPos() + vel * dt + acc * (0.5 * dt * dt));
+    m_frame.SetPos_dt(vel + acc * dt);
+    m_frame.SetRot(rot);
+    m_frame.SetWvel_par(wvel);
+}
+
 }  // namespace synchrono
 }  // namespace chrono
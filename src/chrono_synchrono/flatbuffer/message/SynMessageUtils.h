@@ -78,6 +78,12 @@ class SYN_API SynPose {
 
     ChFrameMoving<>& GetFrame() { return m_frame; }
 
+    ///@brief Extrapolate this pose forward in time (dead reckoning)
+    /// Assumes constant linear acceleration and constant angular velocity over the time interval.
+    ///
+    ///@param dt the time interval
+    void Extrapolate(double dt);
+
   private:
     ChFrameMoving<> m_frame;
 };
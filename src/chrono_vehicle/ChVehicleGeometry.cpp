@@ -20,6 +20,7 @@
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/ChVehicleGeometry.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/assets/ChModelFileShape.h"
@@ -69,8 +70,16 @@ ChVehicleGeometry::LineShape::LineShape(const ChVector<>& pos,
     : m_pos(pos), m_rot(rot), m_line(line) {}
 
 ChVehicleGeometry::ConvexHullsShape::ConvexHullsShape(const std::string& filename, int matID) : m_matID(matID) {
-    geometry::ChTriangleMeshConnected mesh;
-    utils::LoadConvexHulls(vehicle::GetDataFile(filename), mesh, m_hulls);
+    typedef std::vector<std::vector<ChVector<>>> HullList;
+    // The hulls file is parsed only if its contents are not already available in the vehicle data cache
+    auto hulls = ChVehicleDataCache::Get<HullList>(
+        vehicle::GetDataFile(filename), "CONVEX_HULLS", [](const std::string& file) {
+            geometry::ChTriangleMeshConnected mesh;
+            auto data = chrono_types::make_shared<HullList>();
+            utils::LoadConvexHulls(file, mesh, *data);
+            return std::static_pointer_cast<const HullList>(data);
+        });
+    m_hulls = *hulls;
 }
 
 ChVehicleGeometry::TrimeshShape::TrimeshShape(const ChVector<>& pos,
@@ -78,7 +87,10 @@ ChVehicleGeometry::TrimeshShape::TrimeshShape(const ChVector<>& pos,
                                               double radius,
                                               int matID)
     : m_radius(radius), m_pos(pos), m_matID(matID) {
-    m_trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(vehicle::GetDataFile(filename), true, false);
+    // Collision meshes are modified during collision model construction, so use a copy of the (possibly shared) mesh
+    auto trimesh = ChVehicleDataCache::GetWavefrontMesh(vehicle::GetDataFile(filename), true, false);
+    if (trimesh)
+        m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(*trimesh);
 }
 
 ChVehicleGeometry::TrimeshShape::TrimeshShape(const ChVector<>& pos,
@@ -145,8 +157,7 @@ void ChVehicleGeometry::CreateVisualizationAssets(std::shared_ptr<ChBody> body,
     }
 
     if (vis == VisualizationType::MESH && m_has_mesh) {
-        auto trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(vehicle::GetDataFile(m_vis_mesh_file),
-                                                                                  true, true);
+        auto trimesh = ChVehicleDataCache::GetWavefrontMesh(vehicle::GetDataFile(m_vis_mesh_file), true, true);
         auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         trimesh_shape->SetMesh(trimesh);
         trimesh_shape->SetName(filesystem::path(m_vis_mesh_file).stem());
@@ -96,8 +96,15 @@ ChVehicleCosimBaseNode::ChVehicleCosimBaseNode(const std::string& name)
       m_num_tracked_mbs_nodes(0),
       m_num_terrain_nodes(0),
       m_num_tire_nodes(0),
-      m_rank(-1) {
+      m_rank(-1),
+      m_shm_transport(false),
+      m_shm_ring_size(8 << 20),
+      m_extrapolate(false),
+      m_num_syncs(0),
+      m_sync_time(0),
+      m_sync_time_prev(0) {
     MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
+    m_transport = chrono_types::make_unique<ChVehicleCosimTransportMPI>();
 }
 
 void ChVehicleCosimBaseNode::Initialize() {
@@ -184,11 +191,83 @@ void ChVehicleCosimBaseNode::Initialize() {
         }
     }
 
+    int shm_min;
+    int shm_max;
+    int shm = m_shm_transport ? 1 : 0;
+    MPI_Allreduce(&shm, &shm_min, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&shm, &shm_max, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (shm_min != shm_max) {
+        if (m_rank == 0)
+            cerr << "Error: shared memory transport must be enabled on all nodes or on none." << endl;
+        err = true;
+    }
+
     if (err) {
         MPI_Abort(MPI_COMM_WORLD, 1);
     }
+
+    // Create the shared memory transport (collective)
+    if (m_shm_transport)
+        m_transport = chrono_types::make_unique<ChVehicleCosimTransportSHM>(m_shm_ring_size);
+
+    delete[] type_all;
+}
+
+void ChVehicleCosimBaseNode::EnableSharedMemoryTransport(bool val, size_t ring_size) {
+    m_shm_transport = val;
+    m_shm_ring_size = ring_size;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleCosimBaseNode::RecordSyncTime(double time) {
+    m_sync_time_prev = m_sync_time;
+    m_sync_time = time;
+    m_num_syncs++;
+}
+
+BodyState ChVehicleCosimBaseNode::ExtrapolateState(const BodyState& state,
+                                                   const BodyState& state_prev,
+                                                   double dt) const {
+    double h = m_sync_time - m_sync_time_prev;
+    if (h <= 0)
+        return state;
+
+    // Estimate accelerations from the velocities at the last two synchronization points
+    ChVector<> lin_acc = (state.lin_vel - state_prev.lin_vel) / h;
+    ChVector<> ang_acc = (state.ang_vel - state_prev.ang_vel) / h;
+
+    BodyState new_state;
+    new_state.pos = state.pos + state.lin_vel * dt + lin_acc * (0.5 * dt * dt);
+    new_state.lin_vel = state.lin_vel + lin_acc * dt;
+    new_state.ang_vel = state.ang_vel + ang_acc * dt;
+
+    // Rotate by the rotation vector (expressed in the absolute frame) corresponding to the average angular velocity
+    ChQuaternion<> q;
+    q.Q_from_Rotv((state.ang_vel + ang_acc * (0.5 * dt)) * dt);
+    new_state.rot = q * state.rot;
+    new_state.rot.Normalize();
+
+    return new_state;
+}
+
+TerrainForce ChVehicleCosimBaseNode::ExtrapolateForce(const TerrainForce& force,
+                                                      const TerrainForce& force_prev,
+                                                      double dt) const {
+    double h = m_sync_time - m_sync_time_prev;
+    if (h <= 0)
+        return force;
+
+    TerrainForce new_force;
+    new_force.point = force.point;
+    new_force.force = force.force + (force.force - force_prev.force) * (dt / h);
+    new_force.moment = force.moment + (force.moment - force_prev.moment) * (dt / h);
+
+    return new_force;
 }
 
+// -----------------------------------------------------------------------------
+
 void ChVehicleCosimBaseNode::SetOutDir(const std::string& dir_name, const std::string& suffix) {
     m_out_dir = dir_name;
     m_node_out_dir = dir_name + "/" + m_name + suffix;
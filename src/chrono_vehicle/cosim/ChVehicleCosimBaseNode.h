@@ -22,6 +22,7 @@
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <mpi.h>
@@ -31,7 +32,9 @@
 #include "chrono/core/ChQuaternion.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/ChVehicleGeometry.h"
+#include "chrono_vehicle/cosim/ChVehicleCosimTransport.h"
 
 #ifdef CHRONO_POSTPROCESS
     #include "chrono_postprocess/ChBlender.h"
@@ -148,6 +151,20 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     /// Enable/disable verbose messages during simulation (default: true).
     void SetVerbose(bool verbose) { m_verbose = verbose; }
 
+    /// Enable/disable shared memory transport for the data exchanged at each synchronization (default: false).
+    /// If enabled, nodes running on the same host exchange data through ring buffers of the specified size (in bytes)
+    /// in shared memory; communication with nodes on other hosts falls back to MPI. This setting must be identical on
+    /// all nodes and must be specified before calling Initialize().
+    void EnableSharedMemoryTransport(bool val, size_t ring_size = 8 << 20);
+
+    /// Enable/disable extrapolation of the coupling data over a co-simulation step (default: false).
+    /// By default, the coupling data received at a synchronization point (body states or forces) is held constant
+    /// while the node advances to the next synchronization point. For a multirate co-simulation, in which a node takes
+    /// several integration steps (see SetStepSize) per co-simulation step, enabling extrapolation lets the node update
+    /// the coupling data at each of its integration steps, based on the data received at the last two synchronization
+    /// points. Body states are extrapolated assuming constant accelerations and forces are extrapolated linearly.
+    void EnableCouplingExtrapolation(bool val) { m_extrapolate = val; }
+
     /// Enable run-time visualization (default: false).
     /// If enabled, rendering is done with the specified frequency.
     /// Note that a concrete node may not support run-time visualization or may not render all physics elements.
@@ -242,6 +259,22 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     /// Utility function to receive and unpack a struct with geometry information.
     void RecvGeometry(ChVehicleGeometry& geom, int source) const;
 
+    /// Record the time of the current synchronization point.
+    /// A derived class must call this function from Synchronize() if it uses extrapolation of coupling data.
+    void RecordSyncTime(double time);
+
+    /// Return true if coupling data can be extrapolated.
+    /// This requires that extrapolation was enabled and that at least two synchronization points were recorded.
+    bool CanExtrapolate() const { return m_extrapolate && m_num_syncs > 1; }
+
+    /// Extrapolate a body state, given the states at the last two synchronization points.
+    /// The state is extrapolated at time 'dt' after the last synchronization point.
+    BodyState ExtrapolateState(const BodyState& state, const BodyState& state_prev, double dt) const;
+
+    /// Extrapolate a force, given the forces at the last two synchronization points.
+    /// The force is extrapolated at time 'dt' after the last synchronization point.
+    TerrainForce ExtrapolateForce(const TerrainForce& force, const TerrainForce& force_prev, double dt) const;
+
     /// Utility function to display a progress bar to the terminal.
     /// Displays an ASCII progress bar for the quantity x which must be a value between 0 and n.
     /// The width 'w' represents the number of '=' characters corresponding to 100%.
@@ -249,6 +282,16 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
 
     int m_rank;  ///< MPI rank of this node (in MPI_COMM_WORLD)
 
+    std::unique_ptr<ChVehicleCosimTransport> m_transport;  ///< transport for data exchanged at synchronization
+    bool m_shm_transport;                                   ///< use shared memory transport?
+    size_t m_shm_ring_size;                                 ///< size of shared memory ring buffers
+
+    // Multirate coupling
+    bool m_extrapolate;       ///< extrapolate coupling data over a co-simulation step?
+    int m_num_syncs;          ///< number of synchronization points recorded
+    double m_sync_time;       ///< time of last synchronization point
+    double m_sync_time_prev;  ///< time of previous synchronization point
+
     double m_step_size;  ///< integration step size
 
     std::string m_name;          ///< name of the node
@@ -120,6 +120,7 @@ void ChVehicleCosimTerrainNode::Initialize() {
             m_mesh_contact.resize(m_num_objects);
         }
         m_rigid_state.resize(m_num_objects);
+        m_rigid_state_prev.resize(m_num_objects);
         m_rigid_contact.resize(m_num_objects);
 
         // 5. Receive object information (geometry, contact materials, load mass)
@@ -223,6 +224,8 @@ void ChVehicleCosimTerrainNode::InitializeTrackData() {
 // Only the main terrain node participates in the co-simulation data exchange.
 // -----------------------------------------------------------------------------
 void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
+    RecordSyncTime(time);
+
     switch (m_interface_type) {
         case InterfaceType::BODY:
             if (m_wheeled)
@@ -246,9 +249,10 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
     for (int i = 0; i < m_num_objects; i++) {
         if (m_rank == TERRAIN_NODE_RANK) {
             // Receive rigid body state data for this tire
-            MPI_Status status;
             double state_data[13];
-            MPI_Recv(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            m_transport->Recv(state_data, 13, TIRE_NODE_RANK(i), step_number);
+
+            m_rigid_state_prev[i] = m_rigid_state[i];
 
             m_rigid_state[i].pos = ChVector<>(state_data[0], state_data[1], state_data[2]);
             m_rigid_state[i].rot = ChQuaternion<>(state_data[3], state_data[4], state_data[5], state_data[6]);
@@ -274,7 +278,7 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
             double force_data[] = {m_rigid_contact[i].force.x(),  m_rigid_contact[i].force.y(),
                                    m_rigid_contact[i].force.z(),  m_rigid_contact[i].moment.x(),
                                    m_rigid_contact[i].moment.y(), m_rigid_contact[i].moment.z()};
-            MPI_Send(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            m_transport->Send(force_data, 6, TIRE_NODE_RANK(i), step_number);
 
             if (m_verbose)
                 cout << "[Terrain node] Send: spindle force (" << i << ") = " << m_rigid_contact[i].force << endl;
@@ -293,12 +297,12 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
 
     // Receive rigid body data for all track shoes
     if (m_rank == TERRAIN_NODE_RANK) {
-        MPI_Status status;
-        MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+        m_transport->Recv(all_states.data(), 13 * m_num_objects, MBS_NODE_RANK, step_number);
 
         // Unpack rigid body data
         start_idx = 0;
         for (int i = 0; i < m_num_objects; i++) {
+            m_rigid_state_prev[i] = m_rigid_state[i];
             m_rigid_state[i].pos =
                 ChVector<>(all_states[start_idx + 0], all_states[start_idx + 1], all_states[start_idx + 2]);
             m_rigid_state[i].rot = ChQuaternion<>(all_states[start_idx + 3], all_states[start_idx + 4],
@@ -336,7 +340,7 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
             start_idx += 6;
         }
 
-        MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        m_transport->Send(all_forces.data(), 6 * m_num_objects, MBS_NODE_RANK, step_number);
 
         if (m_verbose)
             cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
@@ -348,11 +352,13 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
         if (m_rank == TERRAIN_NODE_RANK) {
             auto nv = m_geometry[i].m_coll_meshes[0].m_trimesh->getNumVertices();
 
-            // Receive mesh state data
-            MPI_Status status;
-            double* vert_data = new double[2 * 3 * nv];
-            MPI_Recv(vert_data, 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD,
-                     &status);
+            // Receive mesh state data (unpacked directly from the transport buffer)
+            size_t size;
+            auto vert_data = static_cast<const double*>(m_transport->BeginRecv(TIRE_NODE_RANK(i), step_number, size));
+            if (size != 2 * 3 * nv * sizeof(double)) {
+                m_transport->EndRecv(TIRE_NODE_RANK(i));
+                throw ChException("Mesh state message does not match the number of mesh vertices");
+            }
 
             for (int iv = 0; iv < nv; iv++) {
                 int offset = 3 * iv;
@@ -363,10 +369,10 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
                     ChVector<>(vert_data[offset + 0], vert_data[offset + 1], vert_data[offset + 2]);
             }
 
+            m_transport->EndRecv(TIRE_NODE_RANK(i));
+
             ////if (m_verbose)
             ////    PrintMeshUpdateData(i);
-
-            delete[] vert_data;
         }
 
         // Set position, rotation, and velocity of proxy bodies.
@@ -384,17 +390,16 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
 
         if (m_rank == TERRAIN_NODE_RANK) {
             // Send vertex indices and forces.
-            MPI_Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, MPI_INT, TIRE_NODE_RANK(i), step_number,
-                     MPI_COMM_WORLD);
+            m_transport->Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, TIRE_NODE_RANK(i), step_number);
 
-            double* force_data = new double[3 * m_mesh_contact[i].nv];
+            auto force_data = static_cast<double*>(
+                m_transport->BeginSend(TIRE_NODE_RANK(i), 3 * m_mesh_contact[i].nv * sizeof(double)));
             for (int iv = 0; iv < m_mesh_contact[i].nv; iv++) {
                 force_data[3 * iv + 0] = m_mesh_contact[i].vforce[iv].x();
                 force_data[3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
                 force_data[3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
             }
-            MPI_Send(force_data, 3 * m_mesh_contact[i].nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
-            delete[] force_data;
+            m_transport->EndSend(TIRE_NODE_RANK(i), step_number);
 
             if (m_verbose)
                 cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts()
@@ -422,6 +427,30 @@ void ChVehicleCosimTerrainNode::Advance(double step_size) {
     Render(step_size);
 }
 
+void ChVehicleCosimTerrainNode::ExtrapolateProxies(double dt) {
+    if (!CanExtrapolate())
+        return;
+
+    switch (m_interface_type) {
+        case InterfaceType::BODY:
+            for (int i = 0; i < m_num_objects; i++) {
+                auto state = ExtrapolateState(m_rigid_state[i], m_rigid_state_prev[i], dt);
+                UpdateRigidProxy(i, state);
+            }
+            break;
+        case InterfaceType::MESH:
+            for (int i = 0; i < m_num_objects; i++) {
+                MeshState state;
+                state.vvel = m_mesh_state[i].vvel;
+                state.vpos.resize(m_mesh_state[i].vpos.size());
+                for (size_t iv = 0; iv < state.vpos.size(); iv++)
+                    state.vpos[iv] = m_mesh_state[i].vpos[iv] + m_mesh_state[i].vvel[iv] * dt;
+                UpdateMeshProxy(i, state);
+            }
+            break;
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 void ChVehicleCosimTerrainNode::OutputData(int frame) {
@@ -159,6 +159,12 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     /// Load contact forces (expressed in absolute frame) into the provided TerrainForce struct.
     virtual void GetForceRigidProxy(unsigned int i, TerrainForce& rigid_contact) = 0;
 
+    /// Update the proxies with the body or mesh states extrapolated at time 'dt' after the last synchronization.
+    /// A derived class can call this function at each of its integration steps during a co-simulation step (see
+    /// EnableCouplingExtrapolation). Body states are extrapolated from the states at the last two synchronization
+    /// points; mesh vertices are advanced with their current velocities.
+    void ExtrapolateProxies(double dt);
+
   protected:
     double m_dimX;  ///< patch length (X direction)
     double m_dimY;  ///< patch width (Y direction)
@@ -176,6 +182,7 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
 
     std::vector<MeshState> m_mesh_state;        ///< mesh state (used for MESH communication)
     std::vector<BodyState> m_rigid_state;       ///< rigid state (used for BODY communication interface)
+    std::vector<BodyState> m_rigid_state_prev;  ///< rigid state at previous synchronization (BODY interface)
     std::vector<MeshContact> m_mesh_contact;    ///< mesh contact forces (used for MESH communication interface)
     std::vector<TerrainForce> m_rigid_contact;  ///< rigid contact force (used for BODY communication interface)
 
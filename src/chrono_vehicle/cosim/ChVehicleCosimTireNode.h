@@ -176,6 +176,10 @@ class CH_VEHICLE_API ChVehicleCosimTireNode : public ChVehicleCosimBaseNode {
     // Communication data (loaded by derived classes)
     ChVehicleGeometry m_geometry;  ///< tire geometry and contact material
 
+    // Multirate coupling
+    BodyState m_spindle_state;       ///< spindle state at last synchronization
+    BodyState m_spindle_state_prev;  ///< spindle state at previous synchronization
+
   private:
     virtual ChSystem* GetSystemPostprocess() const override { return m_system; }
     void InitializeSystem();
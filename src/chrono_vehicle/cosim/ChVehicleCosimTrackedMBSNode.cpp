@@ -133,6 +133,9 @@ void ChVehicleCosimTrackedMBSNode::Initialize() {
 
     GetChassisBody()->SetBodyFixed(m_fix_chassis);
 
+    m_shoe_force.resize(num_track_shoes);
+    m_shoe_force_prev.resize(num_track_shoes);
+
     // Send to TERRAIN node the number of interacting objects (here, total number of track shoes)
     MPI_Send(&num_track_shoes, 1, MPI_INT, TERRAIN_NODE_RANK, 0, MPI_COMM_WORLD);
 
@@ -240,6 +243,8 @@ void ChVehicleCosimTrackedMBSNode::InitializeSystem() {
 // - receive and apply vertex contact forces
 // -----------------------------------------------------------------------------
 void ChVehicleCosimTrackedMBSNode::Synchronize(int step_number, double time) {
+    RecordSyncTime(time);
+
     int num_shoes = (int)GetNumTrackShoes();
     std::vector<double> all_states(13 * num_shoes);
     std::vector<double> all_forces(6 * num_shoes);
@@ -268,12 +273,11 @@ void ChVehicleCosimTrackedMBSNode::Synchronize(int step_number, double time) {
     }
 
     // Send track shoe states to the terrain node
-    MPI_Send(all_states.data(), 13 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    m_transport->Send(all_states.data(), 13 * num_shoes, TERRAIN_NODE_RANK, step_number);
 
     // Receive track shoe forces as applied to the center of the track shoe body.
     // Note that we assume this is the resultant wrench at the track shoe origin (expressed in absolute frame).
-    MPI_Status status;
-    MPI_Recv(all_forces.data(), 6 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    m_transport->Recv(all_forces.data(), 6 * num_shoes, TERRAIN_NODE_RANK, step_number);
 
     // Apply track shoe forces on each individual track shoe body
     start_idx = 0;
@@ -284,6 +288,8 @@ void ChVehicleCosimTrackedMBSNode::Synchronize(int step_number, double time) {
             force.force = ChVector<>(all_forces[start_idx + 0], all_forces[start_idx + 1], all_forces[start_idx + 2]);
             force.moment = ChVector<>(all_forces[start_idx + 3], all_forces[start_idx + 4], all_forces[start_idx + 5]);
             ApplyTrackShoeForce(i, j, force);
+            m_shoe_force_prev[start_idx / 6] = m_shoe_force[start_idx / 6];
+            m_shoe_force[start_idx / 6] = force;
             start_idx += 6;
         }
     }
@@ -298,6 +304,18 @@ void ChVehicleCosimTrackedMBSNode::Advance(double step_size) {
     double t = 0;
     while (t < step_size) {
         double h = std::min<>(m_step_size, step_size - t);
+        if (CanExtrapolate() && t > 0) {
+            // Update track shoe forces for multirate coupling
+            int k = 0;
+            for (int i = 0; i < GetNumTracks(); i++) {
+                for (int j = 0; j < GetNumTrackShoes(i); j++) {
+                    auto force = ExtrapolateForce(m_shoe_force[k], m_shoe_force_prev[k], t);
+                    force.point = GetTrackShoeBody(i, j)->GetPos();
+                    ApplyTrackShoeForce(i, j, force);
+                    k++;
+                }
+            }
+        }
         PreAdvance(h);
         m_system->DoStepDynamics(h);
         if (m_DBP_rig) {
@@ -157,6 +157,9 @@ class CH_VEHICLE_API ChVehicleCosimTrackedMBSNode : public ChVehicleCosimBaseNod
     void InitializeSystem();
 
     bool m_fix_chassis;
+
+    std::vector<TerrainForce> m_shoe_force;       ///< track shoe forces at last synchronization
+    std::vector<TerrainForce> m_shoe_force_prev;  ///< track shoe forces at previous synchronization
 };
 
 /// @} vehicle_cosim
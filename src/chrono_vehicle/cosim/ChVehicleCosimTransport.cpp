@@ -0,0 +1,246 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Transport layers for the data exchanged between vehicle co-simulation nodes.
+//
+// =============================================================================
+
+#include <atomic>
+#include <new>
+#include <string>
+#include <thread>
+
+#include "chrono_vehicle/cosim/ChVehicleCosimTransport.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// MPI transport
+// -----------------------------------------------------------------------------
+
+ChVehicleCosimTransportMPI::ChVehicleCosimTransportMPI() {
+    int size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    m_send_data.resize(size);
+    m_recv_data.resize(size);
+}
+
+void* ChVehicleCosimTransportMPI::BeginSend(int dest, size_t size) {
+    m_send_data[dest].resize(size);
+    return m_send_data[dest].data();
+}
+
+void ChVehicleCosimTransportMPI::EndSend(int dest, int tag) {
+    MPI_Send(m_send_data[dest].data(), (int)m_send_data[dest].size(), MPI_BYTE, dest, tag, MPI_COMM_WORLD);
+}
+
+const void* ChVehicleCosimTransportMPI::BeginRecv(int source, int tag, size_t& size) {
+    MPI_Status status;
+    int count;
+    MPI_Probe(source, tag, MPI_COMM_WORLD, &status);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    m_recv_data[source].resize(count);
+    MPI_Recv(m_recv_data[source].data(), count, MPI_BYTE, source, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    size = (size_t)count;
+    return m_recv_data[source].data();
+}
+
+// -----------------------------------------------------------------------------
+// Shared memory transport
+//
+// A ring buffer consists of a header with the total number of bytes written (head) and read (tail), followed by the
+// data area. Only the sender modifies the head and only the receiver modifies the tail. Each message is stored as a
+// contiguous record (a header followed by the payload, padded to a multiple of 8 bytes). A record which does not fit
+// before the end of the data area is placed at its beginning; the skipped bytes are marked with a WRAP record (or
+// implicitly skipped if too few to hold a record header). A message sent with MPI is announced by an MPI record, so
+// that the receiver processes messages in order.
+// -----------------------------------------------------------------------------
+
+struct ChVehicleCosimTransportSHM::Ring {
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+
+    Ring() : head(0), tail(0) {}
+    char* data() { return reinterpret_cast<char*>(this) + sizeof(Ring); }
+};
+
+struct ChVehicleCosimTransportSHM::Record {
+    enum Type { DATA, WRAP, VIA_MPI };
+    uint64_t size;  ///< payload size (bytes)
+    int32_t tag;    ///< message tag
+    int32_t type;   ///< record type
+};
+
+static inline uint64_t Pad8(uint64_t size) {
+    return (size + 7) & ~uint64_t(7);
+}
+
+ChVehicleCosimTransportSHM::ChVehicleCosimTransportSHM(size_t ring_size) {
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    m_out.resize(size, nullptr);
+    m_in.resize(size, nullptr);
+    m_send_record.resize(size, nullptr);
+    m_send_advance.resize(size, 0);
+    m_recv_advance.resize(size, 0);
+
+    // Ranks on the same host and their ranks in MPI_COMM_WORLD
+    int local_rank;
+    int local_size;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, m_rank, MPI_INFO_NULL, &m_comm);
+    MPI_Comm_rank(m_comm, &local_rank);
+    MPI_Comm_size(m_comm, &local_size);
+    std::vector<int> world_rank(local_size);
+    MPI_Allgather(&m_rank, 1, MPI_INT, world_rank.data(), 1, MPI_INT, m_comm);
+
+    // Each rank owns one incoming ring buffer for each rank on the same host
+    m_capacity = (size_t)((Pad8(ring_size) + 63) & ~uint64_t(63));
+    size_t ring_bytes = sizeof(Ring) + m_capacity;
+    char* base;
+    MPI_Win_allocate_shared((MPI_Aint)(local_size * ring_bytes), 1, MPI_INFO_NULL, m_comm, &base, &m_win);
+    for (int i = 0; i < local_size; i++)
+        new (base + i * ring_bytes) Ring();
+
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, m_win);
+    MPI_Win_sync(m_win);
+    MPI_Barrier(m_comm);
+
+    for (int i = 0; i < local_size; i++) {
+        if (i == local_rank)
+            continue;
+        MPI_Aint seg_size;
+        int disp_unit;
+        char* seg;
+        MPI_Win_shared_query(m_win, i, &seg_size, &disp_unit, &seg);
+        m_out[world_rank[i]] = reinterpret_cast<Ring*>(seg + local_rank * ring_bytes);
+        m_in[world_rank[i]] = reinterpret_cast<Ring*>(base + i * ring_bytes);
+    }
+}
+
+ChVehicleCosimTransportSHM::~ChVehicleCosimTransportSHM() {
+    MPI_Win_unlock_all(m_win);
+    MPI_Win_free(&m_win);
+    MPI_Comm_free(&m_comm);
+}
+
+ChVehicleCosimTransportSHM::Record* ChVehicleCosimTransportSHM::Reserve(int dest, size_t size) {
+    Ring* ring = m_out[dest];
+    uint64_t record = sizeof(Record) + Pad8(size);
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t offset = head % m_capacity;
+    uint64_t skip = (m_capacity - offset < record) ? m_capacity - offset : 0;
+
+    // Wait until the receiver has freed enough space
+    while (head + skip + record - ring->tail.load(std::memory_order_acquire) > m_capacity)
+        std::this_thread::yield();
+
+    if (skip >= sizeof(Record)) {
+        auto wrap = reinterpret_cast<Record*>(ring->data() + offset);
+        wrap->size = 0;
+        wrap->tag = 0;
+        wrap->type = Record::WRAP;
+    }
+
+    m_send_advance[dest] = skip + record;
+    return reinterpret_cast<Record*>(ring->data() + (head + skip) % m_capacity);
+}
+
+void ChVehicleCosimTransportSHM::Publish(int dest) {
+    Ring* ring = m_out[dest];
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    ring->head.store(head + m_send_advance[dest], std::memory_order_release);
+}
+
+void* ChVehicleCosimTransportSHM::BeginSend(int dest, size_t size) {
+    // Use MPI for ranks on other hosts and for messages which may not fit in the ring buffer
+    if (!m_out[dest] || 2 * (sizeof(Record) + Pad8(size)) > m_capacity) {
+        m_send_record[dest] = nullptr;
+        return ChVehicleCosimTransportMPI::BeginSend(dest, size);
+    }
+
+    m_send_record[dest] = Reserve(dest, size);
+    m_send_record[dest]->size = size;
+    return reinterpret_cast<char*>(m_send_record[dest]) + sizeof(Record);
+}
+
+void ChVehicleCosimTransportSHM::EndSend(int dest, int tag) {
+    if (auto record = m_send_record[dest]) {
+        record->tag = tag;
+        record->type = Record::DATA;
+        Publish(dest);
+        m_send_record[dest] = nullptr;
+        return;
+    }
+
+    // Announce a message sent with MPI to a co-located rank
+    if (m_out[dest]) {
+        auto record = Reserve(dest, 0);
+        record->size = m_send_data[dest].size();
+        record->tag = tag;
+        record->type = Record::VIA_MPI;
+        Publish(dest);
+    }
+
+    ChVehicleCosimTransportMPI::EndSend(dest, tag);
+}
+
+const void* ChVehicleCosimTransportSHM::BeginRecv(int source, int tag, size_t& size) {
+    Ring* ring = m_in[source];
+    m_recv_advance[source] = 0;
+    if (!ring)
+        return ChVehicleCosimTransportMPI::BeginRecv(source, tag, size);
+
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    while (true) {
+        // Wait for a record from the sender
+        while (ring->head.load(std::memory_order_acquire) == tail)
+            std::this_thread::yield();
+
+        // Skip to the beginning of the data area if necessary
+        uint64_t offset = tail % m_capacity;
+        auto record = reinterpret_cast<Record*>(ring->data() + offset);
+        if (m_capacity - offset < sizeof(Record) || record->type == Record::WRAP) {
+            tail += m_capacity - offset;
+            ring->tail.store(tail, std::memory_order_release);
+            continue;
+        }
+
+        if (record->tag != tag)
+            throw ChException("Unexpected co-simulation message tag from rank " + std::to_string(source));
+
+        if (record->type == Record::VIA_MPI) {
+            ring->tail.store(tail + sizeof(Record), std::memory_order_release);
+            return ChVehicleCosimTransportMPI::BeginRecv(source, tag, size);
+        }
+
+        size = (size_t)record->size;
+        m_recv_advance[source] = sizeof(Record) + Pad8(size);
+        return reinterpret_cast<char*>(record) + sizeof(Record);
+    }
+}
+
+void ChVehicleCosimTransportSHM::EndRecv(int source) {
+    if (m_recv_advance[source] == 0)
+        return;
+
+    Ring* ring = m_in[source];
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    ring->tail.store(tail + m_recv_advance[source], std::memory_order_release);
+    m_recv_advance[source] = 0;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
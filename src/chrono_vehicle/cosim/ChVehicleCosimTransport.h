@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Transport layers for the data exchanged between vehicle co-simulation nodes.
+//
+// =============================================================================
+
+#ifndef CH_VEHCOSIM_TRANSPORT_H
+#define CH_VEHCOSIM_TRANSPORT_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <mpi.h>
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_cosim
+/// @{
+
+/// Base class for the transport of messages between co-simulation nodes.
+/// Nodes are identified by their rank in MPI_COMM_WORLD. Messages between a given pair of nodes are received in the
+/// order in which they were sent. To avoid unnecessary copies, a message can be assembled directly in memory owned by
+/// the transport (BeginSend/EndSend) and read in place (BeginRecv/EndRecv).
+class CH_VEHICLE_API ChVehicleCosimTransport {
+  public:
+    virtual ~ChVehicleCosimTransport() {}
+
+    /// Return a buffer of the given size (in bytes) for a message to the specified rank.
+    /// The message is sent with EndSend. At most one message per destination can be under construction.
+    virtual void* BeginSend(int dest, size_t size) = 0;
+
+    /// Send the message started with BeginSend, using the specified tag.
+    virtual void EndSend(int dest, int tag) = 0;
+
+    /// Receive the next message from the specified rank, with the specified tag.
+    /// Returns a pointer to the message data, which remains valid until the matching call to EndRecv. On return,
+    /// 'size' contains the message size (in bytes).
+    virtual const void* BeginRecv(int source, int tag, size_t& size) = 0;
+
+    /// Release the message obtained with BeginRecv.
+    virtual void EndRecv(int source) = 0;
+
+    /// Send an array of n values of type T to the specified rank.
+    template <typename T>
+    void Send(const T* data, size_t n, int dest, int tag) {
+        void* buffer = BeginSend(dest, n * sizeof(T));
+        if (n > 0)
+            std::memcpy(buffer, data, n * sizeof(T));
+        EndSend(dest, tag);
+    }
+
+    /// Receive an array of at most n values of type T from the specified rank.
+    /// Returns the number of values received.
+    template <typename T>
+    size_t Recv(T* data, size_t n, int source, int tag) {
+        size_t size;
+        const void* buffer = BeginRecv(source, tag, size);
+        if (size > n * sizeof(T))
+            throw ChException("Co-simulation message larger than the receive buffer");
+        if (size > 0)
+            std::memcpy(data, buffer, size);
+        EndRecv(source);
+        return size / sizeof(T);
+    }
+};
+
+/// Transport of co-simulation messages using MPI point-to-point communication on MPI_COMM_WORLD.
+class CH_VEHICLE_API ChVehicleCosimTransportMPI : public ChVehicleCosimTransport {
+  public:
+    ChVehicleCosimTransportMPI();
+
+    virtual void* BeginSend(int dest, size_t size) override;
+    virtual void EndSend(int dest, int tag) override;
+    virtual const void* BeginRecv(int source, int tag, size_t& size) override;
+    virtual void EndRecv(int source) override {}
+
+  protected:
+    int m_rank;                                  ///< rank of this process in MPI_COMM_WORLD
+    std::vector<std::vector<char>> m_send_data;  ///< message under construction for each destination
+    std::vector<std::vector<char>> m_recv_data;  ///< last message received from each source
+};
+
+/// Transport of co-simulation messages through shared memory, for nodes running on the same host.
+/// Each pair of co-located ranks communicates through a lock-free ring buffer in an MPI shared memory window, owned by
+/// the receiving rank. Messages are written and read in place, with no intermediate copies. Messages exchanged with
+/// ranks on other hosts, or larger than half the ring capacity, are sent with MPI.
+/// The constructor and destructor are collective: they must be called on all ranks.
+class CH_VEHICLE_API ChVehicleCosimTransportSHM : public ChVehicleCosimTransportMPI {
+  public:
+    /// Create the shared memory transport, with ring buffers of the specified capacity (in bytes).
+    ChVehicleCosimTransportSHM(size_t ring_size = 8 << 20);
+    ~ChVehicleCosimTransportSHM();
+
+    /// Return true if the specified rank runs on the same host (and messages to it use shared memory).
+    bool IsColocated(int rank) const { return m_out[rank] != nullptr; }
+
+    virtual void* BeginSend(int dest, size_t size) override;
+    virtual void EndSend(int dest, int tag) override;
+    virtual const void* BeginRecv(int source, int tag, size_t& size) override;
+    virtual void EndRecv(int source) override;
+
+  private:
+    struct Ring;
+    struct Record;
+
+    /// Reserve space for a record with the given payload size in the ring to the specified rank.
+    Record* Reserve(int dest, size_t size);
+
+    /// Make the reserved record visible to the receiver.
+    void Publish(int dest);
+
+    size_t m_capacity;  ///< capacity of each ring buffer (bytes)
+    MPI_Comm m_comm;    ///< communicator of the ranks on this host
+    MPI_Win m_win;      ///< shared memory window holding the ring buffers
+
+    std::vector<Ring*> m_out;               ///< ring buffer to each rank (null if not co-located)
+    std::vector<Ring*> m_in;                ///< ring buffer from each rank (null if not co-located)
+    std::vector<Record*> m_send_record;     ///< record reserved for each destination (null: sent with MPI)
+    std::vector<uint64_t> m_send_advance;   ///< ring space used by the record reserved for each destination
+    std::vector<uint64_t> m_recv_advance;   ///< ring space used by the record read from each source (0: MPI)
+};
+
+/// @} vehicle_cosim
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
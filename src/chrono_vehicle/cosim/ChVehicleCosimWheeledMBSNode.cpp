@@ -134,6 +134,9 @@ void ChVehicleCosimWheeledMBSNode::Initialize() {
 
     GetChassisBody()->SetBodyFixed(m_fix_chassis);
 
+    m_spindle_force.resize(num_spindles);
+    m_spindle_force_prev.resize(num_spindles);
+
     // For each TIRE, send initial location
     for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
         // Send wheel state to the tire node
@@ -264,7 +267,7 @@ void ChVehicleCosimWheeledMBSNode::InitializeSystem() {
 // - receive and apply vertex contact forces
 // -----------------------------------------------------------------------------
 void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
-    MPI_Status status;
+    RecordSyncTime(time);
 
     for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
         // Send wheel state to the tire node
@@ -276,7 +279,7 @@ void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
             state.ang_vel.x(), state.ang_vel.y(), state.ang_vel.z()                   //
         };
 
-        MPI_Send(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+        m_transport->Send(state_data, 13, TIRE_NODE_RANK(i), step_number);
 
         if (m_verbose)
             cout << "[MBS node    ] Send: spindle position (" << i << ") = " << state.pos << endl;
@@ -284,7 +287,7 @@ void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
         // Receive spindle force as applied to the center of the spindle/wheel.
         // Note that we assume this is the resultant wrench at the wheel origin (expressed in absolute frame).
         double force_data[6];
-        MPI_Recv(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+        m_transport->Recv(force_data, 6, TIRE_NODE_RANK(i), step_number);
 
         TerrainForce spindle_force;
         spindle_force.point = GetSpindleBody(i)->GetPos();
@@ -292,6 +295,9 @@ void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
         spindle_force.moment = ChVector<>(force_data[3], force_data[4], force_data[5]);
         ApplySpindleForce(i, spindle_force);
 
+        m_spindle_force_prev[i] = m_spindle_force[i];
+        m_spindle_force[i] = spindle_force;
+
         if (m_verbose)
             cout << "[MBS node    ] Recv: spindle force (" << i << ") = " << spindle_force.force << endl;
     }
@@ -307,6 +313,14 @@ void ChVehicleCosimWheeledMBSNode::Advance(double step_size) {
     double t = 0;
     while (t < step_size) {
         double h = std::min<>(m_step_size, step_size - t);
+        if (CanExtrapolate() && t > 0) {
+            // Update spindle forces for multirate coupling
+            for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
+                auto spindle_force = ExtrapolateForce(m_spindle_force[i], m_spindle_force_prev[i], t);
+                spindle_force.point = GetSpindleBody(i)->GetPos();
+                ApplySpindleForce(i, spindle_force);
+            }
+        }
         PreAdvance(h);
         m_system->DoStepDynamics(h);
         if (m_DBP_rig) {
@@ -170,6 +170,9 @@ class CH_VEHICLE_API ChVehicleCosimWheeledMBSNode : public ChVehicleCosimBaseNod
     void InitializeSystem();
 
     bool m_fix_chassis;
+
+    std::vector<TerrainForce> m_spindle_force;       ///< spindle forces at last synchronization
+    std::vector<TerrainForce> m_spindle_force_prev;  ///< spindle forces at previous synchronization
 };
 
 /// @} vehicle_cosim
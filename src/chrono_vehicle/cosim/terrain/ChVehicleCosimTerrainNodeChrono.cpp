@@ -184,6 +184,8 @@ void ChVehicleCosimTerrainNodeChrono::OnAdvance(double step_size) {
     double t = 0;
     while (t < step_size) {
         double h = std::min<>(m_step_size, step_size - t);
+        if (t > 0)
+            ExtrapolateProxies(t);
         GetSystem()->DoStepDynamics(h);
         t += h;
     }
@@ -63,6 +63,10 @@ void ChVehicleCosimTireNodeFlexible::Advance(double step_size) {
         m_tire_def->GetMesh()->ResetCounters();
         m_tire_def->GetMesh()->ResetTimers();
         double h = std::min<>(m_step_size, step_size - t);
+        if (CanExtrapolate() && t > 0) {
+            // Update spindle state for multirate coupling
+            ApplySpindleState(ExtrapolateState(m_spindle_state, m_spindle_state_prev, t));
+        }
         m_system->DoStepDynamics(h);
         t += h;
     }
@@ -33,6 +33,7 @@
 #include "chrono_vehicle/terrain/RigidTerrain.h"
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_thirdparty/stb/stb.h"
 #include "chrono_thirdparty/filesystem/path.h"
@@ -235,7 +236,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
     patch->m_visualize = visualization;
 
     // Load mesh from file
-    patch->m_trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_file, true, true);
+    patch->m_trimesh = ChVehicleDataCache::GetWavefrontMesh(mesh_file, true, true);
 
     // Create the collision model
     patch->m_body->GetCollisionModel()->ClearModel();
@@ -243,7 +244,10 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
         patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh, true, false, VNULL,
                                                             ChMatrix33<>(1), sweep_sphere_radius);
     } else {
-        patch->m_trimesh_s = geometry::ChTriangleMeshSoup::CreateFromWavefrontFile(mesh_file);
+        // Create the triangle soup from the already loaded mesh (avoid parsing the mesh file again)
+        patch->m_trimesh_s = chrono_types::make_shared<geometry::ChTriangleMeshSoup>();
+        for (int i = 0; i < patch->m_trimesh->getNumTriangles(); i++)
+            patch->m_trimesh_s->addTriangle(patch->m_trimesh->getTriangle(i));
         patch->m_body->GetCollisionModel()->AddTriangleMesh(material, patch->m_trimesh_s, true, false, VNULL,
                                                             ChMatrix33<>(1), sweep_sphere_radius);
     }
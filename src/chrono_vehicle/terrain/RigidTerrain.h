@@ -117,11 +117,12 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     );
 
     /// Add a terrain patch represented by a triangular mesh.
-    /// The mesh is specified through a Wavefront file and is used for both contact and visualization.
+    /// The mesh is specified through a Wavefront OBJ file or a file in the Chrono binary mesh format (see
+    /// ChTriangleMeshConnected::WriteBinaryMesh) and is used for both contact and visualization.
     std::shared_ptr<Patch> AddPatch(
         std::shared_ptr<ChMaterialSurface> material,  ///< [in] contact material
         const ChCoordsys<>& position,                 ///< [in] patch location and orientation
-        const std::string& mesh_file,                 ///< [in] filename of the input mesh (OBJ)
+        const std::string& mesh_file,                 ///< [in] filename of the input mesh (OBJ or binary)
         bool connected_mesh = true,                   ///< [in] use connected contact mesh?
         double sweep_sphere_radius = 0,               ///< [in] radius of sweep sphere
         bool visualization = true                     ///< [in] enable/disable construction of visualization assets
@@ -506,7 +506,7 @@ bool calcBarycentricCoordinates(const ChVector<>& v1,
 
 void SCMLoader::Initialize(const std::string& mesh_file, double delta) {
     // Load triangular mesh
-    auto trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(mesh_file, true, true);
+    auto trimesh = geometry::ChTriangleMeshConnected::CreateFromFile(mesh_file, true, true);
 
     Initialize(*trimesh, delta);
 }
@@ -1811,5 +1811,59 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
     }
 }
 
+// Save and restore the deformation history of the terrain.
+// Node records are written as raw memory; a snapshot can only be read back by the same build.
+void SCMLoader::WriteExtraState(std::ostream& stream) const {
+    uint64_t num_nodes = m_grid_map.size();
+    stream.write(reinterpret_cast<const char*>(&num_nodes), sizeof(num_nodes));
+    for (const auto& nr : m_grid_map) {
+        int ij[2] = {nr.first.x(), nr.first.y()};
+        stream.write(reinterpret_cast<const char*>(ij), sizeof(ij));
+        stream.write(reinterpret_cast<const char*>(&nr.second), sizeof(NodeRecord));
+    }
+}
+
+void SCMLoader::ReadExtraState(std::istream& stream) {
+    // Nodes currently modified, to be reset in the visualization mesh if not in the restored set
+    std::vector<ChVector2<int>> old_nodes;
+    old_nodes.reserve(m_grid_map.size());
+    for (const auto& nr : m_grid_map)
+        old_nodes.push_back(nr.first);
+
+    uint64_t num_nodes = 0;
+    stream.read(reinterpret_cast<char*>(&num_nodes), sizeof(num_nodes));
+    m_grid_map.clear();
+    m_grid_map.reserve(num_nodes);
+    for (uint64_t i = 0; i < num_nodes; i++) {
+        int ij[2];
+        NodeRecord rec;
+        stream.read(reinterpret_cast<char*>(ij), sizeof(ij));
+        stream.read(reinterpret_cast<char*>(&rec), sizeof(NodeRecord));
+        m_grid_map.insert(std::make_pair(ChVector2<int>(ij[0], ij[1]), rec));
+    }
+    m_modified_nodes.clear();
+
+    // Update visualization
+    if (m_trimesh_shape) {
+        auto update_vertex = [this](const ChVector2<int>& ij, const NodeRecord& nr) {
+            if (!CheckMeshBounds(ij))
+                return;
+            int iv = GetMeshVertexIndex(ij);
+            UpdateMeshVertexCoordinates(ij, iv, nr);
+            if (!m_trimesh_shape->IsWireframe())
+                UpdateMeshVertexNormal(ij, iv);
+            m_external_modified_vertices.push_back(iv);
+        };
+        for (const auto& ij : old_nodes) {
+            if (m_grid_map.find(ij) == m_grid_map.end()) {
+                double level = GetInitHeight(ij);
+                update_vertex(ij, NodeRecord(level, level, GetInitNormal(ij)));
+            }
+        }
+        for (const auto& nr : m_grid_map)
+            update_vertex(nr.first, nr.second);
+    }
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
@@ -245,13 +245,14 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     );
 
     /// Initialize the terrain system (mesh).
-    /// The initial undeformed terrain profile is provided via the specified Wavefront OBJ mesh file.
+    /// The initial undeformed terrain profile is provided via the specified Wavefront OBJ mesh file (or a mesh file in
+    /// the Chrono binary mesh format).
     /// The dimensions of the terrain patch in the horizontal plane of the SCM frame is set to the range of the x and y
     /// mesh vertex coordinates, respectively.  The SCM grid resolution is specified through 'delta' and initial heights
     /// at grid points are obtained through linear interpolation (outside the mesh footprint, the height of a grid node
     /// is set to the height of the closest point on the mesh).  A visualization mesh is created from the original mesh
     /// resampled at the grid node points.
-    void Initialize(const std::string& mesh_file,  ///< [in] filename for the mesh (Wavefront OBJ)
+    void Initialize(const std::string& mesh_file,  ///< [in] filename for the mesh (Wavefront OBJ or binary)
                     double delta                   ///< [in] grid spacing (may be slightly decreased)
     );
 
@@ -361,8 +362,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     );
 
     /// Initialize the terrain system (mesh).
-    /// The initial undeformed terrain profile is provided via the specified Wavefront OBJ mesh file.
-    void Initialize(const std::string& mesh_file,  ///< [in] filename for the mesh (Wavefront OBJ)
+    /// The initial undeformed terrain profile is provided via the specified Wavefront OBJ mesh file (or a mesh file in
+    /// the Chrono binary mesh format).
+    void Initialize(const std::string& mesh_file,  ///< [in] filename for the mesh (Wavefront OBJ or binary)
                     double delta                   ///< [in] grid spacing (may be slightly decreased)
     );
 
@@ -372,6 +374,12 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
                     double delta                                       ///< [in] grid spacing
     );
 
+    /// Write the records of all modified grid nodes (the deformation history of the terrain).
+    virtual void WriteExtraState(std::ostream& stream) const override;
+
+    /// Read the records of modified grid nodes, replacing the current terrain deformation.
+    virtual void ReadExtraState(std::istream& stream) override;
+
   private:
     // SCM patch type
     enum class PatchType {
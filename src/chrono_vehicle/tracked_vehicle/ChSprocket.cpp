@@ -20,8 +20,11 @@
 //
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/assets/ChLineShape.h"
 #include "chrono/assets/ChColor.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono_vehicle/tracked_vehicle/ChSprocket.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackAssembly.h"
@@ -30,7 +33,7 @@ namespace chrono {
 namespace vehicle {
 
 // -----------------------------------------------------------------------------
-ChSprocket::ChSprocket(const std::string& name) : ChPart(name), m_lateral_contact(true) {}
+ChSprocket::ChSprocket(const std::string& name) : ChPart(name), m_lateral_contact(true), m_num_candidates(0) {}
 
 ChSprocket::~ChSprocket() {
     auto sys = m_gear->GetSystem();
@@ -342,5 +345,78 @@ void ChSprocket::Output(ChVehicleOutput& database) const {
     database.WriteJoints(joints);
 }
 
+// -----------------------------------------------------------------------------
+// Sprocket collision callback base class
+// -----------------------------------------------------------------------------
+
+// Minimum number of candidate track shoes assigned to a thread.
+static const int min_candidates_per_thread = 4;
+
+ChSprocketContactCallback::ChSprocketContactCallback(ChTrackAssembly* track, ChSprocket* sprocket)
+    : m_track(track), m_owner(sprocket), m_buffered(false) {}
+
+void ChSprocketContactCallback::ProcessTrackShoes(ChSystem* system) {
+    m_owner->m_collision_timer.reset();
+    m_owner->m_collision_timer.start();
+
+    m_locS_abs = m_owner->GetGearBody()->GetPos();
+    m_dirS_abs = m_owner->GetGearBody()->GetA().Get_A_Yaxis();
+
+    // Only a few track shoes wrap around the gear at any time. Collect those within the window of the derived class.
+    m_candidates.clear();
+    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
+        if (IsCandidate(is))
+            m_candidates.push_back(is);
+    }
+    int num_candidates = (int)m_candidates.size();
+    m_owner->m_num_candidates = num_candidates;
+
+    int nthreads = std::min(system->GetNumthreadsCollision(), num_candidates / min_candidates_per_thread);
+
+    if (nthreads <= 1) {
+        for (auto is : m_candidates)
+            CheckShoe(is);
+    } else {
+        // Buffer contacts per thread. With a static schedule, each thread processes a contiguous range of candidates,
+        // in thread order, so concatenating the buffers preserves the track shoe order of the sequential loop.
+        if ((int)m_contacts.size() < nthreads)
+            m_contacts.resize(nthreads);
+        m_buffered = true;
+#pragma omp parallel num_threads(nthreads)
+        {
+            m_contacts[ChOMP::GetThreadNum()].clear();
+#pragma omp for schedule(static)
+            for (int i = 0; i < num_candidates; ++i)
+                CheckShoe(m_candidates[i]);
+        }
+        m_buffered = false;
+
+        auto container = system->GetContactContainer();
+        for (int it = 0; it < nthreads; ++it) {
+            for (const auto& contact : m_contacts[it])
+                container->AddContact(contact.cinfo, contact.mat1, contact.mat2);
+        }
+    }
+
+    m_owner->m_collision_timer.stop();
+}
+
+bool ChSprocketContactCallback::InWindow(const ChVector<>& point, double radius) const {
+    // Squared distance from the gear axis (i.e., in the x-z plane of the sprocket)
+    ChVector<> delta = point - m_locS_abs;
+    double axial = Vdot(delta, m_dirS_abs);
+    return delta.Length2() - axial * axial <= radius * radius;
+}
+
+void ChSprocketContactCallback::AddContact(const collision::ChCollisionInfo& cinfo,
+                                           std::shared_ptr<ChMaterialSurface> mat1,
+                                           std::shared_ptr<ChMaterialSurface> mat2) {
+    if (m_buffered) {
+        m_contacts[ChOMP::GetThreadNum()].push_back({cinfo, mat1, mat2});
+        return;
+    }
+    m_owner->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(cinfo, mat1, mat2);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
@@ -30,6 +30,8 @@
 #ifndef CH_SPROCKET_H
 #define CH_SPROCKET_H
 
+#include "chrono/core/ChTimer.h"
+#include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/physics/ChShaft.h"
 #include "chrono/physics/ChShaftsBody.h"
 #include "chrono/geometry/ChLinePath.h"
@@ -89,6 +91,13 @@ class CH_VEHICLE_API ChSprocket : public ChPart {
     /// Disable lateral contact for preventing detracking (default: enabled).
     void DisableLateralContact() { m_lateral_contact = false; }
 
+    /// Get the wall-clock time (in seconds) spent in the sprocket - track shoe collision detection at the last call.
+    double GetCollisionTime() const { return m_collision_timer.GetTimeSeconds(); }
+
+    /// Get the number of track shoes tested for contact with the gear at the last collision detection.
+    /// Shoes outside a window around the gear are culled before any narrow-phase test.
+    int GetNumCollisionCandidates() const { return m_num_candidates; }
+
     /// Initialize this sprocket subsystem.
     /// The sprocket subsystem is initialized by attaching it to the specified chassis body at the specified location
     /// (with respect to and expressed in the reference frame of the chassis).
@@ -173,7 +182,62 @@ class CH_VEHICLE_API ChSprocket : public ChPart {
 
     bool m_lateral_contact;  ///< if 'true', enable lateral conatact to prevent detracking
 
+    ChTimer m_collision_timer;  ///< timer for sprocket - track shoe collision detection
+    int m_num_candidates;       ///< number of track shoes tested at the last collision detection
+
     friend class ChTrackAssembly;
+    friend class ChSprocketContactCallback;
+};
+
+/// Base class for the custom collision callbacks of sprocket templates.
+/// Only track shoes within a window around the gear are passed to the narrow-phase tests of the derived class. If the
+/// system uses more than one collision thread, these candidates are processed in parallel; contacts are buffered per
+/// thread and added to the system in track shoe order.
+class CH_VEHICLE_API ChSprocketContactCallback : public ChSystem::CustomCollisionCallback {
+  public:
+    virtual ~ChSprocketContactCallback() {}
+
+  protected:
+    ChSprocketContactCallback(ChTrackAssembly* track,  ///< [in] containing track assembly
+                              ChSprocket* sprocket     ///< [in] associated sprocket
+    );
+
+    /// Cull the track shoes and call CheckShoe for all remaining candidates.
+    /// Must be called from OnCustomCollision. This function also updates the sprocket collision statistics.
+    void ProcessTrackShoes(ChSystem* system);
+
+    /// Return true if the specified track shoe may be in contact with the gear.
+    /// Called sequentially for all track shoes; should be a cheap, conservative test (see InWindow).
+    virtual bool IsCandidate(size_t is) const = 0;
+
+    /// Perform the narrow-phase collision tests for the specified track shoe.
+    /// May be called concurrently for different track shoes. Contacts must be reported through AddContact.
+    virtual void CheckShoe(size_t is) = 0;
+
+    /// Return true if the given point (global frame) is within the specified distance from the gear axis.
+    bool InWindow(const ChVector<>& point, double radius) const;
+
+    /// Record a sprocket contact. Safe to call from CheckShoe.
+    void AddContact(const collision::ChCollisionInfo& cinfo,
+                    std::shared_ptr<ChMaterialSurface> mat1,
+                    std::shared_ptr<ChMaterialSurface> mat2);
+
+    ChTrackAssembly* m_track;  ///< containing track assembly
+
+    ChVector<> m_locS_abs;  ///< sprocket gear center (global frame), set before culling
+    ChVector<> m_dirS_abs;  ///< sprocket gear axis (global frame), set before culling
+
+  private:
+    struct ContactData {
+        collision::ChCollisionInfo cinfo;
+        std::shared_ptr<ChMaterialSurface> mat1;
+        std::shared_ptr<ChMaterialSurface> mat2;
+    };
+
+    ChSprocket* m_owner;                               ///< sprocket owning this callback
+    std::vector<size_t> m_candidates;                  ///< track shoes that passed the culling
+    std::vector<std::vector<ContactData>> m_contacts;  ///< per-thread buffered contacts
+    bool m_buffered;                                   ///< if true, buffer contacts (parallel processing)
 };
 
 /// Vector of handles to sprocket subsystems.
@@ -152,6 +152,18 @@ class CH_VEHICLE_API ChTrackedVehicle : public ChVehicle {
         return m_contact_manager->GetSprocketResistiveTorque(side);
     }
 
+    /// Return the wall-clock time (in seconds) spent in sprocket - track shoe collision detection for the specified
+    /// track assembly, at the last collision detection.
+    double GetSprocketCollisionTime(VehicleSide side) const {
+        return m_tracks[side]->GetSprocket()->GetCollisionTime();
+    }
+
+    /// Return the number of track shoes of the specified track assembly that were tested for contact with the
+    /// sprocket at the last collision detection (i.e., those not culled as too far from the gear).
+    int GetSprocketCollisionCandidates(VehicleSide side) const {
+        return m_tracks[side]->GetSprocket()->GetNumCollisionCandidates();
+    }
+
     /// Write contact information to file.
     /// If data collection was enabled and at least one subsystem is monitored,
     /// contact information is written (in CSV format) to the specified file.
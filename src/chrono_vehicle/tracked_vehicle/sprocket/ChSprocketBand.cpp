@@ -17,6 +17,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/assets/ChCylinderShape.h"
@@ -61,7 +62,7 @@ static ChVector2<> CalcCircleCenter(const ChVector2<>& A, const ChVector2<>& B,
     return O;
 }
 
-class SprocketBandContactCB : public ChSystem::CustomCollisionCallback {
+class SprocketBandContactCB : public ChSprocketContactCallback {
   public:
     //// TODO Add in a collision envelope to the contact algorithm for NSC
     SprocketBandContactCB(ChTrackAssembly* track,     ///< containing track assembly
@@ -72,7 +73,8 @@ class SprocketBandContactCB : public ChSystem::CustomCollisionCallback {
                           double lateral_backlash,    ///< play relative to shoe guiding pin
                           const ChVector<>& shoe_pin  ///< location of shoe guide pin center
                           )
-        : m_track(track),
+        : ChSprocketContactCallback(track, track->GetSprocket().get()),
+          m_envelope(envelope),
           m_lateral_contact(lateral_contact),
           m_lateral_backlash(lateral_backlash),
           m_shoe_pin(shoe_pin) {
@@ -167,6 +169,12 @@ class SprocketBandContactCB : public ChSystem::CustomCollisionCallback {
     virtual void OnCustomCollision(ChSystem* system) override;
 
   private:
+    // Cull track shoes whose tread body is too far from the gear axis.
+    virtual bool IsCandidate(size_t is) const override;
+
+    // Test collision of the specified track shoe with the sprocket.
+    virtual void CheckShoe(size_t is) override;
+
     // Test collision between a tread segment body and the sprocket's gear profile
     void CheckTreadSegmentSprocket(std::shared_ptr<ChTrackShoeBand> shoe,  // track shoe
                                    const ChVector<>& locS_abs              // center of sprocket (global frame)
@@ -200,10 +208,12 @@ class SprocketBandContactCB : public ChSystem::CustomCollisionCallback {
                           const ChVector<>& dirS_abs              // sprocket Y direction (global frame)
     );
 
-    ChTrackAssembly* m_track;    // pointer to containing track assembly
     ChSprocketBand* m_sprocket;  // pointer to the sprocket
 
+    double m_envelope;  // collision detection envelope (used as margin for culling)
+
     double m_gear_tread_broadphase_dist_squared;  // Tread body to Sprocket quick Broadphase distance squared check
+    double m_R_window;                            // radius of culling window around the gear axis
 
     ChVector2<> m_gear_center_p;                 // center of (+x) arc, in sprocket body x-z plane
     ChVector2<> m_gear_center_m;                 // center of (-x) arc, in sprocket body x-z plane
@@ -265,31 +275,38 @@ void SprocketBandContactCB::OnCustomCollision(ChSystem* system) {
         m_tread_tip_height =
             shoe->GetToothHeight() +
             shoe->GetTreadThickness() / 2;  // height of the belt tooth profile from the tip to its base line
+
+        // Window around the gear axis for the tread body: a shoe outside this window cannot pass the tread broadphase
+        // test (or touch the gear with its guiding pin, if lateral contact is enabled).
+        m_R_window = std::sqrt(m_gear_tread_broadphase_dist_squared);
+        if (m_lateral_contact)
+            m_R_window = std::max(m_R_window, m_sprocket->GetOuterRadius() + m_shoe_pin.Length());
+        m_R_window += m_envelope;
     }
 
     // Return now if collision disabled on sproket.
     if (!m_sprocket->GetGearBody()->GetCollide())
         return;
 
-    // Sprocket gear center location, expressed in global frame
-    ChVector<> locS_abs = m_sprocket->GetGearBody()->GetPos();
+    // Test the track shoes near the sprocket
+    ProcessTrackShoes(system);
+}
 
-    // Sprocket "normal" (Y axis), expressed in global frame
-    ChVector<> dirS_abs = m_sprocket->GetGearBody()->GetA().Get_A_Yaxis();
+bool SprocketBandContactCB::IsCandidate(size_t is) const {
+    return InWindow(m_track->GetTrackShoe(is)->GetShoeBody()->GetPos(), m_R_window);
+}
 
-    // Loop over all track shoes in the associated track
-    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
-        auto shoe = std::static_pointer_cast<ChTrackShoeBand>(m_track->GetTrackShoe(is));
+void SprocketBandContactCB::CheckShoe(size_t is) {
+    auto shoe = std::static_pointer_cast<ChTrackShoeBand>(m_track->GetTrackShoe(is));
 
-        CheckTreadSegmentSprocket(shoe, locS_abs);
+    CheckTreadSegmentSprocket(shoe, m_locS_abs);
 
-        if (m_lateral_contact) {
-            // Express guiding pin center in the global frame
-            ChVector<> locPin_abs = shoe->GetShoeBody()->TransformPointLocalToParent(m_shoe_pin);
+    if (m_lateral_contact) {
+        // Express guiding pin center in the global frame
+        ChVector<> locPin_abs = shoe->GetShoeBody()->TransformPointLocalToParent(m_shoe_pin);
 
-            // Perform collision detection with the central pin
-            CheckPinSprocket(shoe, locPin_abs, dirS_abs);
-        }
+        // Perform collision detection with the central pin
+        CheckPinSprocket(shoe, locPin_abs, m_dirS_abs);
     }
 }
 
@@ -590,8 +607,7 @@ void SprocketBandContactCB::CheckTreadArcSprocketArc(std::shared_ptr<ChTrackShoe
     contact.distance = collision_distance;
     ////contact.eff_radius = sprocket_arc_radius;  //// TODO: take into account tooth_arc_radius?
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_sprocket->GetContactMaterial(),
-                                                                              shoe->m_tooth_material);
+    AddContact(contact, m_sprocket->GetContactMaterial(), shoe->m_tooth_material);
 }
 
 // Working in the (x-z) plane, perform a 2D collision test between the circle of radius 'cr'
@@ -634,8 +650,7 @@ void SprocketBandContactCB::CheckSegmentCircle(std::shared_ptr<ChTrackShoeBand>
     contact.distance = dist - cr;
     ////contact.eff_radius = cr;
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_sprocket->GetContactMaterial(),
-                                                                              shoe->m_tooth_material);
+    AddContact(contact, m_sprocket->GetContactMaterial(), shoe->m_tooth_material);
 }
 
 void SprocketBandContactCB::CheckPinSprocket(std::shared_ptr<ChTrackShoeBand> shoe,
@@ -676,7 +691,7 @@ void SprocketBandContactCB::CheckPinSprocket(std::shared_ptr<ChTrackShoeBand> sh
     ////std::cout << "  normal: " << contact.vN;
     ////std::cout << std::endl;
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_material, m_material);
+    AddContact(contact, m_material, m_material);
 }
 
 // -----------------------------------------------------------------------------
@@ -28,7 +28,7 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
-class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
+class SprocketDoublePinContactCB : public ChSprocketContactCallback {
   public:
     SprocketDoublePinContactCB(ChTrackAssembly* track,     ///< containing track assembly
                                double envelope,            ///< collision detection envelope
@@ -44,7 +44,7 @@ class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
                                double lateral_backlash,    ///< play relative to shoe guiding pin
                                const ChVector<>& shoe_pin  ///< location of shoe guide pin center
                                )
-        : m_track(track),
+        : ChSprocketContactCallback(track, track->GetSprocket().get()),
           m_gear_nteeth(gear_nteeth),
           m_gear_RT(gear_RT),
           m_gear_R(gear_R),
@@ -66,6 +66,11 @@ class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
         m_sbeta = std::sin(m_beta / 2);
         m_cbeta = std::cos(m_beta / 2);
 
+        // Windows around the gear axis for the connector bodies and the shoe body: a connector outside its window
+        // cannot pass the broadphase test, a shoe body outside its window cannot touch the gear with its guiding pin.
+        m_R_connector = m_R_sum + envelope;
+        m_R_pin = m_gear_RT + m_shoe_pin.Length() + envelope;
+
         // Create contact material for sprocket - guiding pin contacts (to prevent detracking)
         // Note: zero friction
         ChContactMaterialData minfo;
@@ -78,6 +83,12 @@ class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
     virtual void OnCustomCollision(ChSystem* system) override;
 
   private:
+    // Cull track shoes whose connectors (and guiding pin) are too far from the gear axis.
+    virtual bool IsCandidate(size_t is) const override;
+
+    // Test collision of the specified track shoe with the sprocket.
+    virtual void CheckShoe(size_t is) override;
+
     // Test collision between a connector body and the sprocket's gear profiles.
     void CheckConnectorSprocket(std::shared_ptr<ChBody> connector,                 // connector body
                                 const ChFrame<>& shape_frame,                      // frame of connector collision shape
@@ -123,7 +134,6 @@ class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
                           const ChVector<>& dirS_abs                   // sprocket Y direction (global frame)
     );
 
-    ChTrackAssembly* m_track;         // pointer to containing track assembly
     ChSprocketDoublePin* m_sprocket;  // pointer to the sprocket
 
     int m_gear_nteeth;    // sprocket gear, number of teeth
@@ -149,7 +159,9 @@ class SprocketDoublePinContactCB : public ChSystem::CustomCollisionCallback {
     ////double m_gear_Rhat;  // adjusted gear arc radius
     ////double m_shoe_Rhat;  // adjusted shoe cylinder radius
 
-    double m_R_sum;  // test quantity for broadphase check
+    double m_R_sum;        // test quantity for broadphase check
+    double m_R_connector;  // radius of culling window for connector bodies
+    double m_R_pin;        // radius of culling window for shoe bodies (lateral contact)
 
     std::shared_ptr<ChMaterialSurface> m_material;  // material for sprocket-pin contact (detracking)
 };
@@ -162,42 +174,56 @@ void SprocketDoublePinContactCB::OnCustomCollision(ChSystem* system) {
     if (!m_sprocket->GetGearBody()->GetCollide() || !m_track->GetTrackShoe(0)->GetShoeBody()->GetCollide())
         return;
 
-    // Sprocket gear center location, expressed in global frame
-    ChVector<> locS_abs = m_sprocket->GetGearBody()->GetPos();
-
-    // Sprocket "normal" (Y axis), expressed in global frame
-    ChVector<> dirS_abs = m_sprocket->GetGearBody()->GetA().Get_A_Yaxis();
-
-    // Loop over all track shoes in the associated track
-    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
-        auto shoe = std::static_pointer_cast<ChTrackShoeDoublePin>(m_track->GetTrackShoe(is));
-
-        switch (shoe->m_topology) {
-            case DoublePinTrackShoeType::TWO_CONNECTORS: {
-                // The collision shape frames are the same as the left and right connector body frames
-                CheckConnectorSprocket(shoe->m_connector_L, *shoe->m_connector_L, shoe->GetSprocketContactMaterial(),
-                                       locS_abs);
-                CheckConnectorSprocket(shoe->m_connector_R, *shoe->m_connector_R, shoe->GetSprocketContactMaterial(),
-                                       locS_abs);
-            } break;
-            case DoublePinTrackShoeType::ONE_CONNECTOR: {
-                // The collision shape frames are offset in the Y direction from the connector body frame.
-                ChFrame<> frame_left = *shoe->m_connector_L;
-                frame_left.coord.pos += frame_left.GetA() * ChVector<>(0, shoe->GetShoeWidth() / 2, 0);
-                CheckConnectorSprocket(shoe->m_connector_L, frame_left, shoe->GetSprocketContactMaterial(), locS_abs);
-                ChFrame<> frame_right = *shoe->m_connector_L;
-                frame_right.coord.pos -= frame_right.GetA() * ChVector<>(0, shoe->GetShoeWidth() / 2, 0);
-                CheckConnectorSprocket(shoe->m_connector_L, frame_right, shoe->GetSprocketContactMaterial(), locS_abs);
-            } break;
-        }
-
-        if (m_lateral_contact) {
-            // Express guiding pin center in the global frame
-            ChVector<> locPin_abs = shoe->GetShoeBody()->TransformPointLocalToParent(m_shoe_pin);
-
-            // Perform collision detection with the central pin
-            CheckPinSprocket(shoe, locPin_abs, dirS_abs);
-        }
+    // Test the track shoes near the sprocket
+    ProcessTrackShoes(system);
+}
+
+bool SprocketDoublePinContactCB::IsCandidate(size_t is) const {
+    auto shoe = std::static_pointer_cast<ChTrackShoeDoublePin>(m_track->GetTrackShoe(is));
+
+    if (m_lateral_contact && InWindow(shoe->GetShoeBody()->GetPos(), m_R_pin))
+        return true;
+
+    switch (shoe->m_topology) {
+        case DoublePinTrackShoeType::TWO_CONNECTORS:
+            return InWindow(shoe->m_connector_L->GetPos(), m_R_connector) ||
+                   InWindow(shoe->m_connector_R->GetPos(), m_R_connector);
+        case DoublePinTrackShoeType::ONE_CONNECTOR:
+            // The collision shapes are offset by half the shoe width from the connector body frame.
+            return InWindow(shoe->m_connector_L->GetPos(), m_R_connector + shoe->GetShoeWidth() / 2);
+    }
+
+    return true;
+}
+
+void SprocketDoublePinContactCB::CheckShoe(size_t is) {
+    auto shoe = std::static_pointer_cast<ChTrackShoeDoublePin>(m_track->GetTrackShoe(is));
+
+    switch (shoe->m_topology) {
+        case DoublePinTrackShoeType::TWO_CONNECTORS: {
+            // The collision shape frames are the same as the left and right connector body frames
+            CheckConnectorSprocket(shoe->m_connector_L, *shoe->m_connector_L, shoe->GetSprocketContactMaterial(),
+                                   m_locS_abs);
+            CheckConnectorSprocket(shoe->m_connector_R, *shoe->m_connector_R, shoe->GetSprocketContactMaterial(),
+                                   m_locS_abs);
+        } break;
+        case DoublePinTrackShoeType::ONE_CONNECTOR: {
+            // The collision shape frames are offset in the Y direction from the connector body frame.
+            ChFrame<> frame_left = *shoe->m_connector_L;
+            frame_left.coord.pos += frame_left.GetA() * ChVector<>(0, shoe->GetShoeWidth() / 2, 0);
+            CheckConnectorSprocket(shoe->m_connector_L, frame_left, shoe->GetSprocketContactMaterial(), m_locS_abs);
+            ChFrame<> frame_right = *shoe->m_connector_L;
+            frame_right.coord.pos -= frame_right.GetA() * ChVector<>(0, shoe->GetShoeWidth() / 2, 0);
+            CheckConnectorSprocket(shoe->m_connector_L, frame_right, shoe->GetSprocketContactMaterial(), m_locS_abs);
+        } break;
+    }
+
+    if (m_lateral_contact) {
+        // Express guiding pin center in the global frame
+        ChVector<> locPin_abs = shoe->GetShoeBody()->TransformPointLocalToParent(m_shoe_pin);
+
+        // Perform collision detection with the central pin
+        CheckPinSprocket(shoe, locPin_abs, m_dirS_abs);
     }
 }
 
@@ -347,8 +373,7 @@ void SprocketDoublePinContactCB::CheckCircleArc(std::shared_ptr<ChBody> connecto
     contact.distance = Rdiff - dist;
     ////contact.eff_radius = cr;  //// TODO: take into account ar?
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_sprocket->GetContactMaterial(),
-                                                                              mat_connector);
+    AddContact(contact, m_sprocket->GetContactMaterial(), mat_connector);
 }
 
 // Working in the (x-z) plane, perform a 2D collision test between the circle of radius 'cr'
@@ -393,8 +418,7 @@ void SprocketDoublePinContactCB::CheckCircleSegment(
     contact.distance = dist - cr;
     ////contact.eff_radius = cr;
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_sprocket->GetContactMaterial(),
-                                                                              mat_connector);
+    AddContact(contact, m_sprocket->GetContactMaterial(), mat_connector);
 }
 
 void SprocketDoublePinContactCB::CheckPinSprocket(std::shared_ptr<ChTrackShoeDoublePin> shoe,
@@ -434,7 +458,7 @@ void SprocketDoublePinContactCB::CheckPinSprocket(std::shared_ptr<ChTrackShoeDou
     ////std::cout << "  normal: " << contact.vN;
     ////std::cout << std::endl;
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_material, m_material);
+    AddContact(contact, m_material, m_material);
 }
 
 // -----------------------------------------------------------------------------
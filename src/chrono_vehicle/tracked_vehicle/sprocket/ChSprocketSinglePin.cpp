@@ -17,6 +17,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono_vehicle/tracked_vehicle/sprocket/ChSprocketSinglePin.h"
@@ -28,7 +29,7 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
-class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
+class SprocketSinglePinContactCB : public ChSprocketContactCallback {
   public:
     SprocketSinglePinContactCB(ChTrackAssembly* track,     ///< containing track assembly
                                double envelope,            ///< collision detection envelope
@@ -44,7 +45,7 @@ class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
                                double lateral_backlash,    ///< play relative to shoe guiding pin
                                const ChVector<>& shoe_pin  ///< location of shoe guide pin center
                                )
-        : m_track(track),
+        : ChSprocketContactCallback(track, track->GetSprocket().get()),
           m_envelope(envelope),
           m_gear_nteeth(gear_nteeth),
           m_gear_RO(gear_RO),
@@ -66,6 +67,13 @@ class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
         m_R_diff = m_gear_R - m_shoe_R;
         m_Rhat_diff = m_gear_Rhat - m_shoe_Rhat;
 
+        // Window around the gear axis for the shoe body reference point: a shoe outside this window cannot pass the
+        // broadphase tests on its contact cylinders (or on its guiding pin, if lateral contact is enabled).
+        m_R_window = m_R_sum + std::max(std::abs(m_shoe_locF), std::abs(m_shoe_locR));
+        if (m_lateral_contact)
+            m_R_window = std::max(m_R_window, m_gear_RO + m_shoe_pin.Length());
+        m_R_window += m_envelope;
+
         // Create contact material for sprocket - guiding pin contacts (to prevent detracking)
         // Note: zero friction
         ChContactMaterialData minfo;
@@ -78,6 +86,12 @@ class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
     virtual void OnCustomCollision(ChSystem* system) override;
 
   private:
+    // Cull track shoes whose reference point is too far from the gear axis.
+    virtual bool IsCandidate(size_t is) const override;
+
+    // Test collision of the specified track shoe with the sprocket.
+    virtual void CheckShoe(size_t is) override;
+
     // Test collision of a shoe contact cylinder with the sprocket's gear profiles.
     // This may introduce up to two contacts (one with each gear plane).
     void CheckCylinderSprocket(std::shared_ptr<ChTrackShoeSinglePin> shoe,  // track shoe
@@ -103,7 +117,6 @@ class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
     // The calculation is performed in the (x-z) plane.
     ChVector<> FindClosestArc(const ChVector<>& loc);
 
-    ChTrackAssembly* m_track;         // pointer to containing track assembly
     ChSprocketSinglePin* m_sprocket;  // handle to the sprocket
 
     double m_envelope;  // collision detection envelope
@@ -127,6 +140,7 @@ class SprocketSinglePinContactCB : public ChSystem::CustomCollisionCallback {
     double m_R_sum;      // test quantity for broadphase check
     double m_R_diff;     // test quantity for narrowphase check
     double m_Rhat_diff;  // test quantity for narrowphase check
+    double m_R_window;   // radius of culling window around the gear axis
 
     std::shared_ptr<ChMaterialSurface> m_material;  // material for sprocket-pin contact (detracking)
 };
@@ -138,37 +152,37 @@ void SprocketSinglePinContactCB::OnCustomCollision(ChSystem* system) {
     if (!m_sprocket->GetGearBody()->GetCollide() || !m_track->GetTrackShoe(0)->GetShoeBody()->GetCollide())
         return;
 
-    // Sprocket gear center location, expressed in global frame
-    ChVector<> locS_abs = m_sprocket->GetGearBody()->GetPos();
+    // Test the track shoes near the sprocket
+    ProcessTrackShoes(system);
+}
 
-    // Sprocket "normal" (Y axis), expressed in global frame
-    ChVector<> dirS_abs = m_sprocket->GetGearBody()->GetA().Get_A_Yaxis();
+bool SprocketSinglePinContactCB::IsCandidate(size_t is) const {
+    return InWindow(m_track->GetTrackShoe(is)->GetShoeBody()->GetPos(), m_R_window);
+}
 
-    // Loop over all shoes in the associated track
-    for (size_t is = 0; is < m_track->GetNumTrackShoes(); ++is) {
-        auto shoe = std::static_pointer_cast<ChTrackShoeSinglePin>(m_track->GetTrackShoe(is));
+void SprocketSinglePinContactCB::CheckShoe(size_t is) {
+    auto shoe = std::static_pointer_cast<ChTrackShoeSinglePin>(m_track->GetTrackShoe(is));
 
-        // Calculate locations of the centers of the shoe's contact cylinders
-        // (expressed in the global frame)
-        ChVector<> locF_abs = shoe->GetShoeBody()->TransformPointLocalToParent(ChVector<>(m_shoe_locF, 0, 0));
-        ChVector<> locR_abs = shoe->GetShoeBody()->TransformPointLocalToParent(ChVector<>(m_shoe_locR, 0, 0));
+    // Calculate locations of the centers of the shoe's contact cylinders
+    // (expressed in the global frame)
+    ChVector<> locF_abs = shoe->GetShoeBody()->TransformPointLocalToParent(ChVector<>(m_shoe_locF, 0, 0));
+    ChVector<> locR_abs = shoe->GetShoeBody()->TransformPointLocalToParent(ChVector<>(m_shoe_locR, 0, 0));
 
-        // Express contact cylinder direction (common for both cylinders) in the global frame
-        ChVector<> dir_abs = shoe->GetShoeBody()->GetA().Get_A_Yaxis();
+    // Express contact cylinder direction (common for both cylinders) in the global frame
+    ChVector<> dir_abs = shoe->GetShoeBody()->GetA().Get_A_Yaxis();
 
-        // Perform collision test for the front contact cylinder
-        CheckCylinderSprocket(shoe, locF_abs, dir_abs, locS_abs);
+    // Perform collision test for the front contact cylinder
+    CheckCylinderSprocket(shoe, locF_abs, dir_abs, m_locS_abs);
 
-        // Perform collision test for the rear contact cylinder.
-        CheckCylinderSprocket(shoe, locR_abs, dir_abs, locS_abs);
+    // Perform collision test for the rear contact cylinder.
+    CheckCylinderSprocket(shoe, locR_abs, dir_abs, m_locS_abs);
 
-        if (m_lateral_contact) {
-            // Express guiding pin center in the global frame
-            ChVector<> locPin_abs = shoe->GetShoeBody()->TransformPointLocalToParent(m_shoe_pin);
+    if (m_lateral_contact) {
+        // Express guiding pin center in the global frame
+        ChVector<> locPin_abs = shoe->GetShoeBody()->TransformPointLocalToParent(m_shoe_pin);
 
-            // Perform collision detection with the central pin
-            CheckPinSprocket(shoe, locPin_abs, dirS_abs);
-        }
+        // Perform collision detection with the central pin
+        CheckPinSprocket(shoe, locPin_abs, m_dirS_abs);
     }
 }
 
@@ -253,8 +267,7 @@ void SprocketSinglePinContactCB::CheckCircleProfile(std::shared_ptr<ChTrackShoeS
     contact.distance = m_R_diff - dist;
     ////contact.eff_radius = m_shoe_R;  //// TODO: take into account m_gear_R?
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_sprocket->GetContactMaterial(),
-                                                                              shoe->GetSprocketContactMaterial());
+    AddContact(contact, m_sprocket->GetContactMaterial(), shoe->GetSprocketContactMaterial());
 }
 
 // Find the center of the profile arc that is closest to the specified location.
@@ -308,7 +321,7 @@ void SprocketSinglePinContactCB::CheckPinSprocket(std::shared_ptr<ChTrackShoeSin
     ////std::cout << "  normal: " << contact.vN;
     ////std::cout << std::endl;
 
-    m_sprocket->GetGearBody()->GetSystem()->GetContactContainer()->AddContact(contact, m_material, m_material);
+    AddContact(contact, m_material, m_material);
 }
 
 // -----------------------------------------------------------------------------
@@ -16,11 +16,11 @@
 //
 // =============================================================================
 
-#include <fstream>
 #include <vector>
 #include <utility>
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_vehicle/chassis/RigidChassis.h"
 #include "chrono_vehicle/chassis/ChassisConnectorHitch.h"
@@ -91,7 +91,6 @@
 #include "chrono_vehicle/tracked_vehicle/track_assembly/TrackAssemblySinglePin.h"
 
 #include "chrono_thirdparty/rapidjson/filereadstream.h"
-#include "chrono_thirdparty/rapidjson/istreamwrapper.h"
 
 using namespace rapidjson;
 
@@ -101,15 +100,14 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 
 void ReadFileJSON(const std::string& filename, Document& d) {
-    std::ifstream ifs(filename);
-    if (!ifs.good()) {
+    auto doc = ChVehicleDataCache::GetJSON(filename);
+    if (!doc) {
         GetLog() << "ERROR: Could not open JSON file: " << filename << "\n";
+    } else if (doc->IsNull()) {
+        GetLog() << "ERROR: Invalid JSON file: " << filename << "\n";
+        d.SetNull();
     } else {
-        IStreamWrapper isw(ifs);
-        d.ParseStream<ParseFlag::kParseCommentsFlag>(isw);
-        if (d.IsNull()) {
-            GetLog() << "ERROR: Invalid JSON file: " << filename << "\n";
-        }
+        d.CopyFrom(*doc, d.GetAllocator());
     }
 }
 
@@ -53,6 +53,8 @@ namespace vehicle {
 
 /// Load and return a RapidJSON document from the specified file.
 /// A Null document is returned if the file cannot be opened.
+/// If the model data cache is enabled, the file is parsed only once and the returned document is a copy of the cached
+/// one (see ChVehicleDataCache).
 CH_VEHICLE_API void ReadFileJSON(const std::string& filename, rapidjson::Document& d);
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Batch runner for independent Chrono::Vehicle simulations (e.g., Monte-Carlo
+// campaigns), executed concurrently on a pool of worker threads.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_vehicle/utils/ChVehicleBatchRunner.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+
+// Logger collecting all output in a string (one per running scenario).
+class StringLog : public ChLog {
+  public:
+    StringLog() {}
+    virtual void Output(const char* data, size_t n) override {
+        if (current_level != CHQUIET)
+            m_text.append(data, n);
+    }
+    std::string m_text;
+};
+
+// -----------------------------------------------------------------------------
+
+ChVehicleBatchRunner::ChVehicleBatchRunner(int num_workers) : m_threads_per_system(1), m_capture_log(true) {
+    m_num_workers = (num_workers > 0) ? num_workers : std::max((int)std::thread::hardware_concurrency(), 1);
+}
+
+std::vector<ChVehicleBatchRunner::Result> ChVehicleBatchRunner::Run(
+    const std::vector<std::shared_ptr<Scenario>>& scenarios,
+    double end_time,
+    double step) {
+    int num_scenarios = (int)scenarios.size();
+    std::vector<Result> results(num_scenarios);
+
+    // Scenarios are assigned to workers dynamically (next available scenario)
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        int i;
+        while ((i = next++) < num_scenarios)
+            RunScenario(*scenarios[i], end_time, step, results[i]);
+    };
+
+    int num_threads = std::min(m_num_workers, num_scenarios);
+    if (num_threads <= 1) {
+        worker();
+        return results;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (int it = 0; it < num_threads; it++)
+        threads.emplace_back(worker);
+    for (auto& thread : threads)
+        thread.join();
+
+    return results;
+}
+
+void ChVehicleBatchRunner::RunScenario(Scenario& scenario, double end_time, double step, Result& result) const {
+    StringLog log;
+    if (m_capture_log)
+        SetThreadLog(&log);
+
+    result.success = true;
+    result.sim_time = 0;
+    result.num_steps = 0;
+
+    ChTimer timer;
+    timer.reset();
+    timer.start();
+
+    try {
+        scenario.Initialize();
+
+        auto sys = scenario.GetSystem();
+        if (!sys)
+            throw ChException("Scenario does not provide a Chrono system");
+        sys->SetNumThreads(m_threads_per_system, m_threads_per_system, m_threads_per_system);
+
+        double time = sys->GetChTime();
+        while (time < end_time - 1e-3 * step && !scenario.Done()) {
+            scenario.Synchronize(time);
+            scenario.Advance(step);
+            time = sys->GetChTime();
+            result.num_steps++;
+        }
+        result.sim_time = time;
+
+        scenario.Finalize();
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.message = e.what();
+    } catch (...) {
+        result.success = false;
+        result.message = "Unknown exception";
+    }
+
+    timer.stop();
+    result.wall_time = timer();
+
+    if (m_capture_log) {
+        SetThreadLog(nullptr);
+        result.log = std::move(log.m_text);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Batch runner for independent Chrono::Vehicle simulations (e.g., Monte-Carlo
+// campaigns), executed concurrently on a pool of worker threads.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_BATCH_RUNNER_H
+#define CH_VEHICLE_BATCH_RUNNER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Runner for a batch of independent simulation scenarios on a pool of worker threads.\n
+/// Each scenario owns its Chrono system (and vehicle, terrain, driver, etc.) and is constructed, advanced, and
+/// finalized on a single worker thread. Scenarios are assigned dynamically to the available workers, so that a
+/// single multi-core node can run as many scenarios concurrently as there are workers.\n
+/// State isolation between concurrently running scenarios:
+/// - the Chrono system of each scenario is restricted to SetNumThreadsPerSystem() threads (default: 1), to avoid
+///   oversubscription of the worker threads;
+/// - each worker uses its own ChLog object (see SetThreadLog), so that log output of different scenarios is not
+///   interleaved; the captured output is returned with the results of each scenario;
+/// - the unique identifiers generated with GetUniqueIntID() are thread safe.
+///
+/// Process-wide settings (Chrono::Vehicle world frame, data paths) must be set before calling Run() and must not be
+/// changed while scenarios are running. Model data that does not change during a simulation (visualization and
+/// collision meshes, JSON specification files, tire data) can be shared between scenarios, provided it is only
+/// accessed for reading.
+class CH_VEHICLE_API ChVehicleBatchRunner {
+  public:
+    /// Base class for an independent simulation scenario.
+    /// All functions of a scenario object are called from the same worker thread.
+    class CH_VEHICLE_API Scenario {
+      public:
+        virtual ~Scenario() {}
+
+        /// Construct the Chrono system and all simulation components (vehicle, terrain, driver, etc.).
+        virtual void Initialize() = 0;
+
+        /// Return the Chrono system of this scenario (called after Initialize).
+        virtual ChSystem* GetSystem() = 0;
+
+        /// Synchronize all simulation components at the specified time.
+        virtual void Synchronize(double time) = 0;
+
+        /// Advance the state of all simulation components by the specified step.
+        virtual void Advance(double step) = 0;
+
+        /// Return true to terminate the scenario before reaching the final time (default: false).
+        virtual bool Done() const { return false; }
+
+        /// Process the scenario results (called once the scenario ends).
+        /// This is also the place to release any resources (e.g., the Chrono system) no longer needed.
+        virtual void Finalize() {}
+    };
+
+    /// Outcome of a scenario run.
+    struct Result {
+        bool success;         ///< false if the scenario threw an exception
+        std::string message;  ///< exception message (if any)
+        std::string log;      ///< log output of the scenario (if captured)
+        double sim_time;      ///< final simulation time
+        int num_steps;        ///< number of simulation steps
+        double wall_time;     ///< wall-clock time for initializing and simulating the scenario (seconds)
+    };
+
+    /// Construct a batch runner with the specified number of worker threads.
+    /// If num_workers <= 0, use the number of hardware threads.
+    ChVehicleBatchRunner(int num_workers = 0);
+
+    ~ChVehicleBatchRunner() {}
+
+    /// Get the number of worker threads.
+    int GetNumWorkers() const { return m_num_workers; }
+
+    /// Set the number of threads used by each Chrono system (default: 1).
+    /// See ChSystem::SetNumThreads.
+    void SetNumThreadsPerSystem(int num_threads) { m_threads_per_system = num_threads; }
+
+    /// Enable/disable capturing the log output of each scenario (default: true).
+    /// If disabled, all scenarios use the global logging system and their output may be interleaved.
+    void SetCaptureLog(bool val) { m_capture_log = val; }
+
+    /// Run the given scenarios until the specified final time, using the specified step size.
+    /// This function blocks until all scenarios are completed. It returns the outcome of each scenario, in the order
+    /// in which the scenarios were provided. An exception thrown by a scenario terminates that scenario only.
+    std::vector<Result> Run(const std::vector<std::shared_ptr<Scenario>>& scenarios, double end_time, double step);
+
+  private:
+    /// Initialize, simulate, and finalize a single scenario (executed on a worker thread).
+    void RunScenario(Scenario& scenario, double end_time, double step, Result& result) const;
+
+    int m_num_workers;         ///< number of worker threads
+    int m_threads_per_system;  ///< number of threads for each Chrono system
+    bool m_capture_log;        ///< capture log output of each scenario
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,240 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Process-wide cache of model data loaded from files (JSON specification files,
+// triangle meshes, tire parameter files).
+//
+// =============================================================================
+
+#include <atomic>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <sys/stat.h>
+
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
+
+#include "chrono/utils/ChUtilsHash.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+
+// Digest of the contents of a file, valid as long as the file size and modification time do not change.
+struct FileDigest {
+    long long size;
+    time_t mtime;
+    time_t indexed;  // time when the file was read
+    std::string digest;
+};
+
+// Cache storage (shared by all threads)
+struct DataCacheStorage {
+    std::atomic<bool> enabled{false};
+    std::atomic<size_t> hits{0};
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const void>> entries;
+    std::unordered_map<std::string, FileDigest> files;  // file index (keyed by file name)
+};
+
+static DataCacheStorage& storage() {
+    static DataCacheStorage cache;
+    return cache;
+}
+
+// Read the entire contents of the specified file.
+static bool ReadContents(const std::string& filename, std::string& contents) {
+    std::ifstream ifs(filename, std::ios::binary);
+    if (!ifs.good())
+        return false;
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    contents = oss.str();
+    return true;
+}
+
+// Get the size and modification time of the specified file.
+static bool GetFileStatus(const std::string& filename, long long& size, time_t& mtime) {
+#ifdef _WIN32
+    struct _stat64 sb;
+    if (_stat64(filename.c_str(), &sb) != 0)
+        return false;
+#else
+    struct stat sb;
+    if (stat(filename.c_str(), &sb) != 0)
+        return false;
+#endif
+    size = (long long)sb.st_size;
+    mtime = sb.st_mtime;
+    return true;
+}
+
+// Get the SHA-256 digest of the contents of the specified file.
+// The digest is taken from the file index if the file size and modification time did not change since the file was
+// last read. Otherwise, the file is read and hashed, its contents are returned (if requested), and the index is
+// updated. As modification times have a resolution of one second, the index entry of a file modified in the same
+// second it was read is not trusted (the file could have changed again after it was read).
+static bool GetFileDigest(const std::string& filename, std::string& digest, std::string* contents, bool& read) {
+    read = false;
+
+    long long size;
+    time_t mtime;
+    if (!GetFileStatus(filename, size, mtime))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(storage().mutex);
+        auto it = storage().files.find(filename);
+        if (it != storage().files.end()) {
+            const auto& file = it->second;
+            if (file.size == size && file.mtime == mtime && file.mtime < file.indexed) {
+                digest = file.digest;
+                return true;
+            }
+        }
+    }
+
+    time_t indexed = std::time(nullptr);
+    std::string data;
+    if (!ReadContents(filename, data))
+        return false;
+    digest = utils::HashSHA256(data.data(), data.size());
+    read = true;
+
+    // Index the file only if it did not change while it was read
+    long long size_after;
+    time_t mtime_after;
+    if (GetFileStatus(filename, size_after, mtime_after) && size_after == (long long)data.size() &&
+        mtime_after == mtime) {
+        std::lock_guard<std::mutex> lock(storage().mutex);
+        storage().files[filename] = {size, mtime, indexed, digest};
+    }
+
+    if (contents)
+        *contents = std::move(data);
+    return true;
+}
+
+// Construct a key from the data type and the digest of the file contents.
+static std::string MakeKey(const std::string& type, const std::string& digest) {
+    return type + "_" + digest;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleDataCache::Enable(bool val) {
+    storage().enabled = val;
+    if (!val)
+        Clear();
+}
+
+bool ChVehicleDataCache::IsEnabled() {
+    return storage().enabled;
+}
+
+void ChVehicleDataCache::Clear() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    storage().entries.clear();
+    storage().files.clear();
+    storage().hits = 0;
+}
+
+size_t ChVehicleDataCache::GetNumEntries() {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    return storage().entries.size();
+}
+
+size_t ChVehicleDataCache::GetNumHits() {
+    return storage().hits;
+}
+
+bool ChVehicleDataCache::GetKey(const std::string& filename, const std::string& type, std::string& key) {
+    std::string digest;
+    bool read;
+    if (!GetFileDigest(filename, digest, nullptr, read))
+        return false;
+    key = MakeKey(type, digest);
+    return true;
+}
+
+std::shared_ptr<const void> ChVehicleDataCache::Find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    auto it = storage().entries.find(key);
+    if (it == storage().entries.end())
+        return nullptr;
+    storage().hits++;
+    return it->second;
+}
+
+std::shared_ptr<const void> ChVehicleDataCache::Insert(const std::string& key, std::shared_ptr<const void> data) {
+    std::lock_guard<std::mutex> lock(storage().mutex);
+    auto res = storage().entries.insert({key, data});
+    return res.first->second;
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<const rapidjson::Document> ChVehicleDataCache::GetJSON(const std::string& filename) {
+    std::string contents;
+    bool read = false;
+
+    bool enabled = IsEnabled();
+    std::string key;
+    if (enabled) {
+        std::string digest;
+        if (!GetFileDigest(filename, digest, &contents, read))
+            return nullptr;
+        key = MakeKey("JSON", digest);
+        if (auto data = Find(key))
+            return std::static_pointer_cast<const rapidjson::Document>(data);
+    }
+
+    if (!read && !ReadContents(filename, contents))
+        return nullptr;
+
+    auto d = chrono_types::make_shared<rapidjson::Document>();
+    d->Parse<rapidjson::ParseFlag::kParseCommentsFlag>(contents.c_str());
+    if (d->HasParseError())
+        d->SetNull();
+
+    // Do not cache invalid documents
+    if (!enabled || d->IsNull())
+        return d;
+
+    return std::static_pointer_cast<const rapidjson::Document>(Insert(key, d));
+}
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> ChVehicleDataCache::GetWavefrontMesh(const std::string& filename,
+                                                                                       bool load_normals,
+                                                                                       bool load_uv) {
+    if (!IsEnabled())
+        return geometry::ChTriangleMeshConnected::CreateFromFile(filename, load_normals, load_uv);
+
+    std::string type = std::string("OBJ") + (load_normals ? "_normals" : "") + (load_uv ? "_uv" : "");
+    auto mesh = Get<geometry::ChTriangleMeshConnected>(filename, type, [&](const std::string& name) {
+        return geometry::ChTriangleMeshConnected::CreateFromFile(name, load_normals, load_uv);
+    });
+    if (!mesh)
+        return nullptr;
+
+    // Return a copy of the cached mesh, so that callers (mesh visualization and collision shapes) can modify it
+    return chrono_types::make_shared<geometry::ChTriangleMeshConnected>(*mesh);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Process-wide cache of model data loaded from files (JSON specification files,
+// triangle meshes, tire parameter files).
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_DATA_CACHE_H
+#define CH_VEHICLE_DATA_CACHE_H
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Process-wide cache of immutable model data loaded from files.\n
+/// Cached entries are content-addressed: they are identified by the type of data and by the SHA-256 digest of the
+/// contents of the file they were loaded from (not by the file name). As such, the same data is shared by all objects
+/// that load identical files, while a file modified on disk results in a new cache entry. The digest of a file is
+/// reused (without reading the file again) as long as the file size and modification time do not change.\n
+/// Chrono::Vehicle uses this cache (if enabled) for parsed JSON specification files (see ReadFileJSON), Wavefront OBJ
+/// meshes used for visualization and collision, and tire parameter files. This makes repeated instantiation of
+/// vehicle models (e.g., for batch simulations with ChVehicleBatchRunner) much cheaper.\n
+/// Caching is disabled by default. Shared data is returned as read-only (const) objects; triangle meshes, which
+/// visualization and collision shapes require as modifiable objects, are returned as copies of the cached meshes.\n
+/// All functions of this class are thread safe.
+class CH_VEHICLE_API ChVehicleDataCache {
+  public:
+    ChVehicleDataCache(ChVehicleDataCache const&) = delete;
+    void operator=(ChVehicleDataCache const&) = delete;
+
+    /// Enable/disable the model data cache (default: false).
+    /// Disabling the cache also clears all cached entries.
+    static void Enable(bool val);
+
+    /// Return true if the model data cache is enabled.
+    static bool IsEnabled();
+
+    /// Remove all entries from the cache.
+    /// Data currently in use is not affected (it is released when no longer referenced).
+    static void Clear();
+
+    /// Return the number of cached entries.
+    static size_t GetNumEntries();
+
+    /// Return the number of cache hits since the cache was last cleared.
+    static size_t GetNumHits();
+
+    /// Return the parsed JSON document from the specified file.
+    /// If the cache is disabled, the file is parsed at each call. An empty pointer is returned if the file cannot be
+    /// opened; a Null document is returned if the file cannot be parsed.
+    static std::shared_ptr<const rapidjson::Document> GetJSON(const std::string& filename);
+
+    /// Return a triangle mesh loaded from the specified Wavefront OBJ file (or file in the Chrono binary mesh format).
+    /// If the cache is enabled, the returned mesh is a copy of the cached mesh (this saves loading the file again) and
+    /// can be modified by the caller.
+    /// An empty pointer is returned if the mesh cannot be loaded.
+    static std::shared_ptr<geometry::ChTriangleMeshConnected> GetWavefrontMesh(const std::string& filename,
+                                                                               bool load_normals = true,
+                                                                               bool load_uv = false);
+
+    /// Return data of arbitrary type, loaded from the specified file with the provided function.
+    /// The 'type' string identifies the type of data (and any loading options); data created from identical files
+    /// with the same 'type' is shared. If the cache is disabled, the loader function is invoked at each call.
+    template <typename T>
+    static std::shared_ptr<const T> Get(const std::string& filename,
+                                        const std::string& type,
+                                        std::function<std::shared_ptr<const T>(const std::string&)> loader) {
+        std::string key;
+        if (!IsEnabled() || !GetKey(filename, type, key))
+            return loader(filename);
+        auto data = std::static_pointer_cast<const T>(Find(key));
+        if (!data) {
+            data = loader(filename);
+            if (data)
+                data = std::static_pointer_cast<const T>(Insert(key, data));
+        }
+        return data;
+    }
+
+  private:
+    ChVehicleDataCache() {}
+
+    /// Calculate the cache key for the given file and data type.
+    /// Return false if the file cannot be read.
+    static bool GetKey(const std::string& filename, const std::string& type, std::string& key);
+
+    /// Return the cached entry with given key (empty pointer if not found).
+    static std::shared_ptr<const void> Find(const std::string& key);
+
+    /// Insert the given entry in the cache and return the cached entry.
+    /// If another entry with the same key was inserted in the meantime (by a different thread), that one is returned.
+    static std::shared_ptr<const void> Insert(const std::string& key, std::shared_ptr<const void> data);
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
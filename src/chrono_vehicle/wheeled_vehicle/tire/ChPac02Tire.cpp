@@ -43,6 +43,7 @@
 #include "chrono_vehicle/ChVehicleModelData.h"
 
 #include "chrono_vehicle/wheeled_vehicle/tire/ChPac02Tire.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 namespace chrono {
 namespace vehicle {
@@ -301,7 +302,63 @@ double ChPac02Tire::CalcMy(double Fx, double Fz, double gamma) {
 
 // -----------------------------------------------------------------------------
 
+// Parameters resulting from parsing a TIR file
+struct ChPac02Tire::TIRData {
+    MFCoeff par;
+    VehicleSide measured_side;
+    bool use_friction_ellipsis;
+    unsigned int use_mode;
+    bool tire_conditions_found;
+    bool vertical_table_found;
+    bool bottoming_table_found;
+    ChFunction_Recorder bott_map;
+};
+
 void ChPac02Tire::SetMFParamsByFile(const std::string& tirFileName) {
+    if (!ChVehicleDataCache::IsEnabled()) {
+        LoadTIRFile(tirFileName);
+        return;
+    }
+
+    // The TIR file is parsed only if its contents are not already available in the vehicle data cache
+    auto data = ChVehicleDataCache::Get<TIRData>(tirFileName, "Pac02_TIR", [this](const std::string& filename) {
+        // Start from default settings, so that the loaded data only depends on the file contents
+        m_par = MFCoeff();
+        m_measured_side = LEFT;
+        m_use_friction_ellipsis = true;
+        m_use_mode = 0;
+        m_tire_conditions_found = false;
+        m_vertical_table_found = false;
+        m_bottoming_table_found = false;
+        m_bott_map.Reset();
+
+        LoadTIRFile(filename);
+
+        auto tir = chrono_types::make_shared<TIRData>();
+        tir->par = m_par;
+        tir->measured_side = m_measured_side;
+        tir->use_friction_ellipsis = m_use_friction_ellipsis;
+        tir->use_mode = m_use_mode;
+        tir->tire_conditions_found = m_tire_conditions_found;
+        tir->vertical_table_found = m_vertical_table_found;
+        tir->bottoming_table_found = m_bottoming_table_found;
+        tir->bott_map = m_bott_map;
+        return tir;
+    });
+
+    m_par = data->par;
+    m_measured_side = data->measured_side;
+    m_use_friction_ellipsis = data->use_friction_ellipsis;
+    m_use_mode = data->use_mode;
+    m_tire_conditions_found = data->tire_conditions_found;
+    m_vertical_table_found = data->vertical_table_found;
+    m_bottoming_table_found = data->bottoming_table_found;
+    m_bott_map.Reset();
+    for (const auto& point : data->bott_map.GetPoints())
+        m_bott_map.AddPoint(point.x, point.y, point.w);
+}
+
+void ChPac02Tire::LoadTIRFile(const std::string& tirFileName) {
     FILE* fp = fopen(tirFileName.c_str(), "r+");
     if (fp == NULL) {
         GetLog() << "TIR File not found <" << tirFileName << ">!\n";
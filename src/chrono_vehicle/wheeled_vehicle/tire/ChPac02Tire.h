@@ -113,6 +113,7 @@ class CH_VEHICLE_API ChPac02Tire : public ChForceElementTire {
 
     // TIR file (ADAMS compatible) loader routines
     void SetMFParamsByFile(const std::string& tirFileName);
+    void LoadTIRFile(const std::string& tirFileName);
     void LoadSectionUnits(FILE* fp);
     void LoadSectionModel(FILE* fp);
     void LoadSectionDimension(FILE* fp);
@@ -155,6 +156,8 @@ class CH_VEHICLE_API ChPac02Tire : public ChForceElementTire {
 
     unsigned int m_use_mode;
 
+    struct TIRData;  // parameters loaded from a TIR file (shared through the vehicle data cache)
+
     struct MFCoeff {
         // [UNITS]
         double u_time = 1;
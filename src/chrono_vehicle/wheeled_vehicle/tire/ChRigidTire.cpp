@@ -25,6 +25,7 @@
 #include "chrono_vehicle/wheeled_vehicle/tire/ChRigidTire.h"
 
 #include "chrono_vehicle/terrain/SCMTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 namespace chrono {
 namespace vehicle {
@@ -58,7 +59,13 @@ void ChRigidTire::Initialize(std::shared_ptr<ChWheel> wheel) {
 
     if (m_use_contact_mesh) {
         // Mesh contact
-        m_trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(m_contact_meshFile, true, false);
+        // Use a copy of the (possibly shared) mesh, as it may be modified below
+        auto trimesh = ChVehicleDataCache::GetWavefrontMesh(m_contact_meshFile, true, false);
+        if (!trimesh) {
+            std::cerr << "ChRigidTire: cannot load contact mesh " << m_contact_meshFile << std::endl;
+            throw ChException("ChRigidTire: cannot load contact mesh " + m_contact_meshFile);
+        }
+        m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(*trimesh);
 
         //// RADU
         // Hack to deal with current limitation: cannot set offset on a trimesh collision shape!
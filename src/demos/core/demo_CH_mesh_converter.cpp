@@ -0,0 +1,92 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Converter from Wavefront OBJ or STL mesh files to the Chrono binary mesh
+// format. Binary mesh files can be used wherever Chrono loads large meshes
+// (e.g., RigidTerrain mesh patches, SCM terrain) and load much faster.
+//
+// Usage:  demo_CH_mesh_converter <input file> [<output file>]
+//         If not specified, the output file is the input file with extension
+//         replaced by '.chmesh'.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <input file (OBJ or STL)> [<output file>]" << std::endl;
+        return 1;
+    }
+
+    std::string in_file = argv[1];
+    filesystem::path in_path(in_file);
+    if (!in_path.is_file()) {
+        std::cout << "Input file " << in_file << " does not exist" << std::endl;
+        return 1;
+    }
+
+    std::string out_file;
+    if (argc > 2)
+        out_file = argv[2];
+    else if (in_path.parent_path().empty())
+        out_file = in_path.stem() + ".chmesh";
+    else
+        out_file = in_path.parent_path().str() + "/" + in_path.stem() + ".chmesh";
+
+    // Load the input mesh (including normals and texture coordinates)
+    ChTimer timer;
+    timer.start();
+    std::shared_ptr<ChTriangleMeshConnected> mesh;
+    if (in_path.extension() == "stl" || in_path.extension() == "STL")
+        mesh = ChTriangleMeshConnected::CreateFromSTLFile(in_file, true);
+    else
+        mesh = ChTriangleMeshConnected::CreateFromWavefrontFile(in_file, true, true);
+    timer.stop();
+    if (!mesh) {
+        std::cout << "Error loading mesh from " << in_file << std::endl;
+        return 1;
+    }
+    std::cout << "Loaded " << in_file << " in " << timer() << " s" << std::endl;
+    std::cout << "   vertices:  " << mesh->getNumVertices() << std::endl;
+    std::cout << "   normals:   " << mesh->getNumNormals() << std::endl;
+    std::cout << "   triangles: " << mesh->getNumTriangles() << std::endl;
+
+    // Write the binary mesh file
+    if (!mesh->WriteBinaryMesh(out_file)) {
+        std::cout << "Error writing binary mesh file " << out_file << std::endl;
+        return 1;
+    }
+
+    // Reload from the binary file for comparison
+    timer.reset();
+    timer.start();
+    auto bin_mesh = ChTriangleMeshConnected::CreateFromBinaryFile(out_file, true, true);
+    timer.stop();
+    if (!bin_mesh || bin_mesh->getNumTriangles() != mesh->getNumTriangles()) {
+        std::cout << "Error reloading binary mesh file " << out_file << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << out_file << " (reloaded in " << timer() << " s)" << std::endl;
+
+    return 0;
+}
@@ -91,6 +91,7 @@ int main(int argc, char* argv[]) {
     auto step_size = cli.GetAsType<double>("step_size");
     auto end_time = cli.GetAsType<double>("end_time");
     auto heartbeat = cli.GetAsType<double>("heartbeat");
+    auto max_lag = cli.GetAsType<double>("max_lag");
     auto contact_method =
         (cli.Matches<std::string>("contact_method", "SMC") ? ChContactMethod::SMC : ChContactMethod::NSC);
     auto size_x = cli.GetAsType<double>("sizeX");
@@ -107,6 +108,8 @@ int main(int argc, char* argv[]) {
 
     // Change SynChronoManager settings
     syn_manager.SetHeartbeat(heartbeat);
+    if (max_lag > 0)
+        syn_manager.SetAsynchronous(true, max_lag);
 
     // ----------------------
     // Vehicle Initialization
@@ -366,6 +369,7 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<double>("Simulation", "s,step_size", "Step size", "3e-3");
     cli.AddOption<double>("Simulation", "e,end_time", "End time", "1000");
     cli.AddOption<double>("Simulation", "b,heartbeat", "Heartbeat", "1e-2");
+    cli.AddOption<double>("Simulation", "max_lag", "Max. remote state lag for asynchronous sync (0: lockstep)", "0");
     cli.AddOption<std::string>("Simulation", "c,contact_method", "Contact Method", "SMC", "NSC/SMC");
 
     // SCM specific options
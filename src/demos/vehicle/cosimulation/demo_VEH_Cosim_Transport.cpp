@@ -0,0 +1,178 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark for the co-simulation transport layers.
+//
+// Measures the latency of the exchange between a TIRE node and the TERRAIN node
+// for a MESH interface, as a function of the tire mesh size, with MPI and with
+// shared memory transport. At each exchange, the tire node sends vertex
+// positions and velocities and the terrain node replies with contact forces on
+// a fraction of the vertices.
+//
+// Run on 2 MPI ranks, e.g.:
+//    mpirun -np 2 demo_VEH_Cosim_Transport
+//
+// =============================================================================
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include <mpi.h>
+
+#include "chrono/core/ChTypes.h"
+#include "chrono/core/ChVector.h"
+
+#include "chrono_vehicle/cosim/ChVehicleCosimTransport.h"
+
+#include "chrono_thirdparty/cxxopts/ChCLI.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Ranks playing the roles of the tire and terrain nodes
+#define TIRE_RANK 0
+#define TERRAIN_RANK 1
+
+// Fraction of mesh vertices in contact
+double contact_fraction = 0.1;
+
+// Perform the specified number of exchanges and return the average exchange time (in seconds)
+double Exchange(ChVehicleCosimTransport& transport, int nv, int num_exchanges) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    int nvc = (int)(contact_fraction * nv);
+    std::vector<ChVector<>> vpos(nv, ChVector<>(1, 2, 3));
+    std::vector<ChVector<>> vvel(nv, ChVector<>(4, 5, 6));
+    std::vector<int> vidx(nvc);
+    std::vector<ChVector<>> vforce(nvc);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    double start = MPI_Wtime();
+
+    for (int step = 0; step < num_exchanges; step++) {
+        if (rank == TIRE_RANK) {
+            // Pack mesh state directly in the transport buffer
+            auto vert_data = static_cast<double*>(transport.BeginSend(TERRAIN_RANK, 2 * 3 * nv * sizeof(double)));
+            for (int iv = 0; iv < nv; iv++) {
+                vert_data[3 * iv + 0] = vpos[iv].x();
+                vert_data[3 * iv + 1] = vpos[iv].y();
+                vert_data[3 * iv + 2] = vpos[iv].z();
+                vert_data[3 * nv + 3 * iv + 0] = vvel[iv].x();
+                vert_data[3 * nv + 3 * iv + 1] = vvel[iv].y();
+                vert_data[3 * nv + 3 * iv + 2] = vvel[iv].z();
+            }
+            transport.EndSend(TERRAIN_RANK, step);
+
+            // Receive contact vertex indices and forces
+            size_t size;
+            auto index_data = static_cast<const int*>(transport.BeginRecv(TERRAIN_RANK, step, size));
+            nvc = (int)(size / sizeof(int));
+            vidx.assign(index_data, index_data + nvc);
+            transport.EndRecv(TERRAIN_RANK);
+            auto force_data = static_cast<const double*>(transport.BeginRecv(TERRAIN_RANK, step, size));
+            for (int iv = 0; iv < nvc; iv++)
+                vforce[iv] = ChVector<>(force_data[3 * iv + 0], force_data[3 * iv + 1], force_data[3 * iv + 2]);
+            transport.EndRecv(TERRAIN_RANK);
+        } else if (rank == TERRAIN_RANK) {
+            // Unpack mesh state directly from the transport buffer
+            size_t size;
+            auto vert_data = static_cast<const double*>(transport.BeginRecv(TIRE_RANK, step, size));
+            for (int iv = 0; iv < nv; iv++) {
+                vpos[iv] = ChVector<>(vert_data[3 * iv + 0], vert_data[3 * iv + 1], vert_data[3 * iv + 2]);
+                vvel[iv] = ChVector<>(vert_data[3 * nv + 3 * iv + 0], vert_data[3 * nv + 3 * iv + 1],
+                                      vert_data[3 * nv + 3 * iv + 2]);
+            }
+            transport.EndRecv(TIRE_RANK);
+
+            // Send contact vertex indices and forces
+            for (int iv = 0; iv < nvc; iv++) {
+                vidx[iv] = iv;
+                vforce[iv] = vpos[iv] * 1e-3;
+            }
+            transport.Send(vidx.data(), nvc, TIRE_RANK, step);
+            auto force_data = static_cast<double*>(transport.BeginSend(TIRE_RANK, 3 * nvc * sizeof(double)));
+            for (int iv = 0; iv < nvc; iv++) {
+                force_data[3 * iv + 0] = vforce[iv].x();
+                force_data[3 * iv + 1] = vforce[iv].y();
+                force_data[3 * iv + 2] = vforce[iv].z();
+            }
+            transport.EndSend(TIRE_RANK, step);
+        }
+    }
+
+    double time = (MPI_Wtime() - start) / num_exchanges;
+    MPI_Bcast(&time, 1, MPI_DOUBLE, TIRE_RANK, MPI_COMM_WORLD);
+    return time;
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+
+    int rank;
+    int num_procs;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+
+    ChCLI cli(argv[0], "Co-simulation transport benchmark (run on 2 MPI ranks)");
+    cli.AddOption<int>("Benchmark", "n,num_exchanges", "Number of exchanges per mesh size", "200");
+    cli.AddOption<int>("Benchmark", "m,max_vertices", "Largest number of mesh vertices", "1000000");
+    cli.AddOption<int>("Benchmark", "r,ring_size", "Shared memory ring buffer size (MB)", "64");
+
+    if (!cli.Parse(argc, argv, rank == 0)) {
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (num_procs != 2) {
+        if (rank == 0)
+            std::cout << "\n\nThis benchmark must be run on 2 MPI ranks.\n\n" << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+
+    int num_exchanges = cli.GetAsType<int>("num_exchanges");
+    int max_vertices = cli.GetAsType<int>("max_vertices");
+    size_t ring_size = (size_t)cli.GetAsType<int>("ring_size") << 20;
+
+    // Transports must be destroyed before MPI_Finalize
+    auto transport_mpi = chrono_types::make_unique<ChVehicleCosimTransportMPI>();
+    auto transport_shm = chrono_types::make_unique<ChVehicleCosimTransportSHM>(ring_size);
+
+    if (rank == 0) {
+        std::cout << "Shared memory transport: " << (transport_shm->IsColocated(1) ? "enabled" : "not available")
+                  << std::endl;
+        printf("%10s %12s %14s %14s %10s\n", "vertices", "bytes", "MPI [us]", "SHM [us]", "speedup");
+    }
+
+    for (int nv = 100; nv <= max_vertices; nv *= 10) {
+        // Warm up, then time both transports
+        Exchange(*transport_mpi, nv, 10);
+        double time_mpi = Exchange(*transport_mpi, nv, num_exchanges);
+        Exchange(*transport_shm, nv, 10);
+        double time_shm = Exchange(*transport_shm, nv, num_exchanges);
+
+        if (rank == 0) {
+            int bytes = 2 * 3 * nv * sizeof(double);
+            printf("%10d %12d %14.2f %14.2f %10.2f\n", nv, bytes, 1e6 * time_mpi, 1e6 * time_shm, time_mpi / time_shm);
+        }
+    }
+
+    transport_shm.reset();
+    transport_mpi.reset();
+
+    MPI_Finalize();
+    return 0;
+}
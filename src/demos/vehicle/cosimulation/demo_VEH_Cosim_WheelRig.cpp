@@ -18,6 +18,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <limits>
@@ -62,6 +63,8 @@ bool GetProblemSpecs(int argc,
                      int& nthreads_tire,
                      int& nthreads_terrain,
                      double& step_size,
+                     double& cosim_step,
+                     bool& extrapolate,
                      bool& fixed_settling_time,
                      double& KE_threshold,
                      double& settling_time,
@@ -73,6 +76,7 @@ bool GetProblemSpecs(int argc,
                      double& toe_angle,
                      double& dbp_filter_window,
                      bool& use_checkpoint,
+                     bool& shm_transport,
                      double& output_fps,
                      double& vis_output_fps,
                      double& render_fps,
@@ -120,6 +124,8 @@ int main(int argc, char** argv) {
     int nthreads_tire = 1;
     int nthreads_terrain = 1;
     double step_size = 1e-4;
+    double cosim_step = 0;
+    bool extrapolate = false;
     bool fixed_settling_time = true;
     double KE_threshold = std::numeric_limits<double>::infinity();
     double settling_time = 0.4;
@@ -127,6 +133,7 @@ int main(int argc, char** argv) {
     double base_vel = 1.0;
     double slip = 0;
     bool use_checkpoint = false;
+    bool shm_transport = false;
     double output_fps = 100;
     double vis_output_fps = 100;
     double render_fps = 0;
@@ -142,9 +149,10 @@ int main(int argc, char** argv) {
     std::string suffix = "";
     bool verbose = true;
     if (!GetProblemSpecs(argc, argv, rank, terrain_specfile, tire_specfile, nthreads_tire, nthreads_terrain, step_size,
-                         fixed_settling_time, KE_threshold, settling_time, sim_time, act_type, base_vel, slip,
-                         total_mass, toe_angle, dbp_filter_window, use_checkpoint, output_fps, vis_output_fps,
-                         render_fps, sim_output, settling_output, vis_output, renderRT, verbose, suffix)) {
+                         cosim_step, extrapolate, fixed_settling_time, KE_threshold, settling_time, sim_time, act_type,
+                         base_vel, slip, total_mass, toe_angle, dbp_filter_window, use_checkpoint, shm_transport,
+                         output_fps, vis_output_fps, render_fps, sim_output, settling_output, vis_output, renderRT,
+                         verbose, suffix)) {
         MPI_Finalize();
         return 1;
     }
@@ -216,9 +224,10 @@ int main(int argc, char** argv) {
     MPI_Barrier(MPI_COMM_WORLD);
 
     // Number of simulation steps between miscellaneous events.
-    int sim_steps = (int)std::ceil(sim_time / step_size);
-    int output_steps = (int)std::ceil(1 / (output_fps * step_size));
-    int vis_output_steps = (int)std::ceil(1 / (vis_output_fps * step_size));
+    // The MBS node integrates with the co-simulation step size.
+    int sim_steps = (int)std::ceil(sim_time / cosim_step);
+    int output_steps = (int)std::ceil(1 / (output_fps * cosim_step));
+    int vis_output_steps = (int)std::ceil(1 / (vis_output_fps * cosim_step));
 
     // Initialize co-simulation framework (specify 1 tire node).
     cosim::InitializeFramework(1);
@@ -236,7 +245,7 @@ int main(int argc, char** argv) {
         auto mbs = new ChVehicleCosimRigNode();
         mbs->SetVerbose(verbose);
         mbs->SetInitialLocation(init_loc);
-        mbs->SetStepSize(step_size);
+        mbs->SetStepSize(cosim_step);
         mbs->SetNumThreads(1);
         mbs->SetTotalMass(total_mass);
         mbs->SetOutDir(out_dir, suffix);
@@ -428,6 +437,8 @@ int main(int argc, char** argv) {
 
     // Initialize systems
     // (perform initial inter-node data exchange)
+    node->EnableSharedMemoryTransport(shm_transport);
+    node->EnableCouplingExtrapolation(extrapolate);
     node->Initialize();
 
     // Perform co-simulation
@@ -437,14 +448,14 @@ int main(int argc, char** argv) {
 
     double t_start = MPI_Wtime();
     for (int is = 0; is < sim_steps; is++) {
-        double time = is * step_size;
+        double time = is * cosim_step;
 
         if (verbose && rank == 0)
             cout << is << " ---------------------------- " << endl;
         MPI_Barrier(MPI_COMM_WORLD);
 
         node->Synchronize(is, time);
-        node->Advance(step_size);
+        node->Advance(cosim_step);
         if (verbose)
             cout << "Node" << rank << " sim time = " << node->GetStepExecutionTime() << "  ["
                  << node->GetTotalExecutionTime() << "]" << endl;
@@ -481,6 +492,8 @@ bool GetProblemSpecs(int argc,
                      int& nthreads_tire,
                      int& nthreads_terrain,
                      double& step_size,
+                     double& cosim_step,
+                     bool& extrapolate,
                      bool& fixed_settling_time,
                      double& KE_threshold,
                      double& settling_time,
@@ -492,6 +505,7 @@ bool GetProblemSpecs(int argc,
                      double& toe_angle,
                      double& dbp_filter_window,
                      bool& use_checkpoint,
+                     bool& shm_transport,
                      double& output_fps,
                      double& vis_output_fps,
                      double& render_fps,
@@ -521,6 +535,8 @@ bool GetProblemSpecs(int argc,
     cli.AddOption<double>("Simulation", "sim_time", "Simulation length after settling phase [s]",
                           std::to_string(sim_time));
     cli.AddOption<double>("Simulation", "step_size", "Integration step size [s]", std::to_string(step_size));
+    cli.AddOption<double>("Simulation", "cosim_step", "Co-simulation step size [s] (default: integration step size)");
+    cli.AddOption<bool>("Simulation", "extrapolate", "Extrapolate coupling data over a co-simulation step");
 
     cli.AddOption<int>("Simulation", "threads_tire", "Number of OpenMP threads for the tire node",
                        std::to_string(nthreads_tire));
@@ -528,6 +544,7 @@ bool GetProblemSpecs(int argc,
                        std::to_string(nthreads_terrain));
 
     cli.AddOption<bool>("Simulation", "use_checkpoint", "Initialize from checkpoint file");
+    cli.AddOption<bool>("Simulation", "shm_transport", "Exchange data between nodes through shared memory");
 
     cli.AddOption<bool>("Output", "quiet", "Disable verbose messages");
     cli.AddOption<bool>("Output", "no_output", "Disable generation of simulation output files");
@@ -600,6 +617,8 @@ bool GetProblemSpecs(int argc,
 
     sim_time = cli.GetAsType<double>("sim_time");
     step_size = cli.GetAsType<double>("step_size");
+    cosim_step = std::max(step_size, cli.CheckOption("cosim_step") ? cli.GetAsType<double>("cosim_step") : 0.0);
+    extrapolate = cli.GetAsType<bool>("extrapolate");
 
     total_mass = cli.GetAsType<double>("total_mass");
     toe_angle = cli.GetAsType<double>("toe_angle");
@@ -617,6 +636,7 @@ bool GetProblemSpecs(int argc,
     render_fps = cli.GetAsType<double>("render_fps");
 
     use_checkpoint = cli.GetAsType<bool>("use_checkpoint");
+    shm_transport = cli.GetAsType<bool>("shm_transport");
 
     nthreads_tire = cli.GetAsType<int>("threads_tire");
     nthreads_terrain = cli.GetAsType<int>("threads_terrain");
@@ -0,0 +1,266 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2020 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Distributed benchmark of a granular discharge from a wedge hopper.
+//
+// The domain is split along the vertical direction, so that the granular
+// material initially loads the upper sub-domains and progressively moves to
+// the lower ones. The parallel efficiency T_1 / (N * T_N) is reported against
+// the wall-clock time of a single-rank run of the same problem, e.g.:
+//    mpirun -np 1 btest_DISTR_hopper -n 2 -t 0.5
+//    mpirun -np 4 btest_DISTR_hopper -n 2 -t 0.5 -b 0  -r <T_1>
+//    mpirun -np 4 btest_DISTR_hopper -n 2 -t 0.5 -b 50 -r <T_1>
+// Use -k to enable the non-blocking inter-rank exchange.
+//
+// =============================================================================
+
+#include <mpi.h>
+#include <omp.h>
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "chrono_distributed/collision/ChBoundary.h"
+#include "chrono_distributed/collision/ChCollisionModelDistributed.h"
+#include "chrono_distributed/physics/ChSystemDistributed.h"
+
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsSamplers.h"
+
+#include "chrono_thirdparty/cxxopts/ChCLI.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+#define MASTER 0
+
+// Granular Properties
+float Y = 2e6f;
+float mu = 0.4f;
+float cr = 0.05f;
+double p_radius = 0.005;
+double p_rho = 2500;
+double spacing = 2.01 * p_radius;  // Distance between adjacent centers of particles
+double p_mass = p_rho * 4 / 3 * CH_C_PI * p_radius * p_radius * p_radius;
+ChVector<> p_inertia = (2.0 / 5.0) * p_mass * p_radius * p_radius * ChVector<>(1, 1, 1);
+
+// Hopper geometry
+double hx = 0.3;                  // half-width of the hopper (X)
+double hy = 0.1;                  // half-depth of the hopper (Y)
+double outlet = 12 * p_radius;    // width of the hopper outlet
+double z_outlet = 0.2;            // height of the hopper outlet above the floor
+double wall_angle = CH_C_PI / 3;  // inclination of hopper walls
+double fill_height = 0.4;         // height of the granular column above the hopper walls
+
+// Simulation
+double time_step = 1e-4;
+double out_fps = 20;
+
+void AddHopper(ChSystemDistributed* sys, double z_top) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetYoungModulus(Y);
+    mat->SetFriction(mu);
+    mat->SetRestitution(cr);
+
+    auto bin = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+    bin->SetIdentifier(-200);
+    bin->SetMass(1);
+    bin->SetPos(ChVector<>(0, 0, 0));
+    bin->SetCollide(true);
+    bin->SetBodyFixed(true);
+    sys->AddBodyAllRanks(bin);
+
+    double wall_len = (hx - outlet / 2) / std::cos(wall_angle);
+    double height = z_top + fill_height;
+    double xc = outlet / 2 + 0.5 * wall_len * std::cos(wall_angle);
+    double zc = z_outlet + 0.5 * wall_len * std::sin(wall_angle);
+
+    auto cb = new ChBoundary(bin, mat);
+    // Floor
+    cb->AddPlane(ChFrame<>(ChVector<>(0, 0, 0), QUNIT), ChVector2<>(2 * hx, 2 * hy));
+    // Inclined hopper walls
+    cb->AddPlane(ChFrame<>(ChVector<>(-xc, 0, zc), Q_from_AngY(wall_angle)), ChVector2<>(wall_len, 2 * hy));
+    cb->AddPlane(ChFrame<>(ChVector<>(+xc, 0, zc), Q_from_AngY(-wall_angle)), ChVector2<>(wall_len, 2 * hy));
+    // low x and high x (full height)
+    cb->AddPlane(ChFrame<>(ChVector<>(-hx, 0, height / 2), Q_from_AngY(CH_C_PI_2)), ChVector2<>(height, 2 * hy));
+    cb->AddPlane(ChFrame<>(ChVector<>(hx, 0, height / 2), Q_from_AngY(-CH_C_PI_2)), ChVector2<>(height, 2 * hy));
+    // low y and high y (full height)
+    cb->AddPlane(ChFrame<>(ChVector<>(0, -hy, height / 2), Q_from_AngX(-CH_C_PI_2)), ChVector2<>(2 * hx, height));
+    cb->AddPlane(ChFrame<>(ChVector<>(0, hy, height / 2), Q_from_AngX(CH_C_PI_2)), ChVector2<>(2 * hx, height));
+}
+
+size_t AddParticles(ChSystemDistributed* sys, double z_top) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetYoungModulus(Y);
+    mat->SetFriction(mu);
+    mat->SetRestitution(cr);
+    mat->SetAdhesion(0);
+
+    utils::GridSampler<> sampler(spacing);
+    ChVector<> center(0, 0, z_top + fill_height / 2);
+    ChVector<> half_dims(hx - spacing, hy - spacing, fill_height / 2 - spacing);
+    auto points = sampler.SampleBox(center, half_dims);
+
+    for (int i = 0; i < points.size(); i++) {
+        auto ball = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+        ball->SetIdentifier(i);
+        ball->SetMass(p_mass);
+        ball->SetInertiaXX(p_inertia);
+        ball->SetPos(points[i]);
+        ball->SetBodyFixed(false);
+        ball->SetCollide(true);
+
+        ball->GetCollisionModel()->ClearModel();
+        utils::AddSphereGeometry(ball.get(), mat, p_radius);
+        ball->GetCollisionModel()->BuildModel();
+        sys->AddBody(ball);
+    }
+
+    return points.size();
+}
+
+int main(int argc, char* argv[]) {
+    int num_ranks;
+    int my_rank;
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    ChCLI cli(argv[0]);
+
+    // Command-line arguments for the benchmark
+    cli.AddOption<int>("Benchmark", "n,nthreads", "Number of OpenMP threads on each rank", "1");
+    cli.AddOption<double>("Benchmark", "t,end_time", "Simulation length", "1");
+    cli.AddOption<int>("Benchmark", "b,balance", "Load balancing interval in steps (0: disabled)", "50");
+    cli.AddOption<bool>("Benchmark", "w,time_metric", "Balance step times instead of body counts", "false");
+    cli.AddOption<bool>("Benchmark", "k,nonblocking", "Use the non-blocking inter-rank exchange", "false");
+    cli.AddOption<double>("Benchmark", "r,ref_time", "Wall-clock time of the single-rank run (0: this run)", "0");
+    cli.AddOption<bool>("Benchmark", "v,verbose", "Enable verbose output", "false");
+
+    if (!cli.Parse(argc, argv, my_rank == 0)) {
+        MPI_Finalize();
+        return 1;
+    }
+
+    const int num_threads = cli.GetAsType<int>("nthreads");
+    const double time_end = cli.GetAsType<double>("end_time");
+    const int balance_interval = cli.GetAsType<int>("balance");
+    const bool time_metric = cli.GetAsType<bool>("time_metric");
+    const bool nonblocking = cli.GetAsType<bool>("nonblocking");
+    const double ref_time = cli.GetAsType<double>("ref_time");
+    const bool verbose = cli.GetAsType<bool>("verbose");
+
+    if (num_threads < 1 || time_end <= 0 || ref_time < 0) {
+        if (my_rank == MASTER)
+            std::cout << "Invalid parameter." << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+
+    // Create distributed system
+    ChSystemDistributed my_sys(MPI_COMM_WORLD, p_radius * 2, 200000);
+    my_sys.SetNumThreads(num_threads);
+    my_sys.Set_G_acc(ChVector<double>(0, 0, -9.8));
+    my_sys.GetComm()->SetNonBlocking(nonblocking);
+
+    // Domain decomposition along the vertical direction
+    double z_top = z_outlet + (hx - outlet / 2) * std::tan(wall_angle);
+    ChVector<double> domlo(-hx - spacing, -hy - spacing, -2.0 * p_radius);
+    ChVector<double> domhi(hx + spacing, hy + spacing, z_top + fill_height + 3.0 * spacing);
+    my_sys.GetDomain()->SetSplitAxis(2);
+    my_sys.GetDomain()->SetSimDomain(domlo, domhi);
+
+    auto metric = ChDomainDistributed::LoadMetric::BODY_COUNT;
+    if (time_metric)
+        metric = ChDomainDistributed::LoadMetric::STEP_TIME;
+    my_sys.GetDomain()->EnableLoadBalancing(balance_interval, metric);
+
+    if (verbose)
+        my_sys.GetDomain()->PrintDomain();
+
+    // Set solver parameters
+    my_sys.GetSettings()->solver.contact_force_model = ChSystemSMC::ContactForceModel::Hertz;
+    my_sys.GetSettings()->solver.adhesion_force_model = ChSystemSMC::AdhesionForceModel::Constant;
+    my_sys.GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::PRIMS;
+    my_sys.GetSettings()->collision.bins_per_axis = vec3(20, 8, 20);
+
+    AddHopper(&my_sys, z_top);
+    auto num_particles = AddParticles(&my_sys, z_top);
+    if (my_rank == MASTER) {
+        std::cout << "Number of MPI ranks:        " << num_ranks << std::endl;
+        std::cout << "Number of threads per rank: " << num_threads << std::endl;
+        std::cout << "Number of particles:        " << num_particles << std::endl;
+        std::cout << "Load balancing interval:    " << balance_interval << std::endl;
+        std::cout << "Non-blocking exchange:      " << nonblocking << std::endl;
+    }
+
+    // Run simulation for specified time
+    int num_steps = (int)std::ceil(time_end / time_step);
+    int out_steps = (int)std::ceil((1 / time_step) / out_fps);
+    double compute_time = 0;
+    double exchange_time = 0;
+
+    MPI_Barrier(my_sys.GetCommunicator());
+    double t_start = MPI_Wtime();
+    for (int i = 0; i < num_steps; i++) {
+        my_sys.DoStepDynamics(time_step);
+        compute_time += my_sys.GetTimerStep();
+        exchange_time += my_sys.data_manager->system_timer.GetTime("Exchange");
+
+        if (i % out_steps == 0) {
+            int num_bodies = my_sys.GetNbodies();
+            std::vector<int> all_bodies(num_ranks);
+            MPI_Gather(&num_bodies, 1, MPI_INT, all_bodies.data(), 1, MPI_INT, MASTER, my_sys.GetCommunicator());
+            if (my_rank == MASTER) {
+                printf("Time: %6.3f  elapsed: %8.2f  imbalance: %5.2f  bodies:", my_sys.GetChTime(),
+                       MPI_Wtime() - t_start, my_sys.GetDomain()->GetImbalance());
+                for (auto n : all_bodies)
+                    printf(" %6d", n);
+                printf("\n");
+            }
+        }
+    }
+    double elapsed = MPI_Wtime() - t_start;
+
+    // Load balance of the computation (average over maximum compute time across ranks)
+    double max_compute;
+    double sum_compute;
+    double max_exchange;
+    MPI_Reduce(&compute_time, &max_compute, 1, MPI_DOUBLE, MPI_MAX, MASTER, my_sys.GetCommunicator());
+    MPI_Reduce(&compute_time, &sum_compute, 1, MPI_DOUBLE, MPI_SUM, MASTER, my_sys.GetCommunicator());
+    MPI_Reduce(&exchange_time, &max_exchange, 1, MPI_DOUBLE, MPI_MAX, MASTER, my_sys.GetCommunicator());
+
+    // Parallel efficiency with respect to the single-rank wall-clock time
+    double serial_time = (ref_time > 0) ? ref_time : (num_ranks == 1 ? elapsed : 0);
+
+    if (my_rank == MASTER) {
+        std::cout << "\nTotal elapsed time:      " << elapsed << std::endl;
+        std::cout << "Max compute time:        " << max_compute << std::endl;
+        std::cout << "Max exchange time:       " << max_exchange << std::endl;
+        std::cout << "Load balance efficiency: " << sum_compute / (num_ranks * max_compute) << std::endl;
+        std::cout << "Number of rebalances:    " << my_sys.GetDomain()->GetNumRebalances() << std::endl;
+        if (serial_time > 0) {
+            std::cout << "Speedup:                 " << serial_time / elapsed << std::endl;
+            std::cout << "Parallel efficiency:     " << serial_time / (num_ranks * elapsed) << std::endl;
+        } else {
+            std::cout << "Parallel efficiency:     n/a (pass the single-rank time with -r)" << std::endl;
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for matrix-free implicit integration of large FEA meshes.
+//
+// A block of corotational hexahedral elements, clamped at its base, deforms
+// under gravity and is integrated with HHT using:
+//   - a direct sparse solver (assembled system matrix)
+//   - GMRES with K and R element blocks stored in the system descriptor
+//   - GMRES with matrix-free K and R products (see ChSystem::EnableMatrixFreeKRM)
+//
+// Besides timing information, each test reports the peak resident set size of
+// the process. Since this is a process-wide high-water mark, run a single test
+// at a time (using --benchmark_filter) when comparing memory use.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+
+#if defined(_WIN32)
+    #define NOMINMAX
+    #include <windows.h>
+    #include <psapi.h>
+    #pragma comment(lib, "psapi.lib")
+#else
+    #include <sys/resource.h>
+#endif
+
+using namespace chrono;
+using namespace chrono::fea;
+
+enum class SolverMode { SPARSE_LU, GMRES_ASSEMBLED, GMRES_MATRIX_FREE };
+
+// Peak resident set size of this process (in MB)
+static double GetPeakRSS() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS info;
+    GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info));
+    return info.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    #if defined(__APPLE__)
+    return usage.ru_maxrss / (1024.0 * 1024.0);  // bytes
+    #else
+    return usage.ru_maxrss / 1024.0;  // kilobytes
+    #endif
+#endif
+}
+
+template <int N, SolverMode MODE>
+class HexaBlock : public utils::ChBenchmarkTest {
+  public:
+    HexaBlock();
+    virtual ~HexaBlock() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(1e-3); }
+
+  private:
+    ChSystemSMC* m_system;
+};
+
+template <int N, SolverMode MODE>
+HexaBlock<N, MODE>::HexaBlock() {
+    m_system = new ChSystemSMC();
+    m_system->Set_G_acc(ChVector<>(5, -9.8, 0));
+
+    // Set solver
+    switch (MODE) {
+        case SolverMode::SPARSE_LU: {
+            auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+            solver->LockSparsityPattern(true);
+            solver->SetVerbose(false);
+            m_system->SetSolver(solver);
+            break;
+        }
+        case SolverMode::GMRES_ASSEMBLED:
+        case SolverMode::GMRES_MATRIX_FREE: {
+            auto solver = chrono_types::make_shared<ChSolverGMRES>();
+            solver->SetMaxIterations(500);
+            solver->SetTolerance(1e-10);
+            solver->EnableDiagonalPreconditioner(true);
+            solver->SetVerbose(false);
+            m_system->SetSolver(solver);
+            m_system->EnableMatrixFreeKRM(MODE == SolverMode::GMRES_MATRIX_FREE);
+            break;
+        }
+    }
+
+    // Set up integrator
+    m_system->SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(m_system->GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-5);
+    integrator->SetMode(ChTimestepperHHT::POSITION);
+    integrator->SetScaling(true);
+    integrator->SetVerbose(false);
+
+    // Material
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    // Create a block of N x 4N x N hexahedral elements, with nodes at the base fixed
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    m_system->Add(mesh);
+
+    int nx = N;
+    int ny = 4 * N;
+    int nz = N;
+    double size = 0.1 / N;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes((nx + 1) * (ny + 1) * (nz + 1));
+    auto index = [&](int i, int j, int k) { return (j * (nz + 1) + k) * (nx + 1) + i; };
+
+    for (int j = 0; j <= ny; j++) {
+        for (int k = 0; k <= nz; k++) {
+            for (int i = 0; i <= nx; i++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(i * size, j * size, k * size));
+                node->SetFixed(j == 0);
+                mesh->AddNode(node);
+                nodes[index(i, j, k)] = node;
+            }
+        }
+    }
+
+    for (int j = 0; j < ny; j++) {
+        for (int k = 0; k < nz; k++) {
+            for (int i = 0; i < nx; i++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(nodes[index(i, j, k)], nodes[index(i, j, k + 1)], nodes[index(i + 1, j, k + 1)],
+                                  nodes[index(i + 1, j, k)], nodes[index(i, j + 1, k)], nodes[index(i, j + 1, k + 1)],
+                                  nodes[index(i + 1, j + 1, k + 1)], nodes[index(i + 1, j + 1, k)]);
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+}
+
+// Benchmark fixture reporting timers and peak memory use
+template <int N, SolverMode MODE>
+class MatrixFreeFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override { m_test = new HexaBlock<N, MODE>(); }
+    void TearDown(const ::benchmark::State& st) override { delete m_test; }
+
+    void Report(benchmark::State& st) {
+        auto descr = m_test->GetSystem()->GetSystemDescriptor();
+        st.counters["SIZE"] = descr->CountActiveVariables() + descr->CountActiveConstraints();
+        st.counters["Step_Total"] = m_test->m_timer_step * 1e3;
+        st.counters["LS_Jacobian"] = m_test->m_timer_jacobian * 1e3;
+        st.counters["LS_Setup"] = m_test->m_timer_ls_setup * 1e3;
+        st.counters["LS_Solve"] = m_test->m_timer_ls_solve * 1e3;
+        st.counters["RSS_peak_MB"] = GetPeakRSS();
+    }
+
+    HexaBlock<N, MODE>* m_test;
+};
+
+#define BM_HEXA(TEST_NAME, N, MODE)                                                            \
+    BENCHMARK_TEMPLATE_DEFINE_F(MatrixFreeFixture, TEST_NAME, N, MODE)(benchmark::State & st) { \
+        while (st.KeepRunning()) {                                                             \
+            m_test->Simulate(5);                                                               \
+        }                                                                                      \
+        Report(st);                                                                            \
+    }                                                                                          \
+    BENCHMARK_REGISTER_F(MatrixFreeFixture, TEST_NAME)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BM_HEXA(SparseLU_4, 4, SolverMode::SPARSE_LU)
+BM_HEXA(GMRES_assembled_4, 4, SolverMode::GMRES_ASSEMBLED)
+BM_HEXA(GMRES_matrix_free_4, 4, SolverMode::GMRES_MATRIX_FREE)
+
+BM_HEXA(SparseLU_8, 8, SolverMode::SPARSE_LU)
+BM_HEXA(GMRES_assembled_8, 8, SolverMode::GMRES_ASSEMBLED)
+BM_HEXA(GMRES_matrix_free_8, 8, SolverMode::GMRES_MATRIX_FREE)
+
+BM_HEXA(SparseLU_16, 16, SolverMode::SPARSE_LU)
+BM_HEXA(GMRES_assembled_16, 16, SolverMode::GMRES_ASSEMBLED)
+BM_HEXA(GMRES_matrix_free_16, 16, SolverMode::GMRES_MATRIX_FREE)
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
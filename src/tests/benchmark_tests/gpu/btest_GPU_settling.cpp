@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Chrono::Gpu benchmark test: settling of granular material in a box, with
+// frictionless and frictional (multi-step history) contact.
+// The same program can be built against the CUDA or the OpenMP (CPU) backend
+// of Chrono::Gpu, to compare throughput (reported as particle updates per
+// second). With the CUDA backend, the number of threads is ignored.
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsSamplers.h"
+
+#include "chrono_gpu/physics/ChSystemGpu.h"
+
+using namespace chrono;
+using namespace chrono::gpu;
+
+// =============================================================================
+
+// Create a box of granular material with range(0) particle layers (each about 40x40 particles).
+static std::unique_ptr<ChSystemGpu> CreateSystem(int num_layers, CHGPU_FRICTION_MODE friction_mode) {
+    float radius = 0.5f;
+    float density = 2.5f;
+    float box_X = 40.0f;
+    float box_Y = 40.0f;
+    float box_Z = 2.2f * radius * num_layers + 10.0f;
+
+    std::unique_ptr<ChSystemGpu> gpu_sys(new ChSystemGpu(radius, density, ChVector<float>(box_X, box_Y, box_Z)));
+
+    utils::HCPSampler<float> sampler(2.02f * radius);
+    ChVector<float> center(0, 0, -box_Z / 2 + 1.01f * radius);
+    ChVector<float> hdims(box_X / 2 - 1.01f * radius, box_Y / 2 - 1.01f * radius, 0);
+    std::vector<ChVector<float>> points;
+    for (int il = 0; il < num_layers; il++) {
+        auto layer = sampler.SampleBox(center, hdims);
+        points.insert(points.end(), layer.begin(), layer.end());
+        center.z() += 2.02f * radius;
+    }
+    gpu_sys->SetParticles(points);
+
+    gpu_sys->SetKn_SPH2SPH(1e7);
+    gpu_sys->SetKn_SPH2WALL(1e7);
+    gpu_sys->SetGn_SPH2SPH(2e4);
+    gpu_sys->SetGn_SPH2WALL(2e4);
+
+    gpu_sys->SetFrictionMode(friction_mode);
+    gpu_sys->SetKt_SPH2SPH(2e6);
+    gpu_sys->SetKt_SPH2WALL(2e6);
+    gpu_sys->SetGt_SPH2SPH(50);
+    gpu_sys->SetGt_SPH2WALL(50);
+    gpu_sys->SetStaticFrictionCoeff_SPH2SPH(0.5f);
+    gpu_sys->SetStaticFrictionCoeff_SPH2WALL(0.5f);
+
+    gpu_sys->SetGravitationalAcceleration(ChVector<float>(0, 0, -980));
+    gpu_sys->SetFixedStepSize(1e-5f);
+    gpu_sys->SetBDFixed(true);
+    gpu_sys->SetVerbosity(CHGPU_VERBOSITY::QUIET);
+
+    return gpu_sys;
+}
+
+// Advance the settling simulation with range(0) layers of particles, using range(1) threads (CPU backend only).
+static void Settling(benchmark::State& state, CHGPU_FRICTION_MODE friction_mode) {
+    auto gpu_sys = CreateSystem((int)state.range(0), friction_mode);
+    gpu_sys->SetNumThreads((int)state.range(1));
+    gpu_sys->Initialize();
+    auto num_particles = gpu_sys->GetNumParticles();
+
+    // Hot start
+    gpu_sys->AdvanceSimulation(1e-4f);
+
+    for (auto _ : state) {
+        gpu_sys->AdvanceSimulation(1e-4f);
+    }
+
+    // 10 steps per iteration
+    state.counters["particles"] = (double)num_particles;
+    state.counters["particles/s"] =
+        benchmark::Counter(10.0 * num_particles * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_CAPTURE(Settling, frictionless, CHGPU_FRICTION_MODE::FRICTIONLESS)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({8, 1})
+    ->Args({32, 1})
+    ->Args({32, 2})
+    ->Args({32, 4})
+    ->Args({32, 8});
+
+BENCHMARK_CAPTURE(Settling, multi_step, CHGPU_FRICTION_MODE::MULTI_STEP)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({8, 1})
+    ->Args({32, 1})
+    ->Args({32, 2})
+    ->Args({32, 4})
+    ->Args({32, 8});
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for constructing a Chrono model with multiple robots from a
+// URDF file, with and without parallel processing and caching of collision
+// meshes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono_parsers/ChParserURDF.h"
+#include "chrono_parsers/ChParserMeshCache.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::parsers;
+
+// =============================================================================
+
+#define NUM_ROBOTS 40
+
+const std::string urdf_file = "robot/robosimian/rs.urdf";
+
+// Create NUM_ROBOTS instances of the robot model, using convex hulls for all mesh collision shapes.
+// Note that each robot is created in a separate system, since the URDF parser identifies bodies by name.
+static void CreateRobotCell(int num_threads) {
+    for (int i = 0; i < NUM_ROBOTS; i++) {
+        ChSystemSMC sys;
+        ChParserURDF robot(GetChronoDataFile(urdf_file));
+        robot.SetAllJointsActuationType(ChParserURDF::ActuationType::POSITION);
+        robot.SetAllBodiesMeshCollisinoType(ChParserURDF::MeshCollisionType::CONVEX_HULL);
+        robot.SetNumThreads(num_threads);
+        robot.PopulateSystem(sys);
+    }
+}
+
+// Model construction without caching, using an increasing number of threads.
+static void URDF_nocache(benchmark::State& state) {
+    int num_threads = (int)state.range(0);
+    ChParserMeshCache::Enable(false);
+    ChParserMeshCache::SetCacheDirectory("");
+
+    for (auto _ : state) {
+        CreateRobotCell(num_threads);
+    }
+
+    state.counters["Threads"] = num_threads;
+    state.counters["Robots"] = NUM_ROBOTS;
+}
+
+// Model construction with in-memory cache (each robot after the first one reuses the processed meshes).
+static void URDF_memory_cache(benchmark::State& state) {
+    int num_threads = (int)state.range(0);
+    ChParserMeshCache::SetCacheDirectory("");
+
+    for (auto _ : state) {
+        ChParserMeshCache::Enable(true);
+        CreateRobotCell(num_threads);
+        state.counters["Hits"] = (double)ChParserMeshCache::GetNumHits();
+        ChParserMeshCache::Enable(false);
+    }
+
+    state.counters["Threads"] = num_threads;
+    state.counters["Robots"] = NUM_ROBOTS;
+}
+
+// Model construction with a warm on-disk cache (as in a second run of the same program).
+static void URDF_disk_cache(benchmark::State& state) {
+    int num_threads = (int)state.range(0);
+    ChParserMeshCache::Enable(false);
+    ChParserMeshCache::SetCacheDirectory(GetChronoOutputPath() + "BTEST_PARSER_URDF_CACHE");
+
+    // Populate the on-disk cache
+    CreateRobotCell(1);
+
+    for (auto _ : state) {
+        ChParserMeshCache::Clear();
+        CreateRobotCell(num_threads);
+        state.counters["Disk_hits"] = (double)ChParserMeshCache::GetNumDiskHits();
+    }
+
+    ChParserMeshCache::SetCacheDirectory("");
+
+    state.counters["Threads"] = num_threads;
+    state.counters["Robots"] = NUM_ROBOTS;
+}
+
+static const int max_threads = std::max((int)std::thread::hardware_concurrency(), 1);
+
+BENCHMARK(URDF_nocache)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(2)->Arg(4)->Arg(max_threads);
+BENCHMARK(URDF_memory_cache)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(max_threads);
+BENCHMARK(URDF_disk_cache)->Unit(benchmark::kMillisecond)->Arg(1)->Arg(max_threads);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    if (!filesystem::create_directory(filesystem::path(GetChronoOutputPath()))) {
+        std::cout << "Error creating directory " << GetChronoOutputPath() << std::endl;
+        return 1;
+    }
+
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for SPH fluid simulation (ChMatterSPH), comparing the neighbor
+// search methods of ChProximityContainerSPH. The throughput is reported as the
+// number of particle updates per second.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChMatterSPH.h"
+#include "chrono/physics/ChProximityContainerSPH.h"
+#include "chrono/utils/ChBenchmark.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+// Create a block of SPH fluid with the given lattice spacing, using the specified neighbor search.
+// With a cell list, collision detection is not needed for the SPH nodes (there are no other bodies here).
+static std::shared_ptr<ChMatterSPH> CreateFluid(ChSystemNSC& sys,
+                                                double spacing,
+                                                ChProximityContainerSPH::NeighborSearch search) {
+    auto fluid = chrono_types::make_shared<ChMatterSPH>();
+    fluid->FillBox(ChVector<>(1, 1, 1), spacing, 1000, ChCoordsys<>(), true, 1.5, 0.3);
+    fluid->GetMaterial().Set_viscosity(0.5);
+    fluid->GetMaterial().Set_pressure_stiffness(300);
+    fluid->SetCollide(search == ChProximityContainerSPH::NeighborSearch::COLLISION_SYSTEM);
+    sys.Add(fluid);
+
+    auto proximity = chrono_types::make_shared<ChProximityContainerSPH>();
+    proximity->SetNeighborSearch(search);
+    sys.Add(proximity);
+
+    return fluid;
+}
+
+// Simulate a block of SPH fluid with the lattice spacing 1/range(0), using range(1) threads.
+static void SPH(benchmark::State& state, ChProximityContainerSPH::NeighborSearch search) {
+    ChSystemNSC sys;
+    sys.SetNumThreads((int)state.range(1));
+    auto fluid = CreateFluid(sys, 1.0 / state.range(0), search);
+    auto num_particles = fluid->GetNnodes();
+
+    // Hot start
+    sys.DoStepDynamics(1e-3);
+
+    for (auto _ : state) {
+        sys.DoStepDynamics(1e-3);
+    }
+
+    state.counters["particles"] = (double)num_particles;
+    state.counters["particles/s"] =
+        benchmark::Counter((double)num_particles * state.iterations(), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_CAPTURE(SPH, collision_system, ChProximityContainerSPH::NeighborSearch::COLLISION_SYSTEM)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({10, 1})
+    ->Args({20, 1});
+
+BENCHMARK_CAPTURE(SPH, cell_list, ChProximityContainerSPH::NeighborSearch::CELL_LIST)
+    ->Unit(benchmark::kMillisecond)
+    ->Args({10, 1})
+    ->Args({20, 1})
+    ->Args({40, 1})
+    ->Args({40, 2})
+    ->Args({40, 4})
+    ->Args({40, 8});
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// DBSCAN clustering of synthetic 1M point clouds: a dense scene of compact
+// objects over a sparse background, and a uniform cloud. Reports the run time
+// for an increasing number of threads.
+//
+// =============================================================================
+
+#include <random>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "chrono_sensor/utils/Dbscan.h"
+
+using namespace chrono;
+
+const int num_points = 1000000;
+const int num_runs = 5;
+
+// points scattered around 50 objects, with a third of the points uniformly spread over the scene
+std::vector<vec3f> ObjectsCloud() {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> uniform(-50.f, 50.f);
+    std::normal_distribution<float> normal(0.f, 0.5f);
+
+    std::vector<vec3f> centers(50);
+    for (auto& c : centers)
+        c = vec3f{uniform(rng), uniform(rng), 0.1f * uniform(rng)};
+
+    std::vector<vec3f> points(num_points);
+    for (int i = 0; i < num_points; i++) {
+        if (i % 3 == 0) {
+            points[i] = vec3f{uniform(rng), uniform(rng), 0.1f * uniform(rng)};
+        } else {
+            const vec3f& c = centers[i % centers.size()];
+            points[i] = vec3f{c[0] + normal(rng), c[1] + normal(rng), c[2] + normal(rng)};
+        }
+    }
+    return points;
+}
+
+std::vector<vec3f> UniformCloud() {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> uniform(0.f, 100.f);
+
+    std::vector<vec3f> points(num_points);
+    for (auto& p : points)
+        p = vec3f{uniform(rng), uniform(rng), uniform(rng)};
+    return points;
+}
+
+void Benchmark(const char* name, std::vector<vec3f>& points, float eps, uint min_pts) {
+    GetLog() << name << " (" << (int)points.size() << " points, eps = " << eps << ", min points = " << (int)min_pts
+             << ")\n";
+
+    int max_threads = ChOMP::GetNumProcs();
+    for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        // the same instance is reused across runs, as the radar filter does every scan
+        DBSCAN dbscan;
+        dbscan.setNumThreads(num_threads);
+
+        ChTimer timer;
+        for (int r = 0; r < num_runs; r++) {
+            timer.start();
+            dbscan.Run(&points, eps, min_pts);
+            timer.stop();
+        }
+
+        GetLog() << "  threads: " << num_threads << "  clusters: " << (int)dbscan.getClusters().size()
+                 << "  noise: " << (int)dbscan.getNoise().size()
+                 << "  time per run [ms]: " << 1000 * timer.GetTimeSeconds() / num_runs << "\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    GetLog() << "Copyright (c) 2023 projectchrono.org\nChrono version: " << CHRONO_VERSION << "\n\n";
+
+    auto objects = ObjectsCloud();
+    Benchmark("Objects cloud", objects, 0.1f, 4);
+
+    auto uniform = UniformCloud();
+    Benchmark("Uniform cloud", uniform, 1.f, 4);
+
+    return 0;
+}
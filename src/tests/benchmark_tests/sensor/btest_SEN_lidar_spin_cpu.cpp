@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Spinning lidar on a moving cart, rendered with the CPU backend. Reports the
+// ray throughput for an increasing number of threads.
+//
+// =============================================================================
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/ChSensorManager.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterPCfromDepth.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+using namespace chrono::sensor;
+
+float end_time = 10.0f;
+
+double RunSpin(int num_threads) {
+    // -----------------
+    // Create the system
+    // -----------------
+    ChSystemNSC sys;
+
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(100, 100, .01, 1000, true, false);
+    floor->SetPos({0, 0, 0});
+    floor->SetBodyFixed(true);
+    sys.Add(floor);
+
+    auto cart = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, false);
+    cart->SetPos({0, 0, 1});
+    cart->SetBodyFixed(true);
+    sys.Add(cart);
+
+    // create alternating walls on left and right
+    int walls = 1000;
+    float wall_size = .5;
+    for (int i = 0; i < walls; i++) {
+        auto wall_body =
+            chrono_types::make_shared<ChBodyEasyCylinder>(geometry::ChAxis::Y, wall_size, 1, 1000, true, true);
+        wall_body->SetPos({4 * i * wall_size, 4, wall_size / 2});
+        wall_body->SetRot(Q_from_AngX(CH_C_PI / 2));
+        wall_body->SetBodyFixed(true);
+        sys.Add(wall_body);
+
+        auto wall_body1 =
+            chrono_types::make_shared<ChBodyEasyCylinder>(geometry::ChAxis::Y, wall_size, 1, 1000, true, true);
+        wall_body1->SetPos({4 * i * wall_size, -4, wall_size / 2});
+        wall_body1->SetRot(Q_from_AngX(CH_C_PI / 2));
+        wall_body1->SetBodyFixed(true);
+        sys.Add(wall_body1);
+    }
+
+    // -----------------------
+    // Create a sensor manager
+    // -----------------------
+    float step_size = 0.01f;
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+    manager->SetNumCpuThreads(num_threads);
+
+    auto lidar = chrono_types::make_shared<ChLidarSensor>(
+        cart,                                                              // body lidar is attached to
+        10.0f,                                                             // scanning rate in Hz
+        chrono::ChFrame<double>({0, 0, 0}, Q_from_AngAxis(0, {0, 1, 0})),  // offset pose
+        1000,                                                              // number of horizontal samples
+        10,                                                                // number of vertical channels
+        2 * (float)CH_C_PI,                                                // horizontal field of view
+        0.1f, -0.1f, 100.0f, LidarBeamShape::RECTANGULAR                   // vertical field of view
+    );
+    lidar->SetName("Lidar Sensor");
+    lidar->SetRenderBackend(RenderBackend::CPU);
+    lidar->SetLag(0);
+    lidar->SetCollectionWindow(0.1f);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterXYZIAccess>());
+    manager->AddSensor(lidar);
+
+    float speed = 16;
+
+    ChTimer timer;
+    while (sys.GetChTime() < end_time) {
+        // move the cart
+        cart->SetPos(cart->GetPos() + ChVector<>({speed * step_size, 0, 0}));
+
+        timer.start();
+        manager->Update();
+        timer.stop();
+
+        sys.DoStepDynamics(step_size);
+    }
+
+    double rays = (double)lidar->GetNumLaunches() * lidar->GetWidth() * lidar->GetHeight();
+    return rays / timer.GetTimeSeconds();
+}
+
+int main(int argc, char* argv[]) {
+    GetLog() << "Copyright (c) 2023 projectchrono.org\nChrono version: " << CHRONO_VERSION << "\n\n";
+
+    int max_threads = ChOMP::GetNumProcs();
+    for (int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        double rays_per_second = RunSpin(num_threads);
+        GetLog() << "threads: " << num_threads << "  rays/s: " << rays_per_second << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for running batches of independent HMMWV simulations with
+// ChVehicleBatchRunner, using an increasing number of worker threads.
+// Each scenario is a straight-line acceleration on rigid terrain with a
+// different target throttle.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <thread>
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleBatchRunner.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+class HmmwvAccScenario : public ChVehicleBatchRunner::Scenario {
+  public:
+    HmmwvAccScenario(double throttle) : m_throttle(throttle) {}
+
+    virtual void Initialize() override;
+    virtual ChSystem* GetSystem() override { return m_hmmwv->GetSystem(); }
+    virtual void Synchronize(double time) override;
+    virtual void Advance(double step) override;
+    virtual void Finalize() override;
+
+    double GetDistance() const { return m_distance; }
+
+  private:
+    double m_throttle;
+    double m_distance;
+    std::unique_ptr<HMMWV_Reduced> m_hmmwv;
+    std::unique_ptr<RigidTerrain> m_terrain;
+};
+
+void HmmwvAccScenario::Initialize() {
+    m_hmmwv = chrono_types::make_unique<HMMWV_Reduced>();
+    m_hmmwv->SetContactMethod(ChContactMethod::SMC);
+    m_hmmwv->SetInitPosition(ChCoordsys<>(ChVector<>(-100, 0, 0.7), QUNIT));
+    m_hmmwv->SetEngineType(EngineModelType::SIMPLE_MAP);
+    m_hmmwv->SetTransmissionType(TransmissionModelType::SIMPLE_MAP);
+    m_hmmwv->SetDriveType(DrivelineTypeWV::RWD);
+    m_hmmwv->SetTireType(TireModelType::TMEASY);
+    m_hmmwv->Initialize();
+
+    m_terrain = chrono_types::make_unique<RigidTerrain>(m_hmmwv->GetSystem());
+    auto patch_material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    patch_material->SetFriction(0.9f);
+    patch_material->SetYoungModulus(2e7f);
+    m_terrain->AddPatch(patch_material, CSYSNORM, 300, 20);
+    m_terrain->Initialize();
+}
+
+void HmmwvAccScenario::Synchronize(double time) {
+    DriverInputs driver_inputs = {0, std::min(time, 1.0) * m_throttle, 0, 0};
+    m_terrain->Synchronize(time);
+    m_hmmwv->Synchronize(time, driver_inputs, *m_terrain);
+}
+
+void HmmwvAccScenario::Advance(double step) {
+    m_terrain->Advance(step);
+    m_hmmwv->Advance(step);
+}
+
+void HmmwvAccScenario::Finalize() {
+    m_distance = m_hmmwv->GetVehicle().GetPos().x() + 100;
+    m_terrain.reset();
+    m_hmmwv.reset();
+}
+
+// =============================================================================
+
+#define NUM_SCENARIOS 16
+#define SIM_TIME 2.0
+#define STEP_SIZE 2e-3
+
+static void HmmwvBatch(benchmark::State& state) {
+    int num_workers = (int)state.range(0);
+
+    ChVehicleBatchRunner runner(num_workers);
+
+    for (auto _ : state) {
+        std::vector<std::shared_ptr<ChVehicleBatchRunner::Scenario>> scenarios;
+        for (int i = 0; i < NUM_SCENARIOS; i++)
+            scenarios.push_back(chrono_types::make_shared<HmmwvAccScenario>(0.5 + 0.5 * i / NUM_SCENARIOS));
+        auto results = runner.Run(scenarios, SIM_TIME, STEP_SIZE);
+
+        double wall_time = 0;
+        for (const auto& r : results) {
+            if (!r.success)
+                state.SkipWithError(r.message.c_str());
+            wall_time += r.wall_time;
+        }
+        state.counters["Scenario_avg"] = 1e3 * wall_time / NUM_SCENARIOS;
+    }
+
+    state.counters["Workers"] = runner.GetNumWorkers();
+    state.counters["Scenarios"] = NUM_SCENARIOS;
+}
+
+BENCHMARK(HmmwvBatch)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(std::max((int)std::thread::hardware_concurrency(), 1));
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,170 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the HACDv2 convex decomposition and the decomposition cache
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/collision/ChConvexDecomposition.h"
+#include "chrono/collision/ChConvexDecompositionCache.h"
+#include "chrono/core/ChGlobal.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+using namespace chrono::geometry;
+
+// Add a torus (with major axis along Z) to the given mesh.
+static void AddTorus(ChTriangleMeshConnected& mesh, const ChVector<>& center, int nu, int nv) {
+    int base = (int)mesh.m_vertices.size();
+    for (int i = 0; i < nu; i++) {
+        for (int j = 0; j < nv; j++) {
+            double u = CH_C_2PI * i / nu;
+            double v = CH_C_2PI * j / nv;
+            double r = 1 + 0.3 * std::cos(v);
+            mesh.m_vertices.push_back(center + ChVector<>(r * std::cos(u), r * std::sin(u), 0.3 * std::sin(v)));
+        }
+    }
+    for (int i = 0; i < nu; i++) {
+        for (int j = 0; j < nv; j++) {
+            int a = base + i * nv + j;
+            int b = base + ((i + 1) % nu) * nv + j;
+            int c = base + ((i + 1) % nu) * nv + (j + 1) % nv;
+            int d = base + i * nv + (j + 1) % nv;
+            mesh.m_face_v_indices.push_back(ChVector<int>(a, b, c));
+            mesh.m_face_v_indices.push_back(ChVector<int>(a, c, d));
+        }
+    }
+}
+
+// Mesh with two disconnected parts.
+static ChTriangleMeshConnected CreateMesh() {
+    ChTriangleMeshConnected mesh;
+    AddTorus(mesh, ChVector<>(0, 0, 0), 16, 8);
+    AddTorus(mesh, ChVector<>(3, 0, 0), 16, 8);
+    return mesh;
+}
+
+// Mesh with a single torus.
+static ChTriangleMeshConnected CreatePart(const ChVector<>& center) {
+    ChTriangleMeshConnected mesh;
+    AddTorus(mesh, center, 16, 8);
+    return mesh;
+}
+
+// Set the input and parameters of a decomposition.
+static void SetInput(ChConvexDecompositionHACDv2& decomposition, const ChTriangleMeshConnected& mesh, int num_threads) {
+    decomposition.Reset();
+    decomposition.AddTriangleMesh(mesh);
+    decomposition.SetParameters(512, 256, 64, 0.2f, 0.0f, 1e-9f);
+    decomposition.SetNumThreads(num_threads);
+}
+
+// Perform the decomposition and return all hull vertices.
+static std::vector<std::vector<ChVector<>>> Decompose(const ChTriangleMeshConnected& mesh, int num_threads) {
+    ChConvexDecompositionHACDv2 decomposition;
+    SetInput(decomposition, mesh, num_threads);
+    int num_hulls = decomposition.ComputeConvexDecomposition();
+    EXPECT_EQ(num_hulls, (int)decomposition.GetHullCount());
+
+    std::vector<std::vector<ChVector<>>> hulls(num_hulls);
+    for (int i = 0; i < num_hulls; i++) {
+        EXPECT_TRUE(decomposition.GetConvexHullResult(i, hulls[i]));
+        EXPECT_FALSE(hulls[i].empty());
+    }
+    EXPECT_FALSE(decomposition.GetConvexHullResult(num_hulls, hulls[0]));
+
+    return hulls;
+}
+
+static void CheckEqual(const std::vector<std::vector<ChVector<>>>& a, const std::vector<std::vector<ChVector<>>>& b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); i++) {
+        ASSERT_EQ(a[i].size(), b[i].size());
+        for (size_t j = 0; j < a[i].size(); j++)
+            ASSERT_TRUE(a[i][j] == b[i][j]);
+    }
+}
+
+TEST(ConvexDecomposition, parallel) {
+    auto mesh = CreateMesh();
+    auto hulls1 = Decompose(mesh, 1);
+    auto hulls2 = Decompose(mesh, 2);
+    ASSERT_FALSE(hulls1.empty());
+    ASSERT_FALSE(hulls2.empty());
+
+    // The parallel decomposition is deterministic
+    CheckEqual(hulls2, Decompose(mesh, 2));
+
+    // The parallel decomposition matches the sequential decomposition of each part, in order of the parts
+    auto hulls_A = Decompose(CreatePart(ChVector<>(0, 0, 0)), 1);
+    auto hulls_B = Decompose(CreatePart(ChVector<>(3, 0, 0)), 1);
+    ASSERT_FALSE(hulls_A.empty());
+    ASSERT_FALSE(hulls_B.empty());
+    hulls_A.insert(hulls_A.end(), hulls_B.begin(), hulls_B.end());
+    CheckEqual(hulls2, hulls_A);
+
+    // A mesh with a single part is decomposed as in the sequential case
+    auto part = CreatePart(ChVector<>(0, 0, 0));
+    CheckEqual(Decompose(part, 1), Decompose(part, 2));
+}
+
+TEST(ConvexDecomposition, memory_cache) {
+    auto mesh = CreateMesh();
+    auto hulls = Decompose(mesh, 1);
+
+    ChConvexDecompositionCache::Enable(true);
+    CheckEqual(hulls, Decompose(mesh, 1));
+    ASSERT_EQ(ChConvexDecompositionCache::GetNumEntries(), 1);
+    ASSERT_EQ(ChConvexDecompositionCache::GetNumHits(), 0);
+
+    CheckEqual(hulls, Decompose(mesh, 1));
+    ASSERT_EQ(ChConvexDecompositionCache::GetNumHits(), 1);
+
+    // Different parameters result in a different entry
+    Decompose(mesh, 2);
+    ASSERT_EQ(ChConvexDecompositionCache::GetNumEntries(), 2);
+    ASSERT_EQ(ChConvexDecompositionCache::GetNumHits(), 1);
+
+    ChConvexDecompositionCache::Enable(false);
+    ASSERT_EQ(ChConvexDecompositionCache::GetNumEntries(), 0);
+}
+
+TEST(ConvexDecomposition, disk_cache) {
+    auto mesh = CreateMesh();
+    auto hulls = Decompose(mesh, 1);
+
+    std::string dir = GetChronoOutputPath() + "UTEST_COLL_CONVEX_DECOMPOSITION";
+    filesystem::create_directory(filesystem::path(GetChronoOutputPath()));
+    ChConvexDecompositionCache::SetCacheDirectory(dir);
+    ChConvexDecompositionCache::Clear();
+
+    CheckEqual(hulls, Decompose(mesh, 1));
+    CheckEqual(hulls, Decompose(mesh, 1));
+    ASSERT_GE(ChConvexDecompositionCache::GetNumDiskHits(), 1);
+
+    // Remove the cache file written by the test
+    ChConvexDecompositionHACDv2 decomposition;
+    SetInput(decomposition, mesh, 1);
+    auto filename = ChConvexDecompositionCache::GetDiskFilename(decomposition.GetCacheKey());
+    ASSERT_TRUE(filesystem::path(filename).exists());
+    ASSERT_TRUE(filesystem::path(filename).remove_file());
+
+    ChConvexDecompositionCache::SetCacheDirectory("");
+}
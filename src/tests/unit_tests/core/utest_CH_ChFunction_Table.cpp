@@ -0,0 +1,262 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for ChFunction_Recorder and the table functions ChFunction_Table and
+// ChFunction_Table2D
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/motion_functions/ChFunction_Derive.h"
+#include "chrono/motion_functions/ChFunction_Mirror.h"
+#include "chrono/motion_functions/ChFunction_Operation.h"
+#include "chrono/motion_functions/ChFunction_Poly345.h"
+#include "chrono/motion_functions/ChFunction_Ramp.h"
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+#include "chrono/motion_functions/ChFunction_Repeat.h"
+#include "chrono/motion_functions/ChFunction_Sine.h"
+#include "chrono/motion_functions/ChFunction_Table.h"
+
+using namespace chrono;
+
+TEST(ChFunctionRecorderTest, insert_and_lookup) {
+    ChFunction_Recorder fun;
+    fun.AddPoint(2, 4);
+    fun.AddPoint(0, 0);
+    fun.AddPoint(3, 9);
+    fun.AddPoint(1, 1);
+    fun.AddPoint(2, 5);  // overwrite
+
+    ASSERT_EQ(fun.GetPoints().size(), 4);
+    for (size_t i = 1; i < fun.GetPoints().size(); i++)
+        ASSERT_LT(fun.GetPoints()[i - 1].x, fun.GetPoints()[i].x);
+
+    ASSERT_DOUBLE_EQ(fun.Get_y(-1), 0.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(4), 9.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(0.5), 0.5);
+    ASSERT_DOUBLE_EQ(fun.Get_y(2.5), 7.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(1.5), 3.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(2.0), 5.0);
+
+    // Random access and batched lookup
+    ChVectorDynamic<> x(6);
+    x << 2.75, 0.25, 1.75, -2.0, 1.25, 10.0;
+    ChVectorDynamic<> y;
+    fun.Get_y_batch(x, y);
+    ASSERT_EQ(y.size(), x.size());
+    for (int k = 0; k < x.size(); k++)
+        ASSERT_DOUBLE_EQ(y(k), fun.Get_y(x(k)));
+    ASSERT_DOUBLE_EQ(y(0), 8.0);
+    ASSERT_DOUBLE_EQ(y(2), 4.0);
+}
+
+TEST(ChFunctionTableTest, linear) {
+    std::vector<double> x = {0, 1, 3, 4};
+    std::vector<double> y = {0, 2, 0, 1};
+    ChFunction_Table fun(x, y);
+
+    ASSERT_FALSE(fun.IsUniform());
+    ASSERT_DOUBLE_EQ(fun.Get_y(-1), 0.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(5), 1.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(0.5), 1.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(2), 1.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y(3.5), 0.5);
+    ASSERT_DOUBLE_EQ(fun.Get_y_dx(2), -1.0);
+    ASSERT_DOUBLE_EQ(fun.Get_y_dxdx(2), 0.0);
+
+    // Same result as a recorder function with the same data
+    ChFunction_Recorder rec;
+    for (size_t i = 0; i < x.size(); i++)
+        rec.AddPoint(x[i], y[i]);
+    ChFunction_Table fun2(rec);
+    for (double t = -0.5; t < 4.5; t += 0.01) {
+        ASSERT_NEAR(fun.Get_y(t), rec.Get_y(t), 1e-14);
+        ASSERT_NEAR(fun2.Get_y(t), rec.Get_y(t), 1e-14);
+    }
+}
+
+TEST(ChFunctionTableTest, uniform) {
+    ChFunction_Sine sine(0, 0.5, 1);
+
+    ChFunction_Table fun;
+    fun.Sample(sine, 0, 2, 201);
+    ASSERT_TRUE(fun.IsUniform());
+    ASSERT_EQ(fun.GetNumPoints(), 201);
+
+    // Values at knots are reproduced
+    for (int i = 0; i < 201; i++)
+        ASSERT_NEAR(fun.Get_y(i * 0.01), sine.Get_y(i * 0.01), 1e-14);
+
+    // Uniform and non-uniform lookup give identical results
+    ChFunction_Table fun2(fun.GetX(), fun.GetY());
+    for (double t = 0.0005; t < 2; t += 0.0037)
+        ASSERT_DOUBLE_EQ(fun.Get_y(t), fun2.Get_y(t));
+
+    ChFunction_Table fun3;
+    fun3.SetupUniform(0, 0.01, fun.GetY());
+    ASSERT_TRUE(fun3.IsUniform());
+    for (double t = 0.0005; t < 2; t += 0.0037)
+        ASSERT_NEAR(fun.Get_y(t), fun3.Get_y(t), 1e-12);
+}
+
+TEST(ChFunctionTableTest, cubic) {
+    ChFunction_Sine sine(0, 0.5, 1);
+
+    ChFunction_Table lin;
+    ChFunction_Table cub;
+    lin.Sample(sine, 0, 2, 41, ChFunction_Table::Interpolation::LINEAR);
+    cub.Sample(sine, 0, 2, 41, ChFunction_Table::Interpolation::CUBIC);
+
+    double err_lin = 0;
+    double err_cub = 0;
+    for (double t = 0.1; t < 1.9; t += 0.001) {
+        err_lin = std::max(err_lin, std::abs(lin.Get_y(t) - sine.Get_y(t)));
+        err_cub = std::max(err_cub, std::abs(cub.Get_y(t) - sine.Get_y(t)));
+        ASSERT_NEAR(cub.Get_y_dx(t), sine.Get_y_dx(t), 1e-2);
+    }
+    ASSERT_LT(err_cub, 1e-4);
+    ASSERT_LT(err_cub, err_lin / 10);
+
+    // Interpolating spline: knots are reproduced and the function is C2
+    for (int i = 0; i < 41; i++)
+        ASSERT_NEAR(cub.Get_y(i * 0.05), sine.Get_y(i * 0.05), 1e-14);
+    double eps = 1e-9;
+    for (int i = 1; i < 40; i++) {
+        double t = i * 0.05;
+        ASSERT_NEAR(cub.Get_y_dx(t - eps), cub.Get_y_dx(t + eps), 1e-6);
+        ASSERT_NEAR(cub.Get_y_dxdx(t - eps), cub.Get_y_dxdx(t + eps), 1e-6);
+    }
+
+    // Batched evaluation
+    ChVectorDynamic<> x(5);
+    x << -1.0, 0.33, 1.0, 1.77, 3.0;
+    ChVectorDynamic<> y, yd, ydd;
+    cub.Get_y_batch(x, y, yd, ydd);
+    for (int k = 0; k < x.size(); k++) {
+        ASSERT_DOUBLE_EQ(y(k), cub.Get_y(x(k)));
+        ASSERT_DOUBLE_EQ(yd(k), cub.Get_y_dx(x(k)));
+        ASSERT_DOUBLE_EQ(ydd(k), cub.Get_y_dxdx(x(k)));
+    }
+}
+
+TEST(ChFunctionTableTest, errors) {
+    ChFunction_Table fun;
+    ASSERT_DOUBLE_EQ(fun.Get_y(1), 0.0);
+    ASSERT_THROW(fun.Setup(std::vector<double>{1}, std::vector<double>{1}), ChException);
+    ASSERT_THROW(fun.Setup(std::vector<double>{0, 1}, std::vector<double>{1}), ChException);
+    ASSERT_THROW(fun.Setup(std::vector<double>{0, 1, 1}, std::vector<double>{1, 2, 3}), ChException);
+}
+
+TEST(ChFunctionTableTest, approximate) {
+    // Composite function: mirror(sin(x) * (1 + 0.5 x)) + d/dx(poly345)
+    auto sine = chrono_types::make_shared<ChFunction_Sine>(0, 0.3, 1);
+    auto ramp = chrono_types::make_shared<ChFunction_Ramp>(1, 0.5);
+    auto prod = chrono_types::make_shared<ChFunction_Operation>();
+    prod->Set_fa(sine);
+    prod->Set_fb(ramp);
+    prod->Set_optype(ChFunction_Operation::ChOP_MUL);
+    auto mirror = chrono_types::make_shared<ChFunction_Mirror>();
+    mirror->Set_fa(prod);
+    mirror->Set_mirror_axis(3.0);
+    auto poly = chrono_types::make_shared<ChFunction_Poly345>(1.0, 6.0);
+    auto derive = chrono_types::make_shared<ChFunction_Derive>();
+    derive->Set_fa(poly);
+    ChFunction_Operation fun;
+    fun.Set_fa(mirror);
+    fun.Set_fb(derive);
+    fun.Set_optype(ChFunction_Operation::ChOP_ADD);
+
+    double tol = 1e-6;
+    ChFunction_Table table;
+    double err = table.Approximate(fun, 0, 6, tol);
+    ASSERT_LE(err, tol);
+    ASSERT_FALSE(table.IsUniform());
+    ASSERT_LT(table.GetNumPoints(), 10000);
+
+    // Check the actual error away from the check points
+    double max_err = 0;
+    for (double t = 0; t <= 6; t += 1.3e-4)
+        max_err = std::max(max_err, std::abs(table.Get_y(t) - fun.Get_y(t)));
+    ASSERT_LT(max_err, 2 * tol);
+
+    // A periodic triangle wave (with kinks) is refined near the kinks
+    auto tooth = chrono_types::make_shared<ChFunction_Mirror>();
+    tooth->Set_fa(chrono_types::make_shared<ChFunction_Ramp>(0, 1));
+    tooth->Set_mirror_axis(0.5);
+    auto wave = chrono_types::make_shared<ChFunction_Repeat>();
+    wave->Set_fa(tooth);
+    wave->Set_window_length(1.0);
+    wave->Set_window_phase(0.1);
+    ChFunction_Table tri;
+    ASSERT_LE(tri.Approximate(*wave, 0, 2, 1e-4), 1e-4);
+    ASSERT_NEAR(tri.Get_y(0.2), 0.3, 1e-4);
+    ASSERT_NEAR(tri.Get_y(1.7), 0.2, 1e-4);
+
+    // A discontinuous function cannot be approximated to the given tolerance; this is reported in the return value
+    auto saw = chrono_types::make_shared<ChFunction_Repeat>();
+    saw->Set_fa(chrono_types::make_shared<ChFunction_Ramp>(0, 1));
+    saw->Set_window_length(1.0);
+    saw->Set_window_phase(0.1);
+    ChFunction_Table step;
+    ASSERT_GT(step.Approximate(*saw, 0, 2, 1e-4, ChFunction_Table::Interpolation::LINEAR), 1e-4);
+    ASSERT_LT(step.GetNumPoints(), 1000);
+    ASSERT_NEAR(step.Get_y(0.5), 0.6, 1e-4);
+
+    // The point budget is respected
+    ChFunction_Table coarse;
+    double err_coarse = coarse.Approximate(fun, 0, 6, 1e-12, ChFunction_Table::Interpolation::CUBIC, 50);
+    ASSERT_LE(coarse.GetNumPoints(), 50);
+    ASSERT_GT(err_coarse, 1e-12);
+}
+
+TEST(ChFunctionTable2DTest, bilinear) {
+    // z = 1 + 2x + 3y + xy is reproduced exactly by bilinear interpolation
+    auto f = [](double x, double y) { return 1 + 2 * x + 3 * y + x * y; };
+
+    std::vector<double> xg = {0, 0.5, 1.5, 3};
+    std::vector<double> yg = {-1, 0, 1, 2, 3};
+    std::vector<double> zg;
+    for (auto xi : xg)
+        for (auto yj : yg)
+            zg.push_back(f(xi, yj));
+
+    ChFunction_Table2D fun(xg, yg, zg);
+    ASSERT_EQ(fun.GetNumPointsX(), 4);
+    ASSERT_EQ(fun.GetNumPointsY(), 5);
+
+    for (double x = 0; x <= 3; x += 0.13) {
+        for (double y = -1; y <= 3; y += 0.17) {
+            ASSERT_NEAR(fun.Get_z(x, y), f(x, y), 1e-12);
+            ASSERT_NEAR(fun.Get_z_dx(x, y), 2 + y, 1e-12);
+            ASSERT_NEAR(fun.Get_z_dy(x, y), 3 + x, 1e-12);
+        }
+    }
+
+    // Clamping outside the grid
+    ASSERT_NEAR(fun.Get_z(-1, -2), f(0, -1), 1e-12);
+    ASSERT_NEAR(fun.Get_z(4, 4), f(3, 3), 1e-12);
+    ASSERT_DOUBLE_EQ(fun.Get_z_dx(4, 0), 0.0);
+
+    // Batched evaluation
+    ChVectorDynamic<> x(3), y(3), z;
+    x << 0.2, 1.7, 2.9;
+    y << 2.5, -0.3, 0.0;
+    fun.Get_z_batch(x, y, z);
+    for (int k = 0; k < 3; k++)
+        ASSERT_NEAR(z(k), f(x(k), y(k)), 1e-12);
+}
@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the preconditioners of the iterative linear solvers.
+// A saddle-point problem with coupled stiffness blocks and bilateral constraints
+// is solved with GMRES, BiCGSTAB, and MINRES using each built-in preconditioner,
+// and the solution is compared against the sparse LU direct solver.
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "chrono/solver/ChConstraintTwoGeneric.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class PreconditionerTest : public ::testing::TestWithParam<ChPreconditionerLS::Type> {
+  protected:
+    PreconditionerTest();
+    ~PreconditionerTest();
+
+    ChSystemDescriptor sysd;
+    std::vector<ChVariablesGeneric*> variables;
+    std::vector<ChKblockGeneric*> kblocks;
+    std::vector<ChConstraintTwoGeneric*> constraints;
+    ChVectorDynamic<> x_ref;
+};
+
+PreconditionerTest::PreconditionerTest() {
+    const int num_vars = 40;
+
+    sysd.BeginInsertion();
+
+    for (int i = 0; i < num_vars; i++) {
+        auto var = new ChVariablesGeneric(3);
+        ChMatrixDynamic<> M = (1.0 + i % 5) * ChMatrixDynamic<>::Identity(3, 3);
+        M(0, 1) = M(1, 0) = 0.3;
+        var->GetMass() = M;
+        var->GetInvMass() = M.inverse();
+        var->Get_fb() = ChVectorDynamic<>::Constant(3, std::sin(1.0 * i));
+        variables.push_back(var);
+        sysd.InsertVariables(var);
+    }
+
+    for (int i = 0; i + 1 < num_vars; i++) {
+        auto kblock = new ChKblockGeneric(variables[i], variables[i + 1]);
+        ChMatrixDynamic<> A(6, 6);
+        for (int r = 0; r < 6; r++)
+            for (int c = 0; c < 6; c++)
+                A(r, c) = std::cos(1.0 * (i + 7 * r + 3 * c));
+        kblock->Get_K() = 100 * A * A.transpose();
+        kblocks.push_back(kblock);
+        sysd.InsertKblock(kblock);
+    }
+
+    for (int i = 0; i + 1 < num_vars; i += 3) {
+        auto constraint = new ChConstraintTwoGeneric(variables[i], variables[i + 1]);
+        for (int k = 0; k < 3; k++) {
+            constraint->Get_Cq_a()(k) = std::sin(1.0 * (i + k));
+            constraint->Get_Cq_b()(k) = std::cos(1.0 * (i - k));
+        }
+        constraint->Set_b_i(0.1 * i);
+        constraints.push_back(constraint);
+        sysd.InsertConstraint(constraint);
+    }
+
+    sysd.EndInsertion();
+
+    // Reference solution
+    ChSolverSparseLU direct;
+    direct.Setup(sysd);
+    direct.Solve(sysd);
+    sysd.FromUnknownsToVector(x_ref);
+}
+
+PreconditionerTest::~PreconditionerTest() {
+    for (auto c : constraints)
+        delete c;
+    for (auto k : kblocks)
+        delete k;
+    for (auto v : variables)
+        delete v;
+}
+
+static void Check(ChIterativeSolverLS& solver,
+                  ChPreconditionerLS::Type type,
+                  ChSystemDescriptor& sysd,
+                  const ChVectorDynamic<>& x_ref) {
+    solver.SetPreconditionerType(type);
+    solver.SetMaxIterations(10000);
+    solver.SetTolerance(1e-12);
+    ASSERT_EQ(solver.GetPreconditionerType(), type);
+    ASSERT_TRUE(solver.Setup(sysd));
+    solver.Solve(sysd);
+
+    ChVectorDynamic<> x;
+    sysd.FromUnknownsToVector(x);
+    ASSERT_LT((x - x_ref).norm(), 1e-6 * x_ref.norm());
+}
+
+TEST_P(PreconditionerTest, GMRES) {
+    ChSolverGMRES solver;
+    Check(solver, GetParam(), sysd, x_ref);
+}
+
+TEST_P(PreconditionerTest, BiCGSTAB) {
+    ChSolverBiCGSTAB solver;
+    Check(solver, GetParam(), sysd, x_ref);
+}
+
+TEST_P(PreconditionerTest, MINRES) {
+    // The ILUT preconditioner is not symmetric and cannot be used with MINRES
+    if (GetParam() == ChPreconditionerLS::Type::ILUT)
+        return;
+    ChSolverMINRES solver;
+    Check(solver, GetParam(), sysd, x_ref);
+}
+
+INSTANTIATE_TEST_SUITE_P(Chrono,
+                         PreconditionerTest,
+                         ::testing::Values(ChPreconditionerLS::Type::DIAGONAL,
+                                           ChPreconditionerLS::Type::BLOCK_JACOBI,
+                                           ChPreconditionerLS::Type::ILUT,
+                                           ChPreconditionerLS::Type::SCHUR));
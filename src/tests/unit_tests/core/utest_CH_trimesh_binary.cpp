@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the Chrono binary mesh format and triangle mesh connectivity
+// =============================================================================
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+// Create a regular grid mesh with n x n cells (two triangles per cell), with normals and UV coordinates.
+static ChTriangleMeshConnected CreateGrid(int n) {
+    ChTriangleMeshConnected mesh;
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            mesh.m_vertices.push_back(ChVector<>(i, j, 0.1 * i * j));
+            mesh.m_UV.push_back(ChVector2<>(i / (double)n, j / (double)n));
+        }
+    }
+    mesh.m_normals.push_back(ChVector<>(0, 0, 1));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int a = i * (n + 1) + j;
+            int b = a + 1;
+            int c = a + n + 1;
+            int d = c + 1;
+            mesh.m_face_v_indices.push_back(ChVector<int>(a, b, d));
+            mesh.m_face_v_indices.push_back(ChVector<int>(a, d, c));
+            mesh.m_face_n_indices.push_back(ChVector<int>(0, 0, 0));
+            mesh.m_face_n_indices.push_back(ChVector<int>(0, 0, 0));
+            mesh.m_face_uv_indices.push_back(ChVector<int>(a, b, d));
+            mesh.m_face_uv_indices.push_back(ChVector<int>(a, d, c));
+        }
+    }
+    return mesh;
+}
+
+TEST(ChTriangleMeshConnected, binary_format) {
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(GetChronoOutputPath())));
+    std::string filename = GetChronoOutputPath() + "utest_CH_trimesh.chmesh";
+
+    auto mesh = CreateGrid(20);
+    ASSERT_TRUE(mesh.WriteBinaryMesh(filename));
+    ASSERT_TRUE(ChTriangleMeshConnected::IsBinaryMeshFile(filename));
+
+    auto loaded = ChTriangleMeshConnected::CreateFromFile(filename, true, true);
+    ASSERT_TRUE(loaded != nullptr);
+    ASSERT_EQ(loaded->m_vertices, mesh.m_vertices);
+    ASSERT_EQ(loaded->m_normals, mesh.m_normals);
+    ASSERT_EQ(loaded->m_UV, mesh.m_UV);
+    ASSERT_EQ(loaded->m_face_v_indices, mesh.m_face_v_indices);
+    ASSERT_EQ(loaded->m_face_n_indices, mesh.m_face_n_indices);
+    ASSERT_EQ(loaded->m_face_uv_indices, mesh.m_face_uv_indices);
+
+    // Optional data is skipped if not requested
+    auto coarse = ChTriangleMeshConnected::CreateFromBinaryFile(filename, false, false);
+    ASSERT_TRUE(coarse != nullptr);
+    ASSERT_EQ(coarse->m_vertices, mesh.m_vertices);
+    ASSERT_TRUE(coarse->m_normals.empty());
+    ASSERT_TRUE(coarse->m_face_uv_indices.empty());
+}
+
+TEST(ChTriangleMeshConnected, connectivity) {
+    auto mesh = CreateGrid(3);
+
+    std::vector<std::array<int, 4>> tri_map;
+    ASSERT_FALSE(mesh.ComputeNeighbouringTriangleMap(tri_map));
+    ASSERT_EQ(tri_map.size(), mesh.m_face_v_indices.size());
+
+    // First cell: triangle 0 (a,b,d) and triangle 1 (a,d,c) share edge (a,d)
+    ASSERT_EQ(tri_map[0][0], 0);
+    ASSERT_EQ(tri_map[0][1], -1);
+    ASSERT_EQ(tri_map[0][3], 1);
+    ASSERT_EQ(tri_map[1][1], 0);
+
+    std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
+    mesh.ComputeWingedEdges(winged_edges, true);
+    // A grid with n x n cells has 3n^2 + 2n edges
+    ASSERT_EQ(winged_edges.size(), 3 * 9 + 2 * 3);
+    ASSERT_EQ(winged_edges[std::make_pair(0, 5)], std::make_pair(0, 1));
+    ASSERT_EQ(winged_edges[std::make_pair(0, 1)], std::make_pair(0, -1));
+
+    winged_edges.clear();
+    mesh.ComputeWingedEdges(winged_edges, false);
+    // Interior edges only
+    ASSERT_EQ(winged_edges.size(), 3 * 9 + 2 * 3 - 4 * 3);
+}
@@ -0,0 +1,195 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for matrix-free implicit integration of FEA meshes.
+//
+// A block of corotational hexahedral elements, clamped at its base, deforms
+// under gravity and is integrated with HHT. The node positions obtained with
+// matrix-free K and R products (see ChSystem::EnableMatrixFreeKRM) are compared
+// with those obtained with the assembled system matrix.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+enum class SolverMode { SPARSE_LU, GMRES_ASSEMBLED, GMRES_MATRIX_FREE, MINRES_MATRIX_FREE };
+
+const int num_steps = 50;
+const double step_size = 1e-3;
+
+class MatrixFreeTest : public ::testing::Test {
+  protected:
+    // Integrate the block with the specified solver and return the final node positions.
+    std::vector<ChVector<>> Simulate(SolverMode mode);
+
+    // Number of K blocks in the system descriptor after the last step.
+    size_t m_num_kblocks;
+};
+
+std::vector<ChVector<>> MatrixFreeTest::Simulate(SolverMode mode) {
+    ChSystemSMC sys;
+    sys.Set_G_acc(ChVector<>(5, -9.8, 0));
+
+    switch (mode) {
+        case SolverMode::SPARSE_LU: {
+            auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+            solver->SetVerbose(false);
+            sys.SetSolver(solver);
+            break;
+        }
+        case SolverMode::GMRES_ASSEMBLED:
+        case SolverMode::GMRES_MATRIX_FREE: {
+            auto solver = chrono_types::make_shared<ChSolverGMRES>();
+            solver->SetMaxIterations(500);
+            solver->SetTolerance(1e-12);
+            solver->EnableDiagonalPreconditioner(true);
+            solver->SetVerbose(false);
+            sys.SetSolver(solver);
+            sys.EnableMatrixFreeKRM(mode == SolverMode::GMRES_MATRIX_FREE);
+            break;
+        }
+        case SolverMode::MINRES_MATRIX_FREE: {
+            auto solver = chrono_types::make_shared<ChSolverMINRES>();
+            solver->SetMaxIterations(500);
+            solver->SetTolerance(1e-12);
+            solver->EnableDiagonalPreconditioner(true);
+            solver->SetVerbose(false);
+            sys.SetSolver(solver);
+            sys.EnableMatrixFreeKRM(true);
+            break;
+        }
+    }
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-8);
+    integrator->SetMode(ChTimestepperHHT::POSITION);
+    integrator->SetScaling(true);
+    integrator->SetVerbose(false);
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    // Block of 2 x 8 x 2 hexahedral elements, with nodes at the base fixed
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    int nx = 2;
+    int ny = 8;
+    int nz = 2;
+    double size = 0.05;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes((nx + 1) * (ny + 1) * (nz + 1));
+    auto index = [&](int i, int j, int k) { return (j * (nz + 1) + k) * (nx + 1) + i; };
+
+    for (int j = 0; j <= ny; j++) {
+        for (int k = 0; k <= nz; k++) {
+            for (int i = 0; i <= nx; i++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(i * size, j * size, k * size));
+                node->SetFixed(j == 0);
+                mesh->AddNode(node);
+                nodes[index(i, j, k)] = node;
+            }
+        }
+    }
+
+    for (int j = 0; j < ny; j++) {
+        for (int k = 0; k < nz; k++) {
+            for (int i = 0; i < nx; i++) {
+                auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+                element->SetNodes(nodes[index(i, j, k)], nodes[index(i, j, k + 1)], nodes[index(i + 1, j, k + 1)],
+                                  nodes[index(i + 1, j, k)], nodes[index(i, j + 1, k)], nodes[index(i, j + 1, k + 1)],
+                                  nodes[index(i + 1, j + 1, k + 1)], nodes[index(i + 1, j + 1, k)]);
+                element->SetMaterial(material);
+                mesh->AddElement(element);
+            }
+        }
+    }
+
+    for (int n = 0; n < num_steps; n++)
+        sys.DoStepDynamics(step_size);
+
+    m_num_kblocks = sys.GetSystemDescriptor()->GetKblocksList().size();
+
+    std::vector<ChVector<>> pos;
+    for (auto node : nodes)
+        pos.push_back(node->GetPos());
+    return pos;
+}
+
+// Largest distance between corresponding nodes
+static double MaxDistance(const std::vector<ChVector<>>& a, const std::vector<ChVector<>>& b) {
+    double dist = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        dist = std::max(dist, (a[i] - b[i]).Length());
+    return dist;
+}
+
+// Largest node displacement from the initial (undeformed) configuration
+static double MaxDisplacement(const std::vector<ChVector<>>& pos) {
+    double size = 0.05;
+    double disp = 0;
+    for (int j = 0; j <= 8; j++) {
+        for (int k = 0; k <= 2; k++) {
+            for (int i = 0; i <= 2; i++) {
+                ChVector<> init(i * size, j * size, k * size);
+                disp = std::max(disp, (pos[(j * 3 + k) * 3 + i] - init).Length());
+            }
+        }
+    }
+    return disp;
+}
+
+TEST_F(MatrixFreeTest, gmres) {
+    auto pos_ref = Simulate(SolverMode::SPARSE_LU);
+    ASSERT_GT(m_num_kblocks, 0u);
+
+    auto pos_asm = Simulate(SolverMode::GMRES_ASSEMBLED);
+    ASSERT_GT(m_num_kblocks, 0u);
+
+    auto pos_mf = Simulate(SolverMode::GMRES_MATRIX_FREE);
+    ASSERT_EQ(m_num_kblocks, 0u);  // K blocks are not stored in matrix-free mode
+
+    // the block must have deformed, so that the comparison is meaningful
+    double disp = MaxDisplacement(pos_ref);
+    ASSERT_GT(disp, 1e-5);
+
+    EXPECT_LT(MaxDistance(pos_asm, pos_ref), 1e-6 * disp);
+    EXPECT_LT(MaxDistance(pos_mf, pos_ref), 1e-5 * disp);
+}
+
+TEST_F(MatrixFreeTest, minres_assembled) {
+    // matrix-free products are not used with MINRES, which falls back to the assembled matrix
+    auto pos_ref = Simulate(SolverMode::SPARSE_LU);
+    auto pos = Simulate(SolverMode::MINRES_MATRIX_FREE);
+    ASSERT_GT(m_num_kblocks, 0u);
+
+    double disp = MaxDisplacement(pos_ref);
+    EXPECT_LT(MaxDistance(pos, pos_ref), 1e-6 * disp);
+}
@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the in-memory and on-disk caches of ChParserMeshCache.
+// Checks cache hits, misses after the source mesh file changes, and recovery
+// from corrupted or truncated cache files.
+//
+// =============================================================================
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/utils/ChUtilsHash.h"
+
+#include "chrono_parsers/ChParserMeshCache.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::parsers;
+
+// Write a tetrahedron with the given apex height as a Wavefront OBJ file; return the file contents.
+static std::string WriteMesh(const std::string& filename, double height) {
+    std::ostringstream oss;
+    oss << "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 0 0 " << height << "\n";
+    oss << "f 1 3 2\nf 1 2 4\nf 2 3 4\nf 3 1 4\n";
+    std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+    ofs << oss.str();
+    return oss.str();
+}
+
+// Name of the on-disk cache file for data of the given type created from a mesh file with the given contents.
+static std::string CacheFilename(const std::string& dir, const std::string& type, const std::string& contents) {
+    return dir + "/" + utils::MakeContentKey(type, contents.data(), contents.size()) + ".bin";
+}
+
+// Return the size of the specified file.
+static size_t FileSize(const std::string& filename) {
+    std::ifstream ifs(filename, std::ios::binary | std::ios::ate);
+    return (size_t)ifs.tellg();
+}
+
+// Keep only the first 'size' bytes of the specified file.
+static void Truncate(const std::string& filename, size_t size) {
+    std::string data(size, 0);
+    {
+        std::ifstream ifs(filename, std::ios::binary);
+        ifs.read(&data[0], size);
+    }
+    std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+    ofs.write(data.data(), size);
+}
+
+// Overwrite the byte at the specified offset from the end of the file.
+static void Corrupt(const std::string& filename, size_t offset) {
+    std::fstream fs(filename, std::ios::binary | std::ios::in | std::ios::out);
+    fs.seekp(FileSize(filename) - offset);
+    fs.put('#');
+}
+
+class MeshCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        filesystem::create_directory(filesystem::path(GetChronoOutputPath()));
+        out_dir = GetChronoOutputPath() + "UTEST_PARSER_MESH_CACHE";
+        filesystem::create_directory(filesystem::path(out_dir));
+        cache_dir = out_dir + "/cache";
+        mesh_file = out_dir + "/tetra.obj";
+    }
+
+    void TearDown() override {
+        ChParserMeshCache::Enable(false);
+        ChParserMeshCache::SetCacheDirectory("");
+        for (const auto& filename : written)
+            filesystem::path(filename).remove_file();
+        filesystem::path(mesh_file).remove_file();
+    }
+
+    std::string out_dir;
+    std::string cache_dir;
+    std::string mesh_file;
+    std::vector<std::string> written;  // cache files to be removed
+};
+
+TEST_F(MeshCacheTest, memory) {
+    auto contents1 = WriteMesh(mesh_file, 1.0);
+    ChParserMeshCache::Enable(true);
+    ChParserMeshCache::Clear();
+
+    // Hit
+    auto mesh1 = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    ASSERT_TRUE(mesh1);
+    ASSERT_EQ(mesh1->getNumVertices(), 4);
+    ASSERT_EQ(ChParserMeshCache::GetNumHits(), 0);
+    ASSERT_EQ(ChParserMeshCache::GetTriangleMesh(mesh_file), mesh1);
+    ASSERT_EQ(ChParserMeshCache::GetNumHits(), 1);
+
+    // Miss after the source changes
+    WriteMesh(mesh_file, 2.0);
+    auto mesh2 = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    ASSERT_TRUE(mesh2);
+    ASSERT_NE(mesh2, mesh1);
+    ASSERT_EQ(mesh2->m_vertices[3].z(), 2.0);
+    ASSERT_EQ(mesh1->m_vertices[3].z(), 1.0);
+    ASSERT_EQ(ChParserMeshCache::GetNumHits(), 1);
+    ASSERT_EQ(ChParserMeshCache::GetNumEntries(), 2);
+
+    // Hit on the original contents
+    WriteMesh(mesh_file, 1.0);
+    ASSERT_EQ(ChParserMeshCache::GetTriangleMesh(mesh_file), mesh1);
+    ASSERT_EQ(ChParserMeshCache::GetNumHits(), 2);
+}
+
+TEST_F(MeshCacheTest, disk) {
+    auto contents1 = WriteMesh(mesh_file, 1.0);
+    ChParserMeshCache::SetCacheDirectory(cache_dir);
+    ChParserMeshCache::Clear();
+
+    auto mesh_bin = CacheFilename(cache_dir, "TRIMESHN", contents1);
+    auto hull_bin = CacheFilename(cache_dir, "HULL", contents1);
+    written.push_back(mesh_bin);
+    written.push_back(hull_bin);
+
+    // Miss, then hit
+    auto mesh = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    auto hull = ChParserMeshCache::GetConvexHull(mesh_file);
+    ASSERT_TRUE(mesh);
+    ASSERT_TRUE(hull);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 0);
+    ASSERT_TRUE(filesystem::path(mesh_bin).exists());
+    ASSERT_TRUE(filesystem::path(hull_bin).exists());
+
+    auto mesh_d = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    auto hull_d = ChParserMeshCache::GetConvexHull(mesh_file);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 2);
+    ASSERT_EQ(mesh_d->m_vertices, mesh->m_vertices);
+    ASSERT_EQ(mesh_d->m_face_v_indices, mesh->m_face_v_indices);
+    ASSERT_EQ(*hull_d, *hull);
+
+    // Miss after the source changes
+    auto contents2 = WriteMesh(mesh_file, 2.0);
+    written.push_back(CacheFilename(cache_dir, "TRIMESHN", contents2));
+    auto mesh2 = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 2);
+    ASSERT_EQ(mesh2->m_vertices[3].z(), 2.0);
+
+    // A cache file recording a different source is ignored
+    WriteMesh(mesh_file, 1.0);
+    Corrupt(mesh_bin, 20);  // digest of the source mesh file (in the trailer)
+    Corrupt(hull_bin, FileSize(hull_bin) - 20);  // digest of the source mesh file (in the header)
+    mesh_d = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    hull_d = ChParserMeshCache::GetConvexHull(mesh_file);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 2);
+    ASSERT_EQ(mesh_d->m_vertices, mesh->m_vertices);
+    ASSERT_EQ(*hull_d, *hull);
+
+    // The cache files were rewritten
+    ChParserMeshCache::GetTriangleMesh(mesh_file);
+    ChParserMeshCache::GetConvexHull(mesh_file);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 4);
+
+    // Truncated cache files are ignored
+    Truncate(mesh_bin, FileSize(mesh_bin) / 2);
+    Truncate(hull_bin, FileSize(hull_bin) - 8);
+    mesh_d = ChParserMeshCache::GetTriangleMesh(mesh_file);
+    hull_d = ChParserMeshCache::GetConvexHull(mesh_file);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 4);
+    ASSERT_EQ(mesh_d->m_vertices, mesh->m_vertices);
+    ASSERT_EQ(*hull_d, *hull);
+
+    ChParserMeshCache::GetTriangleMesh(mesh_file);
+    ChParserMeshCache::GetConvexHull(mesh_file);
+    ASSERT_EQ(ChParserMeshCache::GetNumDiskHits(), 6);
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for forking the state of a system into concurrently advanced branches.
+// A branch with unchanged inputs must reproduce the lead simulation exactly.
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemFork.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+using namespace chrono;
+
+// Row of boxes sliding on the ground into each other (SMC contact).
+// Body 0 is the ground and body 1 is the box pushed by the branch inputs, so that the branch inputs change the
+// outcome of the subsequent collisions.
+static std::shared_ptr<ChSystemSMC> CreateSystem() {
+    auto sys = chrono_types::make_shared<ChSystemSMC>();
+    sys->Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys->SetNumThreads(1);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.2f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(6, 0.2, 2, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, -0.1, 0));
+    ground->SetBodyFixed(true);
+    sys->AddBody(ground);
+
+    for (int i = 0; i < 3; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, true, true, mat);
+        box->SetPos(ChVector<>(-1.0 + 0.5 * i, 0.1 + 0.05 * i, 0));
+        box->SetPos_dt(ChVector<>(1.0 - i, 0, 0));
+        sys->AddBody(box);
+    }
+
+    return sys;
+}
+
+// Collect the positions of all bodies in the given system.
+static std::vector<double> GetPositions(const ChSystem& sys) {
+    std::vector<double> pos;
+    for (const auto& body : sys.Get_bodylist())
+        pos.insert(pos.end(), {body->GetPos().x(), body->GetPos().y(), body->GetPos().z()});
+    return pos;
+}
+
+// Branch inputs: horizontal force on the first box, proportional to the branch index.
+class PushBox : public ChSystemFork::BranchCallback {
+  public:
+    virtual void OnStep(int branch, ChSystem& sys, double step) override {
+        auto box = sys.Get_bodylist()[1];
+        box->Empty_forces_accumulators();
+        box->Accumulate_force(ChVector<>(10.0 * branch, 0, 0), box->GetPos(), false);
+    }
+};
+
+TEST(ChSystemFork, branches) {
+    int num_branches = 4;
+    double step = 1e-3;
+
+    auto lead = CreateSystem();
+    for (int i = 0; i < 200; i++)
+        lead->DoStepDynamics(step);
+
+    ChSystemFork fork;
+    fork.SetNumThreads(2);
+    for (int i = 0; i < num_branches; i++)
+        fork.AddBranch(CreateSystem());
+    fork.RegisterBranchCallback(chrono_types::make_shared<PushBox>());
+    ASSERT_EQ(fork.GetNumBranches(), num_branches);
+
+    fork.Fork(*lead);
+    for (int i = 0; i < num_branches; i++)
+        ASSERT_EQ(GetPositions(*fork.GetBranch(i)), GetPositions(*lead));
+
+    // Advance the lead (no inputs) and all branches
+    for (int i = 0; i < 300; i++)
+        lead->DoStepDynamics(step);
+    fork.Advance(300 * step, step);
+
+    // Branch 0 (no inputs) reproduces the lead simulation, all other branches differ
+    ASSERT_EQ(fork.GetBranch(0)->GetChTime(), lead->GetChTime());
+    ASSERT_EQ(GetPositions(*fork.GetBranch(0)), GetPositions(*lead));
+    std::vector<std::vector<double>> positions;
+    for (int i = 0; i < num_branches; i++) {
+        positions.push_back(GetPositions(*fork.GetBranch(i)));
+        if (i > 0) {
+            ASSERT_NE(positions[i], positions[0]);
+        }
+    }
+
+    // Re-run all branches from the fork state
+    fork.Reset();
+    fork.Advance(300 * step, step);
+    for (int i = 0; i < num_branches; i++)
+        ASSERT_EQ(GetPositions(*fork.GetBranch(i)), positions[i]);
+}
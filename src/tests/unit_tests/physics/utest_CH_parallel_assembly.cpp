@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the parallel traversal of assembly items.
+// A chain of bodies connected with spring-damper elements (so that each body
+// receives forces from several links) is simulated with sequential and with
+// parallel traversal of the assembly lists; the results must be identical (up
+// to round-off in the reduction of link forces).
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/physics/ChShaftsTorsionSpring.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+class ParallelAssemblyTest : public ::testing::TestWithParam<int> {
+  protected:
+    // Create a chain of bodies and a chain of shafts, then simulate for the specified number of steps
+    static void Simulate(ChSystem& sys, int num_steps);
+
+    static const int num_items = 200;
+};
+
+void ParallelAssemblyTest::Simulate(ChSystem& sys, int num_steps) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys.SetSolverType(ChSolver::Type::MINRES);
+    sys.SetSolverMaxIterations(200);
+    sys.SetSolverForceTolerance(1e-12);
+
+    std::shared_ptr<ChBody> prev_body;
+    std::shared_ptr<ChShaft> prev_shaft;
+    for (int i = 0; i < num_items; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>(0.1 * i, 0, 0));
+        body->SetMass(1 + 0.01 * i);
+        body->SetBodyFixed(i == 0);
+        sys.AddBody(body);
+
+        auto shaft = chrono_types::make_shared<ChShaft>();
+        shaft->SetInertia(1 + 0.01 * i);
+        shaft->SetShaftFixed(i == 0);
+        shaft->SetAppliedTorque(0.1 * i);
+        sys.AddShaft(shaft);
+
+        if (i > 0) {
+            auto spring = chrono_types::make_shared<ChLinkTSDA>();
+            spring->Initialize(prev_body, body, false, prev_body->GetPos(), body->GetPos());
+            spring->SetSpringCoefficient(1e4);
+            spring->SetDampingCoefficient(10);
+            sys.AddLink(spring);
+
+            auto torsion = chrono_types::make_shared<ChShaftsTorsionSpring>();
+            torsion->Initialize(prev_shaft, shaft);
+            torsion->SetTorsionalStiffness(1e3);
+            torsion->SetTorsionalDamping(1);
+            sys.Add(torsion);
+        }
+
+        prev_body = body;
+        prev_shaft = shaft;
+    }
+
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(1e-3);
+}
+
+TEST_P(ParallelAssemblyTest, compare) {
+    int num_threads = GetParam();
+
+    ChSystemNSC sys_seq;
+    sys_seq.SetNumThreads(num_threads);
+    Simulate(sys_seq, 100);
+
+    ChSystemNSC sys_par;
+    sys_par.SetNumThreads(num_threads);
+    sys_par.EnableParallelTraversal(true, 8);
+    ASSERT_TRUE(sys_par.GetAssembly().IsParallelTraversalEnabled());
+    Simulate(sys_par, 100);
+
+    const auto& bodies_seq = sys_seq.Get_bodylist();
+    const auto& bodies_par = sys_par.Get_bodylist();
+    ASSERT_EQ(bodies_seq.size(), bodies_par.size());
+    for (size_t i = 0; i < bodies_seq.size(); i++) {
+        ASSERT_NEAR((bodies_seq[i]->GetPos() - bodies_par[i]->GetPos()).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((bodies_seq[i]->GetPos_dt() - bodies_par[i]->GetPos_dt()).Length(), 0.0, 1e-8);
+    }
+
+    const auto& shafts_seq = sys_seq.Get_shaftlist();
+    const auto& shafts_par = sys_par.Get_shaftlist();
+    ASSERT_EQ(shafts_seq.size(), shafts_par.size());
+    for (size_t i = 0; i < shafts_seq.size(); i++) {
+        ASSERT_NEAR(shafts_seq[i]->GetPos(), shafts_par[i]->GetPos(), 1e-10);
+        ASSERT_NEAR(shafts_seq[i]->GetPos_dt(), shafts_par[i]->GetPos_dt(), 1e-8);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Chrono, ParallelAssemblyTest, ::testing::Values(1, 2, 4));
@@ -0,0 +1,174 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for system state snapshots.
+// A simulation restored from a snapshot (in the same system or in an identical
+// one) must reproduce the original simulation exactly.
+//
+// =============================================================================
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChSystemSnapshot.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+
+// Double pendulum and a box falling on the ground (SMC contact).
+static std::unique_ptr<ChSystemSMC> CreateSystem(bool hht) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    if (hht) {
+        sys->SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+        sys->SetTimestepperType(ChTimestepper::Type::HHT);
+        auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys->GetTimestepper());
+        integrator->SetAlpha(-0.2);
+        integrator->SetStepControl(true);
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, -1, 0));
+    ground->SetBodyFixed(true);
+    sys->AddBody(ground);
+
+    auto link1 = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    link1->SetPos(ChVector<>(0.5, 1, 0));
+    sys->AddBody(link1);
+
+    auto link2 = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    link2->SetPos(ChVector<>(1.5, 1, 0));
+    sys->AddBody(link2);
+
+    auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev1->Initialize(ground, link1, ChCoordsys<>(ChVector<>(0, 1, 0)));
+    sys->AddLink(rev1);
+
+    auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev2->Initialize(link1, link2, ChCoordsys<>(ChVector<>(1, 1, 0)));
+    sys->AddLink(rev2);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, true, true, mat);
+    box->SetPos(ChVector<>(-1, -0.7, 0));
+    box->SetRot(Q_from_AngZ(0.3));
+    sys->AddBody(box);
+
+    return sys;
+}
+
+// Simulate for the specified number of steps and collect the body states.
+static std::vector<double> Simulate(ChSystem& sys, int num_steps) {
+    std::vector<double> states;
+    for (int i = 0; i < num_steps; i++) {
+        sys.DoStepDynamics(1e-3);
+        for (const auto& body : sys.Get_bodylist()) {
+            auto& pos = body->GetPos();
+            auto& vel = body->GetPos_dt();
+            states.insert(states.end(), {pos.x(), pos.y(), pos.z(), vel.x(), vel.y(), vel.z()});
+        }
+    }
+    states.push_back(sys.GetChTime());
+    return states;
+}
+
+class SnapshotTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(SnapshotTest, rollback) {
+    auto sys = CreateSystem(GetParam());
+    Simulate(*sys, 200);
+
+    ChSystemSnapshot snapshot;
+    snapshot.Save(*sys);
+    ASSERT_FALSE(snapshot.IsEmpty());
+    ASSERT_DOUBLE_EQ(snapshot.GetTime(), sys->GetChTime());
+
+    auto states1 = Simulate(*sys, 300);
+    snapshot.Restore(*sys);
+    ASSERT_EQ(sys->GetChTime(), snapshot.GetTime());
+    auto states2 = Simulate(*sys, 300);
+
+    ASSERT_EQ(states1, states2);
+}
+
+TEST_P(SnapshotTest, copy) {
+    auto sys1 = CreateSystem(GetParam());
+    auto sys2 = CreateSystem(GetParam());
+    Simulate(*sys1, 200);
+
+    ChSystemSnapshot snapshot;
+    snapshot.Save(*sys1);
+    snapshot.Restore(*sys2);
+
+    auto states1 = Simulate(*sys1, 300);
+    auto states2 = Simulate(*sys2, 300);
+
+    ASSERT_EQ(states1, states2);
+}
+
+TEST_P(SnapshotTest, file) {
+    auto sys1 = CreateSystem(GetParam());
+    auto sys2 = CreateSystem(GetParam());
+    Simulate(*sys1, 200);
+
+    std::string dir = GetChronoOutputPath() + "UTEST_CH_SNAPSHOT";
+    filesystem::create_directory(filesystem::path(GetChronoOutputPath()));
+    filesystem::create_directory(filesystem::path(dir));
+    std::string filename = dir + "/snapshot_" + std::to_string(GetParam()) + ".dat";
+
+    ChSystemSnapshot snapshot1;
+    snapshot1.Save(*sys1);
+    snapshot1.Write(filename);
+
+    ChSystemSnapshot snapshot2;
+    snapshot2.Read(filename);
+    filesystem::path(filename).remove_file();
+    ASSERT_EQ(snapshot2.GetSize(), snapshot1.GetSize());
+    ASSERT_EQ(snapshot2.GetTime(), snapshot1.GetTime());
+    snapshot2.Restore(*sys2);
+
+    auto states1 = Simulate(*sys1, 300);
+    auto states2 = Simulate(*sys2, 300);
+
+    ASSERT_EQ(states1, states2);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChSystemSnapshot, SnapshotTest, ::testing::Values(false, true));
+
+TEST(ChSystemSnapshot, mismatch) {
+    auto sys1 = CreateSystem(false);
+    auto sys2 = CreateSystem(false);
+    sys2->AddBody(chrono_types::make_shared<ChBody>());
+
+    ChSystemSnapshot snapshot;
+    ASSERT_THROW(snapshot.Restore(*sys1), ChException);
+
+    snapshot.Save(*sys1);
+    ASSERT_THROW(snapshot.Restore(*sys2), ChException);
+
+    auto sys3 = CreateSystem(true);
+    ASSERT_THROW(snapshot.Restore(*sys3), ChException);
+}
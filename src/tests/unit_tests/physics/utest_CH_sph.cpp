@@ -0,0 +1,104 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Test for the neighbor search methods of the SPH proximity container.
+// The cell list must reproduce the simulation with proximity pairs provided by
+// the collision system (same kernel radius for all nodes).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChMatterSPH.h"
+#include "chrono/physics/ChProximityContainerSPH.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// Block of SPH fluid falling under gravity, with the given neighbor search and number of threads.
+// The node positions are copied from the given reference fluid (if any), so that all systems start from the same
+// (perturbed) lattice.
+static std::shared_ptr<ChMatterSPH> CreateFluid(ChSystemNSC& sys,
+                                                ChProximityContainerSPH::NeighborSearch search,
+                                                int num_threads,
+                                                std::shared_ptr<ChMatterSPH> ref) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys.SetNumThreads(num_threads);
+
+    auto fluid = chrono_types::make_shared<ChMatterSPH>();
+    fluid->FillBox(ChVector<>(0.5, 0.5, 0.5), 1.0 / 16, 1000, ChCoordsys<>(), true, 1.5, ref ? 0.0 : 0.3);
+    fluid->GetMaterial().Set_viscosity(0.5);
+    fluid->GetMaterial().Set_pressure_stiffness(300);
+    fluid->SetCollide(search == ChProximityContainerSPH::NeighborSearch::COLLISION_SYSTEM);
+    if (ref) {
+        for (unsigned int i = 0; i < fluid->GetNnodes(); i++)
+            fluid->GetNodes()[i]->SetPos(ref->GetNodes()[i]->GetPos());
+    }
+    sys.Add(fluid);
+
+    auto proximity = chrono_types::make_shared<ChProximityContainerSPH>();
+    proximity->SetNeighborSearch(search);
+    sys.Add(proximity);
+
+    return fluid;
+}
+
+// Return the largest difference in node positions and velocities between the two fluids.
+static double MaxDifference(const ChMatterSPH& fluid1, const ChMatterSPH& fluid2) {
+    double diff = 0;
+    for (unsigned int i = 0; i < fluid1.GetNnodes(); i++) {
+        const auto& node1 = fluid1.GetNodes()[i];
+        const auto& node2 = fluid2.GetNodes()[i];
+        diff = std::max(diff, (node1->GetPos() - node2->GetPos()).LengthInf());
+        diff = std::max(diff, (node1->GetPos_dt() - node2->GetPos_dt()).LengthInf());
+    }
+    return diff;
+}
+
+TEST(ChProximityContainerSPH, cell_list_vs_collision_system) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    auto fluid1 = CreateFluid(sys1, ChProximityContainerSPH::NeighborSearch::COLLISION_SYSTEM, 1, nullptr);
+    auto fluid2 = CreateFluid(sys2, ChProximityContainerSPH::NeighborSearch::CELL_LIST, 1, fluid1);
+    ASSERT_EQ(fluid1->GetNnodes(), fluid2->GetNnodes());
+    ASSERT_EQ(MaxDifference(*fluid1, *fluid2), 0.0);
+    auto pos0 = fluid1->GetNodes()[0]->GetPos();
+
+    for (int i = 0; i < 100; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+    }
+    ASSERT_GT((fluid1->GetNodes()[0]->GetPos() - pos0).Length(), 1e-2);
+
+    // The two methods accumulate the same pair contributions in a different order
+    ASSERT_LT(MaxDifference(*fluid1, *fluid2), 1e-10);
+}
+
+TEST(ChProximityContainerSPH, cell_list_threads) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    auto fluid1 = CreateFluid(sys1, ChProximityContainerSPH::NeighborSearch::CELL_LIST, 1, nullptr);
+    auto fluid2 = CreateFluid(sys2, ChProximityContainerSPH::NeighborSearch::CELL_LIST, 4, fluid1);
+
+    for (int i = 0; i < 100; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+    }
+
+    // Per-particle gathers do not depend on the number of threads
+    ASSERT_EQ(MaxDifference(*fluid1, *fluid2), 0.0);
+}
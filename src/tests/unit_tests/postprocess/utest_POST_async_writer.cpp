@@ -0,0 +1,179 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for ChAsyncFileWriter.
+// Checks the order of successive writes to the same file, the limit on the
+// number of pending files, and the propagation of write errors.
+//
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChException.h"
+#include "chrono/core/ChGlobal.h"
+
+#include "chrono_postprocess/ChAsyncFileWriter.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::postprocess;
+
+// Return the contents of the specified file.
+static std::string ReadFile(const std::string& filename) {
+    std::ifstream ifs(filename, std::ios::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+}
+
+static std::vector<char> ToBuffer(const std::string& text) {
+    return std::vector<char>(text.begin(), text.end());
+}
+
+class AsyncWriterTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        filesystem::create_directory(filesystem::path(GetChronoOutputPath()));
+        out_dir = GetChronoOutputPath() + "UTEST_POST_ASYNC_WRITER";
+        filesystem::create_directory(filesystem::path(out_dir));
+    }
+
+    void TearDown() override {
+        for (const auto& filename : files)
+            filesystem::path(filename).remove_file();
+    }
+
+    std::string File(const std::string& name) {
+        files.push_back(out_dir + "/" + name);
+        return files.back();
+    }
+
+    std::string out_dir;
+    std::vector<std::string> files;
+};
+
+TEST_F(AsyncWriterTest, append_order) {
+    // Interleave appends to several files, both with formatted data and with formatters
+    std::vector<std::string> filenames = {File("a.txt"), File("b.txt"), File("c.txt")};
+    std::vector<std::string> expected(filenames.size());
+
+    {
+        ChAsyncFileWriter writer(3, 4);
+        for (size_t f = 0; f < filenames.size(); f++) {
+            writer.Write(filenames[f], ToBuffer("header\n"));
+            expected[f] = "header\n";
+        }
+        for (int i = 0; i < 200; i++) {
+            for (size_t f = 0; f < filenames.size(); f++) {
+                std::string line = std::to_string(i) + "\n";
+                if (i % 2 == 0)
+                    writer.Write(filenames[f], ToBuffer(line), true);
+                else
+                    writer.Write(filenames[f], [line](std::vector<char>& data) { data = ToBuffer(line); }, true);
+                expected[f] += line;
+            }
+        }
+        writer.Flush();
+        ASSERT_EQ(writer.GetNumPending(), 0);
+
+        for (size_t f = 0; f < filenames.size(); f++)
+            ASSERT_EQ(ReadFile(filenames[f]), expected[f]);
+
+        // Overwrite (not append) and let the destructor complete the pending writes
+        writer.Write(filenames[0], ToBuffer("new\n"));
+    }
+
+    ASSERT_EQ(ReadFile(filenames[0]), "new\n");
+}
+
+TEST_F(AsyncWriterTest, bounded_queue) {
+    const int max_pending = 3;
+    ChAsyncFileWriter writer(1, max_pending);
+
+    // Formatters blocking the (single) worker until released
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool release = false;
+    auto blocking = [&](std::vector<char>& data) {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return release; });
+        data = ToBuffer("done\n");
+    };
+
+    for (int i = 0; i < max_pending; i++)
+        writer.Write(File("file" + std::to_string(i) + ".txt"), blocking);
+    ASSERT_EQ(writer.GetNumPending(), max_pending);
+
+    // Queuing one more file must block until the worker makes progress
+    std::atomic<bool> queued(false);
+    std::string last = File("last.txt");
+    std::thread producer([&]() {
+        writer.Write(last, ToBuffer("last\n"));
+        queued = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_FALSE(queued);
+    ASSERT_EQ(writer.GetNumPending(), max_pending);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        release = true;
+    }
+    cv.notify_all();
+    producer.join();
+    ASSERT_TRUE(queued);
+
+    writer.Flush();
+    ASSERT_EQ(writer.GetNumPending(), 0);
+    for (int i = 0; i < max_pending; i++)
+        ASSERT_EQ(ReadFile(files[i]), "done\n");
+    ASSERT_EQ(ReadFile(last), "last\n");
+}
+
+TEST_F(AsyncWriterTest, errors) {
+    ChAsyncFileWriter writer(2, 4);
+    std::string bad = out_dir + "/no_such_dir/file.txt";
+
+    // A failed write is reported by Flush, only once
+    writer.Write(bad, ToBuffer("data\n"));
+    ASSERT_THROW(writer.Flush(), ChException);
+    ASSERT_NO_THROW(writer.Flush());
+
+    // A failed write is reported by the next Write
+    writer.Write(bad, ToBuffer("data\n"));
+    while (writer.GetNumPending() > 0)
+        std::this_thread::yield();
+    ASSERT_THROW(writer.Write(File("good.txt"), ToBuffer("good\n")), ChException);
+    ASSERT_NO_THROW(writer.Write(File("good.txt"), ToBuffer("good\n")));
+    ASSERT_NO_THROW(writer.Flush());
+    ASSERT_EQ(ReadFile(files.back()), "good\n");
+
+    // An exception thrown by a formatter is reported as a failed write
+    writer.Write(File("formatter.txt"), [](std::vector<char>&) { throw ChException("formatter failed"); });
+    ASSERT_THROW(writer.Flush(), ChException);
+
+    // Synchronous writes throw immediately
+    ASSERT_THROW(ChAsyncFileWriter::WriteNow(bad, ToBuffer("data\n")), ChException);
+}
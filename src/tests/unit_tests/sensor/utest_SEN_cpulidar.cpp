@@ -0,0 +1,261 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2023 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the CPU render backend of ChLidarSensor
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/ChSensorManager.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterPCfromDepth.h"
+#include "chrono_sensor/filters/ChFilterVisualizePointCloud.h"
+
+using namespace chrono;
+using namespace sensor;
+
+const float RANGE_ERR = 1e-3f;
+
+// wall whose near face is at x = 5, in front of a lidar at the origin
+static std::shared_ptr<ChBody> AddWall(ChSystem& sys) {
+    auto wall = chrono_types::make_shared<ChBodyEasyBox>(1, 20, 20, 1000, true, false);
+    wall->SetPos({5.5, 0, 0});
+    wall->SetBodyFixed(true);
+    sys.Add(wall);
+    return wall;
+}
+
+TEST(ChCpuLidar, range_to_wall) {
+    ChSystemNSC sys;
+    AddWall(sys);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.Add(ground);
+
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+
+    float hfov = (float)CH_C_PI / 4;
+    float max_vert = (float)CH_C_PI / 12;
+    float min_vert = -(float)CH_C_PI / 12;
+    auto lidar = chrono_types::make_shared<ChLidarSensor>(ground, 10.f, ChFrame<double>(), 16, 4, hfov, max_vert,
+                                                          min_vert, 100.f);
+    lidar->SetRenderBackend(RenderBackend::CPU);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterDIAccess>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterXYZIAccess>());
+    manager->AddSensor(lidar);
+    ASSERT_TRUE(manager->GetCpuEngine());
+    ASSERT_EQ(manager->GetNumEngines(), 0);
+
+    while (sys.GetChTime() < 0.25) {
+        manager->Update();
+        sys.DoStepDynamics(1e-3);
+    }
+
+    UserDIBufferPtr di = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_TRUE(di->Buffer);
+    ASSERT_EQ(di->Width, 16u);
+    ASSERT_EQ(di->Height, 4u);
+    for (unsigned int y = 0; y < di->Height; y++) {
+        float phi = (y / 3.f) * (max_vert - min_vert) + min_vert;
+        for (unsigned int x = 0; x < di->Width; x++) {
+            float theta = (x / 15.f) * hfov - hfov / 2.f;
+            float expected = 5.f / (std::cos(phi) * std::cos(theta));
+            EXPECT_NEAR(di->Buffer[y * di->Width + x].range, expected, RANGE_ERR);
+            EXPECT_GT(di->Buffer[y * di->Width + x].intensity, 0.f);
+        }
+    }
+
+    // every beam hits the wall, so every point lies on its face
+    UserXYZIBufferPtr pc = lidar->GetMostRecentBuffer<UserXYZIBufferPtr>();
+    ASSERT_TRUE(pc->Buffer);
+    ASSERT_EQ(pc->Width, 64u);
+    for (unsigned int i = 0; i < pc->Width; i++) {
+        EXPECT_NEAR(pc->Buffer[i].x, 5.f, RANGE_ERR);
+    }
+}
+
+TEST(ChCpuLidar, miss_returns_zero) {
+    ChSystemNSC sys;
+    AddWall(sys);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.Add(ground);
+
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+
+    // looking away from the wall
+    auto offset_pose = ChFrame<double>({0, 0, 0}, Q_from_AngZ(CH_C_PI));
+    auto lidar = chrono_types::make_shared<ChLidarSensor>(ground, 10.f, offset_pose, 8, 2, (float)CH_C_PI / 4, 0.1f,
+                                                          -0.1f, 100.f);
+    lidar->SetRenderBackend(RenderBackend::CPU);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterDIAccess>());
+    manager->AddSensor(lidar);
+
+    while (sys.GetChTime() < 0.25) {
+        manager->Update();
+        sys.DoStepDynamics(1e-3);
+    }
+
+    UserDIBufferPtr di = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_TRUE(di->Buffer);
+    for (unsigned int i = 0; i < di->Width * di->Height; i++) {
+        EXPECT_EQ(di->Buffer[i].range, 0.f);
+        EXPECT_EQ(di->Buffer[i].intensity, 0.f);
+    }
+}
+
+// Lidar with a single beam along the x axis, traced with 3x3 samples (sample radius 2) spread over the beam
+// divergence, in front of the wall at x = 5 and of a box whose near face is at x = 3. The box covers the column of
+// samples with the largest (positive) horizontal angle only.
+static std::shared_ptr<ChLidarSensor> AddMultiSampleLidar(ChSystem& sys,
+                                                          ChSensorManager& manager,
+                                                          LidarReturnMode mode,
+                                                          float divergence) {
+    AddWall(sys);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 2, 2, 1000, true, false);
+    box->SetPos({3.5, 1.003, 0});
+    box->SetBodyFixed(true);
+    sys.Add(box);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.Add(ground);
+
+    auto lidar = chrono_types::make_shared<ChLidarSensor>(ground, 10.f, ChFrame<double>(), 1, 1, 0.f, 0.f, 0.f, 100.f,
+                                                          LidarBeamShape::ELLIPTICAL, 2, divergence, divergence, mode);
+    lidar->SetRenderBackend(RenderBackend::CPU);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterDIAccess>());
+    manager.AddSensor(lidar);
+
+    while (sys.GetChTime() < 0.25) {
+        manager.Update();
+        sys.DoStepDynamics(1e-3);
+    }
+
+    return lidar;
+}
+
+// Range and intensity of the samples of the beam of AddMultiSampleLidar: with sample radius 2, the samples are offset
+// by -div/3, 0, and div/3 from the beam axis, both horizontally (theta) and vertically (phi)
+static void MultiSampleReturns(float divergence, float range[3][3], float intensity[3][3]) {
+    double offset[3] = {-divergence / 3.0, 0, divergence / 3.0};
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            double cos_angle = std::cos(offset[i]) * std::cos(offset[j]);
+            double x = (j == 2) ? 3 : 5;
+            range[i][j] = (float)(x / cos_angle);
+            intensity[i][j] = (float)cos_angle;
+        }
+    }
+}
+
+TEST(ChCpuLidar, multi_sample_mean_return) {
+    ChSystemNSC sys;
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+    float divergence = 0.006f;
+    auto lidar = AddMultiSampleLidar(sys, *manager, LidarReturnMode::MEAN_RETURN, divergence);
+
+    // the mean return averages the ranges of all 9 samples (all hit) and divides their summed intensity by 9
+    float range[3][3];
+    float intensity[3][3];
+    MultiSampleReturns(divergence, range, intensity);
+    float sum_range = 0;
+    float sum_intensity = 0;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            sum_range += range[i][j];
+            sum_intensity += intensity[i][j];
+        }
+    }
+
+    UserDIBufferPtr di = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_TRUE(di->Buffer);
+    ASSERT_EQ(di->Width, 1u);
+    ASSERT_EQ(di->Height, 1u);
+    EXPECT_NEAR(di->Buffer[0].range, sum_range / 9, RANGE_ERR);
+    EXPECT_NEAR(di->Buffer[0].range, 39.f / 9, RANGE_ERR);  // 6 samples at 5 m, 3 samples at 3 m
+    EXPECT_NEAR(di->Buffer[0].intensity, sum_intensity / 9, 1e-4f);
+}
+
+TEST(ChCpuLidar, multi_sample_strongest_return) {
+    ChSystemNSC sys;
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+    float divergence = 0.006f;
+    auto lidar = AddMultiSampleLidar(sys, *manager, LidarReturnMode::STRONGEST_RETURN, divergence);
+
+    // the intensity of each sample is accumulated over the samples of the beam within 5 cm of its range (weighted by
+    // 1 - |range difference| / 5 cm, here within 1e-3 of 1) and divided by 9; the 6 samples on the wall therefore
+    // give the strongest return, while the 3 samples on the box would be the first return
+    float range[3][3];
+    float intensity[3][3];
+    MultiSampleReturns(divergence, range, intensity);
+    float wall_intensity = 0;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 2; j++) {
+            EXPECT_NEAR(range[i][j], 5.f, 1e-4f);
+            wall_intensity += intensity[i][j];
+        }
+    }
+
+    UserDIBufferPtr di = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_TRUE(di->Buffer);
+    ASSERT_EQ(di->Width, 1u);
+    ASSERT_EQ(di->Height, 1u);
+    EXPECT_NEAR(di->Buffer[0].range, 5.f, RANGE_ERR);
+    EXPECT_NEAR(di->Buffer[0].intensity, wall_intensity / 9, 1e-3f);
+    EXPECT_NEAR(di->Buffer[0].intensity, 6.f / 9, 1e-3f);
+}
+
+TEST(ChCpuLidar, num_threads) {
+    ChSystemNSC sys;
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.Add(ground);
+
+    // the thread count of the CPU engine is passed to its sensors (and their filters), before and after assignment
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+    manager->SetNumCpuThreads(3);
+    auto lidar = chrono_types::make_shared<ChLidarSensor>(ground, 10.f, ChFrame<double>(), 8, 2, (float)CH_C_PI / 4,
+                                                          0.1f, -0.1f, 100.f);
+    lidar->SetRenderBackend(RenderBackend::CPU);
+    manager->AddSensor(lidar);
+    EXPECT_EQ(lidar->GetNumCpuThreads(), 3);
+    manager->SetNumCpuThreads(2);
+    EXPECT_EQ(lidar->GetNumCpuThreads(), 2);
+}
+
+TEST(ChCpuLidar, rejects_unsupported_filter) {
+    ChSystemNSC sys;
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.Add(ground);
+
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+    auto lidar = chrono_types::make_shared<ChLidarSensor>(ground, 10.f, ChFrame<double>(), 8, 2, (float)CH_C_PI / 4,
+                                                          0.1f, -0.1f, 100.f);
+    lidar->SetRenderBackend(RenderBackend::CPU);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterVisualizePointCloud>(640, 480, 1.f));
+    EXPECT_THROW(manager->AddSensor(lidar), std::runtime_error);
+}
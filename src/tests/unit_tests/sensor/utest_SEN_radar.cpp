@@ -113,7 +113,36 @@ TEST(ChRadarSensor, check_velocity) {
 //    }
 }
 
-TEST(Dbscan, check_cluster) {}
+TEST(Dbscan, check_cluster) {
+    // two tight groups far apart, a pair of points too small to be core points, and an isolated point
+    std::vector<vec3f> points;
+    for (int i = 0; i < 5; i++) {
+        points.push_back(vec3f{0.1f * i, 0, 0});
+        points.push_back(vec3f{10 + 0.1f * i, 0, 0});
+    }
+    points.push_back(vec3f{20, 0, 0});
+    points.push_back(vec3f{20.05f, 0, 0});
+    points.push_back(vec3f{-30, 5, 5});
+
+    for (int num_threads : {1, 4}) {
+        DBSCAN dbscan;
+        dbscan.setNumThreads(num_threads);
+        ASSERT_EQ(dbscan.Run(&points, 0.25f, 2), 0);
+
+        const auto& clusters = dbscan.getClusters();
+        ASSERT_EQ(clusters.size(), 2u);
+        ASSERT_EQ(clusters[0], std::vector<uint>({0, 2, 4, 6, 8}));
+        ASSERT_EQ(clusters[1], std::vector<uint>({1, 3, 5, 7, 9}));
+        ASSERT_EQ(dbscan.getNoise(), std::vector<uint>({10, 11, 12}));
+    }
+
+    // a failed run drops the results of the previous one
+    DBSCAN dbscan;
+    dbscan.Run(&points, 0.25f, 2);
+    std::vector<vec3f> empty;
+    dbscan.Run(&empty, 0.25f, 2);
+    ASSERT_TRUE(dbscan.getClusters().empty());
+}
 
 TEST(ChRadarSensor, check_avg_velocity) {}
 
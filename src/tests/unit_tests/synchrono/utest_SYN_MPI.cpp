@@ -16,7 +16,9 @@
 //
 // =============================================================================
 
+#include <cmath>
 #include <numeric>
+#include <set>
 
 #include "gtest/gtest.h"
 
@@ -29,11 +31,14 @@
 #include "chrono_synchrono/agent/SynEnvironmentAgent.h"
 #include "chrono_synchrono/agent/SynWheeledVehicleAgent.h"
 
+#include "chrono_synchrono/flatbuffer/message/SynWheeledVehicleMessage.h"
+
 using namespace chrono;
 using namespace synchrono;
 
 int rank;
 int num_ranks;
+std::shared_ptr<SynMPICommunicator> communicator;
 
 // Define our own main here to handle the MPI setup
 int main(int argc, char* argv[]) {
@@ -41,7 +46,7 @@ int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 
     // Create the MPI communicator and the manager
-    auto communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
+    communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
     rank = communicator->GetRank();
     num_ranks = communicator->GetNumRanks();
     SynChronoManager syn_manager(rank, num_ranks, communicator);
@@ -52,7 +57,13 @@ int main(int argc, char* argv[]) {
     }
 
     // Each rank will be running each test
-    return RUN_ALL_TESTS();
+    int result = RUN_ALL_TESTS();
+
+    // Release the communicator here, so that MPI is finalized before main returns (the manager holds the only other
+    // reference and goes out of scope with main)
+    communicator.reset();
+
+    return result;
 }
 
 TEST(SynChrono, SynChronoInit) {
@@ -102,4 +113,91 @@ TEST(SynChrono, SynChronoInit) {
 
     delete[] msg_lengths;
     delete[] msg_displs;
-}
\ No newline at end of file
+}
+
+TEST(SynChrono, SynChronoInterest) {
+    communicator->SetInterestRadius(10);
+    communicator->SetDeltaEncoding(true);
+    communicator->SetQuantization(1e-3, 1e-4);
+
+    // Pairs of ranks (2k, 2k+1) have nearby vehicles; different pairs are 100 m apart
+    bool has_partner = (rank % 2 == 1) || (rank + 1 < num_ranks);
+    int partner = rank ^ 1;
+
+    for (int step = 0; step < 3; step++) {
+        double x = 100.0 * (rank / 2) + 0.1 * step + 1e-5 * rank;
+        auto message = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(rank, 0), AgentKey());
+        message->SetState(0.1 * step, SynPose(ChVector<>(x, 0, 0), QUNIT), std::vector<SynPose>(4));
+
+        SynMessageList messages = {message};
+        communicator->AddOutgoingMessages(messages);
+        communicator->Synchronize();
+
+        SynMessageList& received = communicator->GetMessages();
+        ASSERT_EQ(received.size(), has_partner ? 1u : 0u);
+        if (has_partner) {
+            auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(received[0]);
+            ASSERT_TRUE(state != nullptr);
+            ASSERT_EQ(state->GetSourceKey().GetNodeID(), partner);
+            ASSERT_EQ(state->wheels.size(), 4u);
+            double partner_x = 100.0 * (partner / 2) + 0.1 * step + 1e-5 * partner;
+            ASSERT_NEAR(state->chassis.GetFrame().GetPos().x(), partner_x, 1e-3);
+        }
+
+        communicator->Reset();
+    }
+
+    communicator->SetInterestRadius(0);
+    communicator->SetDeltaEncoding(false);
+    communicator->SetQuantization(0, 0);
+}
+
+TEST(SynChrono, SynChronoAsync) {
+    // Publish a state without waiting, then poll until the states of all other ranks were received
+    auto message = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(rank, 0), AgentKey());
+    message->SetState(1.0, SynPose(ChVector<>(rank, 0, 0), QUNIT), std::vector<SynPose>(4));
+
+    SynMessageList messages = {message};
+    communicator->AddOutgoingMessages(messages);
+    communicator->SynchronizeAsync();
+
+    std::set<int> sources;
+    while ((int)sources.size() < num_ranks - 1) {
+        communicator->ReceiveAsync();
+        for (auto& received : communicator->GetMessages()) {
+            auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(received);
+            ASSERT_TRUE(state != nullptr);
+            int source = state->GetSourceKey().GetNodeID();
+            ASSERT_NE(source, rank);
+            ASSERT_NEAR(state->chassis.GetFrame().GetPos().x(), source, 1e-12);
+            sources.insert(source);
+        }
+        communicator->Reset();
+    }
+
+    communicator->Barrier();
+}
+
+TEST(SynChrono, SynChronoDeadReckoning) {
+    // Constant linear acceleration and angular velocity about the vertical axis
+    ChFrameMoving<> frame(ChVector<>(1, 2, 3), QUNIT);
+    frame.SetPos_dt(ChVector<>(1, 0, 0));
+    frame.SetPos_dtdt(ChVector<>(0, 0, -2));
+    frame.SetWvel_par(ChVector<>(0, 0, 0.5));
+
+    SynPose pose(frame);
+    pose.Extrapolate(0.5);
+    pose.Extrapolate(1.5);
+
+    double t = 2.0;
+    ChVector<> pos = pose.GetFrame().GetPos();
+    ASSERT_NEAR(pos.x(), 1 + t, 1e-12);
+    ASSERT_NEAR(pos.y(), 2, 1e-12);
+    ASSERT_NEAR(pos.z(), 3 - t * t, 1e-12);
+    ASSERT_NEAR(pose.GetFrame().GetPos_dt().z(), -2 * t, 1e-12);
+
+    ChQuaternion<> rot = pose.GetFrame().GetRot();
+    ASSERT_NEAR(rot.e0(), std::cos(0.25 * t), 1e-12);
+    ASSERT_NEAR(rot.e3(), std::sin(0.25 * t), 1e-12);
+    ASSERT_NEAR(pose.GetFrame().GetWvel_par().z(), 0.5, 1e-12);
+}